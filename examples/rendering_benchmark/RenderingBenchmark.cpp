@@ -0,0 +1,151 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2023 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/TGUI.hpp>
+#include <TGUI/Backend/Renderer/OpenGL.hpp>
+#if TGUI_HAS_RENDERER_BACKEND_OPENGL3
+    #include <TGUI/Backend/Renderer/OpenGL3/BackendRenderTargetOpenGL3.hpp>
+#endif
+#if TGUI_HAS_RENDERER_BACKEND_GLES2
+    #include <TGUI/Backend/Renderer/GLES2/BackendRenderTargetGLES2.hpp>
+#endif
+
+#include <chrono>
+#include <iostream>
+
+// Compares the time it takes to draw the same widget tree when orphaning the buffers on every draw call
+// versus when streaming the vertices through a ring buffer.
+
+static void createWidgets(tgui::BackendGui& gui)
+{
+    tgui::Theme theme{"../../themes/Black.txt"};
+
+    const unsigned int columns = 30;
+    const unsigned int rows = 25;
+    const tgui::Vector2f cellSize = {800.f / columns, 600.f / rows};
+    for (unsigned int y = 0; y < rows; ++y)
+    {
+        for (unsigned int x = 0; x < columns; ++x)
+        {
+            tgui::Widget::Ptr widget;
+            switch ((x + y) % 4)
+            {
+            case 0:
+            {
+                auto button = tgui::Button::create(tgui::String(x));
+                button->setRenderer(theme.getRenderer("Button"));
+                widget = button;
+                break;
+            }
+            case 1:
+            {
+                auto label = tgui::Label::create(tgui::String(y));
+                label->setRenderer(theme.getRenderer("Label"));
+                widget = label;
+                break;
+            }
+            case 2:
+            {
+                auto progressBar = tgui::ProgressBar::create();
+                progressBar->setRenderer(theme.getRenderer("ProgressBar"));
+                progressBar->setValue(x * 100 / columns);
+                widget = progressBar;
+                break;
+            }
+            default:
+            {
+                auto checkBox = tgui::CheckBox::create();
+                checkBox->setRenderer(theme.getRenderer("CheckBox"));
+                checkBox->setChecked((y % 2) == 0);
+                widget = checkBox;
+                break;
+            }
+            }
+
+            widget->setPosition(x * cellSize.x, y * cellSize.y);
+            widget->setSize(cellSize.x - 2, cellSize.y - 2);
+            gui.add(widget);
+        }
+    }
+}
+
+template <typename RenderTargetType>
+static void runBenchmark(tgui::BackendGui& gui, RenderTargetType& renderTarget)
+{
+    const unsigned int warmupFrames = 20;
+    const unsigned int measuredFrames = 300;
+
+    for (const bool useRingBuffer : {false, true})
+    {
+        renderTarget.setRingBufferEnabled(useRingBuffer);
+
+        for (unsigned int i = 0; i < warmupFrames; ++i)
+        {
+            renderTarget.clearScreen();
+            gui.draw();
+        }
+        glFinish();
+
+        const auto startTime = std::chrono::steady_clock::now();
+        for (unsigned int i = 0; i < measuredFrames; ++i)
+        {
+            renderTarget.clearScreen();
+            gui.draw();
+        }
+        glFinish();
+        const auto endTime = std::chrono::steady_clock::now();
+
+        const double totalMs = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+        std::cout << (useRingBuffer ? "Ring buffer: " : "Orphaning:   ")
+                  << (totalMs / measuredFrames) << " ms per frame" << std::endl;
+    }
+
+    renderTarget.setRingBufferEnabled(false);
+}
+
+bool runExample(tgui::BackendGui& gui)
+{
+    try
+    {
+        createWidgets(gui);
+
+        const auto renderTarget = gui.getBackendRenderTarget();
+#if TGUI_HAS_RENDERER_BACKEND_OPENGL3
+        if (auto renderTargetOpenGL3 = std::dynamic_pointer_cast<tgui::BackendRenderTargetOpenGL3>(renderTarget))
+            runBenchmark(gui, *renderTargetOpenGL3);
+#endif
+#if TGUI_HAS_RENDERER_BACKEND_GLES2
+        if (auto renderTargetGLES2 = std::dynamic_pointer_cast<tgui::BackendRenderTargetGLES2>(renderTarget))
+            runBenchmark(gui, *renderTargetGLES2);
+#endif
+        return true;
+    }
+    catch (const tgui::Exception& e)
+    {
+        std::cerr << "TGUI Exception: " << e.what() << std::endl;
+        return false;
+    }
+}
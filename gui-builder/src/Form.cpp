@@ -906,11 +906,8 @@ void Form::load()
     if (!fileContents)
         throw tgui::Exception("Failed to open '" + filename + "'.");
 
-    /// TODO: Optimize this (DataIO::parse function should be able to use a string view directly on file contents)
-    std::stringstream inStream{std::string{reinterpret_cast<const char*>(fileContents.get()), fileSize}};
-
     // Parse the file from memory
-    auto rootNode = tgui::DataIO::parse(inStream);
+    auto rootNode = tgui::DataIO::parse(tgui::CharStringView{reinterpret_cast<const char*>(fileContents.get()), fileSize});
 
     // If the file was created with TGUI 0.8 then convert it into a valid TGUI 0.9/0.10 form
     importOldForm(rootNode);
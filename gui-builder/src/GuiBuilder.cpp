@@ -60,7 +60,7 @@ static const unsigned int UNDO_MAX_SAVES = 1000;
 
 namespace
 {
-    bool compareRenderers(std::map<tgui::String, tgui::ObjectConverter> themePropertyValuePairs, std::map<tgui::String, tgui::ObjectConverter> widgetPropertyValuePairs)
+    bool compareRenderers(tgui::RendererPropertyMap themePropertyValuePairs, tgui::RendererPropertyMap widgetPropertyValuePairs)
     {
         for (auto& pair : themePropertyValuePairs)
         {
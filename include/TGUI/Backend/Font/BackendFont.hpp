@@ -142,6 +142,58 @@ TGUI_MODULE_EXPORT namespace tgui
         TGUI_NODISCARD virtual FontGlyph getGlyph(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness = 0) = 0;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the horizontal offset to move to the next character after a glyph
+        ///
+        /// @param codePoint        Unicode code point of the character
+        /// @param characterSize    Reference character size
+        /// @param bold             Retrieve the advance of the bold version or the regular one?
+        ///
+        /// @return Advance of the glyph, same as the advance member of the glyph returned by getGlyph
+        ///
+        /// Font backends can override this function to return the advance faster than getGlyph, which also has to find
+        /// the location of the glyph in the texture.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD virtual float getGlyphAdvance(char32_t codePoint, unsigned int characterSize, bool bold);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads glyphs ahead of time, so that they don't have to be loaded when a text is displayed for the first time
+        ///
+        /// @param first            First unicode code point of the range of characters to load
+        /// @param last             Last unicode code point of the range (inclusive)
+        /// @param characterSize    Reference character size
+        /// @param bold             Load the bold version or the regular one?
+        /// @param outlineThickness Thickness of outline (when != 0 the glyph will not be filled)
+        ///
+        /// Characters in the range that aren't part of the font are skipped.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void preloadGlyphs(char32_t first, char32_t last, unsigned int characterSize, bool bold = false, float outlineThickness = 0);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads glyphs ahead of time on a background thread
+        ///
+        /// @param first            First unicode code point of the range of characters to load
+        /// @param last             Last unicode code point of the range (inclusive)
+        /// @param characterSize    Reference character size
+        /// @param bold             Load the bold version or the regular one?
+        /// @param outlineThickness Thickness of outline (when != 0 the glyph will not be filled)
+        ///
+        /// The glyphs are added to the font the first time a glyph or texture is requested after the background thread finished.
+        /// Font backends that can't load glyphs in the background load them immediately, like preloadGlyphs does.
+        ///
+        /// @see waitForPreloadedGlyphs
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void preloadGlyphsAsync(char32_t first, char32_t last, unsigned int characterSize, bool bold = false, float outlineThickness = 0);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Blocks until all glyphs requested with preloadGlyphsAsync are loaded and adds them to the font
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void waitForPreloadedGlyphs();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the kerning offset of two glyphs
         ///
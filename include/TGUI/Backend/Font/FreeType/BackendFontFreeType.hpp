@@ -34,7 +34,13 @@
 #endif
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <condition_variable>
     #include <unordered_map>
+    #include <vector>
+    #include <future>
+    #include <deque>
+    #include <mutex>
+    #include <thread>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -50,7 +56,7 @@ TGUI_MODULE_EXPORT namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @brief Font implementations that uses FreeType directly to load glyphs
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    class BackendFontFreetype : public BackendFont
+    class TGUI_API BackendFontFreetype : public BackendFont
     {
     public:
 
@@ -98,6 +104,74 @@ TGUI_MODULE_EXPORT namespace tgui
         TGUI_NODISCARD FontGlyph getGlyph(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness = 0) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the horizontal offset to move to the next character after a glyph
+        ///
+        /// @param codePoint        Unicode code point of the character
+        /// @param characterSize    Reference character size
+        /// @param bold             Retrieve the advance of the bold version or the regular one?
+        ///
+        /// @return Advance of the glyph, same as the advance member of the glyph returned by getGlyph
+        ///
+        /// The advances of the first 256 code points are stored in a table per character size, so they can be returned without
+        /// searching for the glyph.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD float getGlyphAdvance(char32_t codePoint, unsigned int characterSize, bool bold) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads glyphs ahead of time on a background thread
+        ///
+        /// @param first            First unicode code point of the range of characters to load
+        /// @param last             Last unicode code point of the range (inclusive)
+        /// @param characterSize    Reference character size
+        /// @param bold             Load the bold version or the regular one?
+        /// @param outlineThickness Thickness of outline (when != 0 the glyph will not be filled)
+        ///
+        /// The glyphs are rasterized by a separate FreeType instance on another thread. They are placed in the atlas on the
+        /// thread that uses the font, the first time a glyph or texture is requested after the background thread finished.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void preloadGlyphsAsync(char32_t first, char32_t last, unsigned int characterSize, bool bold = false, float outlineThickness = 0) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Blocks until all glyphs requested with preloadGlyphsAsync are loaded and adds them to the atlas
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void waitForPreloadedGlyphs() override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets the amount of worker threads that rasterize glyphs which are requested for the first time
+        ///
+        /// @param threadCount  Amount of worker threads, or 0 to rasterize glyphs on the thread that uses the font
+        ///
+        /// Each worker thread has its own FreeType face. While a glyph is being rasterized, getGlyph returns a placeholder
+        /// without pixels and with an estimated advance, so that showing a lot of new characters at once doesn't block the
+        /// thread that uses the font. Finished glyphs are added to the atlas the next time a glyph or texture is requested,
+        /// after which the texts that use them rebuild their vertices. The gui thus has to keep drawing while hasPendingGlyphs
+        /// returns true. Widgets that measured their text while placeholders were returned aren't resized afterwards.
+        ///
+        /// By default no worker threads are used.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setGlyphLoadingThreadCount(unsigned int threadCount);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of worker threads that rasterize glyphs which are requested for the first time
+        ///
+        /// @return Amount of worker threads, or 0 if glyphs are rasterized on the thread that uses the font
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD unsigned int getGlyphLoadingThreadCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether placeholders were returned for glyphs that haven't been added to the atlas yet
+        ///
+        /// @return True if worker threads are still rasterizing glyphs or if finished glyphs weren't added to the atlas yet
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool hasPendingGlyphs() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the kerning offset of two glyphs
         ///
@@ -224,6 +298,101 @@ TGUI_MODULE_EXPORT namespace tgui
         void setFontScale(float scale) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether glyphs are rendered as signed distance fields, which can be drawn at any character size
+        ///
+        /// @param enabled        Should glyphs be rendered as distance fields?
+        /// @param referenceSize  Character size at which the glyphs are rasterized before converting them to distance fields
+        ///
+        /// @return True if distance fields are used, false if they were disabled or if the renderer doesn't support them
+        ///
+        /// Normally each character size and font scale has its own atlas page with glyphs that are hinted for that size.
+        /// When distance fields are enabled, all character sizes share a single page and the render target uses a shader
+        /// to draw the glyphs at the requested size. Text that is continuously scaled then doesn't cause any new glyphs to be
+        /// rasterized or uploaded. The glyphs aren't hinted though, and sharp corners get slightly rounded when the text is
+        /// drawn much larger than the reference size. Glyphs with an outline are still rasterized separately for each ratio
+        /// between the outline thickness and the character size.
+        ///
+        /// Only the OpenGL3 renderer and the GLES2 renderer with a GLES 3.0 context support distance fields.
+        /// They are disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool setDistanceFieldEnabled(bool enabled, unsigned int referenceSize = 48);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether glyphs are rendered as signed distance fields
+        ///
+        /// @return True if setDistanceFieldEnabled successfully enabled distance fields
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isDistanceFieldEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets the maximum amount of memory that the glyph textures of this font may use
+        ///
+        /// @param bytes  Maximum amount of bytes used by all atlas pages together, or 0 to not limit the memory usage
+        ///
+        /// Each character size is stored in its own atlas page, which grows by adding blocks of a fixed size. When a page has to
+        /// be created or enlarged and the limit would be exceeded, the pages of the character sizes that were least recently
+        /// used are removed first. If that isn't sufficient, glyphs that no longer fit aren't shown until space becomes
+        /// available: once texts stopped requesting new glyphs, the rows of the page whose glyphs are no longer used by any
+        /// text are cleared and their space is reused. Glyphs that are still being displayed are never removed.
+        ///
+        /// By default the memory isn't limited. Pages can never grow beyond the maximum texture size of the renderer.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setAtlasMemoryLimit(std::size_t bytes);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the maximum amount of memory that the glyph textures of this font may use
+        ///
+        /// @return Maximum amount of bytes used by all atlas pages together, or 0 if the memory usage isn't limited
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::size_t getAtlasMemoryLimit() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of memory that is currently used by the glyph textures of this font
+        ///
+        /// @return Amount of bytes needed to store the pixels of all atlas pages (one byte per pixel)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::size_t getAtlasMemoryUsage() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of atlas pages, which is the amount of character sizes that are currently cached
+        ///
+        /// @return Number of glyph textures that exist for this font
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::size_t getAtlasPageCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Writes the glyphs of all character sizes that are currently cached to a file
+        ///
+        /// @param filename  Path to the file to write
+        ///
+        /// @return True if the file was written, false if no font was loaded or if writing the file failed
+        ///
+        /// The file can be passed to loadAtlasCache when the program is started again, so that the glyphs don't need to be
+        /// rasterized again. The file contains a hash of the font data and can only be loaded by the exact same font.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool saveAtlasCache(const String& filename) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Restores the glyphs that were written to a file with saveAtlasCache
+        ///
+        /// @param filename  Path to the file to read
+        ///
+        /// @return True if the glyphs were restored, false if the file couldn't be read or was created for a different font
+        ///
+        /// Glyphs that were already cached are discarded when the file is loaded successfully. Character sizes that are
+        /// larger than the maximum texture size of the renderer or that no longer fit within the memory limit are skipped.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool loadAtlasCache(const String& filename);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -234,12 +403,154 @@ TGUI_MODULE_EXPORT namespace tgui
             float     rsbDelta = 0;  //!< Right offset after forced autohint. Internally used by getKerning()
             FloatRect bounds;        //!< Bounding rectangle of the glyph, in coordinates relative to the baseline
             UIntRect  textureRect;   //!< Texture coordinates of the glyph inside the font's texture
+            bool      pending = false; //!< Is this a placeholder for a glyph that is still being rasterized by a worker thread?
+            bool      noSpace = false; //!< Is the glyph missing from the texture because it didn't fit in the page?
+            unsigned int row = 0;    //!< Index of the row that contains the glyph (only used when the texture rect isn't empty)
+        };
+
+        struct Row
+        {
+            Row(unsigned int rowTop, unsigned int rowHeight) : width(0), top(rowTop), height(rowHeight) {}
+
+            unsigned int width;  //!< Current width of the row, 0 if the row is empty
+            unsigned int top;    //!< Y position of the row into the texture
+            unsigned int height; //!< Height of the row
+            std::uint64_t lastUsed = 0; //!< Value of m_pageUseCounter when a glyph in the row was last requested
+        };
+
+        // Texture that holds all glyphs of a single character size.
+        // The pixels are stored in square blocks that are stacked vertically, so that the page can grow without moving pixels.
+        struct Page
+        {
+            std::unordered_map<std::uint64_t, Glyph> glyphs;
+            std::vector<Row> rows;
+            unsigned int     nextRow = 3; //!< Y position of the next new row in the texture (first 2 rows contain pixels for underlining)
+            bool             full = false; //!< Did a glyph not fit because the page couldn't grow anymore?
+            bool             glyphsRequested = false; //!< Were glyphs requested since the texture was last requested?
+            std::uint64_t    scanStart = 0; //!< Value of m_pageUseCounter when texts had to reload glyphs to find unused rows
+
+            std::vector<std::unique_ptr<std::uint8_t[]>> blocks; //!< Alpha values of the pixels, the color of the glyphs is always white
+            std::shared_ptr<BackendTexture> texture;
+            unsigned int  blockSize = 0; //!< Width and height of each block, which is also the width of the texture
+            unsigned int  textureVersion = 0;
+            UIntRect      dirtyRect; //!< Part of the pixels that changed since they were last copied to the texture
+            std::uint64_t lastUsed = 0; //!< Value of m_pageUseCounter when the page was last accessed
+
+            TGUI_NODISCARD unsigned int getHeight() const
+            {
+                return blockSize * static_cast<unsigned int>(blocks.size());
+            }
+
+            TGUI_NODISCARD std::size_t getByteCount() const
+            {
+                return static_cast<std::size_t>(blockSize) * blockSize * blocks.size();
+            }
+
+            TGUI_NODISCARD std::uint8_t* getPixelRow(unsigned int y) const
+            {
+                return &blocks[y / blockSize][static_cast<std::size_t>(y % blockSize) * blockSize];
+            }
+        };
+
+        // Advances and kerning of the code points below denseTableSize for a character size and style. This allows measuring
+        // text in common scripts by indexing arrays instead of looking up glyphs and asking freetype for the kerning.
+        // Values that weren't calculated yet are NaN.
+        struct MetricsTable
+        {
+            std::vector<float> advances;
+            std::vector<std::unique_ptr<float[]>> kernings; //!< One row per first character, only created when needed
+        };
+
+        // Glyph that was rasterized but that wasn't placed on an atlas page yet
+        struct RasterizedGlyph
+        {
+            char32_t     codePoint = 0;
+            Glyph        glyph;      //!< Metrics of the glyph, the texture rect is only set when placing it on a page
+            unsigned int width = 0;  //!< Width of the bitmap
+            unsigned int height = 0; //!< Height of the bitmap
+            std::vector<std::uint8_t> pixels; //!< Alpha values of the bitmap
         };
 
+        // Glyphs that were rasterized on a background thread by preloadGlyphsAsync
+        struct PreloadedGlyphs
+        {
+            unsigned int scaledCharacterSize = 0;
+            bool         bold = false;
+            float        scaledOutlineThickness = 0;
+            std::vector<RasterizedGlyph> glyphs;
+        };
+
+        // Glyph that is rasterized by a worker thread after setGlyphLoadingThreadCount was called
+        struct GlyphRequest
+        {
+            std::uint64_t glyphKey = 0;
+            char32_t      codePoint = 0;
+            unsigned int  scaledCharacterSize = 0;
+            bool          bold = false;
+            float         scaledOutlineThickness = 0;
+            bool          rasterized = false; //!< Set by the worker thread when rasterizedGlyph contains the result
+            RasterizedGlyph rasterizedGlyph;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Loads a glyph with freetype. The scaled character size is the key of the page in m_pages.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD Glyph loadGlyph(Page& page, char32_t codePoint, unsigned int scaledCharacterSize, bool bold, float scaledOutlineThickness);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Rasterizes a glyph to a bitmap with the given freetype objects, without accessing any members of the font.
+        // The stroker is created when it is still a nullptr and an outline is requested. The glyph is converted to a
+        // distance field when the scaled character size contains the distanceFieldPageFlag.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static bool rasterizeGlyph(FT_Library library, FT_Face face, FT_Stroker& stroker, char32_t codePoint,
+                                                  unsigned int scaledCharacterSize, bool bold, float scaledOutlineThickness,
+                                                  RasterizedGlyph& rasterizedGlyph);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Replaces the alpha values of a rasterized glyph with signed distances, adding a border of the given size around it
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void convertToDistanceField(RasterizedGlyph& rasterizedGlyph, unsigned int spread);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the key of the page that holds the glyphs of a character size, which is the scaled character size unless
+        // distance fields are used
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD unsigned int getPageKey(unsigned int characterSize) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the factor to multiply the glyph metrics on a page with to get the size of the glyph at a character size
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD float getGlyphScale(unsigned int characterSize) const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Loads a glyph with freetype
+        // Copies the bitmap of a rasterized glyph into the page and returns the glyph with its texture rect
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        TGUI_NODISCARD Glyph loadGlyph(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness);
+        TGUI_NODISCARD Glyph insertGlyph(Page& page, const RasterizedGlyph& rasterizedGlyph);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds glyphs from background threads to the atlas. Only finished threads are handled unless wait is true.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void mergePreloadedGlyphs(bool wait);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates a glyph without pixels that is used until a worker thread finished rasterizing the real glyph
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD Glyph createPlaceholderGlyph(char32_t codePoint, unsigned int scaledCharacterSize, bool bold);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Replaces the placeholders of glyphs that worker threads finished rasterizing
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void mergeLoadedGlyphs();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Function executed by each worker thread, which rasterizes requested glyphs until the threads are stopped
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void runGlyphLoadingThread();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Joins the worker threads. Placeholders of glyphs that weren't rasterized yet are removed, so that they get reloaded.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void stopGlyphLoadingThreads();
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Returns a cached glyph or calls loadGlyph to load it when this is the first time the glyph is requested
@@ -247,9 +558,69 @@ TGUI_MODULE_EXPORT namespace tgui
         TGUI_NODISCARD Glyph getInternalGlyph(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness);
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Reserves space in the texture to place the glyph
+        // Reserves space in the texture to place the glyph. Returns an empty rectangle and marks the page as full if the
+        // page can't be enlarged because of the maximum texture size or the memory limit.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD UIntRect findAvailableGlyphRect(Page& page, unsigned int width, unsigned int height, unsigned int& rowIndex);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the page for the given (already scaled) character size, creating it if it doesn't exist yet
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Page& getPage(unsigned int scaledCharacterSize);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes all glyphs from the page and shrinks it back to a single block
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void resetPage(Page& page, unsigned int scaledCharacterSize);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Replaces the blocks of the page by wider ones, for glyphs that are wider than the page.
+        // Returns false if the page can't become wide enough.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool widenPage(Page& page, unsigned int minWidth);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Clears the rows from which no glyph was requested since page.scanStart and removes the glyphs that they contained,
+        // together with the glyphs that didn't fit. Returns false if all rows are still in use.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool clearUnusedRows(Page& page);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes the least recently used pages until the extra bytes fit within the memory limit.
+        // Returns false if the limit would still be exceeded when only the page that is being used is left.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool evictPages(std::size_t extraBytes, const Page* pageInUse);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the pixels of part of the page, either as alpha values or as white RGBA pixels. The buffer is used for storing
+        // the pixels when they can't be returned directly from the page.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static const std::uint8_t* getRegionPixels(const Page& page, UIntRect region, bool alphaOnly, std::vector<std::uint8_t>& buffer);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Extends the part of the page that has to be copied to the texture
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        TGUI_NODISCARD UIntRect findAvailableGlyphRect(unsigned int width, unsigned int height);
+        static void addDirtyRect(Page& page, UIntRect rect);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Calculates a hash of the font file, which is stored in the atlas cache to detect whether it belongs to this font
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::uint64_t getFontDataHash() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the table with advances and kerning for a character size and style, creating it if it doesn't exist yet
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD MetricsTable& getMetricsTable(unsigned int characterSize, bool bold);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Calculates the kerning between two characters with freetype
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD float loadKerning(char32_t first, char32_t second, unsigned int characterSize, bool bold);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes all tables with advances and kerning
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void clearMetricsTables();
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Sets the character size on which the freetype operations are performed
@@ -264,15 +635,6 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
-        struct Row
-        {
-            Row(unsigned int rowTop, unsigned int rowHeight) : width(0), top(rowTop), height(rowHeight) {}
-
-            unsigned int width;  //!< Current width of the row
-            unsigned int top;    //!< Y position of the row into the texture
-            unsigned int height; //!< Height of the row
-        };
-
         FT_Library  m_library = nullptr;  // Handle to the freetype library
         FT_Face     m_face    = nullptr;  // Contains the font (typeface and style)
         FT_Stroker  m_stroker = nullptr;  // Used for rendering outlines
@@ -282,15 +644,33 @@ TGUI_MODULE_EXPORT namespace tgui
         std::unordered_map<unsigned int, float> m_cachedAscents;
         std::unordered_map<unsigned int, float> m_cachedDescents;
 
-        std::unordered_map<std::uint64_t, Glyph> m_glyphs;
-        unsigned int     m_nextRow = 3; //!< Y position of the next new row in the texture (first 2 rows contain pixels for underlining)
-        std::vector<Row> m_rows;
+        static constexpr char32_t denseTableSize = 256;
+        std::unordered_map<unsigned int, MetricsTable> m_metricsTables; // Key is the unscaled character size * 2 + bold
+        unsigned int  m_lastMetricsTableKey = 0;
+        MetricsTable* m_lastMetricsTable = nullptr; // Table that was used most recently, to skip the lookup in m_metricsTables
+
+        std::unordered_map<unsigned int, Page> m_pages; // Atlas page for each scaled character size
+
+        static constexpr unsigned int distanceFieldPageFlag = 0x80000000; // Set in the key of a page with distance fields
+        unsigned int m_distanceFieldSize = 0; // Reference character size of the distance fields, or 0 when they aren't used
+        std::uint64_t m_pageUseCounter = 0;
+        std::size_t   m_atlasMemoryLimit = 0;
 
         std::unique_ptr<std::uint8_t[]> m_fileContents;
-        std::unique_ptr<std::uint8_t[]> m_pixels;
-        std::shared_ptr<BackendTexture> m_texture;
-        unsigned int m_textureSize = 0;
-        unsigned int m_textureVersion = 0;
+        std::size_t m_fileSize = 0;
+        unsigned int m_textureVersion = 0; // Shared by all pages so that a recreated page never reuses an old version
+        std::vector<std::uint8_t> m_uploadBuffer; // Temporary storage for pixels that aren't stored contiguously in a page
+
+        std::vector<std::future<PreloadedGlyphs>> m_preloadedGlyphs; // Results of background threads started by preloadGlyphsAsync
+
+        unsigned int              m_glyphLoadingThreadCount = 0;
+        std::vector<std::thread>  m_glyphLoadingThreads; // Only created once a glyph is requested, as they need the font data
+        std::mutex                m_glyphLoadingMutex; // Protects the members below that are shared with the worker threads
+        std::condition_variable   m_glyphLoadingCondition;
+        std::deque<GlyphRequest>  m_glyphRequests; // Glyphs that no worker thread started on yet
+        std::vector<GlyphRequest> m_loadedGlyphs; // Glyphs that were rasterized but that weren't added to the atlas yet
+        bool                      m_stopGlyphLoadingThreads = false;
+        std::size_t               m_pendingGlyphCount = 0; // Requests of which the result wasn't merged yet, not accessed by workers
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -58,7 +58,14 @@ TGUI_MODULE_EXPORT namespace tgui
         /// @brief Select the color that will be used by clearScreen
         /// @param color  Background color of the window
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        virtual void setClearColor(const tgui::Color& color) = 0;
+        virtual void setClearColor(const Color& color);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the color that is used by clearScreen
+        /// @return Background color of the window
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD Color getClearColor() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -207,6 +214,63 @@ TGUI_MODULE_EXPORT namespace tgui
                                      const unsigned int* indices, std::size_t indexCount, const std::shared_ptr<BackendTexture>& texture) = 0;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Starts drawing to a texture instead of to the screen
+        ///
+        /// @param canvas     Canvas widget of the backend renderer to draw to. It is created when it is a nullptr.
+        /// @param size       Size of the area that will be drawn, in the coordinate system used by the widgets
+        /// @param pixelSize  Size of the area in pixels, usually calculated with the mapSizeToPixels function
+        ///
+        /// @return True if everything drawn until endRenderToTexture is called will be drawn to the canvas. False if the render
+        ///         target doesn't support drawing to textures or when it was already drawing to a texture.
+        ///
+        /// The canvas is resized to pixelSize, so that the area fills the entire canvas. The pixels in the canvas contain colors
+        /// with premultiplied alpha, which is why the canvas should be drawn with the drawRenderTexture function.
+        ///
+        /// @warning Every call to beginRenderToTexture that returns true must have a matching call to endRenderToTexture.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool beginRenderToTexture(std::shared_ptr<Widget>& canvas, Vector2f size, Vector2u pixelSize);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Stops drawing to a texture and continues drawing to the screen
+        ///
+        /// @warning The beginRenderToTexture function must have returned true before calling this function.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void endRenderToTexture();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether everything is currently being drawn to a texture instead of to the screen
+        ///
+        /// @return Was beginRenderToTexture called without a matching call to endRenderToTexture?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isRenderingToTexture() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of pixels that an area would cover on the screen when it isn't scaled or rotated
+        ///
+        /// @param size  Size of the area, in the coordinate system used by the widgets
+        ///
+        /// @return Size of the area in pixels, rounded up
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD Vector2u mapSizeToPixels(Vector2f size) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws a canvas that was filled by drawing to it between beginRenderToTexture and endRenderToTexture
+        ///
+        /// @param states     Render states to use for drawing
+        /// @param size       Size of the area that was drawn to the canvas
+        /// @param pixelSize  Size of the area in pixels, as passed to beginRenderToTexture
+        /// @param canvas     The canvas that was drawn to
+        ///
+        /// The default implementation draws the canvas widget scaled to the requested size.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void drawRenderTexture(const RenderStates& states, Vector2f size, Vector2u pixelSize, const std::shared_ptr<Widget>& canvas);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -221,15 +285,48 @@ TGUI_MODULE_EXPORT namespace tgui
         virtual void updateClipping(FloatRect clipRect, FloatRect clipViewport) = 0;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Called from beginRenderToTexture to redirect drawing to a canvas
+        ///
+        /// @param canvas     Canvas to draw to, which has to be created if it is a nullptr or of the wrong type
+        /// @param pixelSize  Size of the area that will be drawn, in pixels
+        ///
+        /// When this function is called, the view and viewport have already been changed to the area within the canvas.
+        /// The canvas has to be resized to pixelSize and cleared to transparent pixels. Drawing should output premultiplied alpha colors.
+        ///
+        /// @return False if drawing to textures isn't supported. The default implementation always returns false.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool bindRenderTexture(std::shared_ptr<Widget>& canvas, Vector2u pixelSize);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Called from endRenderToTexture to continue drawing to the screen
+        ///
+        /// @param canvas  Canvas that was being drawn to
+        ///
+        /// When this function is called, the view and viewport have already been restored to the ones of the screen.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void unbindRenderTexture(const std::shared_ptr<Widget>& canvas);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
         FloatRect m_viewRect;
         FloatRect m_viewport;
         Vector2f  m_targetSize;
+        Color     m_clearColor;
 
         std::vector<std::pair<FloatRect, FloatRect>> m_clipLayers;
         Vector2f m_pixelsPerPoint = {1, 1};
+
+        // State of the screen that is stored while drawing to a canvas
+        std::shared_ptr<Widget> m_renderCanvas;
+        FloatRect m_screenViewRect;
+        FloatRect m_screenViewport;
+        Vector2f  m_screenTargetSize;
+        Vector2f  m_screenPixelsPerPoint;
+        std::vector<std::pair<FloatRect, FloatRect>> m_screenClipLayers;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
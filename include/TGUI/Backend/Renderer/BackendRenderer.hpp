@@ -76,6 +76,19 @@ TGUI_MODULE_EXPORT namespace tgui
         /// This maximum size is defined by the graphics driver. Most likely this will return 8192 or 16384.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD virtual unsigned int getMaximumTextureSize() = 0;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the render targets of this renderer can draw textures that contain distance fields
+        ///
+        /// @return True if loadDistanceFieldTextureOnly succeeds on the textures created by this renderer
+        ///
+        /// Fonts only render their glyphs to distance fields when the renderer supports them.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD virtual bool supportsDistanceFieldTextures()
+        {
+            return false;
+        }
     };
 }
 
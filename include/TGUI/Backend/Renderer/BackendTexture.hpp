@@ -72,6 +72,55 @@ TGUI_MODULE_EXPORT namespace tgui
         virtual bool loadTextureOnly(Vector2u size, const std::uint8_t* pixels, bool smooth);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the texture from an array of 8-bit alpha values, the color of each pixel is white
+        ///
+        /// @param size   Width and height of the image to create
+        /// @param pixels Pointer to array of size.x*size.y bytes with alpha values, or nullptr to create an empty texture
+        /// @param smooth Should the smooth filter be enabled or not?
+        ///
+        /// @return True when the texture was loaded, false when the backend doesn't support single-channel textures.
+        ///         When false is returned, the caller has to pass RGBA pixels to loadTextureOnly instead.
+        ///
+        /// Storing only the alpha channel requires four times less memory, which is used for the glyphs of fonts.
+        ///
+        /// @warning Just like loadTextureOnly, this function won't store the pixels and isTransparentPixel thus won't work
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool loadAlphaTextureOnly(Vector2u size, const std::uint8_t* pixels, bool smooth);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the texture from an array of 8-bit signed distance values, which the render target draws as white shapes
+        ///
+        /// @param size   Width and height of the image to create
+        /// @param pixels Pointer to array of size.x*size.y bytes with distance values, or nullptr to create an empty texture
+        /// @param smooth Should the smooth filter be enabled or not? Distance fields should be sampled with the smooth filter.
+        ///
+        /// @return True when the texture was loaded, false when the backend can't draw distance fields
+        ///
+        /// A value of 128 lies on the edge of the shape, higher values are inside the shape and lower values outside of it.
+        /// The texture is also an alpha texture, so updateTextureRegion expects one byte per pixel.
+        ///
+        /// @warning Just like loadTextureOnly, this function won't store the pixels and isTransparentPixel thus won't work
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool loadDistanceFieldTextureOnly(Vector2u size, const std::uint8_t* pixels, bool smooth);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Replaces part of the texture with new pixels, without touching the rest of the texture
+        ///
+        /// @param region  Part of the texture to update, which must lie entirely inside the texture
+        /// @param pixels  Pointer to array of region.width*region.height*4 bytes with RGBA pixels,
+        ///                or region.width*region.height bytes with alpha values if isAlphaTexture() returns true
+        ///
+        /// @return True when the region was updated, false when the backend doesn't support partial updates.
+        ///         When false is returned, the caller has to reload the entire texture instead.
+        ///
+        /// @warning Just like loadTextureOnly, this function won't update the pixels returned by getPixels
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool updateTextureRegion(UIntRect region, const std::uint8_t* pixels);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the size of the entire image
         /// @return Texture size
@@ -95,6 +144,22 @@ TGUI_MODULE_EXPORT namespace tgui
         TGUI_NODISCARD bool isSmooth() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the texture was loaded with loadAlphaTextureOnly
+        ///
+        /// @return True if the texture only stores an alpha channel, false if it stores RGBA pixels
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isAlphaTexture() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the texture was loaded with loadDistanceFieldTextureOnly
+        ///
+        /// @return True if the texture contains distance values instead of alpha values
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isDistanceFieldTexture() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Checks if a certain pixel is transparent
         ///
@@ -119,6 +184,8 @@ TGUI_MODULE_EXPORT namespace tgui
         Vector2u m_imageSize;
         std::unique_ptr<std::uint8_t[]> m_pixels;
         bool m_isSmooth = true;
+        bool m_isAlphaTexture = false;
+        bool m_isDistanceFieldTexture = false;
     };
 }
 
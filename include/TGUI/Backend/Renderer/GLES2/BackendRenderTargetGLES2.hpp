@@ -104,9 +104,54 @@ TGUI_MODULE_EXPORT namespace tgui
                              const unsigned int* indices, std::size_t indexCount, const std::shared_ptr<BackendTexture>& texture) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws a canvas that was filled by drawing to it between beginRenderToTexture and endRenderToTexture
+        ///
+        /// @param states     Render states to use for drawing
+        /// @param size       Size of the area that was drawn to the canvas
+        /// @param pixelSize  Size of the area in pixels, as passed to beginRenderToTexture
+        /// @param canvas     The CanvasGLES2 that was drawn to
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawRenderTexture(const RenderStates& states, Vector2f size, Vector2u pixelSize, const std::shared_ptr<Widget>& canvas) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether vertices are streamed to the GPU via ring buffers instead of reallocating the buffers on each draw
+        ///
+        /// @param enabled     Should the vertices and indices be written into large ring buffers?
+        /// @param bufferSize  Size in bytes of both the vertex ring buffer and the index ring buffer
+        ///
+        /// The ring buffers are written with unsynchronized mappings and fences ensure that a region of the buffer is only
+        /// overwritten once the GPU has finished using it. Ring buffers require at least OpenGL ES 3.0, the function has no effect
+        /// on older versions. By default the ring buffers aren't used and the buffers are orphaned with glBufferData on every draw.
+        ///
+        /// @warning This function can't be called while the gui is being drawn
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setRingBufferEnabled(bool enabled, std::size_t bufferSize = 4 * 1024 * 1024);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether vertices are streamed to the GPU via ring buffers
+        ///
+        /// @return Are ring buffers being used?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isRingBufferEnabled() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        // Buffer that is written sequentially and that wraps around when reaching the end
+        struct RingBuffer
+        {
+            unsigned int buffer = 0;
+            std::size_t size = 0;
+            std::size_t offset = 0;
+            std::size_t currentSegment = 0;
+            std::array<void*, 4> segmentFences = {{nullptr, nullptr, nullptr, nullptr}}; // GLsync objects
+            std::array<bool, 4> segmentFencePending = {{false, false, false, false}}; // Left while the draw using it wasn't submitted yet
+        };
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Called from addClippingLayer and removeClippingLayer to apply the clipping
@@ -119,6 +164,25 @@ TGUI_MODULE_EXPORT namespace tgui
         void updateClipping(FloatRect clipRect, FloatRect clipViewport) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Called from beginRenderToTexture to redirect drawing to a canvas
+        ///
+        /// @param canvas     CanvasGLES2 to draw to, which is created if it is a nullptr or of the wrong type
+        /// @param pixelSize  Size of the area that will be drawn, in pixels
+        ///
+        /// @return True when the framebuffer of the canvas could be bound
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool bindRenderTexture(std::shared_ptr<Widget>& canvas, Vector2u pixelSize) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Called from endRenderToTexture to continue drawing to the screen
+        ///
+        /// @param canvas  Canvas that was being drawn to
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void unbindRenderTexture(const std::shared_ptr<Widget>& canvas) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Calls glEnableVertexAttribArray and glVertexAttribPointer.
         // Called only once when using a VAO (GLES 3.x), but on every draw when using GLES 2.0
@@ -132,6 +196,32 @@ TGUI_MODULE_EXPORT namespace tgui
         void createBuffers();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Uploads the vertices and indices to the GPU and draws them, using either the ring buffers or by orphaning the buffers
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void submitVertices(const Vertex* vertices, std::size_t vertexCount, const unsigned int* indices, std::size_t indexCount);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates or destroys the ring buffers and the vertex array object that uses them
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void createRingBuffers(std::size_t bufferSize);
+        void destroyRingBuffers();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Reserves a region in the ring buffer and returns a pointer to write to, or a nullptr if mapping failed.
+        // The offset parameter is set to the start of the reserved region. The buffer has to be bound to the given target.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::uint8_t* mapRingBuffer(RingBuffer& ring, unsigned int target, std::size_t bytes, std::size_t alignment, std::size_t& offset);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Places fences for the segments that were crossed by the last mapped region. Called after the draw was submitted.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void fenceRingBuffer(RingBuffer& ring);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -147,9 +237,21 @@ TGUI_MODULE_EXPORT namespace tgui
 
         Transform m_projectionTransform;
         int m_projectionMatrixShaderUniformLocation = 0;
+        int m_alphaTextureShaderUniformLocation = 0;
+        bool m_alphaTextureBound = false; // Value of the uAlphaTexture uniform in the shader
+        int m_distanceFieldShaderUniformLocation = -1;
+        bool m_distanceFieldBound = false; // Value of the uDistanceField uniform in the shader
         unsigned int m_positionShaderLocation = 0;
         unsigned int m_colorShaderLocation = 1;
         unsigned int m_texCoordShaderLocation = 2;
+
+        bool m_drawingGui = false; // Set while drawGui is drawing the widgets
+        bool m_ringBufferEnabled = false;
+        unsigned int m_ringVertexArray = 0;
+        RingBuffer m_ringVertices;
+        RingBuffer m_ringIndices;
+
+        int m_screenFramebuffer = 0; // Framebuffer that was bound before drawing to a texture
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -98,6 +98,14 @@ TGUI_MODULE_EXPORT namespace tgui
         TGUI_NODISCARD unsigned int getMaximumTextureSize() override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the render targets of this renderer can draw textures that contain distance fields
+        ///
+        /// @return True if the context supports GLES 3.0, which is required for the derivatives used by the fragment shader
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool supportsDistanceFieldTextures() override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
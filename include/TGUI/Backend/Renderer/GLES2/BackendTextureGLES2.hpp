@@ -62,6 +62,50 @@ TGUI_MODULE_EXPORT namespace tgui
         bool loadTextureOnly(Vector2u size, const std::uint8_t* pixels, bool smooth) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the texture from an array of 8-bit alpha values, the color of each pixel is white
+        ///
+        /// @param size   Width and height of the image to create
+        /// @param pixels Pointer to array of size.x*size.y bytes with alpha values, or nullptr to create an empty texture
+        /// @param smooth Should the smooth filter be enabled or not?
+        ///
+        /// @return True when the texture was loaded
+        ///
+        /// The pixels are stored in a GL_ALPHA texture. The render target makes the color white in its fragment shader.
+        ///
+        /// @warning Just like loadTextureOnly, this function won't store the pixels and isTransparentPixel thus won't work
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool loadAlphaTextureOnly(Vector2u size, const std::uint8_t* pixels, bool smooth) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the texture from an array of 8-bit signed distance values, which the render target draws as white shapes
+        ///
+        /// @param size   Width and height of the image to create
+        /// @param pixels Pointer to array of size.x*size.y bytes with distance values, or nullptr to create an empty texture
+        /// @param smooth Should the smooth filter be enabled or not? Distance fields should be sampled with the smooth filter.
+        ///
+        /// @return True when the texture was loaded
+        ///
+        /// The values are stored in the same way as with loadAlphaTextureOnly, the render target turns them into alpha values.
+        ///
+        /// @warning Just like loadTextureOnly, this function won't store the pixels and isTransparentPixel thus won't work
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool loadDistanceFieldTextureOnly(Vector2u size, const std::uint8_t* pixels, bool smooth) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Replaces part of the texture with new pixels, without touching the rest of the texture
+        ///
+        /// @param region  Part of the texture to update, which must lie entirely inside the texture
+        /// @param pixels  Pointer to array of region.width*region.height*4 bytes with RGBA pixels,
+        ///                or region.width*region.height bytes with alpha values if isAlphaTexture() returns true
+        ///
+        /// @return True when the region was updated
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool updateTextureRegion(UIntRect region, const std::uint8_t* pixels) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes whether the smooth filter is enabled or not
         ///
@@ -77,6 +121,15 @@ TGUI_MODULE_EXPORT namespace tgui
         TGUI_NODISCARD unsigned int getInternalTexture() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates or updates the texture with either RGBA pixels or alpha values
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool loadTextureWithFormat(Vector2u size, const std::uint8_t* pixels, bool smooth, bool alphaOnly);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -191,6 +191,8 @@ TGUI_MODULE_EXPORT namespace tgui
         Vector2u m_textureSize;
         Vector2u m_usedTextureSize;
         std::shared_ptr<BackendTextureGLES2> m_backendTexture = std::make_shared<BackendTextureGLES2>();
+
+        friend class BackendRenderTargetGLES2; // Draws to the canvas when a container caches its contents
     };
 }
 
@@ -104,9 +104,94 @@ TGUI_MODULE_EXPORT namespace tgui
                              const unsigned int* indices, std::size_t indexCount, const std::shared_ptr<BackendTexture>& texture) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws a canvas that was filled by drawing to it between beginRenderToTexture and endRenderToTexture
+        ///
+        /// @param states     Render states to use for drawing
+        /// @param size       Size of the area that was drawn to the canvas
+        /// @param pixelSize  Size of the area in pixels, as passed to beginRenderToTexture
+        /// @param canvas     The CanvasOpenGL3 that was drawn to
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawRenderTexture(const RenderStates& states, Vector2f size, Vector2u pixelSize, const std::shared_ptr<Widget>& canvas) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether consecutive draws should be combined into a single draw call
+        ///
+        /// @param batching  Should vertices be collected and only be send to the GPU when the texture or clipping changes?
+        ///
+        /// When batching is enabled, the vertices are transformed on the CPU and added to a single vertex stream. The stream is
+        /// only flushed when the texture or scissor rectangle changes and at the end of drawGui. Batching is disabled by default.
+        ///
+        /// @warning This function can't be called while the gui is being drawn
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setBatchingEnabled(bool batching);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether consecutive draws are combined into a single draw call
+        ///
+        /// @return Is batching enabled?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isBatchingEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how many times drawVertexArray was called during the last call to drawGui
+        ///
+        /// @return Amount of vertex arrays that were drawn in the last frame
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::size_t getDrawCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how many OpenGL draw calls were made during the last call to drawGui
+        ///
+        /// @return Amount of times that vertices were send to the GPU in the last frame
+        ///
+        /// Without batching, this value is identical to the one returned by getDrawCount.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::size_t getFlushCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether vertices are streamed to the GPU via ring buffers instead of reallocating the buffers on each draw
+        ///
+        /// @param enabled     Should the vertices and indices be written into large ring buffers?
+        /// @param bufferSize  Size in bytes of both the vertex ring buffer and the index ring buffer
+        ///
+        /// The ring buffers are persistently mapped when OpenGL 4.4 is available, otherwise an unsynchronized mapping is used.
+        /// Fences ensure that a region of the buffer is only overwritten once the GPU has finished using it.
+        /// By default the ring buffers aren't used and the buffers are orphaned with glBufferData for every draw call.
+        ///
+        /// @warning This function can't be called while the gui is being drawn
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setRingBufferEnabled(bool enabled, std::size_t bufferSize = 4 * 1024 * 1024);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether vertices are streamed to the GPU via ring buffers
+        ///
+        /// @return Are ring buffers being used?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isRingBufferEnabled() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        // Buffer that is written sequentially and that wraps around when reaching the end
+        struct RingBuffer
+        {
+            unsigned int buffer = 0;
+            std::size_t size = 0;
+            std::size_t offset = 0;
+            std::uint8_t* persistentData = nullptr; // Only set when the buffer is persistently mapped
+            std::size_t currentSegment = 0;
+            std::array<void*, 4> segmentFences = {{nullptr, nullptr, nullptr, nullptr}}; // GLsync objects
+            std::array<bool, 4> segmentFencePending = {{false, false, false, false}}; // Left while the draw using it wasn't submitted yet
+        };
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Called from addClippingLayer and removeClippingLayer to apply the clipping
@@ -119,12 +204,75 @@ TGUI_MODULE_EXPORT namespace tgui
         void updateClipping(FloatRect clipRect, FloatRect clipViewport) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Called from beginRenderToTexture to redirect drawing to a canvas
+        ///
+        /// @param canvas     CanvasOpenGL3 to draw to, which is created if it is a nullptr or of the wrong type
+        /// @param pixelSize  Size of the area that will be drawn, in pixels
+        ///
+        /// @return True when the framebuffer of the canvas could be bound
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool bindRenderTexture(std::shared_ptr<Widget>& canvas, Vector2u pixelSize) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Called from endRenderToTexture to continue drawing to the screen
+        ///
+        /// @param canvas  Canvas that was being drawn to
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void unbindRenderTexture(const std::shared_ptr<Widget>& canvas) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Creates the vertex and index buffers
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void createBuffers();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Binds the texture to use for the next draw call, or the empty texture if a nullptr is passed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void bindTexture(const std::shared_ptr<BackendTexture>& texture);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Sends the vertices that were collected while batching to the GPU
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void flushBatch();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Uploads the vertices and indices to the GPU and draws them, using either the ring buffers or by orphaning the buffers
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void submitVertices(const Vertex* vertices, std::size_t vertexCount, const unsigned int* indices, std::size_t indexCount);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates or destroys the ring buffers and the vertex array object that uses them
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void createRingBuffers(std::size_t bufferSize);
+        void destroyRingBuffers();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Reserves a region in the ring buffer and returns a pointer to write to, or a nullptr if mapping failed.
+        // The offset parameter is set to the start of the reserved region. The buffer has to be bound to the given target.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::uint8_t* mapRingBuffer(RingBuffer& ring, unsigned int target, std::size_t bytes, std::size_t alignment, std::size_t& offset);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Places fences for the segments that were crossed by the last mapped region. Called after the draw was submitted.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void fenceRingBuffer(RingBuffer& ring);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Finishes writing to the region that was returned by mapRingBuffer
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void unmapRingBuffer(const RingBuffer& ring, unsigned int target);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -140,6 +288,25 @@ TGUI_MODULE_EXPORT namespace tgui
 
         Transform m_projectionTransform;
         int m_projectionMatrixShaderUniformLocation = 0;
+        int m_distanceFieldShaderUniformLocation = 0;
+        bool m_distanceFieldBound = false; // Value of the uDistanceField uniform in the shader
+
+        bool m_batchingEnabled = false;
+        std::vector<Vertex> m_batchVertices;
+        std::vector<unsigned int> m_batchIndices;
+        std::shared_ptr<BackendTexture> m_batchTexture;
+        std::array<int, 4> m_scissorRect = {{0, 0, 0, 0}};
+
+        bool m_drawingGui = false; // Set while drawGui is drawing the widgets
+        bool m_ringBufferEnabled = false;
+        unsigned int m_ringVertexArray = 0;
+        RingBuffer m_ringVertices;
+        RingBuffer m_ringIndices;
+
+        std::size_t m_drawCount = 0;
+        std::size_t m_flushCount = 0;
+
+        int m_screenFramebuffer = 0; // Framebuffer that was bound before drawing to a texture
     };
 }
 
@@ -98,6 +98,14 @@ TGUI_MODULE_EXPORT namespace tgui
         TGUI_NODISCARD unsigned int getMaximumTextureSize() override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the render targets of this renderer can draw textures that contain distance fields
+        ///
+        /// @return Always true, text glyphs can be rendered from distance fields with OpenGL 3.3
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool supportsDistanceFieldTextures() override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
@@ -99,6 +99,25 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Called from beginRenderToTexture to redirect drawing to a canvas
+        ///
+        /// @param canvas     CanvasSDL to draw to, which is created if it is a nullptr or of the wrong type
+        /// @param pixelSize  Size of the area that will be drawn, in pixels
+        ///
+        /// @return True when the renderer supports render targets and the custom blend mode that is needed to draw the canvas
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool bindRenderTexture(std::shared_ptr<Widget>& canvas, Vector2u pixelSize) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Called from endRenderToTexture to continue drawing to the screen
+        ///
+        /// @param canvas  Canvas that was being drawn to
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void unbindRenderTexture(const std::shared_ptr<Widget>& canvas) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Called from addClippingLayer and removeClippingLayer to apply the clipping
         ///
@@ -115,6 +134,7 @@ TGUI_MODULE_EXPORT namespace tgui
 
         SDL_Renderer* m_renderer = nullptr;
         Transform m_projectionTransform;
+        SDL_Texture* m_screenRenderTarget = nullptr; // Render target that was set before drawing to a texture
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -73,6 +73,17 @@ TGUI_MODULE_EXPORT namespace tgui
         bool loadTextureOnly(Vector2u size, const std::uint8_t* pixels, bool smooth) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Replaces part of the texture with new pixels, without touching the rest of the texture
+        ///
+        /// @param region  Part of the texture to update, which must lie entirely inside the texture
+        /// @param pixels  Pointer to array of region.width*region.height*4 bytes with RGBA pixels
+        ///
+        /// @return True when the region was updated
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool updateTextureRegion(UIntRect region, const std::uint8_t* pixels) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes whether the smooth filter is enabled or not
         ///
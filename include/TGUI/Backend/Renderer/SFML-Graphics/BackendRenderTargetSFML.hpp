@@ -41,6 +41,10 @@
 #include <SFML/Graphics/View.hpp>
 #include <SFML/Graphics/RenderStates.hpp>
 
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <memory>
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 TGUI_MODULE_EXPORT namespace tgui
@@ -112,9 +116,39 @@ TGUI_MODULE_EXPORT namespace tgui
                              const unsigned int* indices, std::size_t indexCount, const std::shared_ptr<BackendTexture>& texture) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws a canvas that was filled by drawing to it between beginRenderToTexture and endRenderToTexture
+        ///
+        /// @param states     Render states to use for drawing
+        /// @param size       Size of the area that was drawn to the canvas
+        /// @param pixelSize  Size of the area in pixels, as passed to beginRenderToTexture
+        /// @param canvas     The CanvasSFML that was drawn to
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawRenderTexture(const RenderStates& states, Vector2f size, Vector2u pixelSize, const std::shared_ptr<Widget>& canvas) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Called from beginRenderToTexture to redirect drawing to a canvas
+        ///
+        /// @param canvas     CanvasSFML to draw to, which is created if it is a nullptr or of the wrong type
+        /// @param pixelSize  Size of the area that will be drawn, in pixels
+        ///
+        /// @return True when the render texture of the canvas could be created
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool bindRenderTexture(std::shared_ptr<Widget>& canvas, Vector2u pixelSize) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Called from endRenderToTexture to continue drawing to the screen
+        ///
+        /// @param canvas  Canvas that was being drawn to
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void unbindRenderTexture(const std::shared_ptr<Widget>& canvas) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Called from addClippingLayer and removeClippingLayer to apply the clipping
         ///
@@ -137,7 +171,7 @@ TGUI_MODULE_EXPORT namespace tgui
 
         sf::RenderTarget* m_target = nullptr;
 
-        Color m_clearColor;
+        sf::RenderTarget* m_screenTarget = nullptr; // Target that was being drawn to before drawing to the render texture
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,217 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2023 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_BACKEND_RENDER_TARGET_SOFTWARE_HPP
+#define TGUI_BACKEND_RENDER_TARGET_SOFTWARE_HPP
+
+#include <TGUI/Backend/Renderer/Software/BackendTextureSoftware.hpp>
+
+#if TGUI_BUILD_AS_CXX_MODULE
+    import tgui;
+#else
+    #include <TGUI/Backend/Renderer/BackendRenderTarget.hpp>
+#endif
+
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <vector>
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TGUI_MODULE_EXPORT namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Render target implementation that rasterizes into an RGBA framebuffer in memory
+    ///
+    /// This render target doesn't need a window or graphics context, which makes it usable for testing and benchmarking on
+    /// machines without a GPU. It can only draw textures that were created by BackendRendererSoftware.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API BackendRenderTargetSoftware : public BackendRenderTarget
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Formula used to combine the colors that are drawn with the pixels that are already in the framebuffer
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        enum class BlendMode
+        {
+            Alpha,             //!< Same as glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA)
+            AlphaToTexture,    //!< Same as Alpha, except for the alpha channel which is blended with (GL_ONE, GL_ONE_MINUS_SRC_ALPHA)
+            PremultipliedAlpha //!< Same as glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA)
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructor
+        ///
+        /// @param size  Width and height of the framebuffer in pixels
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        BackendRenderTargetSoftware(Vector2u size);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the size of the framebuffer
+        /// @return Width and height of the framebuffer in pixels
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD Vector2u getSize() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the pixels that were rendered
+        ///
+        /// @return Pointer to getSize().x * getSize().y * 4 bytes of RGBA pixels, stored row by row starting at the top
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD const std::uint8_t* getPixels() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Select the color that will be used by clearScreen
+        /// @param color  Background color of the window
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setClearColor(const Color& color) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Clears the screen, called at the beginning of each frame when gui.mainLoop() is called
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void clearScreen() override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Informs the render target about which part of the window is used for rendering
+        ///
+        /// @param view        Defines which part of the gui is being shown
+        /// @param viewport    Defines which part of the window is being rendered to
+        /// @param targetSize  Size of the window
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setView(FloatRect view, FloatRect viewport, Vector2f targetSize) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws the gui and all of its widgets
+        ///
+        /// @param root  Root container that holds all widgets in the gui
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawGui(const std::shared_ptr<RootContainer>& root) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws a vertex array. This is called by the other draw functions.
+        ///
+        /// @param states       Render states to use for drawing
+        /// @param vertices     Pointer to first element in array of vertices
+        /// @param vertexCount  Amount of elements in the vertex array
+        /// @param indices      Pointer to first element in array of indices
+        /// @param indexCount   Amount of elements in the indices array
+        /// @param texture      Texture to use, or nullptr when drawing colored triangles
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawVertexArray(const RenderStates& states, const Vertex* vertices, std::size_t vertexCount,
+                             const unsigned int* indices, std::size_t indexCount, const std::shared_ptr<BackendTexture>& texture) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws a canvas that was filled by drawing to it between beginRenderToTexture and endRenderToTexture
+        ///
+        /// @param states     Render states to use for drawing
+        /// @param size       Size of the area that was drawn to the canvas
+        /// @param pixelSize  Size of the area in pixels, as passed to beginRenderToTexture
+        /// @param canvas     The canvas that was drawn to
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawRenderTexture(const RenderStates& states, Vector2f size, Vector2u pixelSize, const std::shared_ptr<Widget>& canvas) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Called from addClippingLayer and removeClippingLayer to apply the clipping
+        ///
+        /// @param clipRect      View rectangle to apply
+        /// @param clipViewport  Viewport to apply
+        ///
+        /// Both rectangles may be empty when nothing that will be drawn is going to be visible.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateClipping(FloatRect clipRect, FloatRect clipViewport) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Called from beginRenderToTexture to redirect drawing to a canvas
+        ///
+        /// @param canvas     Canvas to draw to, which is created if it is a nullptr or of the wrong type
+        /// @param pixelSize  Size of the area that will be drawn, in pixels
+        ///
+        /// @return Always returns true
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool bindRenderTexture(std::shared_ptr<Widget>& canvas, Vector2u pixelSize) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Called from endRenderToTexture to continue drawing to the screen
+        ///
+        /// @param canvas  Canvas that was being drawn to
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void unbindRenderTexture(const std::shared_ptr<Widget>& canvas) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Rasterizes a single triangle into the framebuffer
+        ///
+        /// @param vertices   The three vertices of the triangle
+        /// @param positions  Positions of the vertices in framebuffer pixels
+        /// @param texture    Texture to sample from, or nullptr when drawing colored triangles
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void rasterizeTriangle(const Vertex* vertices[3], const Vector2f positions[3], const BackendTextureSoftware* texture);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        Vector2u m_size;
+        std::vector<std::uint32_t> m_pixels;
+        std::uint32_t m_clearPixel = 0;
+        Transform m_projectionTransform;
+
+        // Clipping rectangle in framebuffer pixels, right and bottom are excluded
+        int m_clipLeft = 0;
+        int m_clipTop = 0;
+        int m_clipRight = 0;
+        int m_clipBottom = 0;
+
+        // Positions of the vertices that are being drawn, reused to avoid allocations
+        std::vector<Vector2f> m_transformedPositions;
+
+        BlendMode m_blendMode = BlendMode::Alpha;
+
+        // Framebuffer of the screen, stored while drawing to a texture
+        Vector2u m_screenSize;
+        std::vector<std::uint32_t> m_screenPixels;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_BACKEND_RENDER_TARGET_SOFTWARE_HPP
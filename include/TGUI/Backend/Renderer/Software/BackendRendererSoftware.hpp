@@ -0,0 +1,76 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2023 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_BACKEND_RENDERER_SOFTWARE_HPP
+#define TGUI_BACKEND_RENDERER_SOFTWARE_HPP
+
+#include <TGUI/Backend/Renderer/Software/BackendTextureSoftware.hpp>
+#include <TGUI/Backend/Renderer/Software/BackendRenderTargetSoftware.hpp>
+
+#if TGUI_BUILD_AS_CXX_MODULE
+    import tgui;
+#else
+    #include <TGUI/Backend/Renderer/BackendRenderer.hpp>
+#endif
+
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <memory>
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TGUI_MODULE_EXPORT namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Backend renderer that rasterizes on the CPU without requiring a window or graphics context
+    ///
+    /// Textures that are created by this renderer can only be drawn by BackendRenderTargetSoftware.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API BackendRendererSoftware : public BackendRenderer
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates a new empty texture object
+        /// @return Shared pointer to a new texture object
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::shared_ptr<BackendTexture> createTexture() override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Get the maximum allowed texture size
+        ///
+        /// @return Maximum width and height that you should try to use in a single texture
+        ///
+        /// There is no hardware limit for the software renderer, the value is only there to keep memory usage reasonable.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD unsigned int getMaximumTextureSize() override;
+    };
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_BACKEND_RENDERER_SOFTWARE_HPP
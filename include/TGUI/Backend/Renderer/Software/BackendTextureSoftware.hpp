@@ -0,0 +1,110 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2023 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_BACKEND_TEXTURE_SOFTWARE_HPP
+#define TGUI_BACKEND_TEXTURE_SOFTWARE_HPP
+
+#include <TGUI/Config.hpp>
+#if TGUI_BUILD_AS_CXX_MODULE
+    import tgui;
+#else
+    #include <TGUI/Backend/Renderer/BackendTexture.hpp>
+#endif
+
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <vector>
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TGUI_MODULE_EXPORT namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Texture implementation that keeps its pixels in memory so that they can be sampled by the software renderer
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API BackendTextureSoftware : public BackendTexture
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the texture from an array of 32-bits RGBA pixels, but don't take ownership of the pixels
+        ///
+        /// @param size   Width and height of the image to create
+        /// @param pixels Pointer to array of size.x*size.y*4 bytes with RGBA pixels, or nullptr to create an empty texture
+        /// @param smooth Should the smooth filter be enabled or not?
+        ///
+        /// @warning Unlike the load function, loadTextureOnly won't store the pixels and isTransparentPixel thus won't work
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool loadTextureOnly(Vector2u size, const std::uint8_t* pixels, bool smooth) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the texture from an array of 8-bit alpha values, the color of each pixel is white
+        ///
+        /// @param size   Width and height of the image to create
+        /// @param pixels Pointer to array of size.x*size.y bytes with alpha values, or nullptr to create an empty texture
+        /// @param smooth Should the smooth filter be enabled or not?
+        ///
+        /// @return True when the texture was loaded
+        ///
+        /// The software renderer stores the texels as white RGBA pixels internally, so that they can be sampled like any other texture.
+        ///
+        /// @warning Just like loadTextureOnly, this function won't store the pixels and isTransparentPixel thus won't work
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool loadAlphaTextureOnly(Vector2u size, const std::uint8_t* pixels, bool smooth) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Replaces part of the texture with new pixels, without touching the rest of the texture
+        ///
+        /// @param region  Part of the texture to update, which must lie entirely inside the texture
+        /// @param pixels  Pointer to array of region.width*region.height*4 bytes with RGBA pixels,
+        ///                or region.width*region.height bytes with alpha values if isAlphaTexture() returns true
+        ///
+        /// @return True when the region was updated
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool updateTextureRegion(UIntRect region, const std::uint8_t* pixels) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the pixels that are sampled when the texture is drawn
+        ///
+        /// @return Pointer to getSize().x * getSize().y * 4 bytes of RGBA pixels, or nullptr if the texture wasn't loaded yet
+        ///
+        /// Unlike getPixels, this function also returns the pixels when the texture was loaded with loadTextureOnly.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD const std::uint8_t* getTexels() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        std::vector<std::uint8_t> m_texels;
+    };
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_BACKEND_TEXTURE_SOFTWARE_HPP
@@ -175,6 +175,68 @@ TGUI_MODULE_EXPORT namespace tgui
         virtual void draw();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether only the invalidated parts of the screen are redrawn
+        ///
+        /// @param enabled  Should draw() only redraw the regions that changed since the previous frame?
+        ///
+        /// When enabled, widgets report the area they occupy when their appearance changes and draw() only redraws those
+        /// regions (on top of the contents of the previous frame). Custom widgets have to call invalidate() whenever their
+        /// appearance changes, otherwise the change might not become visible.
+        ///
+        /// @warning This option should only be enabled when the contents of the render target is preserved between frames
+        ///          (e.g. with the software renderer or when rendering to a single-buffered target). With a swap chain
+        ///          that doesn't preserve the back buffer, the parts that aren't redrawn would contain stale contents.
+        ///
+        /// Partial redrawing is disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setPartialRedrawEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether only the invalidated parts of the screen are redrawn
+        ///
+        /// @return Is partial redrawing enabled?
+        ///
+        /// @see setPartialRedrawEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isPartialRedrawEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Marks the entire screen as needing to be redrawn on the next call to draw()
+        ///
+        /// This only has an effect when partial redrawing is enabled.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidate();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Marks part of the screen as needing to be redrawn on the next call to draw()
+        ///
+        /// @param rect  Region that changed, in the coordinate system used by the widgets
+        ///
+        /// Overlapping regions are merged. This only has an effect when partial redrawing is enabled.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidateRect(FloatRect rect);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether anything changed that requires the gui to be drawn again
+        ///
+        /// @return True if draw() would render something, always true when partial redrawing is disabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isRedrawRequired() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the next call to draw() will redraw the entire screen
+        ///
+        /// @return True if the whole screen has to be redrawn, false if only the invalidated regions will be redrawn
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isFullRedrawRequired() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the internal container of the Gui
         ///
@@ -645,6 +707,10 @@ TGUI_MODULE_EXPORT namespace tgui
         bool m_drawUpdatesTime = true;
         bool m_tabKeyUsageEnabled = true;
 
+        bool m_partialRedrawEnabled = false;
+        bool m_fullRedrawRequired = true;
+        std::vector<FloatRect> m_invalidatedRegions;
+
         Cursor::Type m_requestedMouseCursor = Cursor::Type::Arrow;
         std::stack<Cursor::Type> m_overrideMouseCursors;
 
@@ -0,0 +1,184 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2023 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_COMPACT_STRING_HPP
+#define TGUI_COMPACT_STRING_HPP
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <TGUI/String.hpp>
+
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <string>
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TGUI_MODULE_EXPORT namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Immutable string that stores its characters as UTF-8 to reduce memory usage
+    ///
+    /// A tgui::String needs 4 bytes per character, while this class only needs a single byte for ASCII characters.
+    /// It is intended for storing large amounts of strings that are rarely accessed, such as the items of a list box.
+    /// The amount of characters is cached, so finding the length or checking whether the string only contains ASCII
+    /// characters doesn't require decoding the string. Converting an ASCII string to a tgui::String is a simple copy.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API CompactString
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default constructor that creates an empty string
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        CompactString() = default;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructor that encodes a string
+        ///
+        /// @param str  String to store
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        CompactString(const String& str);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructor that stores a UTF-8 string without converting it
+        ///
+        /// @param str  UTF-8 encoded string to store
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        explicit CompactString(const std::string& str);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructor that stores a UTF-8 string without converting it
+        ///
+        /// @param str  Null-terminated UTF-8 encoded string to store
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        explicit CompactString(const char* str);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Decodes the string
+        /// @return String that can be used to display the text
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD String toString() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the string as it is stored
+        /// @return UTF-8 encoded string
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD const std::string& toStdString() const
+        {
+            return m_utf8;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of characters in the string
+        /// @return Amount of unicode characters, which is the length of the string after calling toString()
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::size_t length() const
+        {
+            return m_length;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Checks whether the string is empty
+        /// @return Does the string contain no characters?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool empty() const
+        {
+            return m_length == 0;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Checks whether the string only consists of ASCII characters
+        /// @return Is every character stored in a single byte?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isAscii() const
+        {
+            return m_length == m_utf8.length();
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Compares the string with a tgui::String without decoding it
+        ///
+        /// @param str  String to compare with
+        ///
+        /// @return Are both strings equal?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool equals(const String& str) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        std::string m_utf8;
+        std::size_t m_length = 0;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TGUI_NODISCARD inline bool operator==(const CompactString& left, const CompactString& right)
+    {
+        return left.toStdString() == right.toStdString();
+    }
+
+    TGUI_NODISCARD inline bool operator!=(const CompactString& left, const CompactString& right)
+    {
+        return left.toStdString() != right.toStdString();
+    }
+
+    TGUI_NODISCARD inline bool operator==(const CompactString& left, const String& right)
+    {
+        return left.equals(right);
+    }
+
+    TGUI_NODISCARD inline bool operator!=(const CompactString& left, const String& right)
+    {
+        return !left.equals(right);
+    }
+
+    TGUI_NODISCARD inline bool operator==(const String& left, const CompactString& right)
+    {
+        return right.equals(left);
+    }
+
+    TGUI_NODISCARD inline bool operator!=(const String& left, const CompactString& right)
+    {
+        return !right.equals(left);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_COMPACT_STRING_HPP
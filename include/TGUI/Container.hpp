@@ -421,6 +421,59 @@ TGUI_MODULE_EXPORT namespace tgui
         void setFocused(bool focused) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the container is drawn to a texture that is reused in later frames
+        ///
+        /// @param enabled  Should the contents of the container be cached?
+        ///
+        /// When enabled, the container and its child widgets are drawn to a texture once. As long as nothing changes inside the
+        /// container, later frames only draw that texture, instead of drawing every child widget again. This is useful for large
+        /// containers with many widgets that rarely change.
+        ///
+        /// The cache is discarded when the container or one of its children is changed, e.g. when the mouse moves on top of a
+        /// child widget that changes its appearance, when a setter changes the contents of a child or when an animation is
+        /// playing. Custom widgets should call invalidate() whenever their appearance changes.
+        /// Contents drawn outside the bounds of the container are not visible while caching is enabled.
+        ///
+        /// Caching is only performed when the backend renderer supports drawing to textures. It is disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setRenderCacheEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the container is drawn to a texture that is reused in later frames
+        ///
+        /// @return Is caching the contents of the container enabled?
+        ///
+        /// @see setRenderCacheEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isRenderCacheEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how many times the container was drawn by reusing its cached texture
+        ///
+        /// @return Amount of frames in which the cache was valid
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::size_t getRenderCacheHits() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how many times the cached texture of the container had to be drawn again
+        ///
+        /// @return Amount of frames in which the contents of the container had to be drawn to the texture
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::size_t getRenderCacheMisses() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Informs the gui that the widget has to be redrawn
+        ///
+        /// This also discards the cached texture when caching is enabled (see setRenderCacheEnabled).
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidate() override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Inform the container about a mouse move event
         /// @param pos  Mouse position
@@ -552,6 +605,21 @@ TGUI_MODULE_EXPORT namespace tgui
         bool updateTime(Duration elapsedTime) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Called by child widgets when part of them has to be redrawn.
+        /// The area is relative to the position where child widgets are placed (i.e. it doesn't include getChildWidgetsOffset()).
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidateChildArea(FloatRect area);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Draws the container by drawing its cached texture, after updating the texture if needed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawWithRenderCache(BackendRenderTarget& target, const RenderStates& states) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /// This function is called when the widget is added to a container. You should not call this function yourself.
@@ -576,7 +644,8 @@ TGUI_MODULE_EXPORT namespace tgui
         /// @param property  Name of the property that was changed
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void rendererChanged(const String& property) override;
+        void rendererChanged(PropertyId property) override;
+        using Widget::rendererChanged;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -638,6 +707,12 @@ TGUI_MODULE_EXPORT namespace tgui
         TGUI_NODISCARD Vector2f transformMousePos(const Widget::Ptr& widget, Vector2f mousePos) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the transform with which a child widget is drawn, based on its position, origin, rotation and scaling
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static Transform getChildWidgetTransform(const Widget& widget);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Finishes adding a widget to the container
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -671,6 +746,14 @@ TGUI_MODULE_EXPORT namespace tgui
         // Does focusing the next widget always keep a widget from this container focused (e.g. in a ChildWindow)?
         bool m_isolatedFocus = false;
 
+        bool m_renderCacheEnabled = false;
+        mutable bool m_renderCacheValid = false;
+        mutable std::shared_ptr<Widget> m_renderCacheCanvas; // Canvas widget of the backend renderer
+        mutable FloatRect m_renderCacheArea;
+        mutable Vector2u m_renderCachePixelSize;
+        mutable std::size_t m_renderCacheHits = 0;
+        mutable std::size_t m_renderCacheMisses = 0;
+
 
         friend class SubwidgetContainer; // Needs access to save and load functions
 
@@ -740,6 +823,17 @@ TGUI_MODULE_EXPORT namespace tgui
         void draw(BackendRenderTarget& target, RenderStates states) const override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Restricts the next draw calls to the given regions
+        ///
+        /// @param regions  Areas to redraw, or an empty list to draw everything
+        ///
+        /// Each region is cleared with the clear color of the render target before the widgets are drawn on top of it.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setRedrawRegions(std::vector<FloatRect> regions);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
@@ -752,6 +846,9 @@ TGUI_MODULE_EXPORT namespace tgui
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        std::vector<FloatRect> m_redrawRegions;
     };
 
 
@@ -29,6 +29,7 @@
 
 #include <TGUI/Animation.hpp>
 #include <TGUI/Cursor.hpp>
+#include <TGUI/GlyphRunCache.hpp>
 #include <TGUI/Timer.hpp>
 #include <TGUI/Widget.hpp>
 #include <TGUI/ToolTip.hpp>
@@ -175,6 +175,59 @@ TGUI_MODULE_EXPORT namespace tgui
         TGUI_NODISCARD FontGlyph getGlyph(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness = 0) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the horizontal offset to move to the next character after a glyph
+        ///
+        /// @param codePoint        Unicode code point of the character
+        /// @param characterSize    Reference character size
+        /// @param bold             Retrieve the advance of the bold version or the regular one?
+        ///
+        /// @return Advance of the glyph, same as the advance member of the glyph returned by getGlyph
+        ///
+        /// This function should be preferred over getGlyph when only the advance is needed, as it can be faster.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD float getGlyphAdvance(char32_t codePoint, unsigned int characterSize, bool bold = false) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads glyphs ahead of time, so that they don't have to be loaded when a text is displayed for the first time
+        ///
+        /// @param first            First unicode code point of the range of characters to load
+        /// @param last             Last unicode code point of the range (inclusive)
+        /// @param characterSize    Reference character size
+        /// @param bold             Load the bold version or the regular one?
+        /// @param outlineThickness Thickness of outline (when != 0 the glyph will not be filled)
+        ///
+        /// @code
+        /// font.preloadGlyphs(U' ', U'~', 13); // Load all printable ASCII characters at the default text size
+        /// @endcode
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void preloadGlyphs(char32_t first, char32_t last, unsigned int characterSize, bool bold = false, float outlineThickness = 0) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads glyphs ahead of time on a background thread
+        ///
+        /// @param first            First unicode code point of the range of characters to load
+        /// @param last             Last unicode code point of the range (inclusive)
+        /// @param characterSize    Reference character size
+        /// @param bold             Load the bold version or the regular one?
+        /// @param outlineThickness Thickness of outline (when != 0 the glyph will not be filled)
+        ///
+        /// The glyphs are added to the font when they are ready. Font backends that can't load glyphs in the background
+        /// load them immediately, like preloadGlyphs does.
+        ///
+        /// @see waitForPreloadedGlyphs
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void preloadGlyphsAsync(char32_t first, char32_t last, unsigned int characterSize, bool bold = false, float outlineThickness = 0) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Blocks until all glyphs requested with preloadGlyphsAsync are loaded and adds them to the font
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void waitForPreloadedGlyphs() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the kerning offset of two glyphs
         ///
@@ -165,6 +165,18 @@ TGUI_MODULE_EXPORT namespace tgui
     TGUI_API bool writeFile(const String& filename, CharStringView textToWrite);
 
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Opens a file in binary mode and writes the given bytes to it
+    ///
+    /// @param filename    Path to the file to write
+    /// @param data        Bytes to be written to the file
+    /// @param sizeInBytes Amount of bytes to write
+    ///
+    /// @return True on success, false if opening or writing to the file failed
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    TGUI_API bool writeFile(const String& filename, const std::uint8_t* data, std::size_t sizeInBytes);
+
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
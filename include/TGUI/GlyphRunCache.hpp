@@ -0,0 +1,187 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2023 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_GLYPH_RUN_CACHE_HPP
+#define TGUI_GLYPH_RUN_CACHE_HPP
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <TGUI/String.hpp>
+
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <memory>
+    #include <list>
+    #include <vector>
+    #include <unordered_map>
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TGUI_MODULE_EXPORT namespace tgui
+{
+    class BackendFont;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Horizontal layout of a string, as calculated from the glyphs and kerning of a font
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct TGUI_API GlyphRun
+    {
+        std::vector<float> advances;  //!< Advance of each character. Tabs are 4 spaces wide, '\r' and '\n' have no advance.
+        std::vector<float> kernings;  //!< Kerning between each character and the previous character on the same line
+        std::vector<float> positions; //!< Horizontal pen position before each character (and after the last), reset at each '\n'
+        float width = 0;              //!< Width of the first line
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Global cache of glyph runs, shared by all texts that display the same string with the same font
+    ///
+    /// Measuring a string requires a glyph and kerning lookup for every character. Widgets that show the same strings many
+    /// times (e.g. repeated values in a list) can get the layout from this cache instead. The least recently used runs are
+    /// removed when the memory used by the cache exceeds its limit.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API GlyphRunCache
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the glyph run of a string, calculating it if it wasn't cached yet
+        ///
+        /// @param text           String to lay out
+        /// @param font           Font used to display the text
+        /// @param characterSize  Size of the characters
+        /// @param bold           Is the text bold?
+        ///
+        /// @return Layout of the string
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::shared_ptr<const GlyphRun> getGlyphRun(const String& text, BackendFont& font, unsigned int characterSize, bool bold);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all runs that were created with a font
+        ///
+        /// @param font  Font that is being destroyed or that was reloaded
+        ///
+        /// This function is called by the fonts themselves, you shouldn't have to call it.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void removeFont(const BackendFont* font);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all runs from the cache
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void clear();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the maximum amount of memory that the cache may use
+        ///
+        /// @param sizeInBytes  Maximum memory used by the runs, or 0 to disable the cache
+        ///
+        /// By default the cache is limited to 1 MB. Runs of texts that are so long that they would use more memory than the limit
+        /// are never stored in the cache.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setMemoryLimit(std::size_t sizeInBytes);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the maximum amount of memory that the cache may use
+        /// @return Memory limit in bytes, 0 if the cache is disabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::size_t getMemoryLimit();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the estimated amount of memory that is currently used by the cache
+        /// @return Memory usage in bytes
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::size_t getMemoryUsage();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how many times getGlyphRun found the run in the cache
+        /// @return Number of cache hits since the statistics were last reset
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::size_t getHitCount();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how many times getGlyphRun had to calculate the run
+        /// @return Number of cache misses since the statistics were last reset
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::size_t getMissCount();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets the hit and miss counters back to 0
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void resetStatistics();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        struct Entry
+        {
+            std::size_t hash = 0;
+            String text;
+            const BackendFont* font = nullptr;
+            unsigned int characterSize = 0;
+            bool bold = false;
+            std::size_t sizeInBytes = 0;
+            std::shared_ptr<const GlyphRun> run;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Calculates the layout of a string
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::shared_ptr<GlyphRun> createGlyphRun(const String& text, BackendFont& font, unsigned int characterSize, bool bold);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes an entry from both the list and the map
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void removeEntry(std::list<Entry>::iterator it);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes the least recently used entries until the memory usage no longer exceeds the limit
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void evictEntries();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        static std::list<Entry> m_entries; // Most recently used entry is at the front
+        static std::unordered_map<std::size_t, std::list<Entry>::iterator> m_entryMap;
+        static std::size_t m_memoryLimit;
+        static std::size_t m_memoryUsage;
+        static std::size_t m_hitCount;
+        static std::size_t m_missCount;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_GLYPH_RUN_CACHE_HPP
@@ -0,0 +1,182 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2023 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_COMPILED_THEME_HPP
+#define TGUI_COMPILED_THEME_HPP
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <TGUI/MappedFile.hpp>
+#include <TGUI/Renderers/WidgetRenderer.hpp>
+
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <cstdint>
+    #include <map>
+    #include <memory>
+    #include <vector>
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TGUI_MODULE_EXPORT namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Theme in a binary format that can be loaded without parsing text
+    ///
+    /// A theme file is compiled ahead of time with the compile function or with the theme-compiler tool. Compiling resolves
+    /// the references between sections, and deserializes the values of the properties that are used by the widgets in TGUI.
+    /// Textures are stored as a filename or as embedded image data, together with their part and middle rectangles.
+    ///
+    /// Opening a compiled theme maps the file in memory. The renderer data of a section is only created when it is requested,
+    /// which only has to copy the values from the file. Properties of which the type isn't known (e.g. properties of custom
+    /// renderers) and values that couldn't be deserialized while compiling are stored as text, just like when loading the
+    /// theme from the text file.
+    ///
+    /// Relative texture and font filenames remain relative to the location of the theme file, so the compiled theme has to
+    /// be placed in the same directory as the text theme file that it was created from.
+    ///
+    /// Usually you don't use this class directly, but load the compiled theme with Theme::loadCompiled.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API CompiledTheme
+    {
+    public:
+
+        using Ptr = std::shared_ptr<CompiledTheme>; //!< Shared compiled theme pointer
+        using ConstPtr = std::shared_ptr<const CompiledTheme>; //!< Shared constant compiled theme pointer
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Compiles a theme file into the binary format
+        ///
+        /// @param filename  Filename of the theme file to compile
+        ///
+        /// @return Contents of the compiled theme
+        ///
+        /// @exception Exception when the theme file can't be read, contains syntax errors or has an undefined reference
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::vector<std::uint8_t> compile(const String& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Compiles a theme file into the binary format and writes the result to a file
+        ///
+        /// @param filename        Filename of the theme file to compile
+        /// @param outputFilename  Filename of the compiled theme to create
+        ///
+        /// @exception Exception when compiling fails or when the output file can't be written
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void compileToFile(const String& filename, const String& outputFilename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Opens a compiled theme
+        ///
+        /// @param filename  Filename of the compiled theme
+        ///
+        /// @exception Exception when the file can't be opened or when it isn't a compiled theme of this TGUI version
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void open(const String& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the names of all sections in the compiled theme
+        /// @return Names of the sections, sorted alphabetically
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::vector<String> getSectionNames() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Checks whether the compiled theme contains a section
+        ///
+        /// @param name  Name of the section
+        ///
+        /// @return Whether a section with the given name exists
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool hasSection(const String& name) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates renderer data from a section in the compiled theme
+        ///
+        /// @param name  Name of the section
+        ///
+        /// @return New renderer data containing the properties of the section, or nullptr when there is no such section
+        ///
+        /// Textures and fonts in the section are loaded by this function.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::shared_ptr<RendererData> createRenderer(const String& name) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the global properties of the theme
+        /// @return Map of the global properties and their values
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::map<String, ObjectConverter> getGlobalProperties() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Reads a value from the file, throws when the offset lies outside the file. The field offset is added to the offset
+        // without the risk of the sum wrapping around, so that an offset near the end of the range can't point to the start.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD const char* readBytes(std::uint32_t offset, std::uint64_t fieldOffset, std::uint32_t size) const;
+        TGUI_NODISCARD std::uint32_t readUInt32(std::uint32_t offset, std::uint64_t fieldOffset = 0) const;
+        TGUI_NODISCARD float readFloat(std::uint32_t offset, std::uint64_t fieldOffset = 0) const;
+        TGUI_NODISCARD String readString(std::uint32_t offset, std::uint64_t fieldOffset = 0) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the offset of the property list of a section, or 0 when the section doesn't exist
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::uint32_t findSection(const String& name) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates renderer data from a list of properties in the file. The depth is the amount of property lists that contain
+        // this one, it is limited so that a list that contains itself can't cause infinite recursion.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::shared_ptr<RendererData> readRendererData(std::uint32_t offset, unsigned int depth = 0) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates the value of a property in a property list
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD ObjectConverter readValue(const String& property, std::uint32_t type, std::uint32_t offset, unsigned int depth) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        MappedFile m_file;
+        String m_resourcePath; // Directory of the compiled theme, which is inserted in front of relative filenames
+        std::uint32_t m_globalPropertiesOffset = 0;
+        std::uint32_t m_sectionCount = 0;
+        std::uint32_t m_sectionsOffset = 0;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_COMPILED_THEME_HPP
@@ -37,6 +37,7 @@
     #include <string>
     #include <map>
     #include <cstdio>
+    #include <algorithm>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -94,6 +95,75 @@ TGUI_MODULE_EXPORT namespace tgui
         };
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Property of a node in a Document
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct PropertyView
+        {
+            CharStringView name;  //!< Name of the property, encoded as UTF-8
+            CharStringView value; //!< Value of the property like it is stored in ValueNode::value, encoded as UTF-8
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Read-only node of a Document
+        ///
+        /// Sections that were copied from a base section through inheritance share their memory with the base section.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct NodeView
+        {
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Finds a property of the node
+            ///
+            /// @param propertyName  Name of the property to search for
+            ///
+            /// @return Property with the given name, or nullptr if the node doesn't contain such property
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            TGUI_NODISCARD const PropertyView* findProperty(CharStringView propertyName) const
+            {
+                const PropertyView* it = std::lower_bound(properties, properties + propertyCount, propertyName,
+                    [](const PropertyView& property, CharStringView searchedName){ return property.name < searchedName; });
+                if ((it != properties + propertyCount) && (it->name == propertyName))
+                    return it;
+                else
+                    return nullptr;
+            }
+
+            CharStringView      name;                 //!< Name of the section, encoded as UTF-8
+            const PropertyView* properties = nullptr; //!< Properties sorted by name, like in Node::propertyValuePairs
+            std::size_t         propertyCount = 0;
+            const NodeView*     children = nullptr;   //!< Nested sections in the order in which they were parsed
+            std::size_t         childCount = 0;
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Read-only tree of nodes that was parsed from a widget file
+        ///
+        /// A Node tree allocates every node and string separately. The nodes and strings of a document are instead placed in
+        /// a few large blocks of memory that are owned by the document. The views remain valid for as long as the document
+        /// exists, they don't point into the data that was parsed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class Document
+        {
+        public:
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns the root node, which contains the global properties and the top-level sections
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            TGUI_NODISCARD const NodeView& getRoot() const
+            {
+                return m_root;
+            }
+
+        private:
+            class Builder;
+            friend class DataIO;
+
+            std::vector<std::unique_ptr<char[]>> m_memoryBlocks;
+            NodeView m_root;
+        };
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Parses a widget file
         ///
@@ -105,6 +175,33 @@ TGUI_MODULE_EXPORT namespace tgui
         TGUI_NODISCARD static std::unique_ptr<Node> parse(std::stringstream& stream);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Parses a widget file that is stored in memory
+        ///
+        /// @param data  Contents of the widget file, e.g. the contents of a file that was read or mapped in memory
+        ///
+        /// @return Root node of the tree of nodes
+        ///
+        /// The data is parsed where it is located, it doesn't have to be copied into a stream first.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::unique_ptr<Node> parse(CharStringView data);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Parses a widget file that is stored in memory into a read-only document
+        ///
+        /// @param data  Contents of the widget file, e.g. the contents of a file that was read or mapped in memory
+        ///
+        /// @return Document containing the same nodes and values as the tree that parse would return
+        ///
+        /// This is faster than parse when the nodes only have to be read, as the nodes aren't allocated one by one.
+        /// Values aren't split into lists like in ValueNode::valueList.
+        ///
+        /// @throw Exception when the data isn't a valid widget file
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static Document parseDocument(CharStringView data);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Emits the widget file
         ///
@@ -55,6 +55,9 @@ TGUI_MODULE_EXPORT namespace tgui
     public:
         TGUI_NODISCARD static std::vector<String> split(const String& str, char delim);
 
+        // Splits a serialized texture into its filename and parameters, without loading the image
+        static void parseTexture(const String& value, String& filename, UIntRect& partRect, UIntRect& middleRect, bool& smooth);
+
     private:
         static std::map<ObjectConverter::Type, DeserializeFunc> m_deserializers;  /// We can't use unordered_map with enum class in GCC < 6
     };
@@ -26,6 +26,7 @@
 #ifndef TGUI_THEME_HPP
 #define TGUI_THEME_HPP
 
+#include <TGUI/Loading/CompiledTheme.hpp>
 #include <TGUI/Loading/ThemeLoader.hpp>
 #include <TGUI/Renderers/WidgetRenderer.hpp>
 
@@ -103,6 +104,22 @@ TGUI_MODULE_EXPORT namespace tgui
         void load(const String& primary);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads a theme that was compiled with CompiledTheme::compile or with the theme-compiler tool
+        ///
+        /// @param filename  Filename of the compiled theme
+        ///
+        /// The file is mapped in memory and the renderers are created from it without parsing text. The theme loader isn't
+        /// used while a compiled theme is loaded. Calling load again switches back to the theme loader.
+        ///
+        /// When the theme was loaded before and a renderer with the same name is encountered, the widgets that were using
+        /// the old renderer will be reloaded with the new renderer.
+        ///
+        /// @exception Exception when the file can't be opened or isn't a compiled theme
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void loadCompiled(const String& filename);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Gets data for the renderers
         ///
@@ -127,6 +144,20 @@ TGUI_MODULE_EXPORT namespace tgui
         TGUI_NODISCARD std::shared_ptr<RendererData> getRendererNoThrow(const String& id);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the renderers and the textures and fonts that they use before they are needed
+        ///
+        /// @param ids  The secondary parameters for the theme loader (names of sections in theme file in DefaultThemeLoader)
+        ///
+        /// Textures and fonts in renderers are normally only loaded when a widget first uses the renderer. When lazy loading is
+        /// enabled in the DefaultThemeLoader, even the sections are only parsed on first use. This function can be used to
+        /// already do this work for renderers that are known to be needed, e.g. during a loading screen.
+        ///
+        /// @throw Exception if theme loader fails to load one of the requested renderers
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void preloadRenderers(const std::vector<String>& ids);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the value of a global property in the theme
         ///
@@ -276,6 +307,15 @@ TGUI_MODULE_EXPORT namespace tgui
         TGUI_NODISCARD static std::map<String, String> getRendererInheritedGlobalProperties(const String& widgetType);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates the renderer data for an id from the compiled theme. Widget types that don't have a section get an empty
+        // renderer, like they do in the default theme loader. Returns nullptr for other ids that don't have a section.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::shared_ptr<RendererData> createRendererFromCompiledTheme(const String& id);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -288,6 +328,7 @@ TGUI_MODULE_EXPORT namespace tgui
         std::map<String, std::shared_ptr<RendererData>> m_renderers; //!< Maps ids to renderer datas
         std::map<String, ObjectConverter> m_globalProperties; //!< Maps id to value
         String m_primary;
+        std::shared_ptr<CompiledTheme> m_compiledTheme; //!< Compiled theme that is used instead of the theme loader
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -101,6 +101,18 @@ TGUI_MODULE_EXPORT namespace tgui
         TGUI_NODISCARD virtual bool canLoad(const String& primary, const String& secondary) = 0;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Turns a texture or font filename in the value of a property into a path relative to the theme file
+        ///
+        /// @param property  Name of the property. Only values of properties named "Font", "Image", "Icon" or starting with
+        ///                  "Texture" are changed.
+        /// @param value     Serialized value of the property, which is changed when it contains a relative filename
+        /// @param path      Directory of the theme file, ending with a slash
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void injectThemePathInValue(const String& property, String& value, const String& path);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -130,6 +142,8 @@ TGUI_MODULE_EXPORT namespace tgui
     /// This loader will be able to extract the data from these files.
     ///
     /// On first access, the entire file will be cached, the next times the cached map is simply returned.
+    /// When lazy loading is enabled, only the global properties are parsed on first access and each section is only parsed
+    /// when it is requested for the first time.
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     class TGUI_API DefaultThemeLoader : public BaseThemeLoader
     {
@@ -192,9 +206,54 @@ TGUI_MODULE_EXPORT namespace tgui
         static void flushCache(const String& filename = "");
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether sections are only parsed when they are requested for the first time
+        ///
+        /// @param lazy  Should sections be parsed on first use instead of when the file is loaded?
+        ///
+        /// By default the entire theme file is parsed when it is loaded. With lazy loading, preloading the file only parses
+        /// the global properties and remembers where each section is located, so that sections that are never used (e.g. for
+        /// widgets that aren't created) are never parsed. A section that references another section will parse that section
+        /// as well when it is loaded.
+        ///
+        /// The setting only affects files that are loaded afterwards, files that are already in the cache aren't reloaded.
+        /// When lazy loading is enabled, the file is read with readFileContents instead of readFile.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setLazyLoading(bool lazy);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether sections are only parsed when they are requested for the first time
+        ///
+        /// @return Are sections parsed on first use instead of when the file is loaded?
+        ///
+        /// @see setLazyLoading
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static bool getLazyLoading();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        // Location of a section inside a file that is loaded lazily
+        struct LazySection
+        {
+            std::string name; // Name as written in the file
+            std::string baseName; // Name of the section that it inherits from as written in the file, if any
+            std::size_t begin = 0; // Offset of the opening bracket
+            std::size_t end = 0; // Offset behind the closing bracket
+        };
+
+        // Contents of a file that is loaded lazily, with the location of each section and the sections that were parsed
+        struct LazyThemeFile
+        {
+            std::string contents;
+            String resourcePath;
+            std::map<String, LazySection> sections;
+            std::map<String, std::unique_ptr<DataIO::Node>> parsedSections;
+        };
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Reads and return the contents of the entire file
         ///
@@ -205,10 +264,34 @@ TGUI_MODULE_EXPORT namespace tgui
         TGUI_NODISCARD virtual std::unique_ptr<DataIO::Node> readFile(const String& filename) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Reads and return the contents of the entire file without parsing it
+        ///
+        /// @param filename  Filename of the file to read
+        ///
+        /// @return Contents of the file, used instead of readFile when lazy loading is enabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD virtual std::string readFileContents(const String& filename) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Parses a section of a lazily loaded file, together with the sections that it references
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void loadLazySection(const String& filename, const String& section);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Finds the location of the sections in the file without parsing them. Returns the text outside the sections.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::string findSections(const std::string& contents, std::map<String, LazySection>& sections);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
         static std::map<String, std::map<String, std::map<String, String>>> m_propertiesCache;
         static std::map<String, std::map<String, String>> m_globalPropertiesCache;
+        static std::map<String, LazyThemeFile> m_lazyFiles;
+        static bool m_lazyLoading;
     };
 
 
@@ -0,0 +1,150 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2023 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_MAPPED_FILE_HPP
+#define TGUI_MAPPED_FILE_HPP
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <TGUI/String.hpp>
+
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <cstdint>
+    #include <memory>
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TGUI_MODULE_EXPORT namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Read-only view on the contents of a file that is mapped in memory
+    ///
+    /// The file is not read when it is opened, the operating system only loads the parts of the file that are accessed.
+    /// When the file can't be mapped in memory (e.g. for files in the Android assets), its contents are read instead.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API MappedFile
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        MappedFile() = default;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Destructor that closes the file
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~MappedFile();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Deleted copy constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        MappedFile(const MappedFile&) = delete;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Deleted assignment operator overload
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        MappedFile& operator=(const MappedFile&) = delete;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Maps a file in memory
+        ///
+        /// @param filename  Filename of the file to open
+        ///
+        /// @return True when the file was opened, false when it couldn't be opened
+        ///
+        /// A file that was previously opened is closed first.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool open(const String& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Closes the file
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void close();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Checks whether a file is opened
+        /// @return Was open called successfully and is the file not yet closed?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isOpen() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the contents of the file
+        /// @return Pointer to the first byte of the file, or a nullptr when no file is opened or when the file is empty
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD const char* getData() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the size of the file
+        /// @return Amount of bytes in the file
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::size_t getSize() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Checks whether the file is mapped in memory or whether its contents had to be read
+        /// @return True when the file is mapped in memory, false when it was read or when no file is opened
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isMapped() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Maps the file in memory, returns false if the platform doesn't support it or when it failed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool mapFile(const String& filename);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Releases the memory mapping
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void unmapFile();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        bool m_opened = false;
+        const char* m_data = nullptr;
+        std::size_t m_size = 0;
+        void* m_mappedMemory = nullptr;
+        std::unique_ptr<std::uint8_t[]> m_readData; // Contents of the file when it couldn't be mapped in memory
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_MAPPED_FILE_HPP
@@ -0,0 +1,184 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2023 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_MAPPED_TEXT_FILE_HPP
+#define TGUI_MAPPED_TEXT_FILE_HPP
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <TGUI/MappedFile.hpp>
+
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <vector>
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TGUI_MODULE_EXPORT namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Read-only access to the lines of a UTF-8 text file that is mapped in memory
+    ///
+    /// The file is not read when it is opened, the operating system only loads the parts of the file that are accessed.
+    /// The positions at which lines start are found on demand: requesting a line only scans the file up to that line.
+    /// Until the entire file has been scanned, the amount of lines is estimated from the part of the file that was scanned.
+    ///
+    /// Lines are separated by '\n' characters, a '\r' in front of the '\n' is not included in the line.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API MappedTextFile
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        MappedTextFile() = default;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Destructor that closes the file
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~MappedTextFile();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Deleted copy constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        MappedTextFile(const MappedTextFile&) = delete;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Deleted assignment operator overload
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        MappedTextFile& operator=(const MappedTextFile&) = delete;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Maps a file in memory
+        ///
+        /// @param filename  Filename of the UTF-8 text file to open
+        ///
+        /// @return True when the file was opened, false when it couldn't be opened
+        ///
+        /// When the file can't be mapped in memory (e.g. for files in the Android assets), its contents are read instead.
+        /// A file that was previously opened is closed first.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool open(const String& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Closes the file
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void close();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Checks whether a file is opened
+        /// @return Was open called successfully and is the file not yet closed?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isOpen() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the size of the file
+        /// @return Amount of bytes in the file
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::size_t getSize() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of lines in the file
+        ///
+        /// @return Amount of '\n' characters plus one when the entire file was scanned, or an estimation otherwise
+        ///
+        /// The estimation is never smaller than the amount of lines that have already been found.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::size_t getLineCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Checks whether the entire file was scanned, in which case getLineCount returns the exact amount of lines
+        /// @return Are the positions of all lines known?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isFullyIndexed() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Scans the file until the positions of the requested lines are known
+        ///
+        /// @param lineCount  Amount of lines at the start of the file that should be found
+        ///
+        /// This function is called automatically when accessing a line, calling it yourself is only useful to improve the
+        /// estimation of getLineCount before accessing the lines.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void indexLines(std::size_t lineCount) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the contents of a line
+        ///
+        /// @param lineIndex  Index of the line
+        ///
+        /// @return Decoded characters of the line, or an empty string when the file has less lines
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD String getLine(std::size_t lineIndex) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the contents of the entire file
+        /// @return Decoded characters of the file, with "\r\n" line endings replaced by '\n' like in getLine
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD String getText() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the byte offset of a line that was already indexed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::size_t getLineOffset(std::size_t lineIndex) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        MappedFile m_file;
+        const char* m_data = nullptr;
+        std::size_t m_size = 0;
+
+        // Only the offset of every 64th line is stored, the lines in between are found by scanning from the nearest offset.
+        // This keeps the index small for files with many lines.
+        mutable std::vector<std::size_t> m_lineOffsets = std::vector<std::size_t>(1, 0);
+        mutable std::size_t m_indexedLineCount = 1; // Amount of lines for which the start position is known
+        mutable std::size_t m_lastIndexedLineOffset = 0; // Position where the last known line starts
+        mutable bool m_fullyIndexed = false;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_MAPPED_TEXT_FILE_HPP
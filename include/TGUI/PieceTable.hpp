@@ -0,0 +1,271 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2023 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_PIECE_TABLE_HPP
+#define TGUI_PIECE_TABLE_HPP
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <TGUI/String.hpp>
+
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <cstdint>
+    #include <string>
+    #include <utility>
+    #include <vector>
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TGUI_MODULE_EXPORT namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Text storage that can insert and erase characters anywhere in a large text without moving the other characters
+    ///
+    /// The characters are never moved once they are stored. The initial text is kept in one buffer and all inserted characters
+    /// are appended to a second buffer. The text consists of pieces that refer to parts of these buffers. The pieces are kept
+    /// in a balanced tree that also counts the newlines, so inserting, erasing, accessing a character and finding the start of
+    /// a line all take logarithmic time.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API PieceTable
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default constructor that creates an empty text
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        PieceTable() = default;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructor that stores an initial text
+        ///
+        /// @param text  Initial text
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        explicit PieceTable(const String& text);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Replaces the entire text
+        ///
+        /// @param text  New text
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setText(const String& text);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the entire text
+        /// @return Copy of the text
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD String getText() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns a part of the text
+        ///
+        /// @param index  Position of the first character
+        /// @param count  Amount of characters, the count is clamped to the end of the text
+        ///
+        /// @return Copy of the characters
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD String substr(std::size_t index, std::size_t count = String::npos) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns a single character
+        ///
+        /// @param index  Position of the character, which must be smaller than the length of the text
+        ///
+        /// @return Character at the given position
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD char32_t getCharacter(std::size_t index) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of characters in the text
+        /// @return Length of the text
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::size_t length() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Checks whether the text is empty
+        /// @return Does the text contain no characters?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool empty() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Inserts characters in the text
+        ///
+        /// @param index  Position where the characters should be inserted, which can't be beyond the end of the text
+        /// @param text   Characters to insert
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void insert(std::size_t index, const String& text);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds characters at the end of the text
+        ///
+        /// @param text  Characters to append
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void append(const String& text);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes characters from the text
+        ///
+        /// @param index  Position of the first character to remove, which can't be beyond the end of the text
+        /// @param count  Amount of characters to remove, the count is clamped to the end of the text
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void erase(std::size_t index, std::size_t count = String::npos);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of lines in the text
+        /// @return Amount of '\n' characters plus one
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::size_t getLineCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the position of the first character of a line
+        ///
+        /// @param lineIndex  Index of the line, which must be smaller than getLineCount()
+        ///
+        /// @return Index of the first character of the line
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::size_t getLineStart(std::size_t lineIndex) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the length of a line
+        ///
+        /// @param lineIndex  Index of the line, which must be smaller than getLineCount()
+        ///
+        /// @return Amount of characters in the line, not including the '\n' at the end of the line
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::size_t getLineLength(std::size_t lineIndex) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the line on which a character is located
+        ///
+        /// @param index  Position of the character, the length of the text is also accepted
+        ///
+        /// @return Amount of '\n' characters in front of the character
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::size_t getLineOfIndex(std::size_t index) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of pieces in which the text is currently split
+        ///
+        /// @return Amount of pieces
+        ///
+        /// This function is mainly useful to verify that typing characters one by one doesn't create a piece for every character.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::size_t getPieceCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        // Pieces are stored in a treap (a binary tree that is kept balanced by giving each node a random priority). The nodes
+        // are ordered by their position in the text and they store the total length of their subtree, so that positions can
+        // be found without storing them. Node 0 is an empty sentinel that is used instead of null pointers.
+        struct Node
+        {
+            bool inAddBuffer = false;
+            std::size_t start = 0; // Position of the piece in its buffer
+            std::size_t length = 0;
+            std::size_t newlineCount = 0;
+            std::size_t subtreeLength = 0;
+            std::size_t subtreeNewlineCount = 0;
+            std::size_t left = 0;
+            std::size_t right = 0;
+            std::uint32_t priority = 0;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates a node for a piece of one of the buffers
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::size_t createNode(bool inAddBuffer, std::size_t start, std::size_t length);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Recalculates the subtree values of a node after its piece or children changed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateNode(std::size_t node);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Splits a tree into a tree with the first characters and a tree with the remaining characters
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::pair<std::size_t, std::size_t> split(std::size_t node, std::size_t index);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Joins two trees, all characters of the left tree are placed before those of the right tree
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::size_t merge(std::size_t left, std::size_t right);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Makes all nodes in a tree available again for new pieces
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void freeTree(std::size_t node);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds the characters of a tree that lie within [first, last) to a string
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void appendCharacters(std::size_t node, std::size_t first, std::size_t last, std::u32string& result) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Counts the newlines in a part of a buffer
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::size_t countNewlines(bool inAddBuffer, std::size_t start, std::size_t length) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Stores all characters in a single buffer again when most of the buffered characters are no longer part of the text
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void compactIfNeeded();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        std::u32string m_originalBuffer;
+        std::vector<std::size_t> m_originalBufferNewlines; // Positions of all '\n' characters in m_originalBuffer
+        std::u32string m_addBuffer;
+        std::vector<std::size_t> m_addBufferNewlines; // Positions of all '\n' characters in m_addBuffer
+
+        std::vector<Node> m_nodes = std::vector<Node>(1);
+        std::vector<std::size_t> m_freeNodes;
+        std::size_t m_root = 0;
+        std::uint32_t m_randomState = 0x9E3779B9;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_PIECE_TABLE_HPP
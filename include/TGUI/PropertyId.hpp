@@ -0,0 +1,234 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2023 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_PROPERTY_ID_HPP
+#define TGUI_PROPERTY_ID_HPP
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <TGUI/String.hpp>
+
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <cstdint>
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Names of all renderer properties that are used by the widgets in TGUI, sorted alphabetically.
+// These properties are given a fixed id at compile time.
+#define TGUI_BUILTIN_RENDERER_PROPERTIES(X) \
+    X(ArrowBackgroundColor) X(ArrowBackgroundColorDisabled) X(ArrowBackgroundColorHover) X(ArrowColor) X(ArrowColorDisabled) \
+    X(ArrowColorHover) X(ArrowsOnNavigationButtonsVisible) X(BackButton) X(BackgroundColor) X(BackgroundColorChecked) \
+    X(BackgroundColorCheckedDisabled) X(BackgroundColorCheckedHover) X(BackgroundColorDisabled) X(BackgroundColorDown) \
+    X(BackgroundColorDownDisabled) X(BackgroundColorDownFocused) X(BackgroundColorDownHover) X(BackgroundColorFocused) \
+    X(BackgroundColorHover) X(BorderBelowTitleBar) X(BorderBetweenArrows) X(BorderColor) X(BorderColorChecked) \
+    X(BorderColorCheckedDisabled) X(BorderColorCheckedFocused) X(BorderColorCheckedHover) X(BorderColorDisabled) \
+    X(BorderColorDown) X(BorderColorDownDisabled) X(BorderColorDownFocused) X(BorderColorDownHover) X(BorderColorFocused) \
+    X(BorderColorHover) X(Borders) X(Button) X(CaretColor) X(CaretColorFocused) X(CaretColorHover) X(CaretWidth) \
+    X(CheckColor) X(CheckColorDisabled) X(CheckColorHover) X(CloseButton) X(Color) X(DefaultTextColor) X(DefaultTextStyle) \
+    X(DistanceToSide) X(EditBox) X(FileTypeComboBox) X(FilenameLabel) X(FillColor) X(Font) X(ForwardButton) \
+    X(GridLinesColor) X(HeaderBackgroundColor) X(HeaderTextColor) X(ImageRotation) X(Label) X(ListBox) X(ListView) \
+    X(MaximizeButton) X(MinimizeButton) X(MinimumResizableBorderWidth) X(Opacity) X(OpacityDisabled) X(Padding) \
+    X(PaddingBetweenButtons) X(RoundedBorderRadius) X(Scrollbar) X(ScrollbarWidth) X(SelectedBackgroundColor) \
+    X(SelectedBackgroundColorHover) X(SelectedBorderColor) X(SelectedBorderColorHover) X(SelectedTextBackgroundColor) \
+    X(SelectedTextColor) X(SelectedTextColorHover) X(SelectedTextStyle) X(SelectedTrackColor) X(SelectedTrackColorHover) \
+    X(SeparatorColor) X(SeparatorSidePadding) X(SeparatorThickness) X(SeparatorVerticalPadding) X(ShowTextOnTitleButtons) \
+    X(Slider) X(SpaceBetweenWidgets) X(TextColor) X(TextColorChecked) X(TextColorCheckedDisabled) X(TextColorCheckedHover) \
+    X(TextColorDisabled) X(TextColorDown) X(TextColorDownDisabled) X(TextColorDownFocused) X(TextColorDownHover) \
+    X(TextColorFilled) X(TextColorFocused) X(TextColorHover) X(TextDistanceRatio) X(TextOutlineColor) \
+    X(TextOutlineThickness) X(TextSize) X(TextStyle) X(TextStyleChecked) X(TextStyleDisabled) X(TextStyleDown) \
+    X(TextStyleDownDisabled) X(TextStyleDownFocused) X(TextStyleDownHover) X(TextStyleFocused) X(TextStyleHover) X(Texture) \
+    X(TextureArrow) X(TextureArrowDisabled) X(TextureArrowDown) X(TextureArrowDownHover) X(TextureArrowHover) \
+    X(TextureArrowUp) X(TextureArrowUpHover) X(TextureBackground) X(TextureBackgroundDisabled) X(TextureBranchCollapsed) \
+    X(TextureBranchExpanded) X(TextureChecked) X(TextureCheckedDisabled) X(TextureCheckedFocused) X(TextureCheckedHover) \
+    X(TextureDisabled) X(TextureDisabledTab) X(TextureDown) X(TextureDownDisabled) X(TextureDownFocused) X(TextureDownHover) \
+    X(TextureFill) X(TextureFocused) X(TextureForeground) X(TextureHeaderBackground) X(TextureHover) \
+    X(TextureItemBackground) X(TextureLeaf) X(TextureSelectedItemBackground) X(TextureSelectedTab) \
+    X(TextureSelectedTabHover) X(TextureSelectedTrack) X(TextureSelectedTrackHover) X(TextureTab) X(TextureTabHover) \
+    X(TextureThumb) X(TextureThumbHover) X(TextureTitleBar) X(TextureTrack) X(TextureTrackHover) X(TextureUnchecked) \
+    X(TextureUncheckedDisabled) X(TextureUncheckedFocused) X(TextureUncheckedHover) X(ThumbColor) X(ThumbColorHover) \
+    X(ThumbWithinTrack) X(TitleBarColor) X(TitleBarHeight) X(TitleColor) X(TrackColor) X(TrackColorHover) \
+    X(TransparentTexture) X(UpButton)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TGUI_MODULE_EXPORT namespace tgui
+{
+    namespace priv
+    {
+        enum BuiltinPropertyIndex : std::uint32_t
+        {
+#define TGUI_BUILTIN_PROPERTY_INDEX(NAME) BuiltinPropertyIndex##NAME,
+            TGUI_BUILTIN_RENDERER_PROPERTIES(TGUI_BUILTIN_PROPERTY_INDEX)
+#undef TGUI_BUILTIN_PROPERTY_INDEX
+            BuiltinPropertyCount
+        };
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Interned name of a renderer property
+    ///
+    /// Every property name is stored only once, in a global table. A PropertyId is the index of the name in that table,
+    /// so comparing two ids is a single integer comparison instead of a string comparison.
+    ///
+    /// The properties that are used by the widgets in TGUI have a fixed id that is known at compile time,
+    /// they are available as constants in the tgui::Property namespace (e.g. tgui::Property::BackgroundColor).
+    /// Other names are added to the table when a PropertyId is constructed from them for the first time.
+    ///
+    /// The ids of the built-in properties are sorted alphabetically. Ids that are created at runtime are larger than all
+    /// built-in ids, in the order in which the names were first used.
+    ///
+    /// The table is shared by the whole program. Access to it is guarded by a mutex, so ids can be created and their names
+    /// can be looked up from any thread. Using the constants for the built-in properties doesn't access the table.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API PropertyId
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default constructor that creates an invalid id, which doesn't belong to any name
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        constexpr PropertyId() = default;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates an id from its index in the table
+        ///
+        /// @param index  Index of the name in the table, as returned by getIndex()
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        constexpr explicit PropertyId(std::uint32_t index) :
+            m_index{index}
+        {
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the id of a property name, adding the name to the table if it wasn't used before
+        ///
+        /// @param name  Name of the property
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        PropertyId(const String& name);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the id of a property name without adding the name to the table
+        ///
+        /// @param name  Name of the property
+        ///
+        /// @return Id of the name, or an invalid id if no PropertyId was ever created for this name
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static PropertyId find(const String& name);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the name of the property
+        ///
+        /// @return Name of the property, or an empty string if the id is invalid
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD const String& getName() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the index of the name in the table
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD constexpr std::uint32_t getIndex() const
+        {
+            return m_index;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Checks whether the id belongs to a name
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD constexpr bool isValid() const
+        {
+            return m_index != invalidIndex;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        static constexpr std::uint32_t invalidIndex = 0xFFFFFFFF;
+
+        std::uint32_t m_index = invalidIndex;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TGUI_NODISCARD constexpr bool operator==(PropertyId left, PropertyId right)
+    {
+        return left.getIndex() == right.getIndex();
+    }
+
+    TGUI_NODISCARD constexpr bool operator!=(PropertyId left, PropertyId right)
+    {
+        return left.getIndex() != right.getIndex();
+    }
+
+    TGUI_NODISCARD constexpr bool operator<(PropertyId left, PropertyId right)
+    {
+        return left.getIndex() < right.getIndex();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // Comparing with a string compares the names, without adding the string to the table
+    TGUI_NODISCARD inline bool operator==(PropertyId left, const String& right)
+    {
+        return left.getName() == right;
+    }
+
+    TGUI_NODISCARD inline bool operator==(const String& left, PropertyId right)
+    {
+        return left == right.getName();
+    }
+
+    TGUI_NODISCARD inline bool operator!=(PropertyId left, const String& right)
+    {
+        return left.getName() != right;
+    }
+
+    TGUI_NODISCARD inline bool operator!=(const String& left, PropertyId right)
+    {
+        return left != right.getName();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Ids of the renderer properties that are used by the widgets in TGUI
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    namespace Property
+    {
+#define TGUI_BUILTIN_PROPERTY_ID(NAME) constexpr PropertyId NAME{priv::BuiltinPropertyIndex##NAME};
+        TGUI_BUILTIN_RENDERER_PROPERTIES(TGUI_BUILTIN_PROPERTY_ID)
+#undef TGUI_BUILTIN_PROPERTY_ID
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_PROPERTY_ID_HPP
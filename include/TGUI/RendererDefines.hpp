@@ -31,18 +31,21 @@
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+// The NAME passed to these macros has to be one of the properties in TGUI_BUILTIN_RENDERER_PROPERTIES,
+// so that the getters and setters use the compile-time id from the tgui::Property namespace.
+
 #define TGUI_RENDERER_PROPERTY_OUTLINE(CLASS, NAME) \
     tgui::Outline CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(tgui::String(#NAME)); \
-        if (it != m_data->propertyValuePairs.end()) \
-            return it->second.getOutline(); \
+        tgui::ObjectConverter* value = m_data->findProperty(tgui::Property::NAME); \
+        if (value) \
+            return value->getOutline(); \
         else \
             return {}; \
     } \
     void CLASS::set##NAME(const tgui::Outline& outline) \
     { \
-        setProperty(tgui::String(#NAME), {outline}); \
+        setProperty(tgui::Property::NAME, {outline}); \
     }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -50,15 +53,15 @@
 #define TGUI_RENDERER_PROPERTY_COLOR(CLASS, NAME, DEFAULT) \
     tgui::Color CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(tgui::String(#NAME)); \
-        if (it != m_data->propertyValuePairs.end()) \
-            return it->second.getColor(); \
+        tgui::ObjectConverter* value = m_data->findProperty(tgui::Property::NAME); \
+        if (value) \
+            return value->getColor(); \
         else \
             return DEFAULT; \
     } \
     void CLASS::set##NAME(tgui::Color color) \
     { \
-        setProperty(tgui::String(#NAME), {color}); \
+        setProperty(tgui::Property::NAME, {color}); \
     }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -66,15 +69,15 @@
 #define TGUI_RENDERER_PROPERTY_TEXT_STYLE(CLASS, NAME, DEFAULT) \
     tgui::TextStyles CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(tgui::String(#NAME)); \
-        if (it != m_data->propertyValuePairs.end()) \
-            return it->second.getTextStyle(); \
+        tgui::ObjectConverter* value = m_data->findProperty(tgui::Property::NAME); \
+        if (value) \
+            return value->getTextStyle(); \
         else \
             return DEFAULT; \
     } \
     void CLASS::set##NAME(tgui::TextStyles style) \
     { \
-        setProperty(tgui::String(#NAME), tgui::ObjectConverter{style}); \
+        setProperty(tgui::Property::NAME, tgui::ObjectConverter{style}); \
     }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -82,9 +85,9 @@
 #define TGUI_RENDERER_PROPERTY_GET_NUMBER(CLASS, NAME, DEFAULT) \
     float CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(tgui::String(#NAME)); \
-        if (it != m_data->propertyValuePairs.end()) \
-            return it->second.getNumber(); \
+        tgui::ObjectConverter* value = m_data->findProperty(tgui::Property::NAME); \
+        if (value) \
+            return value->getNumber(); \
         else \
             return DEFAULT; \
     }
@@ -93,7 +96,7 @@
     TGUI_RENDERER_PROPERTY_GET_NUMBER(CLASS, NAME, DEFAULT) \
     void CLASS::set##NAME(float number) \
     { \
-        setProperty(tgui::String(#NAME), tgui::ObjectConverter{number}); \
+        setProperty(tgui::Property::NAME, tgui::ObjectConverter{number}); \
     }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -101,9 +104,9 @@
 #define TGUI_RENDERER_PROPERTY_GET_BOOL(CLASS, NAME, DEFAULT) \
     bool CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(tgui::String(#NAME)); \
-        if (it != m_data->propertyValuePairs.end()) \
-            return it->second.getBool(); \
+        tgui::ObjectConverter* value = m_data->findProperty(tgui::Property::NAME); \
+        if (value) \
+            return value->getBool(); \
         else \
             return DEFAULT; \
     }
@@ -112,7 +115,7 @@
     TGUI_RENDERER_PROPERTY_GET_BOOL(CLASS, NAME, DEFAULT) \
     void CLASS::set##NAME(bool flag) \
     { \
-        setProperty(tgui::String(#NAME), tgui::ObjectConverter{flag}); \
+        setProperty(tgui::Property::NAME, tgui::ObjectConverter{flag}); \
     }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -120,18 +123,19 @@
 #define TGUI_RENDERER_PROPERTY_TEXTURE(CLASS, NAME) \
     const tgui::Texture& CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(tgui::String(#NAME)); \
-        if (it != m_data->propertyValuePairs.end()) \
-            return it->second.getTexture(); \
+        tgui::ObjectConverter* value = m_data->findProperty(tgui::Property::NAME); \
+        if (value) \
+            return value->getTexture(); \
         else \
         { \
-            m_data->propertyValuePairs[tgui::String(#NAME)] = {tgui::Texture{}}; \
-            return m_data->propertyValuePairs[tgui::String(#NAME)].getTexture(); \
+            m_data->detachLayers(); \
+            m_data->propertyValuePairs[tgui::Property::NAME] = {tgui::Texture{}}; \
+            return m_data->propertyValuePairs[tgui::Property::NAME].getTexture(); \
         } \
     } \
     void CLASS::set##NAME(const tgui::Texture& texture) \
     { \
-        setProperty(tgui::String(#NAME), {texture}); \
+        setProperty(tgui::Property::NAME, {texture}); \
     }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -139,22 +143,23 @@
 #define TGUI_RENDERER_PROPERTY_RENDERER_WITH_DEFAULT(CLASS, NAME, RENDERER, DEFAULT) \
     std::shared_ptr<tgui::RendererData> CLASS::get##NAME() const \
     { \
-        const auto it = m_data->propertyValuePairs.find(tgui::String(#NAME)); \
-        if (it != m_data->propertyValuePairs.end()) \
-            return it->second.getRenderer(); \
+        tgui::ObjectConverter* value = m_data->findProperty(tgui::Property::NAME); \
+        if (value) \
+            return value->getRenderer(); \
         else \
         { \
             const auto& renderer = tgui::Theme::getDefault()->getRendererNoThrow(RENDERER); \
-            m_data->propertyValuePairs[tgui::String(#NAME)] = {renderer ? renderer : (DEFAULT)}; \
+            m_data->detachLayers(); \
+            m_data->propertyValuePairs[tgui::Property::NAME] = {renderer ? renderer : (DEFAULT)}; \
             return renderer; \
         } \
     } \
     void CLASS::set##NAME(std::shared_ptr<tgui::RendererData> renderer) \
     { \
         if (renderer) \
-            setProperty(tgui::String(#NAME), {std::move(renderer)}); \
+            setProperty(tgui::Property::NAME, {std::move(renderer)}); \
         else \
-            setProperty(tgui::String(#NAME), {RendererData::create()}); \
+            setProperty(tgui::Property::NAME, {RendererData::create()}); \
     }
 
 #define TGUI_RENDERER_PROPERTY_RENDERER(CLASS, NAME, RENDERER) \
@@ -29,10 +29,12 @@
 
 #include <TGUI/Config.hpp>
 #include <TGUI/ObjectConverter.hpp>
+#include <TGUI/PropertyId.hpp>
 #include <TGUI/Loading/DataIO.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <unordered_set>
+    #include <vector>
     #include <map>
 #endif
 
@@ -43,21 +45,125 @@ TGUI_MODULE_EXPORT namespace tgui
     class Theme;
     class Widget;
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Values of renderer properties, stored in a vector that is sorted on the property id
+    ///
+    /// The interface is similar to the one of a std::map. Properties can be accessed with either a PropertyId or a String.
+    /// Looking up a property by string never adds the string to the table of property names.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API RendererPropertyMap
+    {
+    public:
+
+        using value_type = std::pair<PropertyId, ObjectConverter>;
+        using iterator = std::vector<value_type>::iterator;
+        using const_iterator = std::vector<value_type>::const_iterator;
+
+        RendererPropertyMap() = default;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructs the map from property-value pairs
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        RendererPropertyMap(const std::map<String, ObjectConverter>& pairs);
+
+        TGUI_NODISCARD iterator begin() { return m_pairs.begin(); }
+        TGUI_NODISCARD iterator end() { return m_pairs.end(); }
+        TGUI_NODISCARD const_iterator begin() const { return m_pairs.begin(); }
+        TGUI_NODISCARD const_iterator end() const { return m_pairs.end(); }
+
+        TGUI_NODISCARD std::size_t size() const { return m_pairs.size(); }
+        TGUI_NODISCARD bool empty() const { return m_pairs.empty(); }
+        void clear() { m_pairs.clear(); }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Finds the value of a property
+        /// @return Iterator to the property-value pair, or end() if the property doesn't have a value
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD iterator find(PropertyId property);
+        TGUI_NODISCARD const_iterator find(PropertyId property) const;
+        TGUI_NODISCARD iterator find(const String& property);
+        TGUI_NODISCARD const_iterator find(const String& property) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the value of a property, inserting an empty value if the property doesn't have a value yet
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ObjectConverter& operator[](PropertyId property);
+        ObjectConverter& operator[](const String& property);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes the value of a property
+        /// @return Amount of removed values (0 or 1)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t erase(PropertyId property);
+        iterator erase(const_iterator it);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        std::vector<value_type> m_pairs;
+    };
+
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @brief Shared data used in renderer classes
+    ///
+    /// The data can be a layer on top of other renderer data, in which case propertyValuePairs only contains the properties
+    /// that differ from the base data. Properties that aren't found in the layer are looked up in the base.
+    /// The base is never modified while layers depend on it: before changing a property of data that has layers, the layers
+    /// are moved to a copy of the data.
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     struct TGUI_API RendererData
     {
         RendererData() = default;
         RendererData(const RendererData& other);
         RendererData& operator=(const RendererData& other);
+        ~RendererData();
 
         TGUI_NODISCARD static std::shared_ptr<RendererData> create(const std::map<String, ObjectConverter>& init = {});
 
         /// @internal
         TGUI_NODISCARD static std::shared_ptr<RendererData> createFromDataIONode(const DataIO::Node* rendererNode);
 
-        std::map<String, ObjectConverter> propertyValuePairs;
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates renderer data that initially has the same property values as the given data, without copying them
+        ///
+        /// @param data  Renderer data that will be used as base of the new layer
+        ///
+        /// @return Layer that stores the properties that are changed afterwards, while other properties are read from the base
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD static std::shared_ptr<RendererData> createLayer(const std::shared_ptr<RendererData>& data);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Finds the value of a property, looking in the base data if the property isn't set in this data
+        /// @return Pointer to the value, or nullptr if the property doesn't have a value
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD ObjectConverter* findProperty(PropertyId property);
+        TGUI_NODISCARD const ObjectConverter* findProperty(PropertyId property) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns all property-value pairs, including the ones that are only stored in the base data
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD RendererPropertyMap getMergedPropertyValuePairs() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Moves the layers that use this data as base to an unchanging copy of the data
+        ///
+        /// This function is called before changing the data, so that the layers don't see the change.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void detachLayers();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Copies the properties of the base data that aren't overwritten into this data and stops using the base
+        ///
+        /// The values of the properties don't change, but afterwards propertyValuePairs contains all of them.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void mergeBase();
+
+        RendererPropertyMap propertyValuePairs;
+        std::shared_ptr<RendererData> base; // Data that is used for properties that aren't found in propertyValuePairs
+        std::unordered_set<RendererData*> layers; // Data that has this data as base
         std::unordered_set<Widget*> observers;
         Theme* connectedTheme = nullptr;
         bool themePropertiesInherited = false;
@@ -210,6 +316,17 @@ TGUI_MODULE_EXPORT namespace tgui
         void setProperty(const String& property, ObjectConverter&& value);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes a property of the renderer
+        ///
+        /// @param property  Id of the property that you would like to change
+        /// @param value     The new value that you like to assign to the property
+        ///
+        /// @throw Exception for unknown properties or when value was of a wrong type
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setProperty(PropertyId property, ObjectConverter&& value);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Retrieves the value of a certain property
         ///
@@ -222,13 +339,35 @@ TGUI_MODULE_EXPORT namespace tgui
         TGUI_NODISCARD ObjectConverter getProperty(const String& property) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Retrieves the value of a certain property
+        ///
+        /// @param property  Id of the property that you would like to retrieve
+        ///
+        /// @return The value of the property or an ObjectConverter object with type ObjectConverter::Type::None when the
+        ///         property did not exist
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD ObjectConverter getProperty(PropertyId property) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Gets a map with all properties and their values
         ///
         /// @return Property-value pairs of the renderer
         ///
+        /// If the renderer data is a layer on top of other data then the properties of the base are first copied into the
+        /// layer, so that the map contains all properties. Use getMergedPropertyValuePairs to get the properties without
+        /// copying them into the layer.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD const RendererPropertyMap& getPropertyValuePairs() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Gets a copy of all properties and their values, including the ones that are only stored in the base data
+        ///
+        /// @return Property-value pairs of the renderer
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        TGUI_NODISCARD const std::map<String, ObjectConverter>& getPropertyValuePairs() const;
+        TGUI_NODISCARD RendererPropertyMap getMergedPropertyValuePairs() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -272,6 +411,7 @@ TGUI_MODULE_EXPORT namespace tgui
         /// @brief Gets a clone of the renderer data
         ///
         /// You can pass this to a widget with the setRenderer function to have a separate non-shared copy of this renderer.
+        /// The returned data contains all properties, even when the data of this renderer is a layer on top of other data.
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD std::shared_ptr<RendererData> clone() const;
@@ -226,6 +226,20 @@ TGUI_MODULE_EXPORT namespace tgui
         }
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether emitting the signal would call any function
+        ///
+        /// @return Is the signal enabled and is at least one function connected to it?
+        ///
+        /// The parameters of emit are evaluated even when nothing is connected. This function can be used to avoid creating
+        /// expensive parameters (e.g. a copy of a large text) when nobody would receive them.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isConnected() const
+        {
+            return m_enabled && !m_handlers.empty();
+        }
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
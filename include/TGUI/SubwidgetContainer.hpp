@@ -194,7 +194,8 @@ TGUI_MODULE_EXPORT namespace tgui
         ///
         /// @param property  Name of the property that was changed
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void rendererChanged(const String& property) override;
+        void rendererChanged(PropertyId property) override;
+        using Widget::rendererChanged;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -386,7 +386,7 @@ TGUI_MODULE_EXPORT namespace tgui
         /// @brief Returns the internal text
         /// @return Backend text that is used internally
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        TGUI_NODISCARD std::shared_ptr<BackendText> getBackendText() const;
+        TGUI_NODISCARD const std::shared_ptr<BackendText>& getBackendText() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -213,6 +213,30 @@ TGUI_MODULE_EXPORT namespace tgui
         }
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Convert an UTF-8 string to UTF-32
+        /// @param inputBegin  Pointer to the first character of the UTF-8 string
+        /// @param inputEnd    Pointer past the last character of the UTF-8 string
+        /// @return Output UTF-32 string
+        ///
+        /// This overload is used when the characters are stored contiguously. When SSE2 or NEON instructions are available,
+        /// ASCII characters are converted 16 at a time. Other characters are decoded in the same way as by the iterator version.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD TGUI_API std::u32string convertUtf8toUtf32(const char* inputBegin, const char* inputEnd);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Convert an UTF-16 string to UTF-32
+        /// @param inputBegin  Pointer to the first character of the UTF-16 string
+        /// @param inputEnd    Pointer past the last character of the UTF-16 string
+        /// @return Output UTF-32 string
+        ///
+        /// This overload is used when the characters are stored contiguously. When SSE2 or NEON instructions are available,
+        /// characters that aren't part of a surrogate pair are converted 8 at a time.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD TGUI_API std::u32string convertUtf16toUtf32(const char16_t* inputBegin, const char16_t* inputEnd);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Convert an std::wstring string to UTF-32
         /// @param str  Input wstring to copy
@@ -257,15 +281,7 @@ TGUI_MODULE_EXPORT namespace tgui
         /// @param strUtf32  Input UTF-32 string
         /// @return Output UTF-8 string
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        TGUI_NODISCARD inline std::string convertUtf32toStdStringUtf8(const std::u32string& strUtf32)
-        {
-            std::string outStrUtf8;
-            outStrUtf8.reserve(strUtf32.length() + 1);
-            for (const char32_t codepoint : strUtf32)
-                encodeCharUtf8(codepoint, outStrUtf8);
-
-            return outStrUtf8;
-        }
+        TGUI_NODISCARD TGUI_API std::string convertUtf32toStdStringUtf8(const std::u32string& strUtf32);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -303,31 +319,7 @@ TGUI_MODULE_EXPORT namespace tgui
         /// @param strUtf32  Input UTF-32 string
         /// @return Output UTF-16 string
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        TGUI_NODISCARD inline std::u16string convertUtf32toUtf16(const std::u32string& strUtf32)
-        {
-            std::u16string outStrUtf16;
-            outStrUtf16.reserve(strUtf32.length() + 1);
-
-            for (const char32_t codepoint : strUtf32)
-            {
-                // If the codepoint fitst inside 2 bytes and it would represent a valid character then just copy it
-                if (codepoint <= 0xFFFF)
-                {
-                    if ((codepoint < 0xD800) || (codepoint > 0xDFFF))
-                        outStrUtf16.push_back(static_cast<char16_t>(codepoint));
-
-                    continue;
-                }
-                else if (codepoint > 0x0010FFFF)
-                    continue; // Invalid character (greater than the maximum Unicode value)
-
-                // The input character needs be converted to two UTF-16 elements
-                outStrUtf16.push_back(static_cast<char16_t>(((codepoint - 0x0010000) >> 10)     + 0xD800));
-                outStrUtf16.push_back(static_cast<char16_t>(((codepoint - 0x0010000) & 0x3FFUL) + 0xDC00));
-            }
-
-            return outStrUtf16;
-        }
+        TGUI_NODISCARD TGUI_API std::u16string convertUtf32toUtf16(const std::u32string& strUtf32);
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     }
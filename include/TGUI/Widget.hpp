@@ -660,6 +660,17 @@ TGUI_MODULE_EXPORT namespace tgui
         void moveToBack();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Informs the gui that the widget has to be redrawn
+        ///
+        /// This only has an effect when partial redrawing was enabled in the gui (see BackendGui::setPartialRedrawEnabled) or
+        /// when one of the parents of the widget caches its contents (see Container::setRenderCacheEnabled).
+        /// Changes made via the functions of the Widget base class and the renderer are detected automatically.
+        /// Custom widgets should call this function when their contents changes in some other way.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void invalidate();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Stores some data into the widget
         /// @param userData  Data to store
@@ -1073,7 +1084,7 @@ TGUI_MODULE_EXPORT namespace tgui
         /// @internal
         /// @brief Callback function which is called on a renderer change and which calls the virtual rendererChanged function
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void rendererChangedCallback(const String& property);
+        void rendererChangedCallback(PropertyId property);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1093,9 +1104,39 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Function called when one of the properties of the renderer is changed
         ///
+        /// @param property  Id of the property that was changed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void rendererChanged(PropertyId property);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Function that was called when one of the properties of the renderer was changed, before properties had ids
+        ///
         /// @param property  Name of the property that was changed
+        ///
+        /// @deprecated Override rendererChanged(PropertyId) instead. This function is final so that an existing override of it
+        ///             fails to compile, instead of silently no longer being called.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_DEPRECATED("Override rendererChanged(PropertyId) instead") virtual void rendererChanged(const String& property) final;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Informs the gui that part of the widget has to be redrawn
+        ///
+        /// @param rect  Area that changed, relative to the top-left position of the widget
+        ///
+        /// @see invalidate
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidateRect(FloatRect rect);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether changes to this widget have to be reported to its parent
+        ///
+        /// This is only the case for visible widgets when partial redrawing is enabled in the gui or when one of the parents
+        /// caches its contents in a texture.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        virtual void rendererChanged(const String& property);
+        TGUI_NODISCARD bool isInvalidationTracked() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
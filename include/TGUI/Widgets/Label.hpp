@@ -32,6 +32,7 @@
 #include <TGUI/CopiedSharedPtr.hpp>
 #include <TGUI/Widgets/Scrollbar.hpp>
 #include <TGUI/Text.hpp>
+#include <TGUI/WordWrapper.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -372,7 +373,8 @@ TGUI_MODULE_EXPORT namespace tgui
         /// @param property  Name of the property that was changed
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void rendererChanged(const String& property) override;
+        void rendererChanged(PropertyId property) override;
+        using Widget::rendererChanged;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -428,6 +430,7 @@ TGUI_MODULE_EXPORT namespace tgui
 
         String m_string;
         std::vector<std::vector<Text>> m_lines;
+        WordWrapper m_wordWrapper;
 
         HorizontalAlignment m_horizontalAlignment = HorizontalAlignment::Left;
         VerticalAlignment m_verticalAlignment = VerticalAlignment::Top;
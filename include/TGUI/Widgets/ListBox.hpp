@@ -27,6 +27,7 @@
 #define TGUI_LIST_BOX_HPP
 
 
+#include <TGUI/CompactString.hpp>
 #include <TGUI/CopiedSharedPtr.hpp>
 #include <TGUI/Widgets/Scrollbar.hpp>
 #include <TGUI/Renderers/ListBoxRenderer.hpp>
@@ -606,7 +607,8 @@ TGUI_MODULE_EXPORT namespace tgui
         /// @param property  Name of the property that was changed
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void rendererChanged(const String& property) override;
+        void rendererChanged(PropertyId property) override;
+        using Widget::rendererChanged;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -640,7 +642,8 @@ TGUI_MODULE_EXPORT namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Update the colors and text style of the selected and hovered items
+        // Update the colors and text style of the selected and hovered items.
+        // Kept for derived classes, the texts of all visible items are now recreated like in updateItemColorsAndStyle.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void updateSelectedAndHoveringItemColorsAndStyle();
 
@@ -664,7 +667,14 @@ TGUI_MODULE_EXPORT namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Checks whether the scrollbar value was changed and emit the onScroll event if it did
+        // Creates the texts for the items that are visible. Only these items need a text, all other items are only stored
+        // as compact strings until they are scrolled into view.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateVisibleItemTexts(std::size_t firstItem, std::size_t lastItem) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Checks whether the scrollbar was changed, redraws the list box if it was and emits the onScroll event if its value changed
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void triggerOnScroll();
 
@@ -696,13 +706,18 @@ TGUI_MODULE_EXPORT namespace tgui
 
         struct Item
         {
-            Text text;
+            CompactString caption;
             Any data;
-            String id;
+            CompactString id;
         };
 
         std::vector<Item> m_items;
 
+        // Texts of the items that were visible when the list box was last drawn
+        mutable std::vector<Text> m_visibleItemTexts;
+        mutable std::size_t m_visibleItemTextsFirstItem = 0;
+        mutable bool m_visibleItemTextsValid = false;
+
         // What is the index of the selected item?
         // This is also used by combo box, so it can't just be changed to a pointer!
         int m_selectedItem = -1;
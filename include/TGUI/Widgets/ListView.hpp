@@ -27,6 +27,7 @@
 #define TGUI_LIST_VIEW_HPP
 
 
+#include <TGUI/CompactString.hpp>
 #include <TGUI/CopiedSharedPtr.hpp>
 #include <TGUI/Widgets/Scrollbar.hpp>
 #include <TGUI/Renderers/ListViewRenderer.hpp>
@@ -67,7 +68,7 @@ TGUI_MODULE_EXPORT namespace tgui
 
         struct Item
         {
-            std::vector<Text> texts;
+            std::vector<CompactString> texts;
             Any data;
             Sprite icon;
         };
@@ -858,7 +859,8 @@ TGUI_MODULE_EXPORT namespace tgui
         ///
         /// @param property  Name of the property that was changed
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void rendererChanged(const String& property) override;
+        void rendererChanged(PropertyId property) override;
+        using Widget::rendererChanged;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -900,7 +902,7 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Create a Text object for an item from the given caption, using the preset color, font, text size and opacity
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        TGUI_NODISCARD Text createText(const String& caption);
+        TGUI_NODISCARD Text createText(const String& caption) const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -910,11 +912,24 @@ TGUI_MODULE_EXPORT namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Changes the color of all Text objects in an item
+        // Changes the color of all Text objects in an item. Only visible items have Text objects, the color of the other items
+        // is decided when they become visible.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual void setItemColor(std::size_t index, const Color& color);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the width of an item's text in one of the columns, without creating a Text object for it
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD float getItemTextWidth(const CompactString& caption) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates the Text objects for the items that are visible, all other items are only stored as compact strings
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateVisibleItemTexts(std::size_t firstItem, std::size_t lastItem) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Calculate the width of the column based on its caption when no column width was provided
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1099,6 +1114,11 @@ TGUI_MODULE_EXPORT namespace tgui
         unsigned int m_iconCount = 0;
         float m_maxIconWidth = 0;
         float m_maxItemWidth = 0; // If there are no columns, this is the maximum width from all items
+
+        // Texts of the items that were visible when the list view was last drawn
+        mutable std::vector<std::vector<Text>> m_visibleItemTexts;
+        mutable std::size_t m_visibleItemTextsFirstItem = 0;
+        mutable bool m_visibleItemTextsValid = false;
         bool m_headerVisible = true;
         bool m_showHorizontalGridLines = false;
         bool m_showVerticalGridLines = true;
@@ -214,6 +214,14 @@ TGUI_MODULE_EXPORT namespace tgui
         void setEnabled(bool enabled) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Informs the gui that the widget has to be redrawn
+        ///
+        /// When a menu is open, the list of menu items is redrawn as well.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidate() override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Adds a new menu
         ///
@@ -537,7 +545,8 @@ TGUI_MODULE_EXPORT namespace tgui
         /// @param property  Name of the property that was changed
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void rendererChanged(const String& property) override;
+        void rendererChanged(PropertyId property) override;
+        using Widget::rendererChanged;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -315,7 +315,8 @@ TGUI_MODULE_EXPORT namespace tgui
         /// @param property  Name of the property that was changed
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void rendererChanged(const String& property) override;
+        void rendererChanged(PropertyId property) override;
+        using Widget::rendererChanged;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -443,6 +444,23 @@ TGUI_MODULE_EXPORT namespace tgui
         bool isShown() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Marks the scrollbar as changed
+        ///
+        /// The scrollbar isn't added to a container, so the widget that contains it has to redraw itself when the scrollbar
+        /// changes. That widget checks whether this function was called with the wasInvalidated function.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidate() override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the scrollbar changed since the last time this function was called
+        ///
+        /// @return Was invalidate() called since the previous call to this function?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool wasInvalidated();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Draw the widget to a render target
         ///
@@ -453,6 +471,9 @@ TGUI_MODULE_EXPORT namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        bool m_invalidated = false;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -28,9 +28,11 @@
 
 
 #include <TGUI/CopiedSharedPtr.hpp>
+#include <TGUI/MappedTextFile.hpp>
 #include <TGUI/Widgets/Scrollbar.hpp>
 #include <TGUI/Renderers/TextAreaRenderer.hpp>
 #include <TGUI/Text.hpp>
+#include <TGUI/WordWrapper.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -113,6 +115,7 @@ TGUI_MODULE_EXPORT namespace tgui
         ///
         /// @param text  New text
         ///
+        /// If a file was being shown with openFile then the file is closed.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void setText(String text);
 
@@ -122,6 +125,7 @@ TGUI_MODULE_EXPORT namespace tgui
         ///
         /// @param text  Text that will be added to the text that is already in the text area
         ///
+        /// This function does nothing while a file is being shown with openFile.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void addText(String text);
 
@@ -131,10 +135,44 @@ TGUI_MODULE_EXPORT namespace tgui
         ///
         /// @return  The text that is currently inside the text area
         ///
+        /// While a file is being shown with openFile, this function decodes the entire file.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD String getText() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Shows the contents of a UTF-8 text file without loading it in memory
+        ///
+        /// @param filename  Filename of the text file
+        ///
+        /// @throw Exception when the file couldn't be opened
+        ///
+        /// The file is mapped in memory and only the lines that are visible are read and decoded, so even huge files (e.g. logs)
+        /// are shown immediately. The amount of lines is estimated until the file has been scanned completely, which happens
+        /// while scrolling through it.
+        ///
+        /// While showing the file, the text can't be edited or selected and lines are not word-wrapped. A horizontal scrollbar
+        /// is used for long lines unless the horizontal scrollbar policy is Never, in which case long lines are cut off.
+        /// The file remains open until closeFile or setText is called. The onTextChange signal is not triggered.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void openFile(const String& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Stops showing the file that was opened with openFile
+        ///
+        /// The text area is empty after calling this function.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void closeFile();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether a file is being shown
+        /// @return Was openFile called without calling closeFile or setText afterwards?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD bool isFileOpen() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes the default text of the text area. This is the text drawn when the text area is empty
         ///
@@ -305,6 +343,7 @@ TGUI_MODULE_EXPORT namespace tgui
         /// @return Lines of text
         ///
         /// Note that this is the amount of lines after word-wrap is applied.
+        /// While a file is being shown with openFile, the amount of lines may be an estimation.
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         TGUI_NODISCARD std::size_t getLinesCount() const;
@@ -451,11 +490,21 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void rearrangeText(bool keepSelection);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Rearrange the text inside the text area and place the selection at the given character indices afterwards.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void rearrangeText(std::size_t selStart, std::size_t selEnd);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Updates the physical size of the scrollbars, as well as the viewport size.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void updateScrollbars();
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Tells the scrollbars how many pixels the text contains
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateScrollbarMaximums(std::size_t lineCount);
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // This function will split the text into five pieces so that the text can be easily drawn.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -560,6 +609,30 @@ TGUI_MODULE_EXPORT namespace tgui
         void recalculateVisibleLines();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Fills the texts with the lines in the range [firstLine, lastLine). Lines outside the view are never placed in a text.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateVisibleTexts(std::size_t firstLine, std::size_t lastLine);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Fills the texts with the lines of the opened file in the range [firstLine, lastLine).
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateVisibleFileTexts(std::size_t firstLine, std::size_t lastLine);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Handles a key press while a file is shown, there is no caret so the keys scroll through the file.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void scrollFileWithKey(const Event::KeyEvent& event);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Emits the onTextChange signal, the text is only copied when a function is connected to the signal.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void emitTextChange();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Retrieves a signal based on its name
         ///
@@ -578,7 +651,8 @@ TGUI_MODULE_EXPORT namespace tgui
         /// @param property  Name of the property that was changed
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void rendererChanged(const String& property) override;
+        void rendererChanged(PropertyId property) override;
+        using Widget::rendererChanged;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -615,13 +689,16 @@ TGUI_MODULE_EXPORT namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
-        String m_text;
         float m_lineHeight = 24;
 
         // The width of the largest line
         float m_maxLineWidth = 0;
 
-        std::vector<String> m_lines;
+        // Stores the text and its word-wrapped lines, so that an edit only has to wrap the paragraphs that changed
+        WordWrapper m_wordWrapper;
+
+        // File that is shown instead of the text. It is shared with copies of the text area, as it can't be changed.
+        std::shared_ptr<MappedTextFile> m_mappedFile;
 
         // The maximum characters (0 by default, which means no limit)
         std::size_t m_maxChars = 0;
@@ -630,6 +707,10 @@ TGUI_MODULE_EXPORT namespace tgui
         std::size_t m_topLine = 1;
         std::size_t m_visibleLines = 1;
 
+        // Lines that are currently placed in the texts
+        std::size_t m_visibleTextsFirstLine = 0;
+        std::size_t m_visibleTextsLastLine = 0;
+
         // Information about the selection
         Vector2<std::size_t> m_selStart;
         Vector2<std::size_t> m_selEnd;
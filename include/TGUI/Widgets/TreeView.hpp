@@ -26,6 +26,7 @@
 #ifndef TGUI_TREE_VIEW_HPP
 #define TGUI_TREE_VIEW_HPP
 
+#include <TGUI/CompactString.hpp>
 #include <TGUI/CopiedSharedPtr.hpp>
 #include <TGUI/Widgets/Scrollbar.hpp>
 #include <TGUI/Renderers/TreeViewRenderer.hpp>
@@ -59,7 +60,7 @@ TGUI_MODULE_EXPORT namespace tgui
         /// @brief Internal representation of a node
         struct Node
         {
-            Text text;
+            CompactString text;
             unsigned int depth = 0;
             bool expanded = true;
             Node* parent = nullptr;
@@ -364,7 +365,8 @@ TGUI_MODULE_EXPORT namespace tgui
         /// @param property  Name of the property that was changed
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void rendererChanged(const String& property) override;
+        void rendererChanged(PropertyId property) override;
+        using Widget::rendererChanged;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -409,12 +411,6 @@ TGUI_MODULE_EXPORT namespace tgui
         TGUI_NODISCARD Widget::Ptr clone() const override;
 
 
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        /// @internal
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void updateTextColors(std::vector<std::shared_ptr<Node>>& nodes);
-
-
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -446,7 +442,7 @@ TGUI_MODULE_EXPORT namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Rebuilds the list of visible items and positions the texts
+        // Rebuilds the list of visible items and calculates the width of the widest item
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         unsigned int updateVisibleNodes(std::vector<std::shared_ptr<Node>>& nodes, Node* selectedNode, float textPadding, unsigned int pos);
 
@@ -457,6 +453,13 @@ TGUI_MODULE_EXPORT namespace tgui
         void updateSelectedAndHoveringItemColors();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates the texts for the items that are on the screen. The nodes only store their text as a compact string,
+        // the Text objects are only created for the few items that are drawn.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateShownNodeTexts(std::size_t firstNode, std::size_t lastNode) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Updates the text color of the hovered item
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -491,6 +494,11 @@ TGUI_MODULE_EXPORT namespace tgui
         unsigned int m_itemHeight = 0;
         float m_maxRight = 0;
 
+        // Texts of the items that were on the screen when the tree view was last drawn
+        mutable std::vector<Text> m_shownNodeTexts;
+        mutable std::size_t m_shownNodeTextsFirstNode = 0;
+        mutable bool m_shownNodeTextsValid = false;
+
         Vector2f m_iconBounds;
 
         CopiedSharedPtr<ScrollbarChildWidget> m_verticalScrollbar;
@@ -0,0 +1,283 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2023 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_WORD_WRAPPER_HPP
+#define TGUI_WORD_WRAPPER_HPP
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <TGUI/Font.hpp>
+#include <TGUI/PieceTable.hpp>
+#include <TGUI/Vector2.hpp>
+
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <vector>
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TGUI_MODULE_EXPORT namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Word-wraps a text and keeps the result, so that edits only require the changed paragraphs to be wrapped again
+    ///
+    /// The text is split into paragraphs at every '\n' character. Each paragraph is wrapped on its own, in exactly the same
+    /// way as Text::wordWrap would wrap the entire text. When characters are inserted or erased, only the paragraphs that
+    /// contain the changed characters are wrapped again the next time the lines are requested.
+    ///
+    /// The text is stored in a PieceTable and only the positions where lines are broken are kept for each paragraph. A line
+    /// can thus be looked up without creating a string for every line of the text.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API WordWrapper
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Replaces the text
+        ///
+        /// @param text  New text
+        ///
+        /// Only the characters between the common start and the common end of the old and new text are replaced.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setText(const String& text);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the text, without the newlines that were added by the word-wrap
+        /// @return Unwrapped text
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD String getText() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns a part of the text
+        ///
+        /// @param index  Position in the unwrapped text of the first character
+        /// @param count  Amount of characters, the count is clamped to the end of the text
+        ///
+        /// @return Characters of the unwrapped text
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD String getSubstring(std::size_t index, std::size_t count = String::npos) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of characters in the text
+        /// @return Length of the unwrapped text
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::size_t getTextLength() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds characters at the end of the text
+        ///
+        /// @param text  Characters to append
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void appendText(const String& text);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Inserts characters in the text
+        ///
+        /// @param index  Position in the unwrapped text where the characters should be inserted
+        /// @param text   Characters to insert
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void insertText(std::size_t index, const String& text);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes characters from the text
+        ///
+        /// @param index  Position in the unwrapped text of the first character to remove
+        /// @param count  Amount of characters to remove, the count is clamped to the end of the text
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void eraseText(std::size_t index, std::size_t count = String::npos);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes how the text is wrapped
+        ///
+        /// @param maxWidth       Maximum width of a line, or 0 to only split the text at the '\n' characters
+        /// @param font           Font of the text
+        /// @param characterSize  The text size
+        /// @param bold           Is the text bold?
+        ///
+        /// All paragraphs have to be wrapped again when one of the parameters differs from the previous call.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setWrapping(float maxWidth, const Font& font, unsigned int characterSize, bool bold);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of lines in the word-wrapped text
+        ///
+        /// @return Number of lines, which is always at least 1
+        ///
+        /// This function and the other functions that access lines first wrap the paragraphs that changed since the last call.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::size_t getLineCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns a single line of the word-wrapped text
+        ///
+        /// @param lineIndex  Index of the line, which must be smaller than getLineCount()
+        ///
+        /// @return Characters on the line, without '\n' character
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD String getLine(std::size_t lineIndex) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of characters on a line of the word-wrapped text
+        ///
+        /// @param lineIndex  Index of the line, which must be smaller than getLineCount()
+        ///
+        /// @return Length of the line, without '\n' character
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::size_t getLineLength(std::size_t lineIndex) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the position in the unwrapped text of the first character on a line
+        ///
+        /// @param lineIndex  Index of the line, which must be smaller than getLineCount()
+        ///
+        /// @return Index of the first character of the line
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::size_t getLineStartIndex(std::size_t lineIndex) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Finds on which line a character is located
+        ///
+        /// @param index  Position in the unwrapped text, the length of the text is also accepted
+        ///
+        /// @return Position of the character on the line (x) and the index of the line (y)
+        ///
+        /// When the text was wrapped in front of the character, the position at the end of the previous line is returned.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD Vector2<std::size_t> getPositionOfIndex(std::size_t index) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns all lines of the word-wrapped text
+        ///
+        /// @return Lines of the text, without '\n' characters. There is always at least one line.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::vector<String> getLines() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the width of the longest line
+        ///
+        /// @return Largest value returned by Text::getLineWidth for any of the lines
+        ///
+        /// The width of each paragraph is kept, so only the paragraphs that were wrapped again since the last call are measured.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD float getMaximumLineWidth() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the word-wrapped text
+        ///
+        /// @return Text with additional '\n' characters, identical to the result of Text::wordWrap
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD String getWrappedText() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how many times a paragraph had to be wrapped
+        ///
+        /// @return Amount of paragraphs that were wrapped since this object was created
+        ///
+        /// This function is mainly useful to verify that edits don't cause unchanged paragraphs to be wrapped again.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::size_t getWrappedParagraphCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        struct Paragraph
+        {
+            std::vector<std::size_t> lineBreaks; // Positions within the paragraph where a new line starts
+            bool dirty = true;                   // Do the line breaks of the paragraph need to be recalculated?
+            float maxLineWidth = -1;             // Width of the longest line, or a negative value when not yet measured
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Replaces paragraphs by new ones that still have to be wrapped
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void replaceParagraphs(std::size_t first, std::size_t oldCount, std::size_t newCount);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Wraps the paragraphs that changed and makes certain that the line counts can be looked up
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateLines() const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the amount of lines in the paragraphs in front of the given paragraph
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::size_t getLineCountBeforeParagraph(std::size_t paragraphIndex) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Finds the paragraph that contains a line. The line index is changed to the line within that paragraph.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TGUI_NODISCARD std::size_t findParagraphOfLine(std::size_t& lineIndex) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Splits a single paragraph into lines that fit within the maximum width
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void wrapParagraph(const String& text, std::vector<std::size_t>& lineBreaks) const;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        PieceTable m_text;
+
+        // The paragraphs are wrapped lazily when lines are requested, which is why these members can change in const functions
+        mutable std::vector<Paragraph> m_paragraphs = std::vector<Paragraph>(1);
+        mutable std::size_t m_dirtyParagraphsBegin = 0; // All dirty paragraphs lie within [begin, end)
+        mutable std::size_t m_dirtyParagraphsEnd = 1;
+        mutable bool m_allParagraphsDirty = true;
+
+        // Fenwick tree containing the line count of each paragraph, to find the paragraph of a line in logarithmic time
+        mutable std::vector<std::size_t> m_lineCountTree;
+        mutable bool m_lineCountTreeValid = false;
+
+        float m_maxWidth = 0;
+        Font m_font;
+        float m_fontScale = 1;
+        unsigned int m_characterSize = 0;
+        bool m_bold = false;
+
+        mutable std::size_t m_wrappedParagraphCount = 0;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_WORD_WRAPPER_HPP
@@ -25,6 +25,7 @@
 
 #include <TGUI/Backend/Font/BackendFont.hpp>
 #include <TGUI/Backend/Window/Backend.hpp>
+#include <TGUI/GlyphRunCache.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <cmath>
@@ -68,6 +69,7 @@ namespace tgui
     {
         TGUI_ASSERT(isBackendSet(), "Backend must still exist when font is destroyed");
         getBackend()->unregisterFont(this);
+        GlyphRunCache::removeFont(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -134,6 +136,43 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    float BackendFont::getGlyphAdvance(char32_t codePoint, unsigned int characterSize, bool bold)
+    {
+        return getGlyph(codePoint, characterSize, bold).advance;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFont::preloadGlyphs(char32_t first, char32_t last, unsigned int characterSize, bool bold, float outlineThickness)
+    {
+        if (first > last)
+            return;
+
+        // The loop condition is at the end, since last could be the maximum value that a char32_t can hold
+        char32_t codePoint = first;
+        do
+        {
+            if (hasGlyph(codePoint))
+                (void)getGlyph(codePoint, characterSize, bold, outlineThickness);
+        }
+        while (codePoint++ != last);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFont::preloadGlyphsAsync(char32_t first, char32_t last, unsigned int characterSize, bool bold, float outlineThickness)
+    {
+        preloadGlyphs(first, last, characterSize, bold, outlineThickness);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFont::waitForPreloadedGlyphs()
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendFont::setSmooth(bool smooth)
     {
         m_isSmooth = smooth;
@@ -154,6 +193,9 @@ namespace tgui
             return;
 
         m_fontScale = scale;
+
+        // The advances of the glyphs can be slightly different when the font is rendered at a different scale
+        GlyphRunCache::removeFont(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
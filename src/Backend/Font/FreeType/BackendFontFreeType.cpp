@@ -29,6 +29,8 @@
     import tgui;
 #else
     #include <TGUI/Backend/Window/Backend.hpp>
+    #include <TGUI/Global.hpp>
+    #include <TGUI/GlyphRunCache.hpp>
 #endif
 
 #if defined(__GNUC__)
@@ -38,6 +40,7 @@
 
 #include <ft2build.h>
 #include FT_FREETYPE_H
+#include FT_ADVANCES_H
 #include FT_GLYPH_H
 #include FT_OUTLINE_H
 #include FT_BITMAP_H
@@ -48,7 +51,12 @@
 #endif
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
+    #include <chrono>
     #include <cmath>
+    #include <cstring>
+    #include <iterator>
+    #include <limits>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -56,6 +64,168 @@
 namespace tgui
 {
     static const float unitsPerPixel = 64; // Freetype's 26.6 pixel format uses 1/64th of a pixel as unit
+    static const unsigned int initialPageSize = 128; // Minimum width and height of the blocks of an atlas page
+
+    static const char atlasCacheMagic[8] = {'T', 'G', 'U', 'I', 'F', 'N', 'T', 'C'}; // Identifies files written by saveAtlasCache
+    static const std::uint32_t atlasCacheVersion = 2; // Has to be increased when the file format or the glyph rasterization changes
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    namespace
+    {
+        // Values in the atlas cache are always stored in little-endian byte order
+        void writeUint32(std::vector<std::uint8_t>& buffer, std::uint32_t value)
+        {
+            for (unsigned int i = 0; i < 4; ++i)
+                buffer.push_back(static_cast<std::uint8_t>(value >> (8 * i)));
+        }
+
+        void writeUint64(std::vector<std::uint8_t>& buffer, std::uint64_t value)
+        {
+            for (unsigned int i = 0; i < 8; ++i)
+                buffer.push_back(static_cast<std::uint8_t>(value >> (8 * i)));
+        }
+
+        void writeFloat(std::vector<std::uint8_t>& buffer, float value)
+        {
+            std::uint32_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            writeUint32(buffer, bits);
+        }
+
+        unsigned int getMaximumTextureSize()
+        {
+            return (isBackendSet() && getBackend()->hasRenderer())
+                ? getBackend()->getRenderer()->getMaximumTextureSize() : std::numeric_limits<unsigned int>::max();
+        }
+
+        // Reads values from the atlas cache. Once reading past the end of the data was attempted, all reads return 0.
+        class AtlasCacheReader
+        {
+        public:
+            AtlasCacheReader(const std::uint8_t* data, std::size_t size) :
+                m_data(data),
+                m_size(size)
+            {
+            }
+
+            TGUI_NODISCARD const std::uint8_t* readBytes(std::size_t count)
+            {
+                if (m_failed || (count > m_size - m_pos))
+                {
+                    m_failed = true;
+                    return nullptr;
+                }
+
+                const std::uint8_t* bytes = m_data + m_pos;
+                m_pos += count;
+                return bytes;
+            }
+
+            TGUI_NODISCARD std::uint32_t readUint32()
+            {
+                const std::uint8_t* bytes = readBytes(4);
+                if (!bytes)
+                    return 0;
+
+                std::uint32_t value = 0;
+                for (unsigned int i = 0; i < 4; ++i)
+                    value |= static_cast<std::uint32_t>(bytes[i]) << (8 * i);
+                return value;
+            }
+
+            TGUI_NODISCARD std::uint64_t readUint64()
+            {
+                const std::uint8_t* bytes = readBytes(8);
+                if (!bytes)
+                    return 0;
+
+                std::uint64_t value = 0;
+                for (unsigned int i = 0; i < 8; ++i)
+                    value |= static_cast<std::uint64_t>(bytes[i]) << (8 * i);
+                return value;
+            }
+
+            TGUI_NODISCARD float readFloat()
+            {
+                const std::uint32_t bits = readUint32();
+                float value;
+                std::memcpy(&value, &bits, sizeof(value));
+                return value;
+            }
+
+            TGUI_NODISCARD bool hasFailed() const
+            {
+                return m_failed;
+            }
+
+        private:
+            const std::uint8_t* m_data;
+            std::size_t m_size;
+            std::size_t m_pos = 0;
+            bool m_failed = false;
+        };
+
+        // Squared distance of pixels that don't have a known distance yet when calculating a distance field
+        const double infiniteDistance = 1e20;
+
+        // One-dimensional squared euclidean distance transform by Felzenszwalb and Huttenlocher. The values are read from and
+        // written to every stride-th element of the data, the other buffers are temporary storage of at least count elements.
+        void calculateDistanceTransform1D(double* data, std::size_t stride, unsigned int count,
+                                          std::vector<double>& values, std::vector<unsigned int>& parabolas, std::vector<double>& boundaries)
+        {
+            for (unsigned int i = 0; i < count; ++i)
+                values[i] = data[i * stride];
+
+            // Find the lower envelope of the parabolas rooted at each element
+            unsigned int k = 0;
+            parabolas[0] = 0;
+            boundaries[0] = -infiniteDistance;
+            boundaries[1] = infiniteDistance;
+            for (unsigned int q = 1; q < count; ++q)
+            {
+                double s;
+                while (true)
+                {
+                    const unsigned int v = parabolas[k];
+                    s = ((values[q] + (static_cast<double>(q) * q)) - (values[v] + (static_cast<double>(v) * v))) / (2.0 * (q - v));
+                    if ((s > boundaries[k]) || (k == 0))
+                        break;
+
+                    --k;
+                }
+
+                ++k;
+                parabolas[k] = q;
+                boundaries[k] = s;
+                boundaries[k + 1] = infiniteDistance;
+            }
+
+            k = 0;
+            for (unsigned int q = 0; q < count; ++q)
+            {
+                while (boundaries[k + 1] < q)
+                    ++k;
+
+                const double offset = static_cast<double>(q) - parabolas[k];
+                data[q * stride] = (offset * offset) + values[parabolas[k]];
+            }
+        }
+
+        // Replaces each value in the grid with the squared distance to the nearest element that had a value of 0
+        void calculateDistanceTransform(std::vector<double>& grid, unsigned int width, unsigned int height)
+        {
+            const unsigned int maxSize = std::max(width, height);
+            std::vector<double> values(maxSize);
+            std::vector<unsigned int> parabolas(maxSize);
+            std::vector<double> boundaries(maxSize + 1);
+
+            for (unsigned int x = 0; x < width; ++x)
+                calculateDistanceTransform1D(&grid[x], width, height, values, parabolas, boundaries);
+            for (unsigned int y = 0; y < height; ++y)
+                calculateDistanceTransform1D(&grid[static_cast<std::size_t>(y) * width], 1, width, values, parabolas, boundaries);
+        }
+    }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -68,43 +238,14 @@ namespace tgui
 
     bool BackendFontFreetype::loadFromMemory(std::unique_ptr<std::uint8_t[]> data, std::size_t sizeInBytes)
     {
+        GlyphRunCache::removeFont(this);
         cleanup();
+        clearMetricsTables();
         m_cachedLineSpacing.clear();
         m_cachedFontHeights.clear();
         m_cachedAscents.clear();
         m_cachedDescents.clear();
-        m_glyphs.clear();
-        m_rows.clear();
-        m_pixels = nullptr;
-        m_texture = nullptr;
-        m_textureSize = 0;
-        m_textureVersion = 0;
-        m_nextRow = 3; // First 2 rows contain pixels for underlining
-
-        constexpr unsigned int initialTextureSize = 128;
-        m_pixels = MakeUniqueForOverwrite<std::uint8_t[]>(initialTextureSize * initialTextureSize * 4);
-
-        std::uint8_t* pixelPtr = m_pixels.get();
-        for (unsigned int y = 0; y < initialTextureSize; ++y)
-        {
-            for (unsigned int x = 0; x < initialTextureSize; ++x)
-            {
-                // Color is always white, alpha channel contains whether the pixel is empty of not
-                *pixelPtr++ = 255;
-                *pixelPtr++ = 255;
-                *pixelPtr++ = 255;
-                *pixelPtr++ = 0;
-            }
-        }
-
-        // Reserve a 2x2 white square in the top left corner of the texture that we can use for drawing an underline
-        for (unsigned int y = 0; y < 2; ++y)
-        {
-            for (unsigned int x = 0; x < 2; ++x)
-                m_pixels[((initialTextureSize * y) + x) * 4 + 3] = 255;
-        }
-
-        m_textureSize = initialTextureSize;
+        m_pages.clear();
 
         // Initialize the freetype library each time, since we currently don't reuse the library object between fonts.
         FT_Library library;
@@ -128,6 +269,7 @@ namespace tgui
         }
 
         m_fileContents = std::move(data);
+        m_fileSize = sizeInBytes;
         m_library = library;
         m_face = face;
         return true;
@@ -149,28 +291,183 @@ namespace tgui
             return glyph;
 
         const Glyph internalGlyph = getInternalGlyph(codePoint, characterSize, bold, outlineThickness);
-        glyph.advance = internalGlyph.advance / m_fontScale;
-        glyph.bounds.setPosition(internalGlyph.bounds.getPosition() / m_fontScale);
-        glyph.bounds.setSize(internalGlyph.bounds.getSize() / m_fontScale);
+        if (m_distanceFieldSize > 0)
+        {
+            // Distance fields are rasterized at the reference size and are scaled to the requested size when drawing
+            const float scale = getGlyphScale(characterSize);
+            glyph.advance = internalGlyph.advance * scale;
+            glyph.bounds.setPosition(internalGlyph.bounds.getPosition() * scale);
+            glyph.bounds.setSize(internalGlyph.bounds.getSize() * scale);
+        }
+        else
+        {
+            glyph.advance = internalGlyph.advance / m_fontScale;
+            glyph.bounds.setPosition(internalGlyph.bounds.getPosition() / m_fontScale);
+            glyph.bounds.setSize(internalGlyph.bounds.getSize() / m_fontScale);
+        }
+
         glyph.textureRect = internalGlyph.textureRect;
         return glyph;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void BackendFontFreetype::preloadGlyphsAsync(char32_t first, char32_t last, unsigned int characterSize, bool bold, float outlineThickness)
+    {
+        if (!m_face || (first > last))
+            return;
+
+        const std::uint8_t* fileContents = m_fileContents.get();
+        const std::size_t fileSize = m_fileSize;
+        const unsigned int scaledCharacterSize = getPageKey(characterSize);
+        const float scaledOutlineThickness = (m_distanceFieldSize > 0) ? (outlineThickness / getGlyphScale(characterSize)) : (outlineThickness * m_fontScale);
+
+        // FreeType objects can't be shared between threads, so the background thread creates its own face from the same data.
+        // The data remains valid until the thread is finished, as cleanup() waits for it before the font data is released.
+        m_preloadedGlyphs.push_back(std::async(std::launch::async,
+            [=]{
+                PreloadedGlyphs preloadedGlyphs;
+                preloadedGlyphs.scaledCharacterSize = scaledCharacterSize;
+                preloadedGlyphs.bold = bold;
+                preloadedGlyphs.scaledOutlineThickness = scaledOutlineThickness;
+
+                FT_Library library;
+                if (FT_Init_FreeType(&library) != 0)
+                    return preloadedGlyphs;
+
+                FT_Face face;
+                if (FT_New_Memory_Face(library, static_cast<const FT_Byte*>(fileContents), static_cast<FT_Long>(fileSize), 0, &face) != 0)
+                {
+                    FT_Done_FreeType(library);
+                    return preloadedGlyphs;
+                }
+
+                FT_Stroker stroker = nullptr;
+                if (FT_Select_Charmap(face, FT_ENCODING_UNICODE) == 0)
+                {
+                    // The loop condition is at the end, since last could be the maximum value that a char32_t can hold
+                    char32_t codePoint = first;
+                    do
+                    {
+                        if (FT_Get_Char_Index(face, static_cast<FT_ULong>(codePoint)) == 0)
+                            continue;
+
+                        RasterizedGlyph rasterizedGlyph;
+                        if (rasterizeGlyph(library, face, stroker, codePoint, scaledCharacterSize, bold, scaledOutlineThickness, rasterizedGlyph))
+                            preloadedGlyphs.glyphs.push_back(std::move(rasterizedGlyph));
+                    }
+                    while (codePoint++ != last);
+                }
+
+                if (stroker)
+                    FT_Stroker_Done(stroker);
+
+                FT_Done_Face(face);
+                FT_Done_FreeType(library);
+                return preloadedGlyphs;
+            }));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFontFreetype::waitForPreloadedGlyphs()
+    {
+        mergePreloadedGlyphs(true);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFontFreetype::setGlyphLoadingThreadCount(unsigned int threadCount)
+    {
+        if (m_glyphLoadingThreadCount == threadCount)
+            return;
+
+        // The new threads are started when the next glyph is requested
+        stopGlyphLoadingThreads();
+        m_glyphLoadingThreadCount = threadCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int BackendFontFreetype::getGlyphLoadingThreadCount() const
+    {
+        return m_glyphLoadingThreadCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendFontFreetype::hasPendingGlyphs() const
+    {
+        return m_pendingGlyphCount > 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float BackendFontFreetype::getGlyphAdvance(char32_t codePoint, unsigned int characterSize, bool bold)
+    {
+        if (!m_face)
+            return 0;
+
+        if (codePoint >= denseTableSize)
+            return getGlyph(codePoint, characterSize, bold).advance;
+
+        MetricsTable& table = getMetricsTable(characterSize, bold);
+        if (!std::isnan(table.advances[codePoint]))
+            return table.advances[codePoint];
+
+        // Placeholders of glyphs that are being rasterized by a worker thread only have an estimated advance
+        const float advance = getGlyph(codePoint, characterSize, bold).advance;
+        if (m_pendingGlyphCount == 0)
+            table.advances[codePoint] = advance;
+
+        return advance;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     float BackendFontFreetype::getKerning(char32_t first, char32_t second, unsigned int characterSize, bool bold)
     {
         // There is no kerning if one of the two characters is the null character
         if ((first == 0) || (second == 0))
             return 0;
 
-        if (!m_face || !setCurrentSize(characterSize))
+        if (!m_face)
             return 0;
 
-        // Retrieve position compensation deltas generated by FT_LOAD_FORCE_AUTOHINT flag
+        if ((first >= denseTableSize) || (second >= denseTableSize))
+            return loadKerning(first, second, characterSize, bold);
+
+        MetricsTable& table = getMetricsTable(characterSize, bold);
+        std::unique_ptr<float[]>& row = table.kernings[first];
+        if (!row)
+        {
+            row = MakeUniqueForOverwrite<float[]>(denseTableSize);
+            std::fill_n(row.get(), denseTableSize, std::numeric_limits<float>::quiet_NaN());
+        }
+
+        if (!std::isnan(row[second]))
+            return row[second];
+
+        // Placeholders of glyphs that are being rasterized by a worker thread don't have the autohint deltas yet
+        const float kerning = loadKerning(first, second, characterSize, bold);
+        if (m_pendingGlyphCount == 0)
+            row[second] = kerning;
+
+        return kerning;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float BackendFontFreetype::loadKerning(char32_t first, char32_t second, unsigned int characterSize, bool bold)
+    {
+        // Retrieve position compensation deltas generated by FT_LOAD_FORCE_AUTOHINT flag.
+        // This is done before setting the size, as loading the glyphs of a distance field changes the size of the face.
         const float firstRsbDelta = getInternalGlyph(first, characterSize, bold, 0).rsbDelta;
         const float secondLsbDelta = getInternalGlyph(second, characterSize, bold, 0).lsbDelta;
 
+        if (!setCurrentSize(characterSize))
+            return 0;
+
         // Get the kerning vector if present
         FT_Vector kerning;
         kerning.x = kerning.y = 0;
@@ -307,26 +604,86 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    std::shared_ptr<BackendTexture> BackendFontFreetype::getTexture(unsigned int, unsigned int& textureVersion)
+    std::shared_ptr<BackendTexture> BackendFontFreetype::getTexture(unsigned int characterSize, unsigned int& textureVersion)
     {
-        if (m_texture)
+        if (!m_preloadedGlyphs.empty())
+            mergePreloadedGlyphs(false);
+        if (m_pendingGlyphCount > 0)
+            mergeLoadedGlyphs();
+
+        const unsigned int pageKey = getPageKey(characterSize);
+        Page& page = getPage(pageKey);
+
+        // When a glyph didn't fit, space is freed once texts stopped requesting glyphs from the page. Texts don't request
+        // glyphs that they already have, so they are first forced to reload them in order to find out which rows are still
+        // used. When the texts are done, the other rows are cleared and texts reload their glyphs again, which places the
+        // glyphs that were missing in the freed rows. Glyphs that are being displayed are thus never removed from the page.
+        if (page.full && !page.glyphsRequested)
+        {
+            if (page.scanStart == 0)
+            {
+                page.scanStart = page.lastUsed;
+                page.textureVersion = ++m_textureVersion;
+            }
+            else
+            {
+                // If all rows are still used then the missing glyphs remain missing until another glyph doesn't fit
+                if (clearUnusedRows(page))
+                    page.textureVersion = ++m_textureVersion;
+
+                page.scanStart = 0;
+                page.full = false;
+            }
+        }
+        page.glyphsRequested = false;
+
+        // When glyphs were added to an existing texture then we only need to upload the part of the atlas that changed.
+        // The rest of the texture remains unchanged, so the version isn't changed and other texts keep their vertices.
+        if (page.texture && (page.dirtyRect.width > 0) && (page.dirtyRect.height > 0))
+        {
+            const std::uint8_t* regionPixels = getRegionPixels(page, page.dirtyRect, page.texture->isAlphaTexture(), m_uploadBuffer);
+
+            // Recreate the entire texture if the backend doesn't support partial updates
+            if (!page.texture->updateTextureRegion(page.dirtyRect, regionPixels))
+                page.texture = nullptr;
+        }
+
+        if (!page.texture)
         {
-            textureVersion = m_textureVersion;
-            return m_texture;
+            // Backends that don't support single-channel textures get the atlas as white RGBA pixels.
+            // Pages with multiple blocks are combined in a temporary buffer. The buffers aren't kept, to not waste memory
+            // on pixels that the renderer already stores.
+            const Vector2u size{page.blockSize, page.getHeight()};
+            std::vector<std::uint8_t> pixelBuffer;
+            const std::uint8_t* pixels = getRegionPixels(page, {0, 0, size.x, size.y}, true, pixelBuffer);
+            page.texture = getBackend()->getRenderer()->createTexture();
+            if (pageKey & distanceFieldPageFlag)
+            {
+                // Distance fields are always interpolated, the shader keeps the edges sharp
+                if (!page.texture->loadDistanceFieldTextureOnly(size, pixels, true))
+                    page.texture->loadAlphaTextureOnly(size, pixels, true);
+            }
+            else if (!page.texture->loadAlphaTextureOnly(size, pixels, m_isSmooth))
+            {
+                std::vector<std::uint8_t> rgbaPixels;
+                page.texture->loadTextureOnly(size, getRegionPixels(page, {0, 0, size.x, size.y}, false, rgbaPixels), m_isSmooth);
+            }
+
+            page.textureVersion = ++m_textureVersion;
         }
 
-        m_texture = getBackend()->getRenderer()->createTexture();
-        m_texture->loadTextureOnly({m_textureSize, m_textureSize}, m_pixels.get(), m_isSmooth);
+        page.dirtyRect = {};
 
-        textureVersion = ++m_textureVersion;
-        return m_texture;
+        textureVersion = page.textureVersion;
+        return page.texture;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Vector2u BackendFontFreetype::getTextureSize(unsigned int)
+    Vector2u BackendFontFreetype::getTextureSize(unsigned int characterSize)
     {
-        return {m_textureSize, m_textureSize};
+        const Page& page = getPage(getPageKey(characterSize));
+        return {page.blockSize, page.getHeight()};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -334,8 +691,12 @@ namespace tgui
     void BackendFontFreetype::setSmooth(bool smooth)
     {
         BackendFont::setSmooth(smooth);
-        if (m_texture)
-            m_texture->setSmooth(m_isSmooth);
+        for (auto& pair : m_pages)
+        {
+            auto& texture = pair.second.texture;
+            if (texture && !(pair.first & distanceFieldPageFlag))
+                texture->setSmooth(m_isSmooth);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -346,51 +707,323 @@ namespace tgui
             return;
 
         BackendFont::setFontScale(scale);
+        clearMetricsTables();
 
-        // Destroy the texture to force texts to update their glyphs
-        m_texture = nullptr;
+        // Destroy the textures to force texts to update their glyphs.
+        // Pages of the old character sizes are kept until they get evicted. Distance fields don't depend on the scale.
+        for (auto& pair : m_pages)
+        {
+            if (!(pair.first & distanceFieldPageFlag))
+                pair.second.texture = nullptr;
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    BackendFontFreetype::Glyph BackendFontFreetype::loadGlyph(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness)
+    bool BackendFontFreetype::setDistanceFieldEnabled(bool enabled, unsigned int referenceSize)
+    {
+        TGUI_ASSERT(referenceSize > 0, "Reference size passed to BackendFontFreetype::setDistanceFieldEnabled can't be 0");
+
+        const bool supported = isBackendSet() && getBackend()->hasRenderer() && getBackend()->getRenderer()->supportsDistanceFieldTextures();
+        const unsigned int distanceFieldSize = (enabled && supported) ? referenceSize : 0;
+        if (m_distanceFieldSize == distanceFieldSize)
+            return (m_distanceFieldSize > 0);
+
+        // Texts will get the texture of a different page, but the advances of the glyphs also changed
+        m_distanceFieldSize = distanceFieldSize;
+        GlyphRunCache::removeFont(this);
+        clearMetricsTables();
+        return (m_distanceFieldSize > 0);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendFontFreetype::isDistanceFieldEnabled() const
+    {
+        return (m_distanceFieldSize > 0);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFontFreetype::setAtlasMemoryLimit(std::size_t bytes)
+    {
+        m_atlasMemoryLimit = bytes;
+        evictPages(0, nullptr);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t BackendFontFreetype::getAtlasMemoryLimit() const
+    {
+        return m_atlasMemoryLimit;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t BackendFontFreetype::getAtlasMemoryUsage() const
+    {
+        std::size_t usage = 0;
+        for (const auto& pair : m_pages)
+            usage += pair.second.getByteCount();
+
+        return usage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t BackendFontFreetype::getAtlasPageCount() const
+    {
+        return m_pages.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendFontFreetype::saveAtlasCache(const String& filename) const
     {
-        Glyph glyph;
         if (!m_face)
-            return glyph;
+            return false;
 
-        if (!setCurrentSize(characterSize))
-            return glyph;
+        std::vector<std::uint8_t> buffer;
+        buffer.reserve(getAtlasMemoryUsage() + 1024);
+
+        buffer.insert(buffer.end(), std::begin(atlasCacheMagic), std::end(atlasCacheMagic));
+        writeUint32(buffer, atlasCacheVersion);
+        writeUint64(buffer, static_cast<std::uint64_t>(m_fileSize));
+        writeUint64(buffer, getFontDataHash());
+        writeUint32(buffer, static_cast<std::uint32_t>(m_pages.size()));
+
+        for (const auto& pair : m_pages)
+        {
+            const Page& page = pair.second;
+            writeUint32(buffer, pair.first);
+            writeUint32(buffer, page.blockSize);
+            writeUint32(buffer, static_cast<std::uint32_t>(page.blocks.size()));
+            writeUint32(buffer, page.nextRow);
+
+            writeUint32(buffer, static_cast<std::uint32_t>(page.rows.size()));
+            for (const auto& row : page.rows)
+            {
+                writeUint32(buffer, row.width);
+                writeUint32(buffer, row.top);
+                writeUint32(buffer, row.height);
+            }
+
+            // Placeholders of glyphs that are still being rasterized by a worker thread aren't stored, neither are glyphs that
+            // didn't fit in the page. They will be loaded again when they are needed.
+            const auto glyphCount = std::count_if(page.glyphs.begin(), page.glyphs.end(),
+                [](const auto& glyphPair){ return !glyphPair.second.pending && !glyphPair.second.noSpace; });
+            writeUint32(buffer, static_cast<std::uint32_t>(glyphCount));
+            for (const auto& glyphPair : page.glyphs)
+            {
+                const Glyph& glyph = glyphPair.second;
+                if (glyph.pending || glyph.noSpace)
+                    continue;
+
+                writeUint64(buffer, glyphPair.first);
+                writeFloat(buffer, glyph.advance);
+                writeFloat(buffer, glyph.lsbDelta);
+                writeFloat(buffer, glyph.rsbDelta);
+                writeFloat(buffer, glyph.bounds.left);
+                writeFloat(buffer, glyph.bounds.top);
+                writeFloat(buffer, glyph.bounds.width);
+                writeFloat(buffer, glyph.bounds.height);
+                writeUint32(buffer, glyph.textureRect.left);
+                writeUint32(buffer, glyph.textureRect.top);
+                writeUint32(buffer, glyph.textureRect.width);
+                writeUint32(buffer, glyph.textureRect.height);
+            }
+
+            const std::size_t blockBytes = static_cast<std::size_t>(page.blockSize) * page.blockSize;
+            for (const auto& block : page.blocks)
+                buffer.insert(buffer.end(), block.get(), block.get() + blockBytes);
+        }
+
+        return writeFile(filename, buffer.data(), buffer.size());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendFontFreetype::loadAtlasCache(const String& filename)
+    {
+        if (!m_face)
+            return false;
+
+        // The entire file is read at once, the pixels are then copied directly into the pages
+        std::size_t fileSize = 0;
+        const auto fileContents = readFileToMemory(filename, fileSize);
+        if (!fileContents)
+            return false;
+
+        AtlasCacheReader reader(fileContents.get(), fileSize);
+        const std::uint8_t* magic = reader.readBytes(sizeof(atlasCacheMagic));
+        if (!magic || (std::memcmp(magic, atlasCacheMagic, sizeof(atlasCacheMagic)) != 0))
+            return false;
+
+        if (reader.readUint32() != atlasCacheVersion)
+            return false;
+
+        const std::uint64_t fontDataSize = reader.readUint64();
+        const std::uint64_t fontDataHash = reader.readUint64();
+        if (reader.hasFailed() || (fontDataSize != static_cast<std::uint64_t>(m_fileSize)) || (fontDataHash != getFontDataHash()))
+            return false;
+
+        const unsigned int maxTextureSize = getMaximumTextureSize();
+
+        // The file is parsed completely before replacing the existing pages, so that nothing changes if the file is corrupt
+        std::unordered_map<unsigned int, Page> pages;
+        std::size_t memoryUsage = 0;
+        const std::uint32_t pageCount = reader.readUint32();
+        for (std::uint32_t pageIndex = 0; pageIndex < pageCount; ++pageIndex)
+        {
+            const unsigned int scaledCharacterSize = reader.readUint32();
+
+            Page page;
+            page.blockSize = reader.readUint32();
+            const std::uint32_t blockCount = reader.readUint32();
+            page.nextRow = reader.readUint32();
+            if (reader.hasFailed() || (page.blockSize < initialPageSize) || (page.blockSize > 65536) || (blockCount == 0)
+             || (blockCount > 65536 / page.blockSize))
+                return false;
+
+            const unsigned int pageHeight = page.blockSize * blockCount;
+            if (page.nextRow > pageHeight)
+                return false;
+
+            const std::uint32_t rowCount = reader.readUint32();
+            for (std::uint32_t i = 0; (i < rowCount) && !reader.hasFailed(); ++i)
+            {
+                const unsigned int width = reader.readUint32();
+                const unsigned int top = reader.readUint32();
+                const unsigned int height = reader.readUint32();
+                if ((width > page.blockSize) || (top > pageHeight) || (height > pageHeight - top))
+                    return false;
+
+                page.rows.emplace_back(top, height);
+                page.rows.back().width = width;
+            }
+
+            const std::uint32_t glyphCount = reader.readUint32();
+            for (std::uint32_t i = 0; (i < glyphCount) && !reader.hasFailed(); ++i)
+            {
+                const std::uint64_t key = reader.readUint64();
+
+                Glyph glyph;
+                glyph.advance = reader.readFloat();
+                glyph.lsbDelta = reader.readFloat();
+                glyph.rsbDelta = reader.readFloat();
+                glyph.bounds.left = reader.readFloat();
+                glyph.bounds.top = reader.readFloat();
+                glyph.bounds.width = reader.readFloat();
+                glyph.bounds.height = reader.readFloat();
+                glyph.textureRect.left = reader.readUint32();
+                glyph.textureRect.top = reader.readUint32();
+                glyph.textureRect.width = reader.readUint32();
+                glyph.textureRect.height = reader.readUint32();
+                if ((glyph.textureRect.left > page.blockSize) || (glyph.textureRect.width > page.blockSize - glyph.textureRect.left)
+                 || (glyph.textureRect.top > pageHeight) || (glyph.textureRect.height > pageHeight - glyph.textureRect.top))
+                    return false;
+
+                // Glyphs with pixels have to lie inside one of the rows
+                if (glyph.textureRect.width > 0)
+                {
+                    const auto rowIt = std::find_if(page.rows.begin(), page.rows.end(), [&glyph](const Row& row){
+                        return (glyph.textureRect.top >= row.top) && (glyph.textureRect.top + glyph.textureRect.height <= row.top + row.height);
+                    });
+                    if (rowIt == page.rows.end())
+                        return false;
+
+                    glyph.row = static_cast<unsigned int>(rowIt - page.rows.begin());
+                }
+
+                page.glyphs.emplace(key, glyph);
+            }
+
+            const std::size_t blockBytes = static_cast<std::size_t>(page.blockSize) * page.blockSize;
+            const std::uint8_t* pixels = reader.readBytes(blockBytes * blockCount);
+            if (!pixels)
+                return false;
+
+            // Skip pages that the renderer can't handle or that would exceed the memory limit
+            if ((pageHeight > maxTextureSize) || ((m_atlasMemoryLimit > 0) && (memoryUsage + (blockBytes * blockCount) > m_atlasMemoryLimit)))
+                continue;
+
+            for (std::uint32_t i = 0; i < blockCount; ++i)
+            {
+                page.blocks.push_back(MakeUniqueForOverwrite<std::uint8_t[]>(blockBytes));
+                std::memcpy(page.blocks.back().get(), pixels + (i * blockBytes), blockBytes);
+            }
+            memoryUsage += blockBytes * blockCount;
+
+            pages[scaledCharacterSize] = std::move(page);
+        }
+
+        if (reader.hasFailed())
+            return false;
+
+        m_pages = std::move(pages);
+        for (auto& pair : m_pages)
+            pair.second.lastUsed = ++m_pageUseCounter;
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    BackendFontFreetype::Glyph BackendFontFreetype::loadGlyph(Page& page, char32_t codePoint, unsigned int scaledCharacterSize, bool bold, float scaledOutlineThickness)
+    {
+        if (!m_face)
+            return {};
+
+        RasterizedGlyph rasterizedGlyph;
+        if (!rasterizeGlyph(m_library, m_face, m_stroker, codePoint, scaledCharacterSize, bold, scaledOutlineThickness, rasterizedGlyph))
+            return {};
+
+        return insertGlyph(page, rasterizedGlyph);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendFontFreetype::rasterizeGlyph(FT_Library library, FT_Face face, FT_Stroker& stroker, char32_t codePoint,
+                                             unsigned int scaledCharacterSize, bool bold, float scaledOutlineThickness,
+                                             RasterizedGlyph& rasterizedGlyph)
+    {
+        const bool distanceField = ((scaledCharacterSize & distanceFieldPageFlag) != 0);
+        const unsigned int pixelSize = scaledCharacterSize & ~distanceFieldPageFlag;
+
+        // Don't call FT_Set_Pixel_Sizes if we don't have to
+        if ((pixelSize != face->size->metrics.x_ppem) && (FT_Set_Pixel_Sizes(face, 0, pixelSize) != FT_Err_Ok))
+            return false;
 #if defined(__GNUC__)
     #pragma GCC diagnostic push
     #pragma GCC diagnostic ignored "-Wold-style-cast"
 #endif
-        // Load the glyph corresponding to the code point
-        FT_Int32 flags = FT_LOAD_TARGET_NORMAL | FT_LOAD_FORCE_AUTOHINT;
-        if (outlineThickness != 0)
+        // Load the glyph corresponding to the code point.
+        // Distance fields are drawn at different sizes, so hinting them for the reference size would only distort them.
+        FT_Int32 flags = distanceField ? (FT_LOAD_TARGET_NORMAL | FT_LOAD_NO_HINTING) : (FT_LOAD_TARGET_NORMAL | FT_LOAD_FORCE_AUTOHINT);
+        if (scaledOutlineThickness != 0)
             flags |= FT_LOAD_NO_BITMAP;
 #if defined(__GNUC__)
     #pragma GCC diagnostic pop
 #endif
-        if (FT_Load_Char(m_face, codePoint, flags) != 0)
-            return glyph;
+        if (FT_Load_Char(face, codePoint, flags) != 0)
+            return false;
 
         // Retrieve the glyph
         FT_Glyph glyphDesc;
-        if (FT_Get_Glyph(m_face->glyph, &glyphDesc) != 0)
-            return glyph;
+        if (FT_Get_Glyph(face->glyph, &glyphDesc) != 0)
+            return false;
 
         // Add an outline if requested and the font supports it
-        if ((outlineThickness != 0) && (glyphDesc->format == FT_GLYPH_FORMAT_OUTLINE))
+        if ((scaledOutlineThickness != 0) && (glyphDesc->format == FT_GLYPH_FORMAT_OUTLINE))
         {
             // Create the stroker if this is the first time an outline was requested with this font
-            if (!m_stroker)
-                FT_Stroker_New(m_library, &m_stroker);
+            if (!stroker)
+                FT_Stroker_New(library, &stroker);
 
-            if (m_stroker)
+            if (stroker)
             {
-                FT_Stroker_Set(m_stroker, static_cast<FT_Fixed>(outlineThickness * m_fontScale * unitsPerPixel), FT_STROKER_LINECAP_ROUND, FT_STROKER_LINEJOIN_ROUND, 0);
-                FT_Glyph_Stroke(&glyphDesc, m_stroker, true);
+                FT_Stroker_Set(stroker, static_cast<FT_Fixed>(scaledOutlineThickness * unitsPerPixel), FT_STROKER_LINECAP_ROUND, FT_STROKER_LINEJOIN_ROUND, 0);
+                FT_Glyph_Stroke(&glyphDesc, stroker, true);
             }
         }
 
@@ -408,7 +1041,7 @@ namespace tgui
         if (FT_Glyph_To_Bitmap(&glyphDesc, FT_RENDER_MODE_NORMAL, nullptr, 1) != 0)
         {
             FT_Done_Glyph(glyphDesc);
-            return glyph;
+            return false;
         }
         FT_BitmapGlyph bitmapGlyph = reinterpret_cast<FT_BitmapGlyph>(glyphDesc);
         FT_Bitmap& bitmap = bitmapGlyph->bitmap;
@@ -416,15 +1049,21 @@ namespace tgui
         // If bold was requested but the font didn't support outlines then apply bold here using a different (lower quality) method
         // We have to cache the outline support bool because FT_Glyph_To_Bitmap changes format to FT_GLYPH_FORMAT_BITMAP.
         if (bold && !outlineSupport)
-            FT_Bitmap_Embolden(static_cast<FT_Library>(m_library), &bitmap, boldWeight, boldWeight);
+            FT_Bitmap_Embolden(library, &bitmap, boldWeight, boldWeight);
+
+        Glyph& glyph = rasterizedGlyph.glyph;
+        rasterizedGlyph.codePoint = codePoint;
 
         // Bit shift is possible without loss because we use FT_LOAD_FORCE_AUTOHINT flag
-        glyph.advance = static_cast<float>(bitmapGlyph->root.advance.x >> 16);
+        if (distanceField)
+            glyph.advance = static_cast<float>(bitmapGlyph->root.advance.x) / 65536.f; // Advance is in 16.16 fixed point format
+        else
+            glyph.advance = static_cast<float>(bitmapGlyph->root.advance.x >> 16);
         if (bold)
             glyph.advance += static_cast<float>(boldWeight) / unitsPerPixel;
 
-        glyph.lsbDelta = static_cast<float>(m_face->glyph->lsb_delta);
-        glyph.rsbDelta = static_cast<float>(m_face->glyph->rsb_delta);
+        glyph.lsbDelta = static_cast<float>(face->glyph->lsb_delta);
+        glyph.rsbDelta = static_cast<float>(face->glyph->rsb_delta);
 
         // Compute the glyph's bounding box
         glyph.bounds.left = static_cast<float>(bitmapGlyph->left);
@@ -432,82 +1071,390 @@ namespace tgui
         glyph.bounds.width = static_cast<float>(bitmap.width);
         glyph.bounds.height = static_cast<float>(bitmap.rows);
 
-        if ((bitmap.width == 0) || (bitmap.rows == 0))
+        // Extract the glyph's pixels from the bitmap.
+        // This loop won't be executed when e.g. loading a space character. The glyph will have an advance but no bitmap.
+        rasterizedGlyph.width = bitmap.width;
+        rasterizedGlyph.height = bitmap.rows;
+        rasterizedGlyph.pixels.resize(static_cast<std::size_t>(bitmap.width) * bitmap.rows);
+        const std::uint8_t* glyphBitmapPixels = bitmap.buffer;
+        for (unsigned int y = 0; y < bitmap.rows; ++y)
         {
-            // This branch will e.g. be executed when loading a space character. The glyph will have an advance but no bitmap.
-            FT_Done_Glyph(glyphDesc);
-            return glyph;
+            std::uint8_t* dstPtr = &rasterizedGlyph.pixels[static_cast<std::size_t>(y) * bitmap.width];
+            if (bitmap.pixel_mode == FT_PIXEL_MODE_MONO)
+            {
+                // Pixels are 1 bit monochrome values
+                for (unsigned int x = 0; x < bitmap.width; ++x)
+                    dstPtr[x] = ((glyphBitmapPixels[(static_cast<int>(y) * bitmap.pitch) + static_cast<int>(x / 8)]) & (1 << (7 - (x % 8)))) ? 255 : 0;
+            }
+            else
+            {
+                // Pixels are 8 bits gray levels
+                for (unsigned int x = 0; x < bitmap.width; ++x)
+                    dstPtr[x] = glyphBitmapPixels[(static_cast<int>(y) * bitmap.pitch) + static_cast<int>(x)];
+            }
         }
 
+        FT_Done_Glyph(glyphDesc);
+
+        if (distanceField)
+            convertToDistanceField(rasterizedGlyph, std::max(2u, pixelSize / 8));
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFontFreetype::convertToDistanceField(RasterizedGlyph& rasterizedGlyph, unsigned int spread)
+    {
+        if ((rasterizedGlyph.width == 0) || (rasterizedGlyph.height == 0))
+            return;
+
+        // The distance field is larger than the glyph, so that the edges can still be smoothed when the glyph is scaled
+        const unsigned int width = rasterizedGlyph.width + (2 * spread);
+        const unsigned int height = rasterizedGlyph.height + (2 * spread);
+        const std::size_t pixelCount = static_cast<std::size_t>(width) * height;
+
+        std::vector<std::uint8_t> coverage(pixelCount, 0);
+        for (unsigned int y = 0; y < rasterizedGlyph.height; ++y)
+        {
+            std::memcpy(&coverage[(static_cast<std::size_t>(y + spread) * width) + spread],
+                        &rasterizedGlyph.pixels[static_cast<std::size_t>(y) * rasterizedGlyph.width],
+                        rasterizedGlyph.width);
+        }
+
+        // Squared distance from each pixel inside the glyph to the nearest pixel outside it, and vice versa
+        std::vector<double> distancesToOutside(pixelCount);
+        std::vector<double> distancesToInside(pixelCount);
+        for (std::size_t i = 0; i < pixelCount; ++i)
+        {
+            const bool inside = (coverage[i] >= 128);
+            distancesToOutside[i] = inside ? infiniteDistance : 0;
+            distancesToInside[i] = inside ? 0 : infiniteDistance;
+        }
+
+        calculateDistanceTransform(distancesToOutside, width, height);
+        calculateDistanceTransform(distancesToInside, width, height);
+
+        rasterizedGlyph.pixels.resize(pixelCount);
+        for (std::size_t i = 0; i < pixelCount; ++i)
+        {
+            // Distance in pixels from the center of the pixel to the edge of the glyph, positive inside the glyph.
+            // Pixels that are partially covered lie on the edge, their coverage provides a more accurate distance.
+            double distance;
+            if ((coverage[i] > 0) && (coverage[i] < 255))
+                distance = (coverage[i] / 255.0) - 0.5;
+            else if (coverage[i] >= 128)
+                distance = std::sqrt(distancesToOutside[i]) - 0.5;
+            else
+                distance = 0.5 - std::sqrt(distancesToInside[i]);
+
+            const double value = std::max(0.0, std::min(1.0, 0.5 + (distance / (2.0 * spread))));
+            rasterizedGlyph.pixels[i] = static_cast<std::uint8_t>(std::round(value * 255));
+        }
+
+        rasterizedGlyph.width = width;
+        rasterizedGlyph.height = height;
+        rasterizedGlyph.glyph.bounds.left -= static_cast<float>(spread);
+        rasterizedGlyph.glyph.bounds.top -= static_cast<float>(spread);
+        rasterizedGlyph.glyph.bounds.width = static_cast<float>(width);
+        rasterizedGlyph.glyph.bounds.height = static_cast<float>(height);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    BackendFontFreetype::Glyph BackendFontFreetype::insertGlyph(Page& page, const RasterizedGlyph& rasterizedGlyph)
+    {
+        Glyph glyph = rasterizedGlyph.glyph;
+        if ((rasterizedGlyph.width == 0) || (rasterizedGlyph.height == 0))
+            return glyph;
+
         // Find a good position for the new glyph into the texture.
         // We leave a small padding around characters, so that filtering doesn't pollute them with pixels from neighbors.
         const unsigned int padding = 2;
-        glyph.textureRect = findAvailableGlyphRect(bitmap.width + (2 * padding), bitmap.rows + (2 * padding));
+        glyph.textureRect = findAvailableGlyphRect(page, rasterizedGlyph.width + (2 * padding), rasterizedGlyph.height + (2 * padding), glyph.row);
+        if (glyph.textureRect.width == 0)
+        {
+            // The page is full. Point to a location that is always transparent (right below the white square at the top
+            // left corner of the page) so that nothing is drawn until space is freed and the glyph is loaded again.
+            glyph.textureRect = {3, 3, 0, 0};
+            glyph.noSpace = true;
+            return glyph;
+        }
+
         glyph.textureRect.left += padding;
         glyph.textureRect.top += padding;
         glyph.textureRect.width -= 2 * padding;
         glyph.textureRect.height -= 2 * padding;
 
-        // Extract the glyph's pixels from the bitmap
-        const std::uint8_t* glyphBitmapPixels = bitmap.buffer;
-        if (bitmap.pixel_mode == FT_PIXEL_MODE_MONO)
+        // Copy the glyph's pixels into the page. Only the alpha channel is stored, the color is always white.
+        for (unsigned int y = 0; y < rasterizedGlyph.height; ++y)
         {
-            // Pixels are 1 bit monochrome values
-            for (unsigned int y = 0; y < bitmap.rows; ++y)
+            std::memcpy(page.getPixelRow(glyph.textureRect.top + y) + glyph.textureRect.left,
+                        &rasterizedGlyph.pixels[static_cast<std::size_t>(y) * rasterizedGlyph.width],
+                        rasterizedGlyph.width);
+        }
+
+        // Mark the changed pixels so that they get copied to the texture
+        addDirtyRect(page, glyph.textureRect);
+        return glyph;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFontFreetype::mergePreloadedGlyphs(bool wait)
+    {
+        for (auto it = m_preloadedGlyphs.begin(); it != m_preloadedGlyphs.end();)
+        {
+            if (!wait && (it->wait_for(std::chrono::seconds(0)) != std::future_status::ready))
             {
-                for (unsigned int x = 0; x < bitmap.width; ++x)
-                {
-                    // The color channels remain white, just fill the alpha channel
-                    const std::size_t index = (glyph.textureRect.left + x) + (glyph.textureRect.top + y) * m_textureSize;
-                    m_pixels[index * 4 + 3] = ((glyphBitmapPixels[(static_cast<int>(y) * bitmap.pitch) + static_cast<int>(x / 8)]) & (1 << (7 - (x % 8)))) ? 255 : 0;
-                }
+                ++it;
+                continue;
+            }
+
+            const PreloadedGlyphs preloadedGlyphs = it->get();
+            it = m_preloadedGlyphs.erase(it);
+
+            Page& page = getPage(preloadedGlyphs.scaledCharacterSize);
+            for (const auto& rasterizedGlyph : preloadedGlyphs.glyphs)
+            {
+                const std::uint64_t glyphKey = constructGlyphKey(rasterizedGlyph.codePoint, preloadedGlyphs.scaledCharacterSize & ~distanceFieldPageFlag,
+                                                                 preloadedGlyphs.bold, preloadedGlyphs.scaledOutlineThickness);
+
+                // The glyph may have been loaded on this thread while the background thread was still busy
+                if (page.glyphs.find(glyphKey) == page.glyphs.end())
+                    page.glyphs.emplace(glyphKey, insertGlyph(page, rasterizedGlyph));
             }
         }
-        else
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    BackendFontFreetype::Glyph BackendFontFreetype::createPlaceholderGlyph(char32_t codePoint, unsigned int scaledCharacterSize, bool bold)
+    {
+        Glyph glyph;
+        glyph.pending = true;
+        glyph.textureRect = {3, 3, 0, 0}; // Location right below the white square that is always transparent
+
+        const unsigned int pixelSize = scaledCharacterSize & ~distanceFieldPageFlag;
+        if ((pixelSize != m_face->size->metrics.x_ppem) && (FT_Set_Pixel_Sizes(m_face, 0, pixelSize) != FT_Err_Ok))
+            return glyph;
+
+        // Reading the unhinted advance from the font is a lot faster than loading the glyph. It is rounded to whole pixels
+        // like the hinted advance, but it could still be a pixel off from the advance that the glyph has once it is loaded.
+        // Distance fields aren't hinted, so their advance is exact.
+        FT_Fixed advance;
+        if (FT_Get_Advance(m_face, FT_Get_Char_Index(m_face, static_cast<FT_ULong>(codePoint)), FT_LOAD_NO_HINTING, &advance) == 0)
+        {
+            glyph.advance = static_cast<float>(advance) / 65536.f; // Advance is in 16.16 fixed point format
+            if (!(scaledCharacterSize & distanceFieldPageFlag))
+                glyph.advance = std::round(glyph.advance);
+            if (bold)
+                glyph.advance += 1; // Same boldWeight as in rasterizeGlyph
+        }
+
+        return glyph;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFontFreetype::mergeLoadedGlyphs()
+    {
+        std::vector<GlyphRequest> loadedGlyphs;
         {
-            // Pixels are 8 bits gray levels
-            for (unsigned int y = 0; y < bitmap.rows; ++y)
+            const std::lock_guard<std::mutex> lock(m_glyphLoadingMutex);
+            loadedGlyphs.swap(m_loadedGlyphs);
+        }
+
+        bool placeholdersReplaced = false;
+        for (const auto& request : loadedGlyphs)
+        {
+            TGUI_ASSERT(m_pendingGlyphCount > 0, "Every loaded glyph has to belong to a request");
+            --m_pendingGlyphCount;
+
+            // The placeholder no longer exists if the page was cleared or removed while the glyph was being rasterized.
+            // The glyph will be requested again in that case.
+            const auto pageIt = m_pages.find(request.scaledCharacterSize);
+            if (pageIt == m_pages.end())
+                continue;
+
+            Page& page = pageIt->second;
+            const auto glyphIt = page.glyphs.find(request.glyphKey);
+            if ((glyphIt == page.glyphs.end()) || !glyphIt->second.pending)
+                continue;
+
+            glyphIt->second = request.rasterized ? insertGlyph(page, request.rasterizedGlyph) : Glyph{};
+
+            // Texts only rebuild their vertices when the texture version changes, which doesn't happen when the glyph
+            // is merely copied to the existing texture.
+            page.textureVersion = ++m_textureVersion;
+            placeholdersReplaced = true;
+        }
+
+        // Text may have been measured with the estimated advances of the placeholders
+        if (placeholdersReplaced)
+            GlyphRunCache::removeFont(this);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFontFreetype::runGlyphLoadingThread()
+    {
+        // FreeType objects can't be shared between threads, so each worker creates its own face from the font data.
+        // The data remains valid while the thread runs, as cleanup() stops the threads before the data is released.
+        FT_Library library = nullptr;
+        FT_Face face = nullptr;
+        FT_Stroker stroker = nullptr;
+        if (FT_Init_FreeType(&library) != 0)
+            library = nullptr;
+        else if (FT_New_Memory_Face(library, static_cast<const FT_Byte*>(m_fileContents.get()), static_cast<FT_Long>(m_fileSize), 0, &face) != 0)
+            face = nullptr;
+        else if (FT_Select_Charmap(face, FT_ENCODING_UNICODE) != 0)
+        {
+            FT_Done_Face(face);
+            face = nullptr;
+        }
+
+        std::unique_lock<std::mutex> lock(m_glyphLoadingMutex);
+        while (true)
+        {
+            m_glyphLoadingCondition.wait(lock, [this]{ return m_stopGlyphLoadingThreads || !m_glyphRequests.empty(); });
+            if (m_stopGlyphLoadingThreads)
+                break;
+
+            GlyphRequest request = std::move(m_glyphRequests.front());
+            m_glyphRequests.pop_front();
+            lock.unlock();
+
+            // If the face couldn't be created then the result is still returned, so that the placeholder gets replaced
+            if (face)
             {
-                for (unsigned int x = 0; x < bitmap.width; ++x)
-                {
-                    // The color channels remain white, just fill the alpha channel
-                    const std::size_t index = (glyph.textureRect.left + x) + (glyph.textureRect.top + y) * m_textureSize;
-                    m_pixels[index * 4 + 3] = glyphBitmapPixels[(static_cast<int>(y) * bitmap.pitch) + static_cast<int>(x)];
-                }
+                request.rasterized = rasterizeGlyph(library, face, stroker, request.codePoint, request.scaledCharacterSize,
+                                                    request.bold, request.scaledOutlineThickness, request.rasterizedGlyph);
             }
+
+            lock.lock();
+            m_loadedGlyphs.push_back(std::move(request));
         }
+        lock.unlock();
 
-        // We will have to recreate the texture now that the pixels changed
-        m_texture = nullptr;
+        if (stroker)
+            FT_Stroker_Done(stroker);
+        if (face)
+            FT_Done_Face(face);
+        if (library)
+            FT_Done_FreeType(library);
+    }
 
-        FT_Done_Glyph(glyphDesc);
-        return glyph;
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFontFreetype::stopGlyphLoadingThreads()
+    {
+        if (m_glyphLoadingThreads.empty())
+            return;
+
+        {
+            const std::lock_guard<std::mutex> lock(m_glyphLoadingMutex);
+            m_stopGlyphLoadingThreads = true;
+        }
+        m_glyphLoadingCondition.notify_all();
+
+        for (auto& thread : m_glyphLoadingThreads)
+            thread.join();
+
+        m_glyphLoadingThreads.clear();
+        m_stopGlyphLoadingThreads = false;
+
+        // Keep the glyphs that were finished and remove the placeholders of the others, so that they get loaded again
+        mergeLoadedGlyphs();
+        bool placeholdersRemoved = false;
+        for (const auto& request : m_glyphRequests)
+        {
+            const auto pageIt = m_pages.find(request.scaledCharacterSize);
+            if (pageIt == m_pages.end())
+                continue;
+
+            Page& page = pageIt->second;
+            const auto glyphIt = page.glyphs.find(request.glyphKey);
+            if ((glyphIt == page.glyphs.end()) || !glyphIt->second.pending)
+                continue;
+
+            page.glyphs.erase(glyphIt);
+            page.textureVersion = ++m_textureVersion;
+            placeholdersRemoved = true;
+        }
+
+        m_glyphRequests.clear();
+        m_pendingGlyphCount = 0;
+
+        if (placeholdersRemoved)
+            GlyphRunCache::removeFont(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     BackendFontFreetype::Glyph BackendFontFreetype::getInternalGlyph(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness)
     {
-        const std::uint64_t glyphKey = constructGlyphKey(codePoint, static_cast<unsigned int>(characterSize * m_fontScale),
-                                                         bold, outlineThickness * m_fontScale);
+        if (!m_preloadedGlyphs.empty())
+            mergePreloadedGlyphs(false);
+        if (m_pendingGlyphCount > 0)
+            mergeLoadedGlyphs();
+
+        // With distance fields the page key differs from the size, but keys of glyphs only have to be unique within a page
+        const unsigned int scaledCharacterSize = getPageKey(characterSize);
+        const float scaledOutlineThickness = (m_distanceFieldSize > 0) ? (outlineThickness / getGlyphScale(characterSize)) : (outlineThickness * m_fontScale);
+        const std::uint64_t glyphKey = constructGlyphKey(codePoint, scaledCharacterSize & ~distanceFieldPageFlag, bold, scaledOutlineThickness);
+
+        Page& page = getPage(scaledCharacterSize);
+        page.glyphsRequested = true;
+
+        const auto it = page.glyphs.find(glyphKey);
+        if (it != page.glyphs.end())
+        {
+            // Remember that the row is still used, so that it doesn't get cleared when the page runs out of space
+            if (it->second.textureRect.width > 0)
+                page.rows[it->second.row].lastUsed = page.lastUsed;
 
-        const auto it = m_glyphs.find(glyphKey);
-        if (it != m_glyphs.end())
             return it->second;
+        }
 
-        const Glyph glyph = loadGlyph(codePoint, characterSize, bold, outlineThickness);
-        return m_glyphs.insert({glyphKey, glyph}).first->second;
+        // Let a worker thread rasterize the glyph and return a placeholder until it is finished
+        if (m_face && (m_glyphLoadingThreadCount > 0))
+        {
+            if (m_glyphLoadingThreads.empty())
+            {
+                for (unsigned int i = 0; i < m_glyphLoadingThreadCount; ++i)
+                    m_glyphLoadingThreads.emplace_back(&BackendFontFreetype::runGlyphLoadingThread, this);
+            }
+
+            GlyphRequest request;
+            request.glyphKey = glyphKey;
+            request.codePoint = codePoint;
+            request.scaledCharacterSize = scaledCharacterSize;
+            request.bold = bold;
+            request.scaledOutlineThickness = scaledOutlineThickness;
+            {
+                const std::lock_guard<std::mutex> lock(m_glyphLoadingMutex);
+                m_glyphRequests.push_back(std::move(request));
+            }
+            m_glyphLoadingCondition.notify_one();
+            ++m_pendingGlyphCount;
+
+            return page.glyphs.insert({glyphKey, createPlaceholderGlyph(codePoint, scaledCharacterSize, bold)}).first->second;
+        }
+
+        const Glyph glyph = loadGlyph(page, codePoint, scaledCharacterSize, bold, scaledOutlineThickness);
+        return page.glyphs.insert({glyphKey, glyph}).first->second;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    UIntRect BackendFontFreetype::findAvailableGlyphRect(unsigned int width, unsigned int height)
+    UIntRect BackendFontFreetype::findAvailableGlyphRect(Page& page, unsigned int width, unsigned int height, unsigned int& rowIndex)
     {
         // Find the line that where the glyph fits well.
         // This is based on the sf::Font class in the SFML library. It might not be the most optimal method, but it is good enough for now.
         Row* bestRow = nullptr;
         float bestRatio = 0;
-        for (auto& row : m_rows)
+        for (auto& row : page.rows)
         {
             float ratio = static_cast<float>(height) / row.height;
 
@@ -516,7 +1463,7 @@ namespace tgui
                 continue;
 
             // Check if there's enough horizontal space left in the row
-            if (width > m_textureSize - row.width)
+            if (width > page.blockSize - row.width)
                 continue;
 
             // Make sure that this new row is the best found so far
@@ -531,47 +1478,50 @@ namespace tgui
         // If we didn't find a matching row, create a new one (10% taller than the glyph)
         if (!bestRow)
         {
-            // Check if the glyph can fit in the texture and resize the texture otherwise
+            const unsigned int maxTextureSize = getMaximumTextureSize();
             const unsigned int rowHeight = height + (height / 10);
-            while ((m_nextRow + rowHeight >= m_textureSize) || (width >= m_textureSize))
+
+            // Add blocks below the existing ones until the row fits, the pixels that are already stored don't have to move.
+            // Other character sizes may have to be removed to stay within the memory limit.
+            bool rowFits = (width < page.blockSize) || widenPage(page, width);
+            while (rowFits && (page.nextRow + rowHeight >= page.getHeight()))
             {
-                /// TODO: Check if maximum texture size is reached and use multiple textures if there isn't enough space left
+                const std::size_t blockBytes = static_cast<std::size_t>(page.blockSize) * page.blockSize;
+                if ((page.getHeight() + page.blockSize > maxTextureSize) || !evictPages(blockBytes, &page))
+                {
+                    rowFits = false;
+                    break;
+                }
 
-                // Copy existing pixels to the top left quadrant
-                auto pixels = MakeUniqueForOverwrite<std::uint8_t[]>((m_textureSize * 2) * (m_textureSize * 2) * 4);
-                for (unsigned int y = 0; y < m_textureSize; ++y)
-                    std::memcpy(&pixels[y * (2 * m_textureSize) * 4], &m_pixels[y * m_textureSize * 4], m_textureSize * 4);
+                page.blocks.push_back(std::make_unique<std::uint8_t[]>(blockBytes));
 
-                // Top right quadrant and bottom halves are filled with empty values
-                // Color is always white, alpha channel contains whether the pixel is empty of not
-                for (unsigned int y = 0; y < m_textureSize; ++y)
+                // The texture has to be recreated with the new size
+                page.texture = nullptr;
+                page.dirtyRect = {};
+            }
+
+            if (rowFits)
+            {
+                page.rows.emplace_back(page.nextRow, rowHeight);
+                page.nextRow += rowHeight;
+                bestRow = &page.rows.back();
+            }
+            else
+            {
+                // The page can't grow, so use the smallest empty row that is high enough.
+                // If there is none then the page is full and the rows that are no longer used will be cleared later.
+                for (auto& row : page.rows)
                 {
-                    std::uint8_t* pixelPtr = &pixels[((y * (2 * m_textureSize)) + m_textureSize) * 4];
-                    for (unsigned int i = 0; i < m_textureSize; ++i)
-                    {
-                        *pixelPtr++ = 255;
-                        *pixelPtr++ = 255;
-                        *pixelPtr++ = 255;
-                        *pixelPtr++ = 0;
-                    }
+                    if ((row.width == 0) && (height <= row.height) && (width <= page.blockSize) && (!bestRow || (row.height < bestRow->height)))
+                        bestRow = &row;
                 }
-                std::uint8_t* pixelPtr = &pixels[m_textureSize * (2 * m_textureSize) * 4];
-                for (unsigned int i = 0; i < (2 * m_textureSize) * m_textureSize; ++i)
+
+                if (!bestRow)
                 {
-                    *pixelPtr++ = 255;
-                    *pixelPtr++ = 255;
-                    *pixelPtr++ = 255;
-                    *pixelPtr++ = 0;
+                    page.full = true;
+                    return {};
                 }
-
-                m_pixels = std::move(pixels);
-                m_textureSize *= 2;
             }
-
-            // We can now create the new row
-            m_rows.emplace_back(m_nextRow, rowHeight);
-            m_nextRow += rowHeight;
-            bestRow = &m_rows.back();
         }
 
         // Find the glyph's rectangle on the selected row
@@ -579,11 +1529,261 @@ namespace tgui
 
         // Update the row informations
         bestRow->width += width;
+        bestRow->lastUsed = page.lastUsed;
+        rowIndex = static_cast<unsigned int>(bestRow - page.rows.data());
         return rect;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    BackendFontFreetype::Page& BackendFontFreetype::getPage(unsigned int scaledCharacterSize)
+    {
+        auto it = m_pages.find(scaledCharacterSize);
+        if (it == m_pages.end())
+        {
+            Page page;
+            resetPage(page, scaledCharacterSize);
+
+            // The new page is created even if it doesn't fit within the memory limit
+            evictPages(page.getByteCount(), nullptr);
+            it = m_pages.emplace(scaledCharacterSize, std::move(page)).first;
+        }
+
+        it->second.lastUsed = ++m_pageUseCounter;
+        return it->second;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFontFreetype::resetPage(Page& page, unsigned int scaledCharacterSize)
+    {
+        // The blocks are made wide enough for glyphs that are twice as wide as the character size, so that pages of large
+        // character sizes rarely have to be widened.
+        const unsigned int maxTextureSize = getMaximumTextureSize();
+        unsigned int blockSize = initialPageSize;
+        while ((blockSize < 2 * (scaledCharacterSize & ~distanceFieldPageFlag)) && (blockSize * 2 <= maxTextureSize))
+            blockSize *= 2;
+
+        page.glyphs.clear();
+        page.rows.clear();
+        page.nextRow = 3; // First 2 rows contain pixels for underlining
+        page.full = false;
+        page.glyphsRequested = false;
+        page.scanStart = 0;
+        page.texture = nullptr;
+        page.dirtyRect = {};
+        page.blockSize = blockSize;
+        page.blocks.clear();
+        page.blocks.push_back(std::make_unique<std::uint8_t[]>(static_cast<std::size_t>(blockSize) * blockSize));
+
+        // Reserve a 2x2 white square in the top left corner of the texture that we can use for drawing an underline
+        for (unsigned int y = 0; y < 2; ++y)
+        {
+            for (unsigned int x = 0; x < 2; ++x)
+                page.getPixelRow(y)[x] = 255;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendFontFreetype::widenPage(Page& page, unsigned int minWidth)
+    {
+        unsigned int blockSize = page.blockSize * 2;
+        while (blockSize <= minWidth)
+            blockSize *= 2;
+
+        const unsigned int height = page.getHeight();
+        const std::size_t blockCount = (height + blockSize - 1) / blockSize;
+        const std::size_t blockBytes = static_cast<std::size_t>(blockSize) * blockSize;
+        if ((blockSize > getMaximumTextureSize()) || !evictPages((blockCount * blockBytes) - page.getByteCount(), &page))
+            return false;
+
+        // The pixels have to be copied to the wider blocks, but this is only needed for exceptionally wide glyphs
+        std::vector<std::unique_ptr<std::uint8_t[]>> blocks;
+        for (std::size_t i = 0; i < blockCount; ++i)
+            blocks.push_back(std::make_unique<std::uint8_t[]>(blockBytes));
+        for (unsigned int y = 0; y < height; ++y)
+            std::memcpy(&blocks[y / blockSize][static_cast<std::size_t>(y % blockSize) * blockSize], page.getPixelRow(y), page.blockSize);
+
+        page.blocks = std::move(blocks);
+        page.blockSize = blockSize;
+
+        // The texture has to be recreated with the new size
+        page.texture = nullptr;
+        page.dirtyRect = {};
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendFontFreetype::clearUnusedRows(Page& page)
+    {
+        std::vector<bool> clearedRows(page.rows.size(), false);
+        bool rowsCleared = false;
+        for (std::size_t i = 0; i < page.rows.size(); ++i)
+        {
+            Row& row = page.rows[i];
+            if ((row.width == 0) || (row.lastUsed > page.scanStart))
+                continue;
+
+            // Remove the old pixels, the padding around new glyphs has to be transparent
+            for (unsigned int y = row.top; y < row.top + row.height; ++y)
+                std::memset(page.getPixelRow(y), 0, row.width);
+
+            addDirtyRect(page, {0, row.top, row.width, row.height});
+            row.width = 0;
+            clearedRows[i] = true;
+            rowsCleared = true;
+        }
+
+        if (!rowsCleared)
+            return false;
+
+        // Glyphs that didn't fit are also removed, so that they are loaded again and placed in the cleared rows
+        for (auto it = page.glyphs.begin(); it != page.glyphs.end();)
+        {
+            const Glyph& glyph = it->second;
+            if (glyph.noSpace || ((glyph.textureRect.width > 0) && clearedRows[glyph.row]))
+                it = page.glyphs.erase(it);
+            else
+                ++it;
+        }
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendFontFreetype::evictPages(std::size_t extraBytes, const Page* pageInUse)
+    {
+        if (m_atlasMemoryLimit == 0)
+            return true;
+
+        while (getAtlasMemoryUsage() + extraBytes > m_atlasMemoryLimit)
+        {
+            auto leastRecentlyUsedIt = m_pages.end();
+            for (auto it = m_pages.begin(); it != m_pages.end(); ++it)
+            {
+                if (&it->second == pageInUse)
+                    continue;
+
+                if ((leastRecentlyUsedIt == m_pages.end()) || (it->second.lastUsed < leastRecentlyUsedIt->second.lastUsed))
+                    leastRecentlyUsedIt = it;
+            }
+
+            if (leastRecentlyUsedIt == m_pages.end())
+                return false;
+
+            m_pages.erase(leastRecentlyUsedIt);
+        }
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::uint8_t* BackendFontFreetype::getRegionPixels(const Page& page, UIntRect region, bool alphaOnly, std::vector<std::uint8_t>& buffer)
+    {
+        // Rows that span the entire page are already stored contiguously when they are part of the same block
+        if (alphaOnly && (region.width == page.blockSize) && (region.top / page.blockSize == (region.top + region.height - 1) / page.blockSize))
+            return page.getPixelRow(region.top);
+
+        const std::size_t bytesPerPixel = alphaOnly ? 1 : 4;
+        buffer.resize(static_cast<std::size_t>(region.width) * region.height * bytesPerPixel);
+        std::uint8_t* dstPtr = buffer.data();
+        for (unsigned int y = 0; y < region.height; ++y)
+        {
+            const std::uint8_t* srcPtr = page.getPixelRow(region.top + y) + region.left;
+            if (alphaOnly)
+            {
+                std::memcpy(dstPtr, srcPtr, region.width);
+                dstPtr += region.width;
+            }
+            else
+            {
+                // Color is always white, alpha channel contains whether the pixel is empty of not
+                for (unsigned int x = 0; x < region.width; ++x)
+                {
+                    *dstPtr++ = 255;
+                    *dstPtr++ = 255;
+                    *dstPtr++ = 255;
+                    *dstPtr++ = srcPtr[x];
+                }
+            }
+        }
+
+        return buffer.data();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFontFreetype::addDirtyRect(Page& page, UIntRect rect)
+    {
+        if ((page.dirtyRect.width > 0) && (page.dirtyRect.height > 0))
+        {
+            const unsigned int right = std::max(page.dirtyRect.left + page.dirtyRect.width, rect.left + rect.width);
+            const unsigned int bottom = std::max(page.dirtyRect.top + page.dirtyRect.height, rect.top + rect.height);
+            page.dirtyRect.left = std::min(page.dirtyRect.left, rect.left);
+            page.dirtyRect.top = std::min(page.dirtyRect.top, rect.top);
+            page.dirtyRect.width = right - page.dirtyRect.left;
+            page.dirtyRect.height = bottom - page.dirtyRect.top;
+        }
+        else
+            page.dirtyRect = rect;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    BackendFontFreetype::MetricsTable& BackendFontFreetype::getMetricsTable(unsigned int characterSize, bool bold)
+    {
+        const unsigned int key = (characterSize * 2) + (bold ? 1 : 0);
+        if (m_lastMetricsTable && (m_lastMetricsTableKey == key))
+            return *m_lastMetricsTable;
+
+        auto it = m_metricsTables.find(key);
+        if (it == m_metricsTables.end())
+        {
+            it = m_metricsTables.emplace(key, MetricsTable{}).first;
+            it->second.advances.resize(denseTableSize, std::numeric_limits<float>::quiet_NaN());
+            it->second.kernings.resize(denseTableSize);
+        }
+
+        // Pointers to elements of an unordered_map remain valid until the element is erased
+        m_lastMetricsTableKey = key;
+        m_lastMetricsTable = &it->second;
+        return it->second;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFontFreetype::clearMetricsTables()
+    {
+        m_metricsTables.clear();
+        m_lastMetricsTable = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int BackendFontFreetype::getPageKey(unsigned int characterSize) const
+    {
+        if (m_distanceFieldSize > 0)
+            return m_distanceFieldSize | distanceFieldPageFlag;
+        else
+            return static_cast<unsigned int>(characterSize * m_fontScale);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float BackendFontFreetype::getGlyphScale(unsigned int characterSize) const
+    {
+        if (m_distanceFieldSize > 0)
+            return static_cast<float>(characterSize) / static_cast<float>(m_distanceFieldSize);
+        else
+            return 1 / m_fontScale;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool BackendFontFreetype::setCurrentSize(unsigned int characterSize)
     {
         unsigned int scaledCharacterSize = static_cast<unsigned int>(characterSize * m_fontScale);
@@ -597,8 +1797,29 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::uint64_t BackendFontFreetype::getFontDataHash() const
+    {
+        // 64-bit FNV-1a hash
+        std::uint64_t hash = 14695981039346656037ull;
+        for (std::size_t i = 0; i < m_fileSize; ++i)
+        {
+            hash ^= m_fileContents[i];
+            hash *= 1099511628211ull;
+        }
+
+        return hash;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendFontFreetype::cleanup()
     {
+        // Background threads may still be reading the font data
+        stopGlyphLoadingThreads();
+        for (auto& preloadedGlyphs : m_preloadedGlyphs)
+            preloadedGlyphs.wait();
+        m_preloadedGlyphs.clear();
+
         if (m_stroker)
             FT_Stroker_Done(m_stroker);
 
@@ -29,6 +29,7 @@
     import tgui;
 #else
     #include <TGUI/Backend/Window/Backend.hpp>
+    #include <TGUI/GlyphRunCache.hpp>
 #endif
 
 #include <cassert>
@@ -52,6 +53,7 @@ namespace tgui
 
     bool BackendFontSDLttf::loadFromMemory(std::unique_ptr<std::uint8_t[]> data, std::size_t sizeInBytes)
     {
+        GlyphRunCache::removeFont(this);
         m_glyphs.clear();
         m_rows.clear();
         m_pixels = nullptr;
@@ -29,6 +29,7 @@
     import tgui;
 #else
     #include <TGUI/Backend/Window/Backend.hpp>
+    #include <TGUI/GlyphRunCache.hpp>
 #endif
 
 #include <SFML/Config.hpp>
@@ -44,6 +45,7 @@ namespace tgui
 
     bool BackendFontSFML::loadFromMemory(std::unique_ptr<std::uint8_t[]> data, std::size_t sizeInBytes)
     {
+        GlyphRunCache::removeFont(this);
         m_textures.clear();
         m_textureVersions.clear();
 
@@ -25,7 +25,7 @@
 
 #include <TGUI/Backend/Renderer/BackendRenderTarget.hpp>
 #include <TGUI/Backend/Renderer/BackendText.hpp>
-#include <TGUI/Widget.hpp>
+#include <TGUI/Container.hpp>
 
 #include <cassert>
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
@@ -175,6 +175,20 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void BackendRenderTarget::setClearColor(const Color& color)
+    {
+        m_clearColor = color;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Color BackendRenderTarget::getClearColor() const
+    {
+        return m_clearColor;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendRenderTarget::setView(FloatRect view, FloatRect viewport, Vector2f targetSize)
     {
         TGUI_ASSERT(m_clipLayers.empty(), "You can't change the view of the render target during drawing");
@@ -199,6 +213,17 @@ namespace tgui
         RenderStates statesWithRoundedPos = states;
         statesWithRoundedPos.transform.roundPosition(m_pixelsPerPoint.x, m_pixelsPerPoint.y);
 
+        // Containers that cache their contents in a texture are drawn by the container itself
+        if (widget->isContainer())
+        {
+            const auto& container = static_cast<const Container&>(*widget);
+            if (container.isRenderCacheEnabled() && !isRenderingToTexture())
+            {
+                container.drawWithRenderCache(*this, statesWithRoundedPos);
+                return;
+            }
+        }
+
         widget->draw(*this, statesWithRoundedPos);
     }
 
@@ -363,14 +388,19 @@ namespace tgui
         // Round the text to the nearest pixel to try to avoid blurry text
         transformedStates.transform.roundPosition(m_pixelsPerPoint.x, m_pixelsPerPoint.y);
 
-        auto vertexData = text.getBackendText()->getVertexData();
+        // The vertices are read directly from the text, so that no memory has to be allocated while drawing
+        BackendText& backendText = *text.getBackendText();
+        const std::shared_ptr<BackendTexture>& texture = backendText.prepareVertices();
+        if (!texture)
+            return;
 
-        for (const auto& data : vertexData)
-        {
-            const std::shared_ptr<BackendTexture>& texture = data.first;
-            const std::shared_ptr<std::vector<Vertex>>& vertices = data.second;
-            drawVertexArray(transformedStates, vertices->data(), vertices->size(), nullptr, 0, texture);
-        }
+        const std::vector<Vertex>& outlineVertices = backendText.getOutlineVertices();
+        if (!outlineVertices.empty())
+            drawVertexArray(transformedStates, outlineVertices.data(), outlineVertices.size(), nullptr, 0, texture);
+
+        const std::vector<Vertex>& vertices = backendText.getVertices();
+        if (!vertices.empty())
+            drawVertexArray(transformedStates, vertices.data(), vertices.size(), nullptr, 0, texture);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -444,6 +474,105 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendRenderTarget::beginRenderToTexture(std::shared_ptr<Widget>& canvas, Vector2f size, Vector2u pixelSize)
+    {
+        if (m_renderCanvas || (size.x <= 0) || (size.y <= 0) || (pixelSize.x == 0) || (pixelSize.y == 0))
+            return false;
+
+        // Store the state of the screen so that it can be restored in endRenderToTexture
+        m_screenViewRect = m_viewRect;
+        m_screenViewport = m_viewport;
+        m_screenTargetSize = m_targetSize;
+        m_screenPixelsPerPoint = m_pixelsPerPoint;
+        m_screenClipLayers = std::move(m_clipLayers);
+        m_clipLayers.clear();
+
+        m_viewRect = {{0, 0}, size};
+        m_viewport = {{0, 0}, Vector2f{pixelSize}};
+        m_targetSize = Vector2f{pixelSize};
+        m_pixelsPerPoint = {m_viewport.width / m_viewRect.width, m_viewport.height / m_viewRect.height};
+
+        if (!bindRenderTexture(canvas, pixelSize) || !canvas)
+        {
+            m_viewRect = m_screenViewRect;
+            m_viewport = m_screenViewport;
+            m_targetSize = m_screenTargetSize;
+            m_pixelsPerPoint = m_screenPixelsPerPoint;
+            m_clipLayers = std::move(m_screenClipLayers);
+            return false;
+        }
+
+        m_renderCanvas = canvas;
+        updateClipping(m_viewRect, m_viewport);
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTarget::endRenderToTexture()
+    {
+        TGUI_ASSERT(m_renderCanvas, "BackendRenderTarget::endRenderToTexture can only be called after beginRenderToTexture returned true");
+        TGUI_ASSERT(m_clipLayers.empty(), "Every clipping layer added while drawing to a texture must be removed before calling endRenderToTexture");
+
+        m_viewRect = m_screenViewRect;
+        m_viewport = m_screenViewport;
+        m_targetSize = m_screenTargetSize;
+
+        const std::shared_ptr<Widget> canvas = std::move(m_renderCanvas);
+        m_renderCanvas = nullptr;
+        unbindRenderTexture(canvas);
+
+        m_clipLayers = std::move(m_screenClipLayers);
+        m_screenClipLayers.clear();
+        if (m_clipLayers.empty())
+            updateClipping(m_viewRect, m_viewport);
+        else
+            updateClipping(m_clipLayers.back().first, m_clipLayers.back().second);
+
+        // The clipping functions reset the value when the entire screen is clipped, but we want to restore the original value
+        m_pixelsPerPoint = m_screenPixelsPerPoint;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendRenderTarget::isRenderingToTexture() const
+    {
+        return m_renderCanvas != nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Vector2u BackendRenderTarget::mapSizeToPixels(Vector2f size) const
+    {
+        return {static_cast<unsigned int>(std::max(0.f, std::ceil(size.x * m_pixelsPerPoint.x))),
+                static_cast<unsigned int>(std::max(0.f, std::ceil(size.y * m_pixelsPerPoint.y)))};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTarget::drawRenderTexture(const RenderStates& states, Vector2f size, Vector2u pixelSize, const std::shared_ptr<Widget>& canvas)
+    {
+        // The canvas has one pixel per unit, so it has to be scaled to the size of the area that was drawn to it
+        RenderStates canvasStates = states;
+        canvasStates.transform.scale({size.x / static_cast<float>(pixelSize.x), size.y / static_cast<float>(pixelSize.y)});
+        canvas->draw(*this, canvasStates);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendRenderTarget::bindRenderTexture(std::shared_ptr<Widget>&, Vector2u)
+    {
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTarget::unbindRenderTexture(const std::shared_ptr<Widget>&)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Backend/Renderer/BackendText.hpp>
+#include <TGUI/GlyphRunCache.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <cmath>
@@ -93,10 +94,9 @@ namespace tgui
         if (m_verticesNeedUpdate)
             return;
 
-        TGUI_ASSERT(m_vertices != nullptr, "m_vertices should have already been created if m_verticesNeedUpdate is false");
         const Vertex::Color vertexColor(color);
-        for (std::size_t i = 0; i < m_vertices->size(); ++i)
-            (*m_vertices)[i].color = vertexColor;
+        for (auto& vertex : m_vertices)
+            vertex.color = vertexColor;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -120,12 +120,9 @@ namespace tgui
         if (m_verticesNeedUpdate)
             return;
 
-        if (m_outlineVertices)
-        {
-            const Vertex::Color vertexColor(color);
-            for (std::size_t i = 0; i < m_outlineVertices->size(); ++i)
-                (*m_outlineVertices)[i].color = vertexColor;
-        }
+        const Vertex::Color vertexColor(color);
+        for (auto& vertex : m_outlineVertices)
+            vertex.color = vertexColor;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -199,52 +196,67 @@ namespace tgui
         if (index > m_string.length())
             index = m_string.length();
 
-        const bool isBold           = static_cast<unsigned int>(m_style) & TextStyle::Bold;
-        const float whitespaceWidth = m_font->getGlyph(U' ', m_characterSize, isBold).advance;
-        const float lineSpacing     = m_font->getLineSpacing(m_characterSize);
+        // The horizontal position is found in the glyph run, only the lines need to be counted
+        const bool isBold = static_cast<unsigned int>(m_style) & TextStyle::Bold;
+        const auto run = GlyphRunCache::getGlyphRun(m_string, *m_font, m_characterSize, isBold);
 
-        Vector2f position;
-        char32_t prevChar = 0;
+        Vector2f position{run->positions[index], 0};
+        const float lineSpacing = m_font->getLineSpacing(m_characterSize);
         for (std::size_t i = 0; i < index; ++i)
         {
-            const char32_t curChar = m_string[i];
+            if (m_string[i] == U'\n')
+                position.y += lineSpacing;
+        }
 
-            // Skip the carriage return character as we will pretend it isn't there
-            if (curChar == U'\r')
-                continue;
+        return position;
+    }
 
-            // Apply the kerning offset
-            position.x += m_font->getKerning(prevChar, curChar, m_characterSize, isBold);
-            prevChar = curChar;
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            // Handle special characters
-            switch (curChar)
-            {
-                case ' ':  position.x += whitespaceWidth;             continue;
-                case '\t': position.x += whitespaceWidth * 4;         continue;
-                case '\n': position.y += lineSpacing; position.x = 0; continue;
-            }
+    const BackendText::TextVertexData& BackendText::getVertexData()
+    {
+        m_vertexData.clear();
+
+        const std::shared_ptr<BackendTexture>& texture = prepareVertices();
+        if (!texture)
+            return m_vertexData;
+
+        // The vectors are only created once, assigning the vertices to them reuses their memory
+        if (!m_outlineVertices.empty())
+        {
+            if (!m_vertexDataOutlineVertices)
+                m_vertexDataOutlineVertices = std::make_shared<std::vector<Vertex>>();
 
-            // For regular characters, add the advance offset of the glyph
-            position.x += m_font->getGlyph(curChar, m_characterSize, isBold).advance;
+            *m_vertexDataOutlineVertices = m_outlineVertices;
+            m_vertexData.emplace_back(texture, m_vertexDataOutlineVertices);
         }
 
-        return position;
+        if (!m_vertices.empty())
+        {
+            if (!m_vertexDataVertices)
+                m_vertexDataVertices = std::make_shared<std::vector<Vertex>>();
+
+            *m_vertexDataVertices = m_vertices;
+            m_vertexData.emplace_back(texture, m_vertexDataVertices);
+        }
+
+        return m_vertexData;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    BackendText::TextVertexData BackendText::getVertexData()
+    const std::shared_ptr<BackendTexture>& BackendText::prepareVertices()
     {
-        BackendText::TextVertexData data;
-
         if (!m_font)
-            return data;
+        {
+            m_texture = nullptr;
+            return m_texture;
+        }
 
         unsigned int textureVersion;
-        auto texture = m_font->getTexture(m_characterSize, textureVersion);
-        if (!texture)
-            return data;
+        m_texture = m_font->getTexture(m_characterSize, textureVersion);
+        if (!m_texture)
+            return m_texture;
 
         // If the font texture changes then we need to update the texture coordinates
         if (textureVersion != m_lastFontTextureVersion)
@@ -255,16 +267,24 @@ namespace tgui
             updateVertices();
 
             // It is possible that the texture changes during the update
-            texture = m_font->getTexture(m_characterSize, m_lastFontTextureVersion);
+            m_texture = m_font->getTexture(m_characterSize, m_lastFontTextureVersion);
         }
 
-        if (m_outlineVertices && !m_outlineVertices->empty())
-            data.emplace_back(texture, m_outlineVertices);
+        return m_texture;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::vector<Vertex>& BackendText::getVertices() const
+    {
+        return m_vertices;
+    }
 
-        if (m_vertices && !m_vertices->empty())
-            data.emplace_back(texture, m_vertices);
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        return data;
+    const std::vector<Vertex>& BackendText::getOutlineVertices() const
+    {
+        return m_outlineVertices;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -276,19 +296,19 @@ namespace tgui
 
         m_verticesNeedUpdate = false;
 
-        if (!m_vertices)
-            m_vertices = std::make_shared<std::vector<Vertex>>();
-        if (!m_outlineVertices && (m_outlineThickness != 0))
-            m_outlineVertices = std::make_shared<std::vector<Vertex>>();
-
+        // The vectors are cleared instead of recreated, so that the memory is reused when the text changes
         m_size = {0, 0};
-        m_vertices->clear();
-        if (m_outlineVertices)
-            m_outlineVertices->clear();
+        m_vertices.clear();
+        m_outlineVertices.clear();
 
         if (m_characterSize == 0)
             return;
 
+        // Each character needs at most one quad, only the underline and strike through lines can add more
+        m_vertices.reserve(m_string.length() * 6);
+        if (m_outlineThickness != 0)
+            m_outlineVertices.reserve(m_string.length() * 6);
+
         const Vertex::Color vertexFillColor(m_fillColor);
         const Vertex::Color vertexOutlineColor(m_outlineColor);
 
@@ -307,40 +327,45 @@ namespace tgui
         const float strikeThroughOffset = isStrikeThrough ? (xBounds.top + (xBounds.height / 2.f)) : 0.f;
 
         // Precompute the variables needed by the algorithm
-        const float whitespaceWidth = m_font->getGlyph(U' ', m_characterSize, isBold).advance;
+        const float whitespaceWidth = m_font->getGlyphAdvance(U' ', m_characterSize, isBold);
         const float lineSpacing = m_font->getLineSpacing(m_characterSize);
         float x = m_outlineThickness;
         float y = m_font->getAscent(m_characterSize) + m_outlineThickness;
 
+        // The kerning between the characters is taken from the glyph run, which is shared with other texts with the same string
+        const auto run = GlyphRunCache::getGlyphRun(m_string, *m_font, m_characterSize, isBold);
+
         // Create one quad for each character
         float maxX = 0.f;
         char32_t prevChar = 0;
         unsigned int nrLines = 1;
-        for (const char32_t curChar : m_string)
+        for (std::size_t i = 0; i < m_string.length(); ++i)
         {
+            const char32_t curChar = m_string[i];
+
             // Skip the carriage return character since we can't render it
             if (curChar == U'\r')
                 continue;
 
             // Apply the kerning offset
-            x += m_font->getKerning(prevChar, curChar, m_characterSize, isBold);
+            x += run->kernings[i];
 
             // If we're using the underlined style and there's a new line, draw a line
             if (isUnderlined && (curChar == U'\n' && prevChar != U'\n'))
             {
-                addLine(*m_vertices, x, y, vertexFillColor, underlineOffset, underlineThickness, 0, fontScale);
+                addLine(m_vertices, x, y, vertexFillColor, underlineOffset, underlineThickness, 0, fontScale);
 
                 if (m_outlineThickness != 0)
-                    addLine(*m_outlineVertices, x, y, vertexOutlineColor, underlineOffset, underlineThickness, m_outlineThickness, fontScale);
+                    addLine(m_outlineVertices, x, y, vertexOutlineColor, underlineOffset, underlineThickness, m_outlineThickness, fontScale);
             }
 
             // If we're using the strike through style and there's a new line, draw a line across all characters
             if (isStrikeThrough && (curChar == U'\n' && prevChar != U'\n'))
             {
-                addLine(*m_vertices, x, y, vertexFillColor, strikeThroughOffset, underlineThickness, 0, fontScale);
+                addLine(m_vertices, x, y, vertexFillColor, strikeThroughOffset, underlineThickness, 0, fontScale);
 
                 if (m_outlineThickness != 0)
-                    addLine(*m_outlineVertices, x, y, vertexOutlineColor, strikeThroughOffset, underlineThickness, m_outlineThickness, fontScale);
+                    addLine(m_outlineVertices, x, y, vertexOutlineColor, strikeThroughOffset, underlineThickness, m_outlineThickness, fontScale);
             }
 
             prevChar = curChar;
@@ -374,7 +399,7 @@ namespace tgui
                 float right  = glyph.bounds.left + glyph.bounds.width;
 
                 // Add the outline glyph to the vertices
-                addGlyphQuad(*m_outlineVertices, {x, y}, vertexOutlineColor, glyph, fontScale, italicShear);
+                addGlyphQuad(m_outlineVertices, {x, y}, vertexOutlineColor, glyph, fontScale, italicShear);
                 maxX = std::max(maxX, x + right - italicShear * top - m_outlineThickness);
             }
 
@@ -382,7 +407,7 @@ namespace tgui
             const auto& glyph = m_font->getGlyph(curChar, m_characterSize, isBold);
 
             // Add the glyph to the vertices
-            addGlyphQuad(*m_vertices, {x, y}, vertexFillColor, glyph, fontScale, italicShear);
+            addGlyphQuad(m_vertices, {x, y}, vertexFillColor, glyph, fontScale, italicShear);
 
             // Update the current bounds with the non outlined glyph bounds
             if (m_outlineThickness == 0)
@@ -397,19 +422,19 @@ namespace tgui
         // If we're using the underlined style, add the last line
         if (isUnderlined && (x > 0))
         {
-            addLine(*m_vertices, x, y, vertexFillColor, underlineOffset, underlineThickness, 0, fontScale);
+            addLine(m_vertices, x, y, vertexFillColor, underlineOffset, underlineThickness, 0, fontScale);
 
             if (m_outlineThickness != 0)
-                addLine(*m_outlineVertices, x, y, vertexOutlineColor, underlineOffset, underlineThickness, m_outlineThickness, fontScale);
+                addLine(m_outlineVertices, x, y, vertexOutlineColor, underlineOffset, underlineThickness, m_outlineThickness, fontScale);
         }
 
         // If we're using the strike through style, add the last line across all characters
         if (isStrikeThrough && (x > 0))
         {
-            addLine(*m_vertices, x, y, vertexFillColor, strikeThroughOffset, underlineThickness, 0, fontScale);
+            addLine(m_vertices, x, y, vertexFillColor, strikeThroughOffset, underlineThickness, 0, fontScale);
 
             if (m_outlineThickness != 0)
-                addLine(*m_outlineVertices, x, y, vertexOutlineColor, strikeThroughOffset, underlineThickness, m_outlineThickness, fontScale);
+                addLine(m_outlineVertices, x, y, vertexOutlineColor, strikeThroughOffset, underlineThickness, m_outlineThickness, fontScale);
         }
 
         // The height of a line can sometimes be slightly larger than the line spacing returned by the font.
@@ -426,18 +451,15 @@ namespace tgui
             const float textureWidth = static_cast<float>(textureSize.x);
             const float textureHeight = static_cast<float>(textureSize.y);
 
-            for (auto& vertex : *m_vertices)
+            for (auto& vertex : m_vertices)
             {
                 vertex.texCoords.x /= textureWidth;
                 vertex.texCoords.y /= textureHeight;
             }
-            if (m_outlineVertices)
+            for (auto& vertex : m_outlineVertices)
             {
-                for (auto& vertex : *m_outlineVertices)
-                {
-                    vertex.texCoords.x /= textureWidth;
-                    vertex.texCoords.y /= textureHeight;
-                }
+                vertex.texCoords.x /= textureWidth;
+                vertex.texCoords.y /= textureHeight;
             }
         }
     }
@@ -448,10 +470,13 @@ namespace tgui
     {
         const float padding = 1;
 
-        const float left   = glyph.bounds.left - padding / fontScale;
-        const float top    = glyph.bounds.top - padding / fontScale;
-        const float right  = glyph.bounds.left + glyph.bounds.width + padding / fontScale;
-        const float bottom = glyph.bounds.top  + glyph.bounds.height + padding / fontScale;
+        // Size of a texel in text coordinates. This is 1/fontScale unless the font scales its glyphs, e.g. with distance fields.
+        const float texelSize = (glyph.textureRect.width > 0) ? (glyph.bounds.width / glyph.textureRect.width) : (1 / fontScale);
+
+        const float left   = glyph.bounds.left - padding * texelSize;
+        const float top    = glyph.bounds.top - padding * texelSize;
+        const float right  = glyph.bounds.left + glyph.bounds.width + padding * texelSize;
+        const float bottom = glyph.bounds.top  + glyph.bounds.height + padding * texelSize;
 
         const float u1 = glyph.textureRect.left - padding;
         const float v1 = glyph.textureRect.top - padding;
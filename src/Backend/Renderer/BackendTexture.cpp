@@ -51,11 +51,34 @@ namespace tgui
         m_pixels = nullptr;
         m_imageSize = size;
         m_isSmooth = smooth;
+        m_isAlphaTexture = false;
+        m_isDistanceFieldTexture = false;
         return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool BackendTexture::loadAlphaTextureOnly(Vector2u, const std::uint8_t*, bool)
+    {
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendTexture::loadDistanceFieldTextureOnly(Vector2u, const std::uint8_t*, bool)
+    {
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendTexture::updateTextureRegion(UIntRect, const std::uint8_t*)
+    {
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Vector2u BackendTexture::getSize() const
     {
         return m_imageSize;
@@ -77,6 +100,20 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool BackendTexture::isAlphaTexture() const
+    {
+        return m_isAlphaTexture;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendTexture::isDistanceFieldTexture() const
+    {
+        return m_isDistanceFieldTexture;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool BackendTexture::isTransparentPixel(Vector2u pixel) const
     {
         if (!m_pixels)
@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Backend/Renderer/GLES2/BackendRenderTargetGLES2.hpp>
+#include <TGUI/Backend/Renderer/GLES2/CanvasGLES2.hpp>
 #include <TGUI/Backend/Renderer/OpenGL.hpp>
 
 #if TGUI_BUILD_AS_CXX_MODULE
@@ -36,6 +37,7 @@
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <numeric>
+    #include <cstring>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -69,11 +71,18 @@ namespace tgui
                 "#version 310 es\n"
                 "precision mediump float;\n"
                 "uniform sampler2D uTexture;\n"
+                "uniform float uAlphaTexture;\n"
+                "uniform float uDistanceField;\n"
                 "in vec4 color;\n"
                 "in vec2 texCoord;\n"
                 "out vec4 outColor;\n"
                 "void main() {\n"
-                "    outColor = texture(uTexture, texCoord) * color;\n"
+                "    vec4 texColor = texture(uTexture, texCoord);\n"
+                "    if (uDistanceField > 0.5) {\n"
+                "        float dist = texColor.a;\n"
+                "        texColor.a = clamp((dist - 0.5) / max(fwidth(dist), 0.0001) + 0.5, 0.0, 1.0);\n"
+                "    }\n"
+                "    outColor = (texColor + vec4(uAlphaTexture, uAlphaTexture, uAlphaTexture, 0.0)) * color;\n"
                 "}";
         }
         else if (TGUI_GLAD_GL_ES_VERSION_3_0)
@@ -95,11 +104,18 @@ namespace tgui
                 "#version 300 es\n"
                 "precision mediump float;\n"
                 "uniform sampler2D uTexture;\n"
+                "uniform float uAlphaTexture;\n"
+                "uniform float uDistanceField;\n"
                 "in vec4 color;\n"
                 "in vec2 texCoord;\n"
                 "out vec4 outColor;\n"
                 "void main() {\n"
-                "    outColor = texture(uTexture, texCoord) * color;\n"
+                "    vec4 texColor = texture(uTexture, texCoord);\n"
+                "    if (uDistanceField > 0.5) {\n"
+                "        float dist = texColor.a;\n"
+                "        texColor.a = clamp((dist - 0.5) / max(fwidth(dist), 0.0001) + 0.5, 0.0, 1.0);\n"
+                "    }\n"
+                "    outColor = (texColor + vec4(uAlphaTexture, uAlphaTexture, uAlphaTexture, 0.0)) * color;\n"
                 "}";
         }
         else // No GLES 3 support
@@ -121,10 +137,11 @@ namespace tgui
                 "#version 100\n"
                 "precision mediump float;\n"
                 "uniform sampler2D uTexture;\n"
+                "uniform float uAlphaTexture;\n"
                 "varying vec4 color;\n"
                 "varying vec2 texCoord;\n"
                 "void main() {\n"
-                "    gl_FragColor = texture2D(uTexture, texCoord) * color;\n"
+                "    gl_FragColor = (texture2D(uTexture, texCoord) + vec4(uAlphaTexture, uAlphaTexture, uAlphaTexture, 0.0)) * color;\n"
                 "}";
         }
 
@@ -190,6 +207,13 @@ namespace tgui
                 throw Exception{U"Failed to initialize BackendRenderTargetGLES2: projectionMatrix uniform wasn't found in shader program"};
         }
 
+        m_alphaTextureShaderUniformLocation = glGetUniformLocation(m_shaderProgram, "uAlphaTexture");
+        if (m_alphaTextureShaderUniformLocation < 0)
+            throw Exception{U"Failed to initialize BackendRenderTargetGLES2: uAlphaTexture uniform wasn't found in shader program"};
+
+        // The GLES 2 shader doesn't support distance fields, the renderer never creates such textures in that case
+        m_distanceFieldShaderUniformLocation = glGetUniformLocation(m_shaderProgram, "uDistanceField");
+
         if (!TGUI_GLAD_GL_ES_VERSION_3_0)
         {
             const int positionShaderLocation = glGetAttribLocation(m_shaderProgram, "inPosition");
@@ -221,6 +245,8 @@ namespace tgui
 
     BackendRenderTargetGLES2::~BackendRenderTargetGLES2()
     {
+        destroyRingBuffers();
+
         TGUI_GL_CHECK(glDeleteBuffers(1, &m_vertexBuffer));
         TGUI_GL_CHECK(glDeleteBuffers(1, &m_indexBuffer));
 
@@ -232,6 +258,7 @@ namespace tgui
 
     void BackendRenderTargetGLES2::setClearColor(const Color& color)
     {
+        BackendRenderTarget::setClearColor(color);
         glClearColor(color.getRed() / 255.f, color.getGreen() / 255.f, color.getBlue() / 255.f, color.getAlpha() / 255.f);
     }
 
@@ -303,17 +330,33 @@ namespace tgui
         TGUI_GL_CHECK(glViewport(viewportGL[0], viewportGL[1], viewportGL[2], viewportGL[3]));
         TGUI_GL_CHECK(glScissor(viewportGL[0], viewportGL[1], viewportGL[2], viewportGL[3]));
         TGUI_GL_CHECK(glUseProgram(m_shaderProgram));
-        if (TGUI_GLAD_GL_ES_VERSION_3_0)
-            TGUI_GL_CHECK(glBindVertexArray(m_vertexArray));
-        TGUI_GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, m_vertexBuffer));
-        TGUI_GL_CHECK(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_indexBuffer));
+        if (m_ringBufferEnabled)
+        {
+            TGUI_GL_CHECK(glBindVertexArray(m_ringVertexArray));
+            TGUI_GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, m_ringVertices.buffer));
+            TGUI_GL_CHECK(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_ringIndices.buffer));
+        }
+        else
+        {
+            if (TGUI_GLAD_GL_ES_VERSION_3_0)
+                TGUI_GL_CHECK(glBindVertexArray(m_vertexArray));
+            TGUI_GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, m_vertexBuffer));
+            TGUI_GL_CHECK(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_indexBuffer));
+        }
 
         // Don't make any assumptions about the currently set texture
         m_currentTexture = nullptr;
         TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_emptyTexture->getInternalTexture()));
+        m_alphaTextureBound = false;
+        TGUI_GL_CHECK(glUniform1f(m_alphaTextureShaderUniformLocation, 0));
+        m_distanceFieldBound = false;
+        if (m_distanceFieldShaderUniformLocation >= 0)
+            TGUI_GL_CHECK(glUniform1f(m_distanceFieldShaderUniformLocation, 0));
 
         // Draw the widgets
+        m_drawingGui = true;
         root->draw(*this, {});
+        m_drawingGui = false;
 
         m_currentTexture = nullptr;
 
@@ -364,25 +407,71 @@ namespace tgui
                 m_currentTexture = nullptr;
                 TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_emptyTexture->getInternalTexture()));
             }
-        }
 
-        // Load the data into the vertex buffer. After some experimenting, orphaning the buffer and allocating a new one each time
-        // was (suprisingly) faster than creating a larger buffer and only writing to non-overlapping ranges within a frame.
-        // Batch rendering (and re-arranging draw calls to be better batchable) would be much faster though.
-        TGUI_GL_CHECK(glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(vertexCount * sizeof(Vertex)), vertices, GL_DYNAMIC_DRAW));
+            // Textures that only contain an alpha channel are sampled as black, the shader needs to turn their color white
+            const bool alphaTexture = (m_currentTexture && m_currentTexture->isAlphaTexture());
+            if (m_alphaTextureBound != alphaTexture)
+            {
+                m_alphaTextureBound = alphaTexture;
+                TGUI_GL_CHECK(glUniform1f(m_alphaTextureShaderUniformLocation, alphaTexture ? 1.f : 0.f));
+            }
+
+            // Distance fields are turned into alpha values by the shader
+            const bool distanceField = (m_currentTexture && m_currentTexture->isDistanceFieldTexture());
+            if (m_distanceFieldBound != distanceField)
+            {
+                m_distanceFieldBound = distanceField;
+                TGUI_GL_CHECK(glUniform1f(m_distanceFieldShaderUniformLocation, distanceField ? 1.f : 0.f));
+            }
+        }
 
         const Transform finalTransform = m_projectionTransform * states.transform;
         glUniformMatrix4fv(m_projectionMatrixShaderUniformLocation, 1, GL_FALSE, finalTransform.getMatrix().data());
 
-        if (indices)
-        {
-            // Load the data into the index buffer
-            TGUI_GL_CHECK(glBufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLsizeiptr>(indexCount * sizeof(GLuint)), indices, GL_STREAM_DRAW));
+        submitVertices(vertices, vertexCount, indices, indexCount);
+    }
 
-            TGUI_GL_CHECK(glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(indexCount), GL_UNSIGNED_INT, nullptr));
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetGLES2::drawRenderTexture(const RenderStates& states, Vector2f size, Vector2u pixelSize, const std::shared_ptr<Widget>& canvas)
+    {
+        // The colors in the canvas have premultiplied alpha
+        TGUI_GL_CHECK(glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA));
+
+        BackendRenderTarget::drawRenderTexture(states, size, pixelSize, canvas);
+
+        TGUI_GL_CHECK(glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetGLES2::setRingBufferEnabled(bool enabled, std::size_t bufferSize)
+    {
+        TGUI_ASSERT(!m_drawingGui, "BackendRenderTargetGLES2::setRingBufferEnabled can't be called while drawing");
+        TGUI_ASSERT(bufferSize >= 4 * sizeof(Vertex), "Ring buffer size in BackendRenderTargetGLES2::setRingBufferEnabled is too small");
+
+        // Unsynchronized buffer mapping and fences don't exist in GLES 2.0
+        if (enabled && !TGUI_GLAD_GL_ES_VERSION_3_0)
+        {
+            TGUI_PRINT_WARNING("BackendRenderTargetGLES2::setRingBufferEnabled ignored, ring buffers require at least OpenGL ES 3.0");
+            return;
         }
-        else // No indices were given, all vertices need to be drawn in the order they were provided
-            TGUI_GL_CHECK(glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(vertexCount)));
+
+        if (enabled && m_ringBufferEnabled && (m_ringVertices.size == bufferSize))
+            return;
+
+        destroyRingBuffers();
+
+        m_ringBufferEnabled = enabled;
+        if (m_ringBufferEnabled)
+            createRingBuffers(bufferSize);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendRenderTargetGLES2::isRingBufferEnabled() const
+    {
+        return m_ringBufferEnabled;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -406,6 +495,56 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool BackendRenderTargetGLES2::bindRenderTexture(std::shared_ptr<Widget>& canvas, Vector2u pixelSize)
+    {
+        auto canvasGL = std::dynamic_pointer_cast<CanvasGLES2>(canvas);
+        if (canvasGL)
+            canvasGL->setSize(Vector2f{pixelSize});
+        else
+        {
+            canvasGL = CanvasGLES2::create(Vector2f{pixelSize});
+            canvas = canvasGL;
+        }
+
+        TGUI_GL_CHECK(glGetIntegerv(GL_FRAMEBUFFER_BINDING, &m_screenFramebuffer));
+        canvasGL->bindFramebuffer();
+        if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+        {
+            TGUI_GL_CHECK(glBindFramebuffer(GL_FRAMEBUFFER, static_cast<GLuint>(m_screenFramebuffer)));
+            return false;
+        }
+
+        // The canvas expects its contents at the top of its texture, which may be larger than the area that is drawn
+        m_targetSize.y = static_cast<float>(canvasGL->m_textureSize.y);
+        const GLint viewportTop = static_cast<GLint>(canvasGL->m_textureSize.y - pixelSize.y);
+        TGUI_GL_CHECK(glViewport(0, viewportTop, static_cast<GLsizei>(pixelSize.x), static_cast<GLsizei>(pixelSize.y)));
+        TGUI_GL_CHECK(glScissor(0, viewportTop, static_cast<GLsizei>(pixelSize.x), static_cast<GLsizei>(pixelSize.y)));
+
+        TGUI_GL_CHECK(glClearColor(0, 0, 0, 0));
+        TGUI_GL_CHECK(glClear(GL_COLOR_BUFFER_BIT));
+        TGUI_GL_CHECK(glClearColor(m_clearColor.getRed() / 255.f, m_clearColor.getGreen() / 255.f, m_clearColor.getBlue() / 255.f, m_clearColor.getAlpha() / 255.f));
+
+        // Blending the alpha channel with (GL_ONE, GL_ONE_MINUS_SRC_ALPHA) results in colors with premultiplied alpha
+        TGUI_GL_CHECK(glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA));
+
+        setView(m_viewRect, m_viewport, m_targetSize);
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetGLES2::unbindRenderTexture(const std::shared_ptr<Widget>&)
+    {
+        TGUI_GL_CHECK(glBindFramebuffer(GL_FRAMEBUFFER, static_cast<GLuint>(m_screenFramebuffer)));
+        TGUI_GL_CHECK(glViewport(static_cast<int>(m_viewport.left), static_cast<int>(m_targetSize.y - m_viewport.top - m_viewport.height),
+                                 static_cast<int>(m_viewport.width), static_cast<int>(m_viewport.height)));
+        TGUI_GL_CHECK(glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA));
+
+        setView(m_viewRect, m_viewport, m_targetSize);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendRenderTargetGLES2::setVertexAttribs()
     {
         TGUI_GL_CHECK(glEnableVertexAttribArray(m_positionShaderLocation));
@@ -449,6 +588,207 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetGLES2::submitVertices(const Vertex* vertices, std::size_t vertexCount, const unsigned int* indices, std::size_t indexCount)
+    {
+        // There is nothing to draw, and the ring buffers can't map an empty range
+        if ((vertexCount == 0) || (indices && (indexCount == 0)))
+            return;
+
+        const std::size_t vertexBytes = vertexCount * sizeof(Vertex);
+        const std::size_t indexBytes = indexCount * sizeof(GLuint);
+        if (m_ringBufferEnabled && (vertexBytes <= m_ringVertices.size) && (indexBytes <= m_ringIndices.size))
+        {
+            bool drawn = false;
+            std::size_t vertexOffset;
+            std::uint8_t* vertexData = mapRingBuffer(m_ringVertices, GL_ARRAY_BUFFER, vertexBytes, sizeof(Vertex), vertexOffset);
+            if (vertexData)
+            {
+                std::memcpy(vertexData, vertices, vertexBytes);
+                TGUI_GL_CHECK(glUnmapBuffer(GL_ARRAY_BUFFER));
+
+                // The vertex attributes always start at the beginning of the buffer, so the indices are shifted instead
+                const auto firstVertex = static_cast<GLuint>(vertexOffset / sizeof(Vertex));
+                if (indices)
+                {
+                    std::size_t indexOffset;
+                    auto* indexData = reinterpret_cast<GLuint*>(mapRingBuffer(m_ringIndices, GL_ELEMENT_ARRAY_BUFFER, indexBytes, sizeof(GLuint), indexOffset));
+                    if (indexData)
+                    {
+                        for (std::size_t i = 0; i < indexCount; ++i)
+                            indexData[i] = firstVertex + indices[i];
+                        TGUI_GL_CHECK(glUnmapBuffer(GL_ELEMENT_ARRAY_BUFFER));
+
+                        TGUI_GL_CHECK(glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(indexCount), GL_UNSIGNED_INT, reinterpret_cast<const GLvoid*>(indexOffset)));
+                        drawn = true;
+                    }
+                }
+                else
+                {
+                    TGUI_GL_CHECK(glDrawArrays(GL_TRIANGLES, static_cast<GLint>(firstVertex), static_cast<GLsizei>(vertexCount)));
+                    drawn = true;
+                }
+            }
+
+            // The segments that were read by the draw can only be fenced once the draw has been submitted
+            fenceRingBuffer(m_ringVertices);
+            fenceRingBuffer(m_ringIndices);
+            if (drawn)
+                return;
+        }
+
+        // If the data doesn't fit in the ring buffers then we temporarily switch to the buffers that are orphaned on each draw
+        if (m_ringBufferEnabled)
+        {
+            TGUI_GL_CHECK(glBindVertexArray(m_vertexArray));
+            TGUI_GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, m_vertexBuffer));
+        }
+
+        // Load the data into the vertex buffer. After some experimenting, orphaning the buffer and allocating a new one each time
+        // was (suprisingly) faster than creating a larger buffer and only writing to non-overlapping ranges within a frame.
+        // Batch rendering (and re-arranging draw calls to be better batchable) would be much faster though.
+        TGUI_GL_CHECK(glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(vertexBytes), vertices, GL_DYNAMIC_DRAW));
+
+        if (indices)
+        {
+            // Load the data into the index buffer
+            TGUI_GL_CHECK(glBufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLsizeiptr>(indexBytes), indices, GL_STREAM_DRAW));
+
+            TGUI_GL_CHECK(glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(indexCount), GL_UNSIGNED_INT, nullptr));
+        }
+        else // No indices were given, all vertices need to be drawn in the order they were provided
+            TGUI_GL_CHECK(glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(vertexCount)));
+
+        if (m_ringBufferEnabled)
+        {
+            TGUI_GL_CHECK(glBindVertexArray(m_ringVertexArray));
+            TGUI_GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, m_ringVertices.buffer));
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetGLES2::createRingBuffers(std::size_t bufferSize)
+    {
+        TGUI_GL_CHECK(glGenVertexArrays(1, &m_ringVertexArray));
+        TGUI_GL_CHECK(glBindVertexArray(m_ringVertexArray));
+
+        const std::array<std::pair<RingBuffer*, GLenum>, 2> rings = {{{&m_ringVertices, GL_ARRAY_BUFFER}, {&m_ringIndices, GL_ELEMENT_ARRAY_BUFFER}}};
+        for (const auto& pair : rings)
+        {
+            RingBuffer& ring = *pair.first;
+            ring = RingBuffer{};
+            ring.size = bufferSize;
+
+            TGUI_GL_CHECK(glGenBuffers(1, &ring.buffer));
+            TGUI_GL_CHECK(glBindBuffer(pair.second, ring.buffer));
+            TGUI_GL_CHECK(glBufferData(pair.second, static_cast<GLsizeiptr>(bufferSize), nullptr, GL_STREAM_DRAW));
+        }
+
+        setVertexAttribs();
+
+        TGUI_GL_CHECK(glBindVertexArray(0));
+
+        TGUI_GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, 0));
+        TGUI_GL_CHECK(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetGLES2::destroyRingBuffers()
+    {
+        for (RingBuffer* ring : {&m_ringVertices, &m_ringIndices})
+        {
+            for (auto& fence : ring->segmentFences)
+            {
+                if (fence)
+                    TGUI_GL_CHECK(glDeleteSync(static_cast<GLsync>(fence)));
+            }
+
+            if (ring->buffer)
+                TGUI_GL_CHECK(glDeleteBuffers(1, &ring->buffer));
+
+            *ring = RingBuffer{};
+        }
+
+        if (m_ringVertexArray)
+        {
+            TGUI_GL_CHECK(glDeleteVertexArrays(1, &m_ringVertexArray));
+            m_ringVertexArray = 0;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::uint8_t* BackendRenderTargetGLES2::mapRingBuffer(RingBuffer& ring, unsigned int target, std::size_t bytes, std::size_t alignment, std::size_t& offset)
+    {
+        TGUI_ASSERT((bytes > 0) && (bytes <= ring.size), "Data passed to BackendRenderTargetGLES2::mapRingBuffer has to fit in the ring buffer");
+
+        // Wrap around to the start of the buffer if the data doesn't fit in the remaining part of the buffer
+        offset = ((ring.offset + alignment - 1) / alignment) * alignment;
+        if (offset + bytes > ring.size)
+            offset = 0;
+
+        // The buffer is divided in segments. When we stop writing to a segment, a fence is placed after the last draw that read
+        // from it. Before overwriting a segment, we wait until its fence has been signaled by the GPU.
+        const std::size_t nrSegments = ring.segmentFences.size();
+        const std::size_t segmentSize = ring.size / nrSegments;
+        const auto enterNextSegment = [&ring,nrSegments]{
+            ring.currentSegment = (ring.currentSegment + 1) % nrSegments;
+
+            auto& fence = ring.segmentFences[ring.currentSegment];
+            if (fence)
+            {
+                GLenum waitResult;
+                do
+                {
+                    waitResult = glClientWaitSync(static_cast<GLsync>(fence), GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+                }
+                while (waitResult == GL_TIMEOUT_EXPIRED);
+
+                TGUI_GL_CHECK(glDeleteSync(static_cast<GLsync>(fence)));
+                fence = nullptr;
+            }
+        };
+
+        // Segments in front of the new region are only read by draws that were already submitted, so they can be fenced now
+        const std::size_t firstSegment = std::min(offset / segmentSize, nrSegments - 1);
+        const std::size_t lastSegment = std::min((offset + bytes - 1) / segmentSize, nrSegments - 1);
+        while (ring.currentSegment != firstSegment)
+        {
+            ring.segmentFences[ring.currentSegment] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+            enterNextSegment();
+        }
+
+        // The segments that the region crosses are also read by the draw that is about to be submitted, so they are only
+        // fenced by fenceRingBuffer after that draw
+        while (ring.currentSegment != lastSegment)
+        {
+            ring.segmentFencePending[ring.currentSegment] = true;
+            enterNextSegment();
+        }
+
+        ring.offset = offset + bytes;
+
+        const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_INVALIDATE_RANGE_BIT;
+        return static_cast<std::uint8_t*>(glMapBufferRange(target, static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(bytes), flags));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetGLES2::fenceRingBuffer(RingBuffer& ring)
+    {
+        for (std::size_t i = 0; i < ring.segmentFences.size(); ++i)
+        {
+            if (!ring.segmentFencePending[i])
+                continue;
+
+            ring.segmentFences[i] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+            ring.segmentFencePending[i] = false;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
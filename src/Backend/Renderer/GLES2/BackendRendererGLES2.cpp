@@ -83,6 +83,13 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendRendererGLES2::supportsDistanceFieldTextures()
+    {
+        return TGUI_GLAD_GL_ES_VERSION_3_0 != 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -48,53 +48,59 @@ namespace tgui
 
     bool BackendTextureGLES2::loadTextureOnly(Vector2u size, const std::uint8_t* pixels, bool smooth)
     {
-        TGUI_ASSERT(isBackendSet(), "BackendTextureGLES2 can't be created when there is no system backend initialized (was a gui created yet?)");
-        TGUI_ASSERT(getBackend()->getRenderer(), "BackendTextureGLES2 can't be created when there is no backend renderer (was a gui attached to a window yet?)");
+        return loadTextureWithFormat(size, pixels, smooth, false);
+    }
 
-        const bool reuseTexture = ((m_textureId != 0) && (size.x == m_imageSize.x) && (size.y == m_imageSize.y) && (smooth == m_isSmooth));
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        BackendTexture::loadTextureOnly(size, pixels, smooth);
+    bool BackendTextureGLES2::loadAlphaTextureOnly(Vector2u size, const std::uint8_t* pixels, bool smooth)
+    {
+        return loadTextureWithFormat(size, pixels, smooth, true);
+    }
 
-        if (!reuseTexture)
-        {
-            if (m_textureId != 0)
-                TGUI_GL_CHECK(glDeleteTextures(1, &m_textureId));
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            TGUI_GL_CHECK(glGenTextures(1, &m_textureId));
-        }
+    bool BackendTextureGLES2::loadDistanceFieldTextureOnly(Vector2u size, const std::uint8_t* pixels, bool smooth)
+    {
+        if (!loadTextureWithFormat(size, pixels, smooth, true))
+            return false;
+
+        m_isDistanceFieldTexture = true;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendTextureGLES2::updateTextureRegion(UIntRect region, const std::uint8_t* pixels)
+    {
+        TGUI_ASSERT((region.left + region.width <= m_imageSize.x) && (region.top + region.height <= m_imageSize.y),
+                    "Region out of range in BackendTextureGLES2::updateTextureRegion");
+
+        if (!m_textureId)
+            return false;
+
+        if ((region.width == 0) || (region.height == 0))
+            return true;
 
         GLint oldBoundTexture;
         TGUI_GL_CHECK(glGetIntegerv(GL_TEXTURE_BINDING_2D, &oldBoundTexture));
 
-        TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_textureId));
-
-        if (reuseTexture)
+        // Rows of alpha values aren't necessarily aligned to 4 bytes
+        GLint oldUnpackAlignment = 4;
+        if (m_isAlphaTexture)
         {
-            if (pixels)
-                TGUI_GL_CHECK(glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, static_cast<GLsizei>(size.x), static_cast<GLsizei>(size.y), GL_RGBA, GL_UNSIGNED_BYTE, pixels));
+            TGUI_GL_CHECK(glGetIntegerv(GL_UNPACK_ALIGNMENT, &oldUnpackAlignment));
+            TGUI_GL_CHECK(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
         }
-        else
-        {
-            TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, smooth ? GL_LINEAR : GL_NEAREST));
-            TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, smooth ? GL_LINEAR : GL_NEAREST));
-
-            TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT));
-            TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT));
 
-            if (TGUI_GLAD_GL_ES_VERSION_3_0)
-            {
-                TGUI_GL_CHECK(glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, static_cast<GLsizei>(size.x), static_cast<GLsizei>(size.y)));
-                if (pixels)
-                    TGUI_GL_CHECK(glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, static_cast<GLsizei>(size.x), static_cast<GLsizei>(size.y), GL_RGBA, GL_UNSIGNED_BYTE, pixels));
-            }
-            else
-            {
-                // GLES 2.0 doesn't support GL_RGBA8
-                TGUI_GL_CHECK(glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, static_cast<GLsizei>(size.x), static_cast<GLsizei>(size.y), 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels));
-            }
-        }
+        TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_textureId));
+        TGUI_GL_CHECK(glTexSubImage2D(GL_TEXTURE_2D, 0, static_cast<GLint>(region.left), static_cast<GLint>(region.top),
+                                      static_cast<GLsizei>(region.width), static_cast<GLsizei>(region.height),
+                                      m_isAlphaTexture ? GL_ALPHA : GL_RGBA, GL_UNSIGNED_BYTE, pixels));
 
-        // Restore the texture that was bound when this function was called
+        // Restore the state that was active when this function was called
+        if (m_isAlphaTexture)
+            TGUI_GL_CHECK(glPixelStorei(GL_UNPACK_ALIGNMENT, oldUnpackAlignment));
         TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, static_cast<GLuint>(oldBoundTexture)));
         return true;
     }
@@ -130,6 +136,75 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendTextureGLES2::loadTextureWithFormat(Vector2u size, const std::uint8_t* pixels, bool smooth, bool alphaOnly)
+    {
+        TGUI_ASSERT(isBackendSet(), "BackendTextureGLES2 can't be created when there is no system backend initialized (was a gui created yet?)");
+        TGUI_ASSERT(getBackend()->getRenderer(), "BackendTextureGLES2 can't be created when there is no backend renderer (was a gui attached to a window yet?)");
+
+        const bool reuseTexture = ((m_textureId != 0) && (size.x == m_imageSize.x) && (size.y == m_imageSize.y) && (smooth == m_isSmooth)
+                                   && (alphaOnly == m_isAlphaTexture));
+
+        BackendTexture::loadTextureOnly(size, pixels, smooth);
+        m_isAlphaTexture = alphaOnly;
+
+        if (!reuseTexture)
+        {
+            if (m_textureId != 0)
+                TGUI_GL_CHECK(glDeleteTextures(1, &m_textureId));
+
+            TGUI_GL_CHECK(glGenTextures(1, &m_textureId));
+        }
+
+        GLint oldBoundTexture;
+        TGUI_GL_CHECK(glGetIntegerv(GL_TEXTURE_BINDING_2D, &oldBoundTexture));
+
+        // Rows of alpha values aren't necessarily aligned to 4 bytes
+        GLint oldUnpackAlignment = 4;
+        if (alphaOnly)
+        {
+            TGUI_GL_CHECK(glGetIntegerv(GL_UNPACK_ALIGNMENT, &oldUnpackAlignment));
+            TGUI_GL_CHECK(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
+        }
+
+        TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_textureId));
+
+        // Sampling a GL_ALPHA texture returns black pixels, the fragment shader of the render target changes them to white
+        const GLenum format = alphaOnly ? GL_ALPHA : GL_RGBA;
+        if (reuseTexture)
+        {
+            if (pixels)
+                TGUI_GL_CHECK(glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, static_cast<GLsizei>(size.x), static_cast<GLsizei>(size.y), format, GL_UNSIGNED_BYTE, pixels));
+        }
+        else
+        {
+            TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, smooth ? GL_LINEAR : GL_NEAREST));
+            TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, smooth ? GL_LINEAR : GL_NEAREST));
+
+            TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT));
+            TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT));
+
+            if (TGUI_GLAD_GL_ES_VERSION_3_0 && !alphaOnly)
+            {
+                TGUI_GL_CHECK(glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, static_cast<GLsizei>(size.x), static_cast<GLsizei>(size.y)));
+                if (pixels)
+                    TGUI_GL_CHECK(glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, static_cast<GLsizei>(size.x), static_cast<GLsizei>(size.y), GL_RGBA, GL_UNSIGNED_BYTE, pixels));
+            }
+            else
+            {
+                // GLES 2.0 doesn't support GL_RGBA8, and glTexStorage2D in GLES 3 doesn't accept GL_ALPHA
+                TGUI_GL_CHECK(glTexImage2D(GL_TEXTURE_2D, 0, static_cast<GLint>(format), static_cast<GLsizei>(size.x), static_cast<GLsizei>(size.y), 0, format, GL_UNSIGNED_BYTE, pixels));
+            }
+        }
+
+        // Restore the state that was active when this function was called
+        if (alphaOnly)
+            TGUI_GL_CHECK(glPixelStorei(GL_UNPACK_ALIGNMENT, oldUnpackAlignment));
+        TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, static_cast<GLuint>(oldBoundTexture)));
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
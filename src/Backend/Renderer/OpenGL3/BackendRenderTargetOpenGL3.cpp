@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Backend/Renderer/OpenGL3/BackendRenderTargetOpenGL3.hpp>
+#include <TGUI/Backend/Renderer/OpenGL3/CanvasOpenGL3.hpp>
 #include <TGUI/Backend/Renderer/OpenGL.hpp>
 
 #if TGUI_BUILD_AS_CXX_MODULE
@@ -37,6 +38,7 @@
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <numeric>
+    #include <cstring>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -85,11 +87,17 @@ namespace tgui
         {
             "#version 330 core\n"
             "uniform sampler2D uTexture;\n"
+            "uniform float uDistanceField;\n"
             "in vec4 color;\n"
             "in vec2 texCoord;\n"
             "out vec4 outColor;\n"
             "void main() {\n"
-            "    outColor = texture(uTexture, texCoord) * color;\n"
+            "    vec4 texColor = texture(uTexture, texCoord);\n"
+            "    if (uDistanceField > 0.5) {\n"
+            "        float dist = texColor.a;\n"
+            "        texColor.a = clamp((dist - 0.5) / max(fwidth(dist), 0.0001) + 0.5, 0.0, 1.0);\n"
+            "    }\n"
+            "    outColor = texColor * color;\n"
             "}"
         };
 
@@ -145,6 +153,8 @@ namespace tgui
         if (!TGUI_GLAD_GL_VERSION_4_3)
             m_projectionMatrixShaderUniformLocation = glGetUniformLocation(m_shaderProgram, "projectionMatrix");
 
+        m_distanceFieldShaderUniformLocation = glGetUniformLocation(m_shaderProgram, "uDistanceField");
+
         createBuffers();
 
         // Create a solid white 1x1 texture to pass to the shader when we aren't drawing a texture
@@ -159,6 +169,8 @@ namespace tgui
 
     BackendRenderTargetOpenGL3::~BackendRenderTargetOpenGL3()
     {
+        destroyRingBuffers();
+
         TGUI_GL_CHECK(glDeleteBuffers(1, &m_vertexBuffer));
         TGUI_GL_CHECK(glDeleteBuffers(1, &m_indexBuffer));
         TGUI_GL_CHECK(glDeleteVertexArrays(1, &m_vertexArray));
@@ -168,6 +180,7 @@ namespace tgui
 
     void BackendRenderTargetOpenGL3::setClearColor(const Color& color)
     {
+        BackendRenderTarget::setClearColor(color);
         glClearColor(color.getRed() / 255.f, color.getGreen() / 255.f, color.getBlue() / 255.f, color.getAlpha() / 255.f);
     }
 
@@ -239,18 +252,43 @@ namespace tgui
         TGUI_GL_CHECK(glViewport(viewportGL[0], viewportGL[1], viewportGL[2], viewportGL[3]));
         TGUI_GL_CHECK(glScissor(viewportGL[0], viewportGL[1], viewportGL[2], viewportGL[3]));
         TGUI_GL_CHECK(glUseProgram(m_shaderProgram));
-        TGUI_GL_CHECK(glBindVertexArray(m_vertexArray));
-        TGUI_GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, m_vertexBuffer));
-        TGUI_GL_CHECK(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_indexBuffer));
+        if (m_ringBufferEnabled)
+        {
+            TGUI_GL_CHECK(glBindVertexArray(m_ringVertexArray));
+            TGUI_GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, m_ringVertices.buffer));
+            TGUI_GL_CHECK(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_ringIndices.buffer));
+        }
+        else
+        {
+            TGUI_GL_CHECK(glBindVertexArray(m_vertexArray));
+            TGUI_GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, m_vertexBuffer));
+            TGUI_GL_CHECK(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_indexBuffer));
+        }
+        m_scissorRect = viewportGL;
 
         // Don't make any assumptions about the currently set texture
         m_currentTexture = nullptr;
         TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_emptyTexture->getInternalTexture()));
+        m_distanceFieldBound = false;
+        TGUI_GL_CHECK(glUniform1f(m_distanceFieldShaderUniformLocation, 0));
+
+        // When batching, the vertices are already transformed on the CPU so the projection matrix only has to be set once
+        if (m_batchingEnabled)
+            glUniformMatrix4fv(m_projectionMatrixShaderUniformLocation, 1, GL_FALSE, m_projectionTransform.getMatrix().data());
+
+        m_drawCount = 0;
+        m_flushCount = 0;
 
         // Draw the widgets
+        m_drawingGui = true;
         root->draw(*this, {});
 
+        if (m_batchingEnabled)
+            flushBatch();
+        m_drawingGui = false;
+
         m_currentTexture = nullptr;
+        m_batchTexture = nullptr;
 
         // Restore the old state
         TGUI_GL_CHECK(glBindVertexArray(0));
@@ -283,59 +321,203 @@ namespace tgui
     void BackendRenderTargetOpenGL3::drawVertexArray(const RenderStates& states, const Vertex* vertices,
         std::size_t vertexCount, const unsigned int* indices, std::size_t indexCount, const std::shared_ptr<BackendTexture>& texture)
     {
-        // Change the bound texture if it changed
-        if (m_currentTexture != texture)
+        ++m_drawCount;
+
+        if (m_batchingEnabled)
         {
-            if (texture)
-            {
-                TGUI_ASSERT(std::dynamic_pointer_cast<BackendTextureOpenGL3>(texture), "BackendRenderTargetOpenGL3 requires textures of type BackendTextureOpenGL3");
-                m_currentTexture = std::static_pointer_cast<BackendTextureOpenGL3>(texture);
+            // The vertices have to be send to the GPU before we can start collecting vertices for a different texture
+            if ((m_batchTexture != texture) && !m_batchIndices.empty())
+                flushBatch();
+
+            m_batchTexture = texture;
 
-                TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_currentTexture->getInternalTexture()));
+            // Transform the vertices on the CPU so that they can be drawn together with vertices that use a different transform
+            const auto firstIndex = static_cast<unsigned int>(m_batchVertices.size());
+            for (std::size_t i = 0; i < vertexCount; ++i)
+                m_batchVertices.emplace_back(states.transform.transformPoint(vertices[i].position), vertices[i].color, vertices[i].texCoords);
+
+            if (indices)
+            {
+                for (std::size_t i = 0; i < indexCount; ++i)
+                    m_batchIndices.push_back(firstIndex + indices[i]);
             }
-            else
+            else // No indices were given, all vertices need to be drawn in the order they were provided
             {
-                m_currentTexture = nullptr;
-                TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_emptyTexture->getInternalTexture()));
+                for (std::size_t i = 0; i < vertexCount; ++i)
+                    m_batchIndices.push_back(firstIndex + static_cast<unsigned int>(i));
             }
+
+            return;
         }
 
-        // Load the data into the vertex buffer. After some experimenting, orphaning the buffer and allocating a new one each time
-        // was (suprisingly) faster than creating a larger buffer and only writing to non-overlapping ranges within a frame.
-        // Batch rendering (and re-arranging draw calls to be better batchable) would be much faster though.
-        TGUI_GL_CHECK(glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(vertexCount * sizeof(Vertex)), vertices, GL_DYNAMIC_DRAW));
+        ++m_flushCount;
+        bindTexture(texture);
 
         const Transform finalTransform = m_projectionTransform * states.transform;
         glUniformMatrix4fv(m_projectionMatrixShaderUniformLocation, 1, GL_FALSE, finalTransform.getMatrix().data());
 
-        if (indices)
-        {
-            // Load the data into the index buffer
-            TGUI_GL_CHECK(glBufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLsizeiptr>(indexCount * sizeof(GLuint)), indices, GL_STREAM_DRAW));
+        submitVertices(vertices, vertexCount, indices, indexCount);
+    }
 
-            TGUI_GL_CHECK(glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(indexCount), GL_UNSIGNED_INT, nullptr));
-        }
-        else // No indices were given, all vertices need to be drawn in the order they were provided
-            TGUI_GL_CHECK(glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(vertexCount)));
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetOpenGL3::drawRenderTexture(const RenderStates& states, Vector2f size, Vector2u pixelSize, const std::shared_ptr<Widget>& canvas)
+    {
+        if (m_batchingEnabled)
+            flushBatch();
+
+        // The colors in the canvas have premultiplied alpha
+        TGUI_GL_CHECK(glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA));
+
+        BackendRenderTarget::drawRenderTexture(states, size, pixelSize, canvas);
+
+        if (m_batchingEnabled)
+            flushBatch();
+
+        TGUI_GL_CHECK(glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetOpenGL3::setBatchingEnabled(bool batching)
+    {
+        TGUI_ASSERT(m_batchIndices.empty(), "BackendRenderTargetOpenGL3::setBatchingEnabled can't be called while drawing");
+        m_batchingEnabled = batching;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendRenderTargetOpenGL3::isBatchingEnabled() const
+    {
+        return m_batchingEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t BackendRenderTargetOpenGL3::getDrawCount() const
+    {
+        return m_drawCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t BackendRenderTargetOpenGL3::getFlushCount() const
+    {
+        return m_flushCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetOpenGL3::setRingBufferEnabled(bool enabled, std::size_t bufferSize)
+    {
+        TGUI_ASSERT(!m_drawingGui && m_batchIndices.empty(), "BackendRenderTargetOpenGL3::setRingBufferEnabled can't be called while drawing");
+        TGUI_ASSERT(bufferSize >= 4 * sizeof(Vertex), "Ring buffer size in BackendRenderTargetOpenGL3::setRingBufferEnabled is too small");
+
+        if (enabled && m_ringBufferEnabled && (m_ringVertices.size == bufferSize))
+            return;
+
+        destroyRingBuffers();
+
+        m_ringBufferEnabled = enabled;
+        if (m_ringBufferEnabled)
+            createRingBuffers(bufferSize);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendRenderTargetOpenGL3::isRingBufferEnabled() const
+    {
+        return m_ringBufferEnabled;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void BackendRenderTargetOpenGL3::updateClipping(FloatRect clipRect, FloatRect clipViewport)
     {
+        std::array<int, 4> scissorRect = {{0, 0, 0, 0}};
         if ((clipViewport.width > 0) && (clipViewport.height > 0) && (clipRect.width > 0) && (clipRect.height > 0))
         {
             m_pixelsPerPoint = {clipViewport.width / clipRect.width, clipViewport.height / clipRect.height};
 
-            TGUI_GL_CHECK(glScissor(static_cast<int>(clipViewport.left), static_cast<int>(m_targetSize.y - clipViewport.top - clipViewport.height),
-                                    static_cast<int>(clipViewport.width), static_cast<int>(clipViewport.height)));
+            scissorRect = {{static_cast<int>(clipViewport.left), static_cast<int>(m_targetSize.y - clipViewport.top - clipViewport.height),
+                            static_cast<int>(clipViewport.width), static_cast<int>(clipViewport.height)}};
         }
         else // Clip the entire window
-        {
             m_pixelsPerPoint = {1, 1};
 
-            TGUI_GL_CHECK(glScissor(0, 0, 0, 0));
+        if (scissorRect == m_scissorRect)
+            return;
+
+        // Vertices that were collected with the old clipping rectangle have to be drawn before the scissor rectangle is changed
+        if (m_batchingEnabled)
+            flushBatch();
+
+        m_scissorRect = scissorRect;
+        TGUI_GL_CHECK(glScissor(m_scissorRect[0], m_scissorRect[1], m_scissorRect[2], m_scissorRect[3]));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendRenderTargetOpenGL3::bindRenderTexture(std::shared_ptr<Widget>& canvas, Vector2u pixelSize)
+    {
+        // Everything that was drawn so far still has to end up on the screen
+        if (m_batchingEnabled)
+            flushBatch();
+
+        auto canvasGL = std::dynamic_pointer_cast<CanvasOpenGL3>(canvas);
+        if (canvasGL)
+            canvasGL->setSize(Vector2f{pixelSize});
+        else
+        {
+            canvasGL = CanvasOpenGL3::create(Vector2f{pixelSize});
+            canvas = canvasGL;
+        }
+
+        TGUI_GL_CHECK(glGetIntegerv(GL_FRAMEBUFFER_BINDING, &m_screenFramebuffer));
+        canvasGL->bindFramebuffer();
+        if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+        {
+            TGUI_GL_CHECK(glBindFramebuffer(GL_FRAMEBUFFER, static_cast<GLuint>(m_screenFramebuffer)));
+            return false;
         }
+
+        // The canvas expects its contents at the top of its texture, which may be larger than the area that is drawn
+        m_targetSize.y = static_cast<float>(canvasGL->m_textureSize.y);
+        const std::array<int, 4> viewportGL = {{0, static_cast<int>(canvasGL->m_textureSize.y - pixelSize.y),
+                                                static_cast<int>(pixelSize.x), static_cast<int>(pixelSize.y)}};
+        TGUI_GL_CHECK(glViewport(viewportGL[0], viewportGL[1], viewportGL[2], viewportGL[3]));
+        TGUI_GL_CHECK(glScissor(viewportGL[0], viewportGL[1], viewportGL[2], viewportGL[3]));
+        m_scissorRect = viewportGL;
+
+        TGUI_GL_CHECK(glClearColor(0, 0, 0, 0));
+        TGUI_GL_CHECK(glClear(GL_COLOR_BUFFER_BIT));
+        TGUI_GL_CHECK(glClearColor(m_clearColor.getRed() / 255.f, m_clearColor.getGreen() / 255.f, m_clearColor.getBlue() / 255.f, m_clearColor.getAlpha() / 255.f));
+
+        // Blending the alpha channel with (GL_ONE, GL_ONE_MINUS_SRC_ALPHA) results in colors with premultiplied alpha
+        TGUI_GL_CHECK(glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA));
+
+        setView(m_viewRect, m_viewport, m_targetSize);
+        if (m_batchingEnabled)
+            glUniformMatrix4fv(m_projectionMatrixShaderUniformLocation, 1, GL_FALSE, m_projectionTransform.getMatrix().data());
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetOpenGL3::unbindRenderTexture(const std::shared_ptr<Widget>&)
+    {
+        if (m_batchingEnabled)
+            flushBatch();
+
+        TGUI_GL_CHECK(glBindFramebuffer(GL_FRAMEBUFFER, static_cast<GLuint>(m_screenFramebuffer)));
+        TGUI_GL_CHECK(glViewport(static_cast<int>(m_viewport.left), static_cast<int>(m_targetSize.y - m_viewport.top - m_viewport.height),
+                                 static_cast<int>(m_viewport.width), static_cast<int>(m_viewport.height)));
+        TGUI_GL_CHECK(glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA));
+
+        setView(m_viewRect, m_viewport, m_targetSize);
+        if (m_batchingEnabled)
+            glUniformMatrix4fv(m_projectionMatrixShaderUniformLocation, 1, GL_FALSE, m_projectionTransform.getMatrix().data());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -372,6 +554,280 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetOpenGL3::bindTexture(const std::shared_ptr<BackendTexture>& texture)
+    {
+        // Only change the bound texture if it changed
+        if (m_currentTexture == texture)
+            return;
+
+        if (texture)
+        {
+            TGUI_ASSERT(std::dynamic_pointer_cast<BackendTextureOpenGL3>(texture), "BackendRenderTargetOpenGL3 requires textures of type BackendTextureOpenGL3");
+            m_currentTexture = std::static_pointer_cast<BackendTextureOpenGL3>(texture);
+
+            TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_currentTexture->getInternalTexture()));
+        }
+        else
+        {
+            m_currentTexture = nullptr;
+            TGUI_GL_CHECK(glBindTexture(GL_TEXTURE_2D, m_emptyTexture->getInternalTexture()));
+        }
+
+        // Distance fields are turned into alpha values by the shader
+        const bool distanceField = (m_currentTexture && m_currentTexture->isDistanceFieldTexture());
+        if (m_distanceFieldBound != distanceField)
+        {
+            m_distanceFieldBound = distanceField;
+            TGUI_GL_CHECK(glUniform1f(m_distanceFieldShaderUniformLocation, distanceField ? 1.f : 0.f));
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetOpenGL3::flushBatch()
+    {
+        if (m_batchIndices.empty())
+            return;
+
+        ++m_flushCount;
+        bindTexture(m_batchTexture);
+        submitVertices(m_batchVertices.data(), m_batchVertices.size(), m_batchIndices.data(), m_batchIndices.size());
+
+        // The capacity of the vectors is kept so that no memory has to be allocated for the next batch
+        m_batchVertices.clear();
+        m_batchIndices.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetOpenGL3::submitVertices(const Vertex* vertices, std::size_t vertexCount, const unsigned int* indices, std::size_t indexCount)
+    {
+        // There is nothing to draw, and the ring buffers can't map an empty range
+        if ((vertexCount == 0) || (indices && (indexCount == 0)))
+            return;
+
+        const std::size_t vertexBytes = vertexCount * sizeof(Vertex);
+        const std::size_t indexBytes = indexCount * sizeof(GLuint);
+        if (m_ringBufferEnabled && (vertexBytes <= m_ringVertices.size) && (indexBytes <= m_ringIndices.size))
+        {
+            bool drawn = false;
+            std::size_t vertexOffset;
+            std::uint8_t* vertexData = mapRingBuffer(m_ringVertices, GL_ARRAY_BUFFER, vertexBytes, sizeof(Vertex), vertexOffset);
+            if (vertexData)
+            {
+                std::memcpy(vertexData, vertices, vertexBytes);
+                unmapRingBuffer(m_ringVertices, GL_ARRAY_BUFFER);
+
+                // The vertex attributes always start at the beginning of the buffer, so the indices are shifted instead
+                const auto firstVertex = static_cast<GLuint>(vertexOffset / sizeof(Vertex));
+                if (indices)
+                {
+                    std::size_t indexOffset;
+                    auto* indexData = reinterpret_cast<GLuint*>(mapRingBuffer(m_ringIndices, GL_ELEMENT_ARRAY_BUFFER, indexBytes, sizeof(GLuint), indexOffset));
+                    if (indexData)
+                    {
+                        for (std::size_t i = 0; i < indexCount; ++i)
+                            indexData[i] = firstVertex + indices[i];
+                        unmapRingBuffer(m_ringIndices, GL_ELEMENT_ARRAY_BUFFER);
+
+                        TGUI_GL_CHECK(glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(indexCount), GL_UNSIGNED_INT, reinterpret_cast<const GLvoid*>(indexOffset)));
+                        drawn = true;
+                    }
+                }
+                else
+                {
+                    TGUI_GL_CHECK(glDrawArrays(GL_TRIANGLES, static_cast<GLint>(firstVertex), static_cast<GLsizei>(vertexCount)));
+                    drawn = true;
+                }
+            }
+
+            // The segments that were read by the draw can only be fenced once the draw has been submitted
+            fenceRingBuffer(m_ringVertices);
+            fenceRingBuffer(m_ringIndices);
+            if (drawn)
+                return;
+        }
+
+        // If the data doesn't fit in the ring buffers then we temporarily switch to the buffers that are orphaned on each draw
+        if (m_ringBufferEnabled)
+        {
+            TGUI_GL_CHECK(glBindVertexArray(m_vertexArray));
+            TGUI_GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, m_vertexBuffer));
+        }
+
+        // Load the data into the vertex buffer. After some experimenting, orphaning the buffer and allocating a new one each time
+        // was (suprisingly) faster than creating a larger buffer and only writing to non-overlapping ranges within a frame.
+        // Batch rendering (see setBatchingEnabled) is much faster though.
+        TGUI_GL_CHECK(glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(vertexBytes), vertices, GL_DYNAMIC_DRAW));
+
+        if (indices)
+        {
+            // Load the data into the index buffer
+            TGUI_GL_CHECK(glBufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLsizeiptr>(indexBytes), indices, GL_STREAM_DRAW));
+
+            TGUI_GL_CHECK(glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(indexCount), GL_UNSIGNED_INT, nullptr));
+        }
+        else // No indices were given, all vertices need to be drawn in the order they were provided
+            TGUI_GL_CHECK(glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(vertexCount)));
+
+        if (m_ringBufferEnabled)
+        {
+            TGUI_GL_CHECK(glBindVertexArray(m_ringVertexArray));
+            TGUI_GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, m_ringVertices.buffer));
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetOpenGL3::createRingBuffers(std::size_t bufferSize)
+    {
+        // Persistent mapping requires glBufferStorage, which only exists since OpenGL 4.4
+        const bool persistentMapping = (TGUI_GLAD_GL_VERSION_4_4 != 0);
+
+        TGUI_GL_CHECK(glGenVertexArrays(1, &m_ringVertexArray));
+        TGUI_GL_CHECK(glBindVertexArray(m_ringVertexArray));
+
+        const std::array<std::pair<RingBuffer*, GLenum>, 2> rings = {{{&m_ringVertices, GL_ARRAY_BUFFER}, {&m_ringIndices, GL_ELEMENT_ARRAY_BUFFER}}};
+        for (const auto& pair : rings)
+        {
+            RingBuffer& ring = *pair.first;
+            ring = RingBuffer{};
+            ring.size = bufferSize;
+
+            TGUI_GL_CHECK(glGenBuffers(1, &ring.buffer));
+            TGUI_GL_CHECK(glBindBuffer(pair.second, ring.buffer));
+            if (persistentMapping)
+            {
+                const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+                TGUI_GL_CHECK(glBufferStorage(pair.second, static_cast<GLsizeiptr>(bufferSize), nullptr, flags));
+                ring.persistentData = static_cast<std::uint8_t*>(glMapBufferRange(pair.second, 0, static_cast<GLsizeiptr>(bufferSize), flags));
+            }
+            else
+                TGUI_GL_CHECK(glBufferData(pair.second, static_cast<GLsizeiptr>(bufferSize), nullptr, GL_STREAM_DRAW));
+        }
+
+        TGUI_GL_CHECK(glEnableVertexAttribArray(0)); // Position
+        TGUI_GL_CHECK(glEnableVertexAttribArray(1)); // Color
+        TGUI_GL_CHECK(glEnableVertexAttribArray(2)); // TexCoord
+        TGUI_GL_CHECK(glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), reinterpret_cast<GLvoid*>(0)));
+        TGUI_GL_CHECK(glVertexAttribPointer(1, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Vertex), reinterpret_cast<GLvoid*>(8)));
+        TGUI_GL_CHECK(glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), reinterpret_cast<GLvoid*>(8 + 4)));
+
+        TGUI_GL_CHECK(glBindVertexArray(0));
+
+        TGUI_GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, 0));
+        TGUI_GL_CHECK(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetOpenGL3::destroyRingBuffers()
+    {
+        for (RingBuffer* ring : {&m_ringVertices, &m_ringIndices})
+        {
+            for (auto& fence : ring->segmentFences)
+            {
+                if (fence)
+                    TGUI_GL_CHECK(glDeleteSync(static_cast<GLsync>(fence)));
+            }
+
+            // Deleting the buffer will also unmap it if it was persistently mapped
+            if (ring->buffer)
+                TGUI_GL_CHECK(glDeleteBuffers(1, &ring->buffer));
+
+            *ring = RingBuffer{};
+        }
+
+        if (m_ringVertexArray)
+        {
+            TGUI_GL_CHECK(glDeleteVertexArrays(1, &m_ringVertexArray));
+            m_ringVertexArray = 0;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::uint8_t* BackendRenderTargetOpenGL3::mapRingBuffer(RingBuffer& ring, unsigned int target, std::size_t bytes, std::size_t alignment, std::size_t& offset)
+    {
+        TGUI_ASSERT((bytes > 0) && (bytes <= ring.size), "Data passed to BackendRenderTargetOpenGL3::mapRingBuffer has to fit in the ring buffer");
+
+        // Wrap around to the start of the buffer if the data doesn't fit in the remaining part of the buffer
+        offset = ((ring.offset + alignment - 1) / alignment) * alignment;
+        if (offset + bytes > ring.size)
+            offset = 0;
+
+        // The buffer is divided in segments. When we stop writing to a segment, a fence is placed after the last draw that read
+        // from it. Before overwriting a segment, we wait until its fence has been signaled by the GPU.
+        const std::size_t nrSegments = ring.segmentFences.size();
+        const std::size_t segmentSize = ring.size / nrSegments;
+        const auto enterNextSegment = [&ring,nrSegments]{
+            ring.currentSegment = (ring.currentSegment + 1) % nrSegments;
+
+            auto& fence = ring.segmentFences[ring.currentSegment];
+            if (fence)
+            {
+                GLenum waitResult;
+                do
+                {
+                    waitResult = glClientWaitSync(static_cast<GLsync>(fence), GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+                }
+                while (waitResult == GL_TIMEOUT_EXPIRED);
+
+                TGUI_GL_CHECK(glDeleteSync(static_cast<GLsync>(fence)));
+                fence = nullptr;
+            }
+        };
+
+        // Segments in front of the new region are only read by draws that were already submitted, so they can be fenced now
+        const std::size_t firstSegment = std::min(offset / segmentSize, nrSegments - 1);
+        const std::size_t lastSegment = std::min((offset + bytes - 1) / segmentSize, nrSegments - 1);
+        while (ring.currentSegment != firstSegment)
+        {
+            ring.segmentFences[ring.currentSegment] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+            enterNextSegment();
+        }
+
+        // The segments that the region crosses are also read by the draw that is about to be submitted, so they are only
+        // fenced by fenceRingBuffer after that draw
+        while (ring.currentSegment != lastSegment)
+        {
+            ring.segmentFencePending[ring.currentSegment] = true;
+            enterNextSegment();
+        }
+
+        ring.offset = offset + bytes;
+        if (ring.persistentData)
+            return ring.persistentData + offset;
+
+        const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_INVALIDATE_RANGE_BIT;
+        return static_cast<std::uint8_t*>(glMapBufferRange(target, static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(bytes), flags));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetOpenGL3::fenceRingBuffer(RingBuffer& ring)
+    {
+        for (std::size_t i = 0; i < ring.segmentFences.size(); ++i)
+        {
+            if (!ring.segmentFencePending[i])
+                continue;
+
+            ring.segmentFences[i] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+            ring.segmentFencePending[i] = false;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetOpenGL3::unmapRingBuffer(const RingBuffer& ring, unsigned int target)
+    {
+        // A persistently mapped buffer remains mapped while it is being used by the GPU
+        if (!ring.persistentData)
+            TGUI_GL_CHECK(glUnmapBuffer(target));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -25,6 +25,7 @@
 
 #include <TGUI/extlibs/IncludeSDL.hpp>
 #include <TGUI/Backend/Renderer/SDL_Renderer/BackendRenderTargetSDL.hpp>
+#include <TGUI/Backend/Renderer/SDL_Renderer/CanvasSDL.hpp>
 
 #if TGUI_BUILD_AS_CXX_MODULE
     import tgui;
@@ -51,6 +52,7 @@ namespace tgui
 
     void BackendRenderTargetSDL::setClearColor(const Color& color)
     {
+        BackendRenderTarget::setClearColor(color);
         SDL_SetRenderDrawColor(m_renderer, color.getRed(), color.getGreen(), color.getBlue(), color.getAlpha());
     }
 
@@ -160,6 +162,72 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool BackendRenderTargetSDL::bindRenderTexture(std::shared_ptr<Widget>& canvas, Vector2u pixelSize)
+    {
+        if (!m_renderer)
+            return false;
+
+        auto canvasSDL = std::dynamic_pointer_cast<CanvasSDL>(canvas);
+        if (canvasSDL)
+            canvasSDL->setSize(Vector2f{pixelSize});
+        else
+        {
+            canvasSDL = CanvasSDL::create(Vector2f{pixelSize});
+            canvas = canvasSDL;
+        }
+
+        SDL_Texture* textureTarget = canvasSDL->getTextureTarget();
+        if (!textureTarget)
+            return false;
+
+        // The normal blend mode already results in premultiplied alpha when drawing to the canvas,
+        // so the canvas itself has to be drawn with (SDL_BLENDFACTOR_ONE, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA).
+        const SDL_BlendMode premultipliedBlendMode = SDL_ComposeCustomBlendMode(
+            SDL_BLENDFACTOR_ONE, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA, SDL_BLENDOPERATION_ADD,
+            SDL_BLENDFACTOR_ONE, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA, SDL_BLENDOPERATION_ADD);
+#if SDL_MAJOR_VERSION >= 3
+        if (!SDL_SetTextureBlendMode(textureTarget, premultipliedBlendMode))
+#else
+        if (SDL_SetTextureBlendMode(textureTarget, premultipliedBlendMode) != 0)
+#endif
+            return false;
+
+        m_screenRenderTarget = SDL_GetRenderTarget(m_renderer);
+#if SDL_MAJOR_VERSION >= 3
+        if (!SDL_SetRenderTarget(m_renderer, textureTarget))
+#else
+        if (SDL_SetRenderTarget(m_renderer, textureTarget) != 0)
+#endif
+            return false;
+
+        SDL_SetRenderDrawColor(m_renderer, 0, 0, 0, 0);
+        SDL_RenderClear(m_renderer);
+        SDL_SetRenderDrawColor(m_renderer, m_clearColor.getRed(), m_clearColor.getGreen(), m_clearColor.getBlue(), m_clearColor.getAlpha());
+
+        setView(m_viewRect, m_viewport, m_targetSize);
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetSDL::unbindRenderTexture(const std::shared_ptr<Widget>&)
+    {
+        SDL_SetRenderTarget(m_renderer, m_screenRenderTarget);
+        m_screenRenderTarget = nullptr;
+
+        // Changing the render target resets the viewport
+        SDL_Rect viewport;
+        viewport.x = static_cast<int>(m_viewport.left);
+        viewport.y = static_cast<int>(m_viewport.top);
+        viewport.w = static_cast<int>(m_viewport.width);
+        viewport.h = static_cast<int>(m_viewport.height);
+        SDL_SetRenderViewport(m_renderer, &viewport);
+
+        setView(m_viewRect, m_viewport, m_targetSize);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendRenderTargetSDL::updateClipping(FloatRect clipRect, FloatRect clipViewport)
     {
         if ((clipViewport.width > 0) && (clipViewport.height > 0) && (clipRect.width > 0) && (clipRect.height > 0))
@@ -123,6 +123,24 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool BackendTextureSDL::updateTextureRegion(UIntRect region, const std::uint8_t* pixels)
+    {
+        TGUI_ASSERT((region.left + region.width <= m_imageSize.x) && (region.top + region.height <= m_imageSize.y),
+                    "Region out of range in BackendTextureSDL::updateTextureRegion");
+
+        if (!m_texture)
+            return false;
+
+        if ((region.width == 0) || (region.height == 0))
+            return true;
+
+        const SDL_Rect rect{static_cast<int>(region.left), static_cast<int>(region.top), static_cast<int>(region.width), static_cast<int>(region.height)};
+        SDL_UpdateTexture(m_texture, &rect, pixels, static_cast<int>(region.width * 4));
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendTextureSDL::setSmooth(bool smooth)
     {
         if (m_isSmooth == smooth)
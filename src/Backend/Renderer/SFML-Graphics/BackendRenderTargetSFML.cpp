@@ -25,6 +25,7 @@
 
 #include <TGUI/Backend/Renderer/SFML-Graphics/BackendRenderTargetSFML.hpp>
 #include <TGUI/Backend/Renderer/SFML-Graphics/BackendTextureSFML.hpp>
+#include <TGUI/Backend/Renderer/SFML-Graphics/CanvasSFML.hpp>
 
 #if TGUI_BUILD_AS_CXX_MODULE
     import tgui;
@@ -36,6 +37,7 @@
 #include <SFML/Graphics/RenderTarget.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
     #include <cmath>
     #include <array>
 #endif
@@ -62,7 +64,7 @@ namespace tgui
 
     void BackendRenderTargetSFML::setClearColor(const Color& color)
     {
-        m_clearColor = color;
+        BackendRenderTarget::setClearColor(color);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -190,6 +192,68 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void BackendRenderTargetSFML::drawRenderTexture(const RenderStates& states, Vector2f size, Vector2u pixelSize, const std::shared_ptr<Widget>& canvas)
+    {
+        // Texture coordinates are specified in pixels in SFML
+        const std::array<sf::Vertex, 6> vertices = {{
+            {{0, 0}, sf::Color::White, {0, 0}},
+            {{0, size.y}, sf::Color::White, {0, static_cast<float>(pixelSize.y)}},
+            {{size.x, 0}, sf::Color::White, {static_cast<float>(pixelSize.x), 0}},
+            {{size.x, 0}, sf::Color::White, {static_cast<float>(pixelSize.x), 0}},
+            {{0, size.y}, sf::Color::White, {0, static_cast<float>(pixelSize.y)}},
+            {{size.x, size.y}, sf::Color::White, {static_cast<float>(pixelSize.x), static_cast<float>(pixelSize.y)}},
+        }};
+
+        // The render texture of the canvas is drawn directly, as its colors have premultiplied alpha
+        TGUI_ASSERT(std::dynamic_pointer_cast<CanvasSFML>(canvas), "BackendRenderTargetSFML requires canvases of type CanvasSFML");
+        sf::RenderStates statesSFML = convertRenderStates(states, nullptr);
+        statesSFML.texture = &std::static_pointer_cast<CanvasSFML>(canvas)->getRenderTexture().getTexture();
+#if SFML_VERSION_MAJOR >= 3
+        statesSFML.blendMode = sf::BlendMode(sf::BlendMode::Factor::One, sf::BlendMode::Factor::OneMinusSrcAlpha);
+#else
+        statesSFML.blendMode = sf::BlendMode(sf::BlendMode::One, sf::BlendMode::OneMinusSrcAlpha);
+#endif
+        m_target->draw(vertices.data(), vertices.size(), sf::PrimitiveType::Triangles, statesSFML);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendRenderTargetSFML::bindRenderTexture(std::shared_ptr<Widget>& canvas, Vector2u pixelSize)
+    {
+        auto canvasSFML = std::dynamic_pointer_cast<CanvasSFML>(canvas);
+        if (canvasSFML)
+            canvasSFML->setSize(Vector2f{pixelSize});
+        else
+        {
+            canvasSFML = CanvasSFML::create(Vector2f{pixelSize});
+            canvas = canvasSFML;
+        }
+
+        sf::RenderTexture& renderTexture = canvasSFML->getRenderTexture();
+        if ((renderTexture.getSize().x < pixelSize.x) || (renderTexture.getSize().y < pixelSize.y))
+            return false;
+
+        // SFML already blends the alpha channel with (One, OneMinusSrcAlpha), so the canvas will contain premultiplied colors
+        renderTexture.clear(sf::Color::Transparent);
+
+        m_screenTarget = m_target;
+        m_target = &renderTexture;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetSFML::unbindRenderTexture(const std::shared_ptr<Widget>& canvas)
+    {
+        TGUI_ASSERT(std::dynamic_pointer_cast<CanvasSFML>(canvas), "BackendRenderTargetSFML requires canvases of type CanvasSFML");
+        std::static_pointer_cast<CanvasSFML>(canvas)->getRenderTexture().display();
+
+        m_target = m_screenTarget;
+        m_screenTarget = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendRenderTargetSFML::updateClipping(FloatRect clipRect, FloatRect clipViewport)
     {
         if ((clipViewport.width > 0) && (clipViewport.height > 0) && (clipRect.width > 0) && (clipRect.height > 0))
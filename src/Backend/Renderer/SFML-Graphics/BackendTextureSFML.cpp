@@ -62,6 +62,27 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool BackendTextureSFML::updateTextureRegion(UIntRect region, const std::uint8_t* pixels)
+    {
+        TGUI_ASSERT((region.left + region.width <= m_imageSize.x) && (region.top + region.height <= m_imageSize.y),
+                    "Region out of range in BackendTextureSFML::updateTextureRegion");
+
+        if (Vector2u{m_texture.getSize()} != m_imageSize)
+            return false;
+
+        if ((region.width == 0) || (region.height == 0))
+            return true;
+
+#if SFML_VERSION_MAJOR >= 3
+        m_texture.update(pixels, {region.width, region.height}, {region.left, region.top});
+#else
+        m_texture.update(pixels, region.width, region.height, region.left, region.top);
+#endif
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendTextureSFML::setSmooth(bool smooth)
     {
         BackendTexture::setSmooth(smooth);
@@ -0,0 +1,561 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2023 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/Backend/Renderer/Software/BackendRenderTargetSoftware.hpp>
+
+#if TGUI_BUILD_AS_CXX_MODULE
+    import tgui;
+#else
+    #include <TGUI/Container.hpp>
+    #include <TGUI/Widgets/ClickableWidget.hpp>
+#endif
+
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
+    #include <array>
+    #include <cmath>
+    #include <cstring>
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #define TGUI_SOFTWARE_RENDERER_USE_SSE2 1
+    #include <emmintrin.h>
+#else
+    #define TGUI_SOFTWARE_RENDERER_USE_SSE2 0
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        // Divides a value in the range [0, 255*255] by 255, rounded to the nearest integer
+        TGUI_NODISCARD std::uint32_t divideBy255(std::uint32_t value)
+        {
+            value += 128;
+            return (value + (value >> 8)) >> 8;
+        }
+
+        TGUI_NODISCARD std::uint32_t packColor(const std::uint8_t color[4])
+        {
+            std::uint32_t packed;
+            std::memcpy(&packed, color, 4);
+            return packed;
+        }
+
+        TGUI_NODISCARD std::uint8_t toColorComponent(float value)
+        {
+            return static_cast<std::uint8_t>(std::max(0.f, std::min(255.f, value)) + 0.5f);
+        }
+
+        // Returns the factors with which the color components and alpha component of the drawn color are multiplied
+        void getSourceFactors(BackendRenderTargetSoftware::BlendMode blendMode, std::uint32_t alpha, std::uint32_t& colorFactor, std::uint32_t& alphaFactor)
+        {
+            colorFactor = (blendMode == BackendRenderTargetSoftware::BlendMode::PremultipliedAlpha) ? 255 : alpha;
+            alphaFactor = (blendMode == BackendRenderTargetSoftware::BlendMode::Alpha) ? alpha : 255;
+        }
+
+        // Blends a color on top of a pixel. With the default blend mode, the same formula is used as
+        // glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA).
+        void blendPixel(std::uint32_t& pixel, const std::uint8_t color[4], BackendRenderTargetSoftware::BlendMode blendMode)
+        {
+            const std::uint32_t alpha = color[3];
+            if (alpha == 0)
+                return;
+
+            if (alpha == 255)
+            {
+                pixel = packColor(color);
+                return;
+            }
+
+            std::uint32_t colorFactor;
+            std::uint32_t alphaFactor;
+            getSourceFactors(blendMode, alpha, colorFactor, alphaFactor);
+
+            std::uint8_t dst[4];
+            std::memcpy(dst, &pixel, 4);
+            for (unsigned int i = 0; i < 3; ++i)
+                dst[i] = static_cast<std::uint8_t>(divideBy255(color[i] * colorFactor + dst[i] * (255 - alpha)));
+            dst[3] = static_cast<std::uint8_t>(divideBy255(color[3] * alphaFactor + dst[3] * (255 - alpha)));
+
+            std::memcpy(&pixel, dst, 4);
+        }
+
+        // Blends a single color on top of a row of pixels. The SIMD and scalar code produce identical results.
+        void blendSpan(std::uint32_t* pixels, std::size_t count, const std::uint8_t color[4], BackendRenderTargetSoftware::BlendMode blendMode)
+        {
+            const std::uint32_t alpha = color[3];
+            if (alpha == 0)
+                return;
+
+            if (alpha == 255)
+            {
+                std::fill_n(pixels, count, packColor(color));
+                return;
+            }
+
+            std::size_t i = 0;
+#if TGUI_SOFTWARE_RENDERER_USE_SSE2
+            std::uint32_t colorFactor;
+            std::uint32_t alphaFactor;
+            getSourceFactors(blendMode, alpha, colorFactor, alphaFactor);
+
+            // Process 4 pixels at once, with every color component widened to 16 bits
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i sourceFactors = _mm_set_epi16(
+                static_cast<short>(alphaFactor), static_cast<short>(colorFactor), static_cast<short>(colorFactor), static_cast<short>(colorFactor),
+                static_cast<short>(alphaFactor), static_cast<short>(colorFactor), static_cast<short>(colorFactor), static_cast<short>(colorFactor));
+            const __m128i colorTerm = _mm_add_epi16(
+                _mm_mullo_epi16(_mm_unpacklo_epi8(_mm_set1_epi32(static_cast<int>(packColor(color))), zero), sourceFactors),
+                _mm_set1_epi16(128));
+            const __m128i inverseAlpha = _mm_set1_epi16(static_cast<short>(255 - alpha));
+            for (; i + 4 <= count; i += 4)
+            {
+                const __m128i dst = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pixels + i));
+                __m128i low = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(dst, zero), inverseAlpha), colorTerm);
+                __m128i high = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(dst, zero), inverseAlpha), colorTerm);
+                low = _mm_srli_epi16(_mm_add_epi16(low, _mm_srli_epi16(low, 8)), 8);
+                high = _mm_srli_epi16(_mm_add_epi16(high, _mm_srli_epi16(high, 8)), 8);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(pixels + i), _mm_packus_epi16(low, high));
+            }
+#endif
+            for (; i < count; ++i)
+                blendPixel(pixels[i], color, blendMode);
+        }
+
+        // Returns the texel at the given position, wrapping around the texture like GL_REPEAT does
+        TGUI_NODISCARD const std::uint8_t* getTexel(const std::uint8_t* texels, Vector2u size, int x, int y)
+        {
+            if (static_cast<unsigned int>(x) >= size.x)
+            {
+                x %= static_cast<int>(size.x);
+                if (x < 0)
+                    x += static_cast<int>(size.x);
+            }
+            if (static_cast<unsigned int>(y) >= size.y)
+            {
+                y %= static_cast<int>(size.y);
+                if (y < 0)
+                    y += static_cast<int>(size.y);
+            }
+
+            return texels + ((static_cast<std::size_t>(y) * size.x) + static_cast<std::size_t>(x)) * 4;
+        }
+
+        // Samples the texture at normalized texture coordinates, the result contains color components in the range [0, 255]
+        void sampleTexture(const BackendTextureSoftware& texture, float u, float v, float result[4])
+        {
+            const Vector2u size = texture.getSize();
+            const std::uint8_t* texels = texture.getTexels();
+            const float x = u * static_cast<float>(size.x);
+            const float y = v * static_cast<float>(size.y);
+
+            if (!texture.isSmooth())
+            {
+                const std::uint8_t* texel = getTexel(texels, size, static_cast<int>(std::floor(x)), static_cast<int>(std::floor(y)));
+                for (unsigned int i = 0; i < 4; ++i)
+                    result[i] = texel[i];
+                return;
+            }
+
+            // Bilinear filtering between the 4 texels that surround the texel centers
+            const float left = std::floor(x - 0.5f);
+            const float top = std::floor(y - 0.5f);
+            const float ratioX = (x - 0.5f) - left;
+            const float ratioY = (y - 0.5f) - top;
+            const int texelX = static_cast<int>(left);
+            const int texelY = static_cast<int>(top);
+            const std::uint8_t* topLeft = getTexel(texels, size, texelX, texelY);
+            const std::uint8_t* topRight = getTexel(texels, size, texelX + 1, texelY);
+            const std::uint8_t* bottomLeft = getTexel(texels, size, texelX, texelY + 1);
+            const std::uint8_t* bottomRight = getTexel(texels, size, texelX + 1, texelY + 1);
+            for (unsigned int i = 0; i < 4; ++i)
+            {
+                const float topValue = topLeft[i] + (topRight[i] - topLeft[i]) * ratioX;
+                const float bottomValue = bottomLeft[i] + (bottomRight[i] - bottomLeft[i]) * ratioX;
+                result[i] = topValue + (bottomValue - topValue) * ratioY;
+            }
+        }
+
+        // There is no canvas widget for the software renderer, so containers that cache their contents use this minimal
+        // widget, which draws the pixels that were copied into its texture.
+        class RenderCacheCanvasSoftware : public ClickableWidget
+        {
+        public:
+            RenderCacheCanvasSoftware() :
+                ClickableWidget{"RenderCacheCanvasSoftware", true}
+            {
+            }
+
+            void draw(BackendRenderTarget& target, RenderStates states) const override
+            {
+                const Vector2f size = getSize();
+                const Vertex::Color vertexColor(Color::applyOpacity(Color::White, m_opacityCached));
+                const std::array<Vertex, 4> vertices = {{
+                    {{0, 0}, vertexColor, {0, 0}},
+                    {{size.x, 0}, vertexColor, {1, 0}},
+                    {{0, size.y}, vertexColor, {0, 1}},
+                    {{size.x, size.y}, vertexColor, {1, 1}},
+                }};
+                const std::array<unsigned int, 6> indices = {{
+                    0, 2, 1,
+                    1, 2, 3
+                }};
+                target.drawVertexArray(states, vertices.data(), vertices.size(), indices.data(), indices.size(), texture);
+            }
+
+            TGUI_NODISCARD Widget::Ptr clone() const override
+            {
+                return std::make_shared<RenderCacheCanvasSoftware>(*this);
+            }
+
+            std::shared_ptr<BackendTextureSoftware> texture = std::make_shared<BackendTextureSoftware>();
+        };
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    BackendRenderTargetSoftware::BackendRenderTargetSoftware(Vector2u size) :
+        m_size{size},
+        m_pixels(static_cast<std::size_t>(size.x) * size.y, 0)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Vector2u BackendRenderTargetSoftware::getSize() const
+    {
+        return m_size;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::uint8_t* BackendRenderTargetSoftware::getPixels() const
+    {
+        return reinterpret_cast<const std::uint8_t*>(m_pixels.data());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetSoftware::setClearColor(const Color& color)
+    {
+        BackendRenderTarget::setClearColor(color);
+
+        const std::uint8_t components[4] = {color.getRed(), color.getGreen(), color.getBlue(), color.getAlpha()};
+        m_clearPixel = packColor(components);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetSoftware::clearScreen()
+    {
+        std::fill(m_pixels.begin(), m_pixels.end(), m_clearPixel);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetSoftware::setView(FloatRect view, FloatRect viewport, Vector2f targetSize)
+    {
+        BackendRenderTarget::setView(view, viewport, targetSize);
+
+        m_projectionTransform = Transform();
+        m_projectionTransform.translate({viewport.left - ((view.left / view.width) * viewport.width),
+                                         viewport.top - ((view.top / view.height) * viewport.height)});
+        m_projectionTransform.scale({viewport.width / view.width, viewport.height / view.height});
+
+        // Allow drawing outside drawGui by clipping to the viewport until a clipping layer is added
+        updateClipping(view, viewport);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetSoftware::drawGui(const std::shared_ptr<RootContainer>& root)
+    {
+        if (m_pixels.empty() || (m_viewRect.width <= 0) || (m_viewRect.height <= 0))
+            return;
+
+        updateClipping(m_viewRect, m_viewport);
+
+        // Draw the widgets
+        root->draw(*this, {});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetSoftware::drawVertexArray(const RenderStates& states, const Vertex* vertices,
+        std::size_t vertexCount, const unsigned int* indices, std::size_t indexCount, const std::shared_ptr<BackendTexture>& texture)
+    {
+        const BackendTextureSoftware* textureSoftware = nullptr;
+        if (texture)
+        {
+            TGUI_ASSERT(std::dynamic_pointer_cast<BackendTextureSoftware>(texture), "BackendRenderTargetSoftware requires textures of type BackendTextureSoftware");
+            textureSoftware = static_cast<const BackendTextureSoftware*>(texture.get());
+
+            // There is nothing to sample from when the texture was never loaded
+            if (!textureSoftware->getTexels())
+                return;
+        }
+
+        if ((m_clipLeft >= m_clipRight) || (m_clipTop >= m_clipBottom))
+            return;
+
+        const Transform finalTransform = m_projectionTransform * states.transform;
+        m_transformedPositions.resize(vertexCount);
+        for (std::size_t i = 0; i < vertexCount; ++i)
+            m_transformedPositions[i] = finalTransform.transformPoint(vertices[i].position);
+
+        // Without indices, every 3 consecutive vertices form a triangle
+        const std::size_t triangleIndexCount = indices ? indexCount : vertexCount;
+        for (std::size_t i = 0; i + 2 < triangleIndexCount; i += 3)
+        {
+            const Vertex* triangleVertices[3];
+            Vector2f trianglePositions[3];
+            for (unsigned int j = 0; j < 3; ++j)
+            {
+                const std::size_t index = indices ? indices[i + j] : (i + j);
+                TGUI_ASSERT(index < vertexCount, "Index out of range in BackendRenderTargetSoftware::drawVertexArray");
+
+                triangleVertices[j] = &vertices[index];
+                trianglePositions[j] = m_transformedPositions[index];
+            }
+
+            rasterizeTriangle(triangleVertices, trianglePositions, textureSoftware);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetSoftware::drawRenderTexture(const RenderStates& states, Vector2f size, Vector2u pixelSize, const std::shared_ptr<Widget>& canvas)
+    {
+        // The pixels in the canvas were stored with premultiplied alpha
+        const BlendMode oldBlendMode = m_blendMode;
+        m_blendMode = BlendMode::PremultipliedAlpha;
+        BackendRenderTarget::drawRenderTexture(states, size, pixelSize, canvas);
+        m_blendMode = oldBlendMode;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendRenderTargetSoftware::bindRenderTexture(std::shared_ptr<Widget>& canvas, Vector2u pixelSize)
+    {
+        if (!std::dynamic_pointer_cast<RenderCacheCanvasSoftware>(canvas))
+            canvas = std::make_shared<RenderCacheCanvasSoftware>();
+
+        canvas->setSize(Vector2f{pixelSize});
+
+        // Draw to a transparent framebuffer with the size of the canvas, the pixels are copied to the canvas afterwards
+        m_screenSize = m_size;
+        m_screenPixels = std::move(m_pixels);
+        m_size = pixelSize;
+        m_pixels.assign(static_cast<std::size_t>(pixelSize.x) * pixelSize.y, 0);
+
+        // Blending the alpha channel with (GL_ONE, GL_ONE_MINUS_SRC_ALPHA) results in colors with premultiplied alpha
+        m_blendMode = BlendMode::AlphaToTexture;
+
+        setView(m_viewRect, m_viewport, m_targetSize);
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetSoftware::unbindRenderTexture(const std::shared_ptr<Widget>& canvas)
+    {
+        TGUI_ASSERT(std::dynamic_pointer_cast<RenderCacheCanvasSoftware>(canvas), "BackendRenderTargetSoftware requires canvases that it created itself");
+        std::static_pointer_cast<RenderCacheCanvasSoftware>(canvas)->texture->loadTextureOnly(m_size, reinterpret_cast<const std::uint8_t*>(m_pixels.data()), false);
+
+        m_size = m_screenSize;
+        m_pixels = std::move(m_screenPixels);
+        m_screenPixels.clear();
+        m_blendMode = BlendMode::Alpha;
+
+        setView(m_viewRect, m_viewport, m_targetSize);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetSoftware::updateClipping(FloatRect clipRect, FloatRect clipViewport)
+    {
+        if ((clipViewport.width > 0) && (clipViewport.height > 0) && (clipRect.width > 0) && (clipRect.height > 0))
+        {
+            m_pixelsPerPoint = {clipViewport.width / clipRect.width, clipViewport.height / clipRect.height};
+
+            // The rectangle is rounded the same way as the scissor rectangle in the OpenGL renderers
+            const int left = static_cast<int>(clipViewport.left);
+            const int top = static_cast<int>(clipViewport.top);
+            m_clipLeft = std::max(0, left);
+            m_clipTop = std::max(0, top);
+            m_clipRight = std::min(static_cast<int>(m_size.x), left + static_cast<int>(clipViewport.width));
+            m_clipBottom = std::min(static_cast<int>(m_size.y), top + static_cast<int>(clipViewport.height));
+        }
+        else // Clip the entire window
+        {
+            m_pixelsPerPoint = {1, 1};
+
+            m_clipLeft = 0;
+            m_clipTop = 0;
+            m_clipRight = 0;
+            m_clipBottom = 0;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetSoftware::rasterizeTriangle(const Vertex* vertices[3], const Vector2f positions[3], const BackendTextureSoftware* texture)
+    {
+        // Order the vertices so that the area is positive. Points inside the triangle are then on the same side of each edge.
+        unsigned int second = 1;
+        unsigned int third = 2;
+        float area = ((positions[1].x - positions[0].x) * (positions[2].y - positions[0].y))
+                   - ((positions[1].y - positions[0].y) * (positions[2].x - positions[0].x));
+        if (area == 0)
+            return;
+
+        if (area < 0)
+        {
+            std::swap(second, third);
+            area = -area;
+        }
+
+        const Vector2f points[3] = {positions[0], positions[second], positions[third]};
+        const Vertex& vertexA = *vertices[0];
+        const Vertex& vertexB = *vertices[second];
+        const Vertex& vertexC = *vertices[third];
+
+        // Only rows of which the pixel center lies inside the triangle are drawn. The top edge is included, the bottom one isn't.
+        const float minY = std::min({points[0].y, points[1].y, points[2].y});
+        const float maxY = std::max({points[0].y, points[1].y, points[2].y});
+        const float firstRow = std::max(static_cast<float>(m_clipTop), std::ceil(minY - 0.5f));
+        const float lastRow = std::min(static_cast<float>(m_clipBottom), std::ceil(maxY - 0.5f));
+        if (firstRow >= lastRow)
+            return;
+
+        const int rowBegin = static_cast<int>(firstRow);
+        const int rowEnd = static_cast<int>(lastRow);
+
+        // Every attribute is a linear function of the pixel position: value = valueAtA + (x - A.x) * deltaX + (y - A.y) * deltaY
+        const Vector2f offsetB = points[1] - points[0];
+        const Vector2f offsetC = points[2] - points[0];
+        const float startValues[6] = {
+            static_cast<float>(vertexA.color.red), static_cast<float>(vertexA.color.green),
+            static_cast<float>(vertexA.color.blue), static_cast<float>(vertexA.color.alpha),
+            vertexA.texCoords.x, vertexA.texCoords.y
+        };
+        const float valuesB[6] = {
+            static_cast<float>(vertexB.color.red), static_cast<float>(vertexB.color.green),
+            static_cast<float>(vertexB.color.blue), static_cast<float>(vertexB.color.alpha),
+            vertexB.texCoords.x, vertexB.texCoords.y
+        };
+        const float valuesC[6] = {
+            static_cast<float>(vertexC.color.red), static_cast<float>(vertexC.color.green),
+            static_cast<float>(vertexC.color.blue), static_cast<float>(vertexC.color.alpha),
+            vertexC.texCoords.x, vertexC.texCoords.y
+        };
+
+        float deltaX[6];
+        float deltaY[6];
+        for (unsigned int i = 0; i < 6; ++i)
+        {
+            const float diffB = valuesB[i] - startValues[i];
+            const float diffC = valuesC[i] - startValues[i];
+            deltaX[i] = ((diffB * offsetC.y) - (diffC * offsetB.y)) / area;
+            deltaY[i] = ((diffC * offsetB.x) - (diffB * offsetC.x)) / area;
+        }
+
+        const bool uniformColor = !texture
+            && (std::memcmp(&vertexA.color, &vertexB.color, sizeof(Vertex::Color)) == 0)
+            && (std::memcmp(&vertexA.color, &vertexC.color, sizeof(Vertex::Color)) == 0);
+        const std::uint8_t uniformColorComponents[4] = {vertexA.color.red, vertexA.color.green, vertexA.color.blue, vertexA.color.alpha};
+
+        for (int row = rowBegin; row < rowEnd; ++row)
+        {
+            const float centerY = static_cast<float>(row) + 0.5f;
+
+            // Find the horizontal range of the row that lies on the inner side of all 3 edges
+            float spanLeft = static_cast<float>(m_clipLeft);
+            float spanRight = static_cast<float>(m_clipRight);
+            bool spanEmpty = false;
+            for (unsigned int i = 0; i < 3; ++i)
+            {
+                const Vector2f& edgeStart = points[i];
+                const Vector2f& edgeEnd = points[(i + 1) % 3];
+                const float edgeDiffY = edgeEnd.y - edgeStart.y;
+                const float edgeValue = ((edgeEnd.x - edgeStart.x) * (centerY - edgeStart.y)) + (edgeDiffY * edgeStart.x);
+                if (edgeDiffY > 0)
+                    spanRight = std::min(spanRight, std::ceil((edgeValue / edgeDiffY) - 0.5f));
+                else if (edgeDiffY < 0)
+                    spanLeft = std::max(spanLeft, std::ceil((edgeValue / edgeDiffY) - 0.5f));
+                else if (edgeValue < 0)
+                    spanEmpty = true;
+            }
+
+            if (spanEmpty || (spanLeft >= spanRight))
+                continue;
+
+            const int columnBegin = static_cast<int>(spanLeft);
+            const int columnEnd = static_cast<int>(spanRight);
+            std::uint32_t* pixels = &m_pixels[(static_cast<std::size_t>(row) * m_size.x) + static_cast<std::size_t>(columnBegin)];
+            if (uniformColor)
+            {
+                blendSpan(pixels, static_cast<std::size_t>(columnEnd - columnBegin), uniformColorComponents, m_blendMode);
+                continue;
+            }
+
+            const float startX = static_cast<float>(columnBegin) + 0.5f - points[0].x;
+            const float startY = centerY - points[0].y;
+            float values[6];
+            for (unsigned int i = 0; i < 6; ++i)
+                values[i] = startValues[i] + (startX * deltaX[i]) + (startY * deltaY[i]);
+
+            for (int column = columnBegin; column < columnEnd; ++column, ++pixels)
+            {
+                std::uint8_t color[4];
+                if (texture)
+                {
+                    float texel[4];
+                    sampleTexture(*texture, values[4], values[5], texel);
+                    for (unsigned int i = 0; i < 4; ++i)
+                        color[i] = toColorComponent(values[i] * texel[i] / 255.f);
+                }
+                else
+                {
+                    for (unsigned int i = 0; i < 4; ++i)
+                        color[i] = toColorComponent(values[i]);
+                }
+
+                blendPixel(*pixels, color, m_blendMode);
+
+                for (unsigned int i = 0; i < 6; ++i)
+                    values[i] += deltaX[i];
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,115 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2023 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/Backend/Renderer/Software/BackendTextureSoftware.hpp>
+
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendTextureSoftware::loadTextureOnly(Vector2u size, const std::uint8_t* pixels, bool smooth)
+    {
+        BackendTexture::loadTextureOnly(size, pixels, smooth);
+
+        const std::size_t byteCount = static_cast<std::size_t>(size.x) * size.y * 4;
+        if (pixels)
+            m_texels.assign(pixels, pixels + byteCount);
+        else
+            m_texels.assign(byteCount, 0);
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendTextureSoftware::loadAlphaTextureOnly(Vector2u size, const std::uint8_t* pixels, bool smooth)
+    {
+        BackendTexture::loadTextureOnly(size, nullptr, smooth);
+        m_isAlphaTexture = true;
+
+        // The texels are stored as white RGBA pixels so that the render target doesn't need to know about the format
+        const std::size_t pixelCount = static_cast<std::size_t>(size.x) * size.y;
+        m_texels.resize(pixelCount * 4);
+        for (std::size_t i = 0; i < pixelCount; ++i)
+        {
+            m_texels[(i * 4) + 0] = 255;
+            m_texels[(i * 4) + 1] = 255;
+            m_texels[(i * 4) + 2] = 255;
+            m_texels[(i * 4) + 3] = pixels ? pixels[i] : 0;
+        }
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendTextureSoftware::updateTextureRegion(UIntRect region, const std::uint8_t* pixels)
+    {
+        TGUI_ASSERT((region.left + region.width <= m_imageSize.x) && (region.top + region.height <= m_imageSize.y),
+                    "Region out of range in BackendTextureSoftware::updateTextureRegion");
+
+        if (m_texels.empty())
+            return false;
+
+        const std::size_t rowBytes = static_cast<std::size_t>(region.width) * 4;
+        for (unsigned int y = 0; y < region.height; ++y)
+        {
+            std::uint8_t* dstRow = &m_texels[((static_cast<std::size_t>(region.top + y) * m_imageSize.x) + region.left) * 4];
+            if (m_isAlphaTexture)
+            {
+                const std::uint8_t* srcRow = pixels + (static_cast<std::size_t>(y) * region.width);
+                for (unsigned int x = 0; x < region.width; ++x)
+                    dstRow[(x * 4) + 3] = srcRow[x];
+            }
+            else
+            {
+                const std::uint8_t* srcRow = pixels + (y * rowBytes);
+                std::copy(srcRow, srcRow + rowBytes, dstRow);
+            }
+        }
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::uint8_t* BackendTextureSoftware::getTexels() const
+    {
+        if (m_texels.empty())
+            return nullptr;
+
+        return m_texels.data();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
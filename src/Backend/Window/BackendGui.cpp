@@ -28,6 +28,11 @@
 #include <TGUI/ToolTip.hpp>
 #include <TGUI/Timer.hpp>
 
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
+    #include <cmath>
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
@@ -228,7 +233,107 @@ namespace tgui
             updateTime();
 
         TGUI_ASSERT(m_backendRenderTarget != nullptr, "Gui must be given a window (or render target) before calling draw()");
-        m_backendRenderTarget->drawGui(m_container);
+        if (!m_partialRedrawEnabled || m_fullRedrawRequired)
+            m_backendRenderTarget->drawGui(m_container);
+        else if (!m_invalidatedRegions.empty())
+        {
+            m_container->setRedrawRegions(std::move(m_invalidatedRegions));
+            m_backendRenderTarget->drawGui(m_container);
+            m_container->setRedrawRegions({});
+        }
+
+        m_invalidatedRegions.clear();
+        m_fullRedrawRequired = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGui::setPartialRedrawEnabled(bool enabled)
+    {
+        m_partialRedrawEnabled = enabled;
+        m_fullRedrawRequired = true;
+        m_invalidatedRegions.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendGui::isPartialRedrawEnabled() const
+    {
+        return m_partialRedrawEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGui::invalidate()
+    {
+        m_fullRedrawRequired = true;
+        m_invalidatedRegions.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendGui::invalidateRect(FloatRect rect)
+    {
+        if (!m_partialRedrawEnabled || m_fullRedrawRequired)
+            return;
+
+        // Round the region outwards to whole units and add a small margin for anti-aliased edges and outlines
+        const float left = std::floor(rect.left) - 1;
+        const float top = std::floor(rect.top) - 1;
+        const float right = std::ceil(rect.left + rect.width) + 1;
+        const float bottom = std::ceil(rect.top + rect.height) + 1;
+
+        const FloatRect& viewRect = m_view.getRect();
+        FloatRect region{std::max(left, viewRect.left), std::max(top, viewRect.top), 0, 0};
+        region.width = std::min(right, viewRect.left + viewRect.width) - region.left;
+        region.height = std::min(bottom, viewRect.top + viewRect.height) - region.top;
+        if ((region.width <= 0) || (region.height <= 0))
+            return;
+
+        // Merge the region with all regions that it overlaps. Every merge can make the region overlap with regions that were
+        // already checked, so we have to restart the search after each merge.
+        auto it = m_invalidatedRegions.begin();
+        while (it != m_invalidatedRegions.end())
+        {
+            if (!region.intersects(*it))
+            {
+                ++it;
+                continue;
+            }
+
+            const float mergedLeft = std::min(region.left, it->left);
+            const float mergedTop = std::min(region.top, it->top);
+            region.width = std::max(region.left + region.width, it->left + it->width) - mergedLeft;
+            region.height = std::max(region.top + region.height, it->top + it->height) - mergedTop;
+            region.left = mergedLeft;
+            region.top = mergedTop;
+
+            m_invalidatedRegions.erase(it);
+            it = m_invalidatedRegions.begin();
+        }
+
+        // Redrawing many small regions separately becomes slower than simply redrawing everything
+        if (m_invalidatedRegions.size() >= 16)
+        {
+            invalidate();
+            return;
+        }
+
+        m_invalidatedRegions.push_back(region);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendGui::isRedrawRequired() const
+    {
+        return !m_partialRedrawEnabled || m_fullRedrawRequired || !m_invalidatedRegions.empty();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendGui::isFullRedrawRequired() const
+    {
+        return !m_partialRedrawEnabled || m_fullRedrawRequired;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -612,6 +717,7 @@ namespace tgui
             m_backendRenderTarget->setView(m_view.getRect(), m_viewport.getRect(), {static_cast<float>(m_framebufferSize.x), static_cast<float>(m_framebufferSize.y)});
 
         m_container->setSize(Vector2f{m_view.getWidth(), m_view.getHeight()});
+        m_fullRedrawRequired = true;
 
         // Derived classes should update m_view in their updateContainerSize() function before calling this function
         const FloatRect& viewRect = m_view.getRect();
@@ -486,7 +486,15 @@ namespace tgui
                 continue;
             }
 
-            m_backendRenderTarget->clearScreen();
+            // When only parts of the screen are redrawn, nothing has to be presented if nothing changed
+            if (!isRedrawRequired())
+            {
+                refreshRequired = false;
+                continue;
+            }
+
+            if (isFullRedrawRequired())
+                m_backendRenderTarget->clearScreen();
             draw();
             presentScreen(); // Call SDL_GL_SwapWindow or SDL_RenderPresent depending on the backend renderer
 
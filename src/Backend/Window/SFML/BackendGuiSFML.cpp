@@ -273,7 +273,15 @@ namespace tgui
                 continue;
             }
 
-            m_backendRenderTarget->clearScreen();
+            // When only parts of the screen are redrawn, nothing has to be presented if nothing changed
+            if (!isRedrawRequired())
+            {
+                refreshRequired = false;
+                continue;
+            }
+
+            if (isFullRedrawRequired())
+                m_backendRenderTarget->clearScreen();
             draw();
             m_window->display();
 
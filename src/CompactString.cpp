@@ -0,0 +1,134 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2023 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/CompactString.hpp>
+#include <TGUI/Utf.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        // Encodes the characters as UTF-8 and returns how many of them were stored. Characters that can't be encoded
+        // (e.g. surrogates) are skipped in the same way as when converting a String to std::string.
+        std::size_t encodeUtf8(const char32_t* begin, const char32_t* end, std::string& outStrUtf8)
+        {
+            std::size_t length = 0;
+            outStrUtf8.clear();
+            outStrUtf8.reserve(static_cast<std::size_t>(end - begin) + 1);
+            for (const char32_t* it = begin; it != end; ++it)
+            {
+                const std::size_t oldSize = outStrUtf8.size();
+                utf::encodeCharUtf8(*it, outStrUtf8);
+                if (outStrUtf8.size() != oldSize)
+                    ++length;
+            }
+            return length;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    CompactString::CompactString(const String& str) :
+        m_length{str.length()}
+    {
+        // Characters that need multiple bytes are rare in most strings, so first try to store the string as ASCII
+        m_utf8.resize(m_length);
+        for (std::size_t i = 0; i < m_length; ++i)
+        {
+            if (str[i] >= 0x80)
+            {
+                m_length = encodeUtf8(str.data(), str.data() + str.length(), m_utf8);
+                return;
+            }
+
+            m_utf8[i] = static_cast<char>(str[i]);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    CompactString::CompactString(const std::string& str) :
+        m_utf8{str},
+        m_length{str.length()}
+    {
+        // Only ASCII can be stored as-is. Other strings are decoded and encoded again, so that malformed UTF-8 is
+        // replaced in the same way as by utf::convertUtf8toUtf32 and the length always matches the stored characters.
+        for (const char c : str)
+        {
+            if (static_cast<unsigned char>(c) >= 0x80)
+            {
+                const std::u32string strUtf32 = utf::convertUtf8toUtf32(str.data(), str.data() + str.length());
+                m_length = encodeUtf8(strUtf32.data(), strUtf32.data() + strUtf32.length(), m_utf8);
+                return;
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    CompactString::CompactString(const char* str) :
+        CompactString{std::string(str)}
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    String CompactString::toString() const
+    {
+        if (!isAscii())
+            return utf::convertUtf8toUtf32(m_utf8.data(), m_utf8.data() + m_utf8.length());
+
+        std::u32string str(m_length, U'\0');
+        for (std::size_t i = 0; i < m_length; ++i)
+            str[i] = static_cast<char32_t>(static_cast<unsigned char>(m_utf8[i]));
+
+        return str;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool CompactString::equals(const String& str) const
+    {
+        if (str.length() != m_length)
+            return false;
+
+        if (!isAscii())
+            return utf::convertUtf8toUtf32(m_utf8.data(), m_utf8.data() + m_utf8.length()) == str;
+
+        for (std::size_t i = 0; i < m_length; ++i)
+        {
+            if (static_cast<char32_t>(static_cast<unsigned char>(m_utf8[i])) != str[i])
+                return false;
+        }
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
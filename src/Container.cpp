@@ -88,7 +88,7 @@ namespace tgui
         {
             auto node = std::make_unique<DataIO::Node>();
             node->name = name;
-            for (const auto& pair : renderer->propertyValuePairs)
+            for (const auto& pair : renderer->getMergedPropertyValuePairs())
             {
                 if (pair.second.getType() == ObjectConverter::Type::RendererData)
                 {
@@ -99,7 +99,7 @@ namespace tgui
                     if (rendererRootNode->propertyValuePairs.empty() && (rendererRootNode->children.size() == 1))
                         rendererRootNode = std::move(rendererRootNode->children[0]);
 
-                    rendererRootNode->name = pair.first;
+                    rendererRootNode->name = pair.first.getName();
                     node->children.push_back(std::move(rendererRootNode));
                 }
                 else
@@ -111,10 +111,10 @@ namespace tgui
                         continue;
 
                     // Skip "Font = null"
-                    if (pair.first == U"Font" && value == U"null")
+                    if ((pair.first == Property::Font) && (value == U"null"))
                         continue;
 
-                    node->propertyValuePairs[pair.first] = std::make_unique<DataIO::ValueNode>(value);
+                    node->propertyValuePairs[pair.first.getName()] = std::make_unique<DataIO::ValueNode>(value);
                 }
             }
 
@@ -170,7 +170,8 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Container::Container(const Container& other) :
-        Widget{other}
+        Widget{other},
+        m_renderCacheEnabled{other.m_renderCacheEnabled}
     {
         // Widgets with layouts that refer to each other need to be added simultaneously.
         // They all need to be in m_widgets before setParent is called on the first widget,
@@ -191,7 +192,8 @@ namespace tgui
         m_widgetBelowMouse        {std::move(other.m_widgetBelowMouse)},
         m_widgetWithLeftMouseDown {std::move(other.m_widgetWithLeftMouseDown)},
         m_widgetWithRightMouseDown{std::move(other.m_widgetWithRightMouseDown)},
-        m_focusedWidget           {std::move(other.m_focusedWidget)}
+        m_focusedWidget           {std::move(other.m_focusedWidget)},
+        m_renderCacheEnabled      {other.m_renderCacheEnabled}
     {
         // Parent of all widgets should be set to nullptr first, in case widgets have layouts depending on each other.
         // Otherwise calling setParent on one widget could cause another widget's position to be recalculated which could
@@ -228,6 +230,10 @@ namespace tgui
             m_widgetWithRightMouseDown = nullptr;
             m_focusedWidget = nullptr;
 
+            m_renderCacheEnabled = right.m_renderCacheEnabled;
+            m_renderCacheValid = false;
+            m_renderCacheCanvas = nullptr;
+
             // Remove all the old widgets
             Container::removeAllWidgets();
 
@@ -257,6 +263,9 @@ namespace tgui
             m_widgetWithLeftMouseDown  = std::move(right.m_widgetWithLeftMouseDown);
             m_widgetWithRightMouseDown = std::move(right.m_widgetWithRightMouseDown);
             m_focusedWidget            = std::move(right.m_focusedWidget);
+            m_renderCacheEnabled       = right.m_renderCacheEnabled;
+            m_renderCacheValid         = false;
+            m_renderCacheCanvas        = nullptr;
             Widget::operator=(std::move(right));
 
             // Parent of all widgets should be set to nullptr first, in case widgets have layouts depending on each other.
@@ -304,6 +313,7 @@ namespace tgui
             widgetPtr->setWidgetName(widgetName);
 
         widgetAdded(widgetPtr);
+        widgetPtr->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -370,6 +380,7 @@ namespace tgui
             }
 
             // Remove the widget
+            widget->invalidate();
             widget->setParent(nullptr);
             m_widgets.erase(m_widgets.begin() + static_cast<std::ptrdiff_t>(i));
             return true;
@@ -385,6 +396,7 @@ namespace tgui
         if (m_mouseHover && m_parentGui && (m_mouseCursor != Cursor::Type::Arrow))
             m_parentGui->requestMouseCursor(m_mouseCursor);
 
+        invalidate();
         for (const auto& widget : m_widgets)
             widget->setParent(nullptr);
 
@@ -431,9 +443,7 @@ namespace tgui
         if (!fileContents)
             throw Exception{U"Failed to open '" + filenameInResources + U"' to load the widgets from it."};
 
-        /// TODO: Optimize this (parse function should be able to use a string view directly on file contents)
-        std::stringstream stream{std::string{reinterpret_cast<const char*>(fileContents.get()), fileSize}};
-        const auto rootNode = DataIO::parse(stream);
+        const auto rootNode = DataIO::parse(CharStringView{reinterpret_cast<const char*>(fileContents.get()), fileSize});
 
         // All files need to be loaded relative to the form file
         const auto& parentPath = Filesystem::Path(filename).getParentPath();
@@ -603,6 +613,7 @@ namespace tgui
 
             // Remove the old widget
             m_widgets.erase(m_widgets.begin() + static_cast<std::ptrdiff_t>(i));
+            widget->invalidate();
             break;
         }
     }
@@ -623,6 +634,7 @@ namespace tgui
 
             // Remove the old widget
             m_widgets.erase(m_widgets.begin() + static_cast<std::ptrdiff_t>(i + 1));
+            widget->invalidate();
             break;
         }
     }
@@ -641,6 +653,7 @@ namespace tgui
                 return m_widgets.size() - 1;
 
             std::swap(m_widgets[i], m_widgets[i+1]);
+            widget->invalidate();
             return i + 1;
         }
 
@@ -662,6 +675,7 @@ namespace tgui
                 return 0;
 
             std::swap(m_widgets[i-2], m_widgets[i-1]);
+            widget->invalidate();
             return i-2;
         }
 
@@ -695,6 +709,7 @@ namespace tgui
         // Move the widget to the new index
         m_widgets.erase(m_widgets.begin() + static_cast<std::ptrdiff_t>(currentWidgetIndex));
         m_widgets.insert(m_widgets.begin() + static_cast<std::ptrdiff_t>(index), widget);
+        widget->invalidate();
         return true;
     }
 
@@ -863,6 +878,47 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::setRenderCacheEnabled(bool enabled)
+    {
+        m_renderCacheEnabled = enabled;
+        m_renderCacheValid = false;
+
+        // Release the memory of the texture when it is no longer needed
+        if (!m_renderCacheEnabled)
+            m_renderCacheCanvas = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::isRenderCacheEnabled() const
+    {
+        return m_renderCacheEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Container::getRenderCacheHits() const
+    {
+        return m_renderCacheHits;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Container::getRenderCacheMisses() const
+    {
+        return m_renderCacheMisses;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::invalidate()
+    {
+        m_renderCacheValid = false;
+        Widget::invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Container::childWidgetFocused(const Widget::Ptr& child)
     {
         if (m_focusedWidget != child)
@@ -1011,16 +1067,16 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Container::rendererChanged(const String& property)
+    void Container::rendererChanged(PropertyId property)
     {
         Widget::rendererChanged(property);
 
-        if ((property == U"Opacity") || (property == U"OpacityDisabled"))
+        if ((property == Property::Opacity) || (property == Property::OpacityDisabled))
         {
             for (const auto& widget : m_widgets)
                 widget->setInheritedOpacity(m_opacityCached);
         }
-        else if (property == U"Font")
+        else if (property == Property::Font)
         {
             for (const auto& widget : m_widgets)
             {
@@ -1235,13 +1291,21 @@ namespace tgui
     bool Container::updateTime(Duration elapsedTime)
     {
         bool screenRefreshRequired = Widget::updateTime(elapsedTime);
+        if (screenRefreshRequired)
+            invalidate();
 
         // Loop through all widgets
         for (auto& widget : m_widgets)
         {
             // Update the elapsed time in widgets that need it
-            if (widget->isVisible())
-                screenRefreshRequired |= widget->updateTime(elapsedTime);
+            if (!widget->isVisible() || !widget->updateTime(elapsedTime))
+                continue;
+
+            // Child containers already invalidated the parts of them that changed
+            if (!widget->isContainer())
+                widget->invalidate();
+
+            screenRefreshRequired = true;
         }
 
         return screenRefreshRequired;
@@ -1249,6 +1313,57 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::invalidateChildArea(FloatRect area)
+    {
+        m_renderCacheValid = false;
+
+        const Vector2f childOffset = getChildWidgetsOffset();
+        area.left += childOffset.x;
+        area.top += childOffset.y;
+
+        if (m_parent)
+            invalidateRect(area);
+        else if (m_parentGui && m_visible)
+            m_parentGui->invalidateRect(area);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::drawWithRenderCache(BackendRenderTarget& target, const RenderStates& states) const
+    {
+        const FloatRect area{getWidgetOffset(), getFullSize()};
+        const Vector2u pixelSize = target.mapSizeToPixels(area.getSize());
+
+        if (m_renderCacheValid && m_renderCacheCanvas && (area == m_renderCacheArea) && (pixelSize == m_renderCachePixelSize))
+            ++m_renderCacheHits;
+        else
+        {
+            // Draw the container to the texture, with the top-left corner of the widget in the top-left corner of the texture
+            RenderStates textureStates;
+            textureStates.transform.translate(-area.getPosition());
+            if (!target.beginRenderToTexture(m_renderCacheCanvas, area.getSize(), pixelSize))
+            {
+                // The render target doesn't support drawing to textures, so we just draw the container directly
+                draw(target, states);
+                return;
+            }
+
+            draw(target, textureStates);
+            target.endRenderToTexture();
+
+            m_renderCacheArea = area;
+            m_renderCachePixelSize = pixelSize;
+            m_renderCacheValid = true;
+            ++m_renderCacheMisses;
+        }
+
+        RenderStates textureStates = states;
+        textureStates.transform.translate(area.getPosition());
+        target.drawRenderTexture(textureStates, area.getSize(), pixelSize, m_renderCacheCanvas);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Container::setParent(Container* parent)
     {
         const BackendGui* oldParentGui = m_parentGui;
@@ -1318,27 +1433,36 @@ namespace tgui
             if (!widget->isVisible())
                 continue;
 
-            const Vector2f origin{widget->getOrigin().x * widget->getSize().x, widget->getOrigin().y * widget->getSize().y};
-
             RenderStates widgetStates = states;
-            widgetStates.transform.translate(widget->getPosition() - origin);
-            if (widget->getRotation() != 0)
-            {
-                const Vector2f rotOrigin{widget->getRotationOrigin().x * widget->getSize().x, widget->getRotationOrigin().y * widget->getSize().y};
-                widgetStates.transform.rotate(widget->getRotation(), rotOrigin);
-            }
-            if ((widget->getScale().x != 1) || (widget->getScale().y != 1))
-            {
-                const Vector2f scaleOrigin{widget->getScaleOrigin().x * widget->getSize().x, widget->getScaleOrigin().y * widget->getSize().y};
-                widgetStates.transform.scale(widget->getScale(), scaleOrigin);
-            }
-
+            widgetStates.transform.combine(getChildWidgetTransform(*widget));
             target.drawWidget(widgetStates, widget);
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Transform Container::getChildWidgetTransform(const Widget& widget)
+    {
+        const Vector2f origin{widget.getOrigin().x * widget.getSize().x, widget.getOrigin().y * widget.getSize().y};
+
+        Transform transform;
+        transform.translate(widget.getPosition() - origin);
+        if (widget.getRotation() != 0)
+        {
+            const Vector2f rotOrigin{widget.getRotationOrigin().x * widget.getSize().x, widget.getRotationOrigin().y * widget.getSize().y};
+            transform.rotate(widget.getRotation(), rotOrigin);
+        }
+        if ((widget.getScale().x != 1) || (widget.getScale().y != 1))
+        {
+            const Vector2f scaleOrigin{widget.getScaleOrigin().x * widget.getSize().x, widget.getScaleOrigin().y * widget.getSize().y};
+            transform.scale(widget.getScale(), scaleOrigin);
+        }
+
+        return transform;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     std::size_t Container::getFocusedWidgetIndex() const
     {
         for (std::size_t i = 0; i < m_widgets.size(); ++i)
@@ -1554,8 +1678,59 @@ namespace tgui
 
     void RootContainer::draw(BackendRenderTarget& target, RenderStates states) const
     {
-        // The only reason to override this function was to change the access specifier, so just call the code from the base class
-        Container::draw(target, states);
+        if (m_redrawRegions.empty())
+        {
+            Container::draw(target, states);
+            return;
+        }
+
+        // Only draw the parts of the screen that changed, the rest of the screen still contains the previous frame.
+        // The bounds of the widgets are calculated once, so that widgets outside a region can be skipped without being drawn.
+        struct VisibleWidget
+        {
+            const Widget::Ptr* widget;
+            Transform transform;
+            FloatRect bounds;
+        };
+
+        std::vector<VisibleWidget> visibleWidgets;
+        visibleWidgets.reserve(m_widgets.size());
+        for (const auto& widget : m_widgets)
+        {
+            if (!widget->isVisible())
+                continue;
+
+            const Transform transform = getChildWidgetTransform(*widget);
+            visibleWidgets.push_back({&widget, transform, transform.transformRect({widget->getWidgetOffset(), widget->getFullSize()})});
+        }
+
+        for (const auto& region : m_redrawRegions)
+        {
+            target.addClippingLayer(states, region);
+
+            RenderStates regionStates = states;
+            regionStates.transform.translate(region.getPosition());
+            target.drawFilledRect(regionStates, region.getSize(), target.getClearColor());
+
+            for (const auto& visibleWidget : visibleWidgets)
+            {
+                if (!visibleWidget.bounds.intersects(region))
+                    continue;
+
+                RenderStates widgetStates = states;
+                widgetStates.transform.combine(visibleWidget.transform);
+                target.drawWidget(widgetStates, *visibleWidget.widget);
+            }
+
+            target.removeClippingLayer();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RootContainer::setRedrawRegions(std::vector<FloatRect> regions)
+    {
+        m_redrawRegions = std::move(regions);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -212,9 +212,9 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void CustomWidgetForBindings::rendererChanged(const String& property)
+    void CustomWidgetForBindings::rendererChanged(PropertyId property)
     {
-        if (!implRendererChanged(property))
+        if (!implRendererChanged(property.getName()))
             Widget::rendererChanged(property);
     }
 
@@ -147,6 +147,51 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    float Font::getGlyphAdvance(char32_t codePoint, unsigned int characterSize, bool bold) const
+    {
+        if (m_backendFont != nullptr)
+            return m_backendFont->getGlyphAdvance(codePoint, characterSize, bold);
+        else
+        {
+            TGUI_PRINT_WARNING("Font::getGlyphAdvance called on font that wasn't initialized");
+            return 0;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Font::preloadGlyphs(char32_t first, char32_t last, unsigned int characterSize, bool bold, float outlineThickness) const
+    {
+        if (m_backendFont != nullptr)
+            m_backendFont->preloadGlyphs(first, last, characterSize, bold, outlineThickness);
+        else
+        {
+            TGUI_PRINT_WARNING("Font::preloadGlyphs called on font that wasn't initialized");
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Font::preloadGlyphsAsync(char32_t first, char32_t last, unsigned int characterSize, bool bold, float outlineThickness) const
+    {
+        if (m_backendFont != nullptr)
+            m_backendFont->preloadGlyphsAsync(first, last, characterSize, bold, outlineThickness);
+        else
+        {
+            TGUI_PRINT_WARNING("Font::preloadGlyphsAsync called on font that wasn't initialized");
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Font::waitForPreloadedGlyphs() const
+    {
+        if (m_backendFont != nullptr)
+            m_backendFont->waitForPreloadedGlyphs();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     float Font::getKerning(char32_t first, char32_t second, unsigned int characterSize, bool bold) const
     {
         if (m_backendFont)
@@ -0,0 +1,248 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2023 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/GlyphRunCache.hpp>
+#include <TGUI/Backend/Font/BackendFont.hpp>
+
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <functional>
+    #include <iterator>
+    #include <string>
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    std::list<GlyphRunCache::Entry> GlyphRunCache::m_entries;
+    std::unordered_map<std::size_t, std::list<GlyphRunCache::Entry>::iterator> GlyphRunCache::m_entryMap;
+    std::size_t GlyphRunCache::m_memoryLimit = 1024 * 1024;
+    std::size_t GlyphRunCache::m_memoryUsage = 0;
+    std::size_t GlyphRunCache::m_hitCount = 0;
+    std::size_t GlyphRunCache::m_missCount = 0;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<const GlyphRun> GlyphRunCache::getGlyphRun(const String& text, BackendFont& font, unsigned int characterSize, bool bold)
+    {
+        if (m_memoryLimit == 0)
+        {
+            ++m_missCount;
+            return createGlyphRun(text, font, characterSize, bold);
+        }
+
+        // Only the hash is used as key, so that no string has to be copied when looking up a run
+        std::size_t hash = std::hash<std::u32string>{}(text.toUtf32());
+        hash ^= std::hash<const void*>{}(&font) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        hash ^= std::hash<unsigned int>{}((characterSize << 1) | (bold ? 1 : 0)) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+
+        const auto mapIt = m_entryMap.find(hash);
+        if (mapIt != m_entryMap.end())
+        {
+            const auto entryIt = mapIt->second;
+            if ((entryIt->font == &font) && (entryIt->characterSize == characterSize) && (entryIt->bold == bold) && (entryIt->text == text))
+            {
+                ++m_hitCount;
+                m_entries.splice(m_entries.begin(), m_entries, entryIt);
+                return entryIt->run;
+            }
+
+            // Two different runs have the same hash. The old one is replaced.
+            removeEntry(entryIt);
+        }
+
+        ++m_missCount;
+        std::shared_ptr<const GlyphRun> run = createGlyphRun(text, font, characterSize, bold);
+
+        // A run that doesn't fit in the cache by itself isn't stored, as it would only evict all other runs
+        const std::size_t sizeInBytes = sizeof(Entry) + sizeof(GlyphRun) + (2 * sizeof(void*)) // Object sizes and list + map nodes
+                                      + (text.length() * sizeof(char32_t)) + (((3 * text.length()) + 1) * sizeof(float));
+        if (sizeInBytes > m_memoryLimit)
+            return run;
+
+        Entry entry;
+        entry.hash = hash;
+        entry.text = text;
+        entry.font = &font;
+        entry.characterSize = characterSize;
+        entry.bold = bold;
+        entry.sizeInBytes = sizeInBytes;
+        entry.run = run;
+
+        m_memoryUsage += entry.sizeInBytes;
+        m_entries.push_front(std::move(entry));
+        m_entryMap[hash] = m_entries.begin();
+
+        evictEntries();
+        return run;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void GlyphRunCache::removeFont(const BackendFont* font)
+    {
+        for (auto it = m_entries.begin(); it != m_entries.end();)
+        {
+            auto nextIt = std::next(it);
+            if (it->font == font)
+                removeEntry(it);
+
+            it = nextIt;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void GlyphRunCache::clear()
+    {
+        m_entries.clear();
+        m_entryMap.clear();
+        m_memoryUsage = 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void GlyphRunCache::setMemoryLimit(std::size_t sizeInBytes)
+    {
+        m_memoryLimit = sizeInBytes;
+        evictEntries();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t GlyphRunCache::getMemoryLimit()
+    {
+        return m_memoryLimit;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t GlyphRunCache::getMemoryUsage()
+    {
+        return m_memoryUsage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t GlyphRunCache::getHitCount()
+    {
+        return m_hitCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t GlyphRunCache::getMissCount()
+    {
+        return m_missCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void GlyphRunCache::resetStatistics()
+    {
+        m_hitCount = 0;
+        m_missCount = 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<GlyphRun> GlyphRunCache::createGlyphRun(const String& text, BackendFont& font, unsigned int characterSize, bool bold)
+    {
+        auto run = std::make_shared<GlyphRun>();
+        run->advances.resize(text.length());
+        run->kernings.resize(text.length());
+        run->positions.resize(text.length() + 1);
+
+        const float whitespaceWidth = font.getGlyphAdvance(U' ', characterSize, bold);
+
+        float x = 0;
+        char32_t prevChar = 0;
+        bool firstLine = true;
+        for (std::size_t i = 0; i < text.length(); ++i)
+        {
+            const char32_t curChar = text[i];
+            run->positions[i] = x;
+
+            // Skip carriage return characters which aren't rendered (we only use line feed characters to indicate a new line)
+            if (curChar == U'\r')
+                continue;
+
+            if (curChar == U'\n')
+            {
+                if (firstLine)
+                {
+                    run->width = x;
+                    firstLine = false;
+                }
+
+                x = 0;
+                prevChar = 0;
+                continue;
+            }
+
+            float advance;
+            if (curChar == U' ')
+                advance = whitespaceWidth;
+            else if (curChar == U'\t')
+                advance = whitespaceWidth * 4;
+            else
+                advance = font.getGlyphAdvance(curChar, characterSize, bold);
+
+            const float kerning = font.getKerning(prevChar, curChar, characterSize, bold);
+            run->advances[i] = advance;
+            run->kernings[i] = kerning;
+
+            x += kerning + advance;
+            prevChar = curChar;
+        }
+
+        run->positions[text.length()] = x;
+        if (firstLine)
+            run->width = x;
+
+        return run;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void GlyphRunCache::removeEntry(std::list<Entry>::iterator it)
+    {
+        m_memoryUsage -= it->sizeInBytes;
+        m_entryMap.erase(it->hash);
+        m_entries.erase(it);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void GlyphRunCache::evictEntries()
+    {
+        while (!m_entries.empty() && (m_memoryUsage > m_memoryLimit))
+            removeEntry(std::prev(m_entries.end()));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
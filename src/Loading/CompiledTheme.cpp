@@ -0,0 +1,765 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2023 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/Loading/CompiledTheme.hpp>
+#include <TGUI/Loading/Deserializer.hpp>
+#include <TGUI/Loading/ThemeLoader.hpp>
+#include <TGUI/Base64.hpp>
+#include <TGUI/Global.hpp>
+#include <TGUI/Utf.hpp>
+
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
+    #include <cstring>
+    #include <limits>
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// A compiled theme consists of the following parts. All numbers are 32-bit values in the byte order of the machine that
+// compiled the theme, offsets are counted from the start of the file and are multiples of 4.
+//
+// Header (32 bytes): signature (8 bytes), format version, byte order mark, file size, offset of the global properties,
+//                    amount of sections and offset of the section table.
+// Section table:     per section the offset and length of its UTF-8 name and the offset of its property list,
+//                    sorted on the name.
+// Property list:     amount of properties, followed per property by the offset and length of its UTF-8 name,
+//                    the type of its value and the offset of its value.
+// Values:            String and Font: offset and length of the UTF-8 text.
+//                    Bool: 0 or 1. Number: float.
+//                    Color: red, green, blue and alpha packed in a single number, followed by whether the color is set.
+//                    Outline: left, top, right and bottom as floats.
+//                    TextStyle: style flags, followed by whether the style is set.
+//                    Texture: source (none, file or embedded), offset and length of the UTF-8 filename or of the image data,
+//                             left, top, width and height of the part rect and of the middle rect, and the smooth flag.
+//                    RendererData: a nested property list, the value offset points directly to it.
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        const char fileSignature[8] = {'T', 'G', 'U', 'I', 'T', 'H', 'M', '\0'};
+        const std::uint32_t formatVersion = 1;
+        const std::uint32_t byteOrderMark = 0x01020304;
+
+        const std::uint32_t headerSize = 32;
+        const std::uint32_t headerVersionOffset = 8;
+        const std::uint32_t headerByteOrderMarkOffset = 12;
+        const std::uint32_t headerFileSizeOffset = 16;
+        const std::uint32_t headerGlobalPropertiesOffset = 20;
+        const std::uint32_t headerSectionCountOffset = 24;
+        const std::uint32_t headerSectionsOffset = 28;
+
+        const std::uint32_t sectionEntrySize = 12;
+        const std::uint32_t propertyEntrySize = 16;
+
+        // Themes only nest a few renderers inside each other, a deeper nesting means that a property list contains itself
+        const unsigned int maxRendererDataDepth = 64;
+
+        enum class ValueType : std::uint32_t
+        {
+            String,
+            Bool,
+            Number,
+            Color,
+            Outline,
+            TextStyle,
+            Font,
+            Texture,
+            RendererData
+        };
+
+        enum class TextureSource : std::uint32_t
+        {
+            None,
+            File,
+            Embedded
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Returns the type of the value of a property that is used by the widgets in TGUI, or Type::String for other properties
+        ObjectConverter::Type getPropertyType(const String& property)
+        {
+            static const std::vector<ObjectConverter::Type> builtinTypes = []{
+                std::vector<ObjectConverter::Type> types(priv::BuiltinPropertyCount, ObjectConverter::Type::String);
+
+                for (const PropertyId id : {Property::ArrowsOnNavigationButtonsVisible, Property::ShowTextOnTitleButtons,
+                                            Property::ThumbWithinTrack, Property::TransparentTexture})
+                    types[id.getIndex()] = ObjectConverter::Type::Bool;
+
+                for (const PropertyId id : {Property::Font})
+                    types[id.getIndex()] = ObjectConverter::Type::Font;
+
+                for (const PropertyId id : {Property::BorderBelowTitleBar, Property::BorderBetweenArrows, Property::CaretWidth,
+                                            Property::DistanceToSide, Property::ImageRotation, Property::MinimumResizableBorderWidth,
+                                            Property::Opacity, Property::OpacityDisabled, Property::PaddingBetweenButtons,
+                                            Property::RoundedBorderRadius, Property::ScrollbarWidth, Property::SeparatorSidePadding,
+                                            Property::SeparatorThickness, Property::SeparatorVerticalPadding,
+                                            Property::SpaceBetweenWidgets, Property::TextDistanceRatio,
+                                            Property::TextOutlineThickness, Property::TextSize, Property::TitleBarHeight})
+                    types[id.getIndex()] = ObjectConverter::Type::Number;
+
+                for (const PropertyId id : {Property::Borders, Property::Padding})
+                    types[id.getIndex()] = ObjectConverter::Type::Outline;
+
+                for (const PropertyId id : {Property::DefaultTextStyle, Property::SelectedTextStyle, Property::TextStyle,
+                                            Property::TextStyleChecked, Property::TextStyleDisabled, Property::TextStyleDown,
+                                            Property::TextStyleDownDisabled, Property::TextStyleDownFocused,
+                                            Property::TextStyleDownHover, Property::TextStyleFocused, Property::TextStyleHover})
+                    types[id.getIndex()] = ObjectConverter::Type::TextStyle;
+
+                for (const PropertyId id : {Property::BackButton, Property::Button, Property::CloseButton, Property::EditBox,
+                                            Property::FileTypeComboBox, Property::FilenameLabel, Property::ForwardButton,
+                                            Property::Label, Property::ListBox, Property::ListView, Property::MaximizeButton,
+                                            Property::MinimizeButton, Property::Scrollbar, Property::Slider, Property::UpButton})
+                    types[id.getIndex()] = ObjectConverter::Type::RendererData;
+
+                // All other built-in properties are either colors or textures
+                for (std::uint32_t i = 0; i < priv::BuiltinPropertyCount; ++i)
+                {
+                    if (types[i] != ObjectConverter::Type::String)
+                        continue;
+
+                    const String& name = PropertyId{i}.getName();
+                    if (name.starts_with(U"Texture"))
+                        types[i] = ObjectConverter::Type::Texture;
+                    else
+                    {
+                        TGUI_ASSERT(name.contains(U"Color"), "Built-in property without a type must be a color");
+                        types[i] = ObjectConverter::Type::Color;
+                    }
+                }
+
+                return types;
+            }();
+
+            const PropertyId id = PropertyId::find(property);
+            if (!id.isValid() || (id.getIndex() >= priv::BuiltinPropertyCount))
+                return ObjectConverter::Type::String;
+
+            return builtinTypes[id.getIndex()];
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Gives access to the resolving of references between sections, the compiled theme doesn't load data through a loader
+        class ReferenceResolver : public BaseThemeLoader
+        {
+        public:
+            using BaseThemeLoader::resolveReferences;
+
+            const std::map<String, String>& load(const String&, const String&) override
+            {
+                throw Exception{U"ReferenceResolver can't load sections"};
+            }
+
+            bool canLoad(const String&, const String&) override
+            {
+                return false;
+            }
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Builds the contents of a compiled theme
+        class ThemeWriter
+        {
+        public:
+            ThemeWriter() :
+                m_data(headerSize, 0)
+            {
+            }
+
+            std::uint32_t getOffset() const
+            {
+                if (m_data.size() > std::numeric_limits<std::uint32_t>::max())
+                    throw Exception{U"Theme is too large to be compiled."};
+
+                return static_cast<std::uint32_t>(m_data.size());
+            }
+
+            void writeUInt32(std::uint32_t value)
+            {
+                const std::size_t pos = m_data.size();
+                m_data.resize(pos + sizeof(value));
+                std::memcpy(&m_data[pos], &value, sizeof(value));
+            }
+
+            void writeFloat(float value)
+            {
+                std::uint32_t bits;
+                std::memcpy(&bits, &value, sizeof(bits));
+                writeUInt32(bits);
+            }
+
+            void setUInt32(std::uint32_t offset, std::uint32_t value)
+            {
+                std::memcpy(&m_data[offset], &value, sizeof(value));
+            }
+
+            // Appends the bytes and adds padding to keep the next offset a multiple of 4. Returns the offset of the bytes.
+            std::uint32_t writeBytes(const void* data, std::size_t size)
+            {
+                const std::uint32_t offset = getOffset();
+                if (size > 0)
+                    m_data.insert(m_data.end(), static_cast<const std::uint8_t*>(data), static_cast<const std::uint8_t*>(data) + size);
+                m_data.resize((m_data.size() + 3) & ~static_cast<std::size_t>(3), 0);
+                return offset;
+            }
+
+            // Returns the offset and length of the written UTF-8 bytes
+            std::pair<std::uint32_t, std::uint32_t> writeString(const String& str)
+            {
+                const std::string utf8 = str.toStdString();
+                return {writeBytes(utf8.data(), utf8.size()), static_cast<std::uint32_t>(utf8.size())};
+            }
+
+            std::uint32_t writeStringValue(const String& str)
+            {
+                const auto stringRef = writeString(str);
+                const std::uint32_t offset = getOffset();
+                writeUInt32(stringRef.first);
+                writeUInt32(stringRef.second);
+                return offset;
+            }
+
+            std::uint32_t writePropertyList(const std::map<String, std::pair<ValueType, std::uint32_t>>& values)
+            {
+                std::vector<std::pair<std::uint32_t, std::uint32_t>> names;
+                names.reserve(values.size());
+                for (const auto& pair : values)
+                    names.push_back(writeString(pair.first));
+
+                const std::uint32_t offset = getOffset();
+                writeUInt32(static_cast<std::uint32_t>(values.size()));
+
+                std::size_t i = 0;
+                for (const auto& pair : values)
+                {
+                    writeUInt32(names[i].first);
+                    writeUInt32(names[i].second);
+                    writeUInt32(static_cast<std::uint32_t>(pair.second.first));
+                    writeUInt32(pair.second.second);
+                    ++i;
+                }
+
+                return offset;
+            }
+
+            std::uint32_t writeSection(const DataIO::Node& node)
+            {
+                // Nested sections overwrite properties with the same name, just like in the theme loader
+                std::map<String, std::pair<ValueType, std::uint32_t>> values;
+                for (const auto& pair : node.propertyValuePairs)
+                    values[pair.first] = writeValue(pair.first, pair.second->value);
+                for (const auto& child : node.children)
+                    values[child->name] = {ValueType::RendererData, writeSection(*child)};
+
+                return writePropertyList(values);
+            }
+
+            // Deserializes the value when the type of the property is known. Values that can't be deserialized are stored as
+            // text, so that they result in the same error as in a theme that isn't compiled when they are used.
+            std::pair<ValueType, std::uint32_t> writeValue(const String& property, const String& value)
+            {
+                try
+                {
+                    switch (getPropertyType(property))
+                    {
+                    case ObjectConverter::Type::Bool:
+                    {
+                        const bool boolValue = Deserializer::deserialize(ObjectConverter::Type::Bool, value).getBool();
+                        const std::uint32_t offset = getOffset();
+                        writeUInt32(boolValue ? 1 : 0);
+                        return {ValueType::Bool, offset};
+                    }
+                    case ObjectConverter::Type::Number:
+                    {
+                        const float number = Deserializer::deserialize(ObjectConverter::Type::Number, value).getNumber();
+                        const std::uint32_t offset = getOffset();
+                        writeFloat(number);
+                        return {ValueType::Number, offset};
+                    }
+                    case ObjectConverter::Type::Color:
+                    {
+                        const Color color = Deserializer::deserialize(ObjectConverter::Type::Color, value).getColor();
+                        const std::uint32_t offset = getOffset();
+                        writeUInt32(static_cast<std::uint32_t>(color.getRed()) | (static_cast<std::uint32_t>(color.getGreen()) << 8)
+                                    | (static_cast<std::uint32_t>(color.getBlue()) << 16) | (static_cast<std::uint32_t>(color.getAlpha()) << 24));
+                        writeUInt32(color.isSet() ? 1 : 0);
+                        return {ValueType::Color, offset};
+                    }
+                    case ObjectConverter::Type::Outline:
+                    {
+                        // Outlines with relative values are rare in themes, they are kept as text
+                        if (value.contains(U'%'))
+                            break;
+
+                        const Outline outline = Deserializer::deserialize(ObjectConverter::Type::Outline, value).getOutline();
+                        const std::uint32_t offset = getOffset();
+                        writeFloat(outline.getLeft());
+                        writeFloat(outline.getTop());
+                        writeFloat(outline.getRight());
+                        writeFloat(outline.getBottom());
+                        return {ValueType::Outline, offset};
+                    }
+                    case ObjectConverter::Type::TextStyle:
+                    {
+                        const TextStyles style = Deserializer::deserialize(ObjectConverter::Type::TextStyle, value).getTextStyle();
+                        const std::uint32_t offset = getOffset();
+                        writeUInt32(style);
+                        writeUInt32(style.isSet() ? 1 : 0);
+                        return {ValueType::TextStyle, offset};
+                    }
+                    case ObjectConverter::Type::Font:
+                    {
+                        // The font is only loaded when the compiled theme is used
+                        String filename;
+                        if (!viewEqualIgnoreCase(value, U"null") && !viewEqualIgnoreCase(value, U"nullptr"))
+                            filename = Deserializer::deserialize(ObjectConverter::Type::String, value).getString();
+
+                        return {ValueType::Font, writeStringValue(filename)};
+                    }
+                    case ObjectConverter::Type::Texture:
+                        return {ValueType::Texture, writeTexture(value)};
+                    case ObjectConverter::Type::RendererData:
+                    {
+                        // References to other sections were replaced by a copy of the section between braces
+                        if (value.empty() || (value[0] != '{'))
+                            break;
+
+                        const std::string utf8 = value.toStdString();
+                        auto node = DataIO::parse(CharStringView{utf8.data(), utf8.size()});
+
+                        // The root node should contain exactly one child which is the node we need
+                        if (node->propertyValuePairs.empty() && (node->children.size() == 1))
+                            node = std::move(node->children[0]);
+
+                        return {ValueType::RendererData, writeSection(*node)};
+                    }
+                    default:
+                        break;
+                    }
+                }
+                catch (const Exception&)
+                {
+                }
+
+                return {ValueType::String, writeStringValue(value)};
+            }
+
+            // The image is only loaded when the compiled theme is used
+            std::uint32_t writeTexture(const String& value)
+            {
+                TextureSource source = TextureSource::None;
+                std::pair<std::uint32_t, std::uint32_t> dataRef{0, 0};
+                UIntRect partRect;
+                UIntRect middleRect;
+                bool smooth = Texture::getDefaultSmooth();
+                if (!value.empty() && !viewEqualIgnoreCase(value, U"none"))
+                {
+                    String filename;
+                    Deserializer::parseTexture(value, filename, partRect, middleRect, smooth);
+
+                    // Images that are embedded in the theme file are stored decoded
+                    if (filename.starts_with(U"data:"))
+                    {
+                        const auto foundIndex = filename.find(U";base64,");
+                        if (foundIndex == String::npos)
+                            throw Exception{U"Texture started with 'data:' but wasn't in format 'data:image/TYPE;base64,DATA'."};
+
+                        const std::string encodedData = filename.substr(foundIndex + 8).toStdString();
+                        const std::vector<std::uint8_t> imageData = base64Decode(CharStringView{encodedData.data(), encodedData.size()});
+                        source = TextureSource::Embedded;
+                        dataRef = {writeBytes(imageData.data(), imageData.size()), static_cast<std::uint32_t>(imageData.size())};
+                    }
+                    else
+                    {
+                        source = TextureSource::File;
+                        dataRef = writeString(filename);
+                    }
+                }
+
+                const std::uint32_t offset = getOffset();
+                writeUInt32(static_cast<std::uint32_t>(source));
+                writeUInt32(dataRef.first);
+                writeUInt32(dataRef.second);
+                for (const UIntRect& rect : {partRect, middleRect})
+                {
+                    writeUInt32(rect.left);
+                    writeUInt32(rect.top);
+                    writeUInt32(rect.width);
+                    writeUInt32(rect.height);
+                }
+                writeUInt32(smooth ? 1 : 0);
+                return offset;
+            }
+
+            std::vector<std::uint8_t> m_data;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        String getFullFilename(const String& filename)
+        {
+#ifdef TGUI_SYSTEM_WINDOWS
+            if ((filename[0] != '/') && (filename[0] != '\\') && ((filename.size() <= 1) || (filename[1] != ':')))
+#else
+            if (filename[0] != '/')
+#endif
+                return (getResourcePath() / filename).asString();
+            else
+                return filename;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<std::uint8_t> CompiledTheme::compile(const String& filename)
+    {
+        if (filename.empty())
+            throw Exception{U"CompiledTheme::compile called with empty filename."};
+
+        const String fullFilename = getFullFilename(filename);
+
+        std::size_t fileSize;
+        const auto fileContents = readFileToMemory(fullFilename, fileSize);
+        if (!fileContents)
+            throw Exception{U"Failed to open theme file '" + fullFilename + U"'."};
+
+        const std::unique_ptr<DataIO::Node> root = DataIO::parse(CharStringView{reinterpret_cast<const char*>(fileContents.get()), fileSize});
+
+        std::map<String, String> globalProperties;
+        for (const auto& pair : root->propertyValuePairs)
+            globalProperties[pair.first] = pair.second->value;
+
+        std::map<String, std::reference_wrapper<const std::unique_ptr<DataIO::Node>>> sections;
+        for (const auto& child : root->children)
+        {
+            const String name = Deserializer::deserialize(ObjectConverter::Type::String, child->name).getString();
+            sections.emplace(name, std::cref(child));
+        }
+
+        ReferenceResolver{}.resolveReferences(sections, globalProperties, root);
+
+        ThemeWriter writer;
+
+        std::map<String, std::pair<ValueType, std::uint32_t>> globalValues;
+        for (const auto& pair : globalProperties)
+            globalValues[pair.first] = writer.writeValue(pair.first, pair.second);
+        const std::uint32_t globalPropertiesOffset = writer.writePropertyList(globalValues);
+
+        // The section table is sorted on the UTF-8 names, so that a section can be found with a binary search
+        std::map<std::string, std::uint32_t> sectionOffsets;
+        for (const auto& section : sections)
+            sectionOffsets[section.first.toStdString()] = writer.writeSection(*section.second.get());
+
+        std::vector<std::uint32_t> nameOffsets;
+        nameOffsets.reserve(sectionOffsets.size());
+        for (const auto& pair : sectionOffsets)
+            nameOffsets.push_back(writer.writeBytes(pair.first.data(), pair.first.size()));
+
+        const std::uint32_t sectionsOffset = writer.getOffset();
+        std::size_t i = 0;
+        for (const auto& pair : sectionOffsets)
+        {
+            writer.writeUInt32(nameOffsets[i]);
+            writer.writeUInt32(static_cast<std::uint32_t>(pair.first.size()));
+            writer.writeUInt32(pair.second);
+            ++i;
+        }
+
+        std::memcpy(writer.m_data.data(), fileSignature, sizeof(fileSignature));
+        writer.setUInt32(headerVersionOffset, formatVersion);
+        writer.setUInt32(headerByteOrderMarkOffset, byteOrderMark);
+        writer.setUInt32(headerFileSizeOffset, writer.getOffset());
+        writer.setUInt32(headerGlobalPropertiesOffset, globalPropertiesOffset);
+        writer.setUInt32(headerSectionCountOffset, static_cast<std::uint32_t>(sectionOffsets.size()));
+        writer.setUInt32(headerSectionsOffset, sectionsOffset);
+        return std::move(writer.m_data);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void CompiledTheme::compileToFile(const String& filename, const String& outputFilename)
+    {
+        const std::vector<std::uint8_t> data = compile(filename);
+        if (!writeFile(outputFilename, data.data(), data.size()))
+            throw Exception{U"Failed to write compiled theme to '" + outputFilename + U"'."};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void CompiledTheme::open(const String& filename)
+    {
+        m_file.close();
+        m_globalPropertiesOffset = 0;
+        m_sectionCount = 0;
+        m_sectionsOffset = 0;
+
+        if (filename.empty())
+            throw Exception{U"CompiledTheme::open called with empty filename."};
+
+        const String fullFilename = getFullFilename(filename);
+        if (!m_file.open(fullFilename))
+            throw Exception{U"Failed to open compiled theme '" + fullFilename + U"'."};
+
+        const char* data = m_file.getData();
+        if ((m_file.getSize() < headerSize) || (std::memcmp(data, fileSignature, sizeof(fileSignature)) != 0)
+         || (readUInt32(headerVersionOffset) != formatVersion) || (readUInt32(headerByteOrderMarkOffset) != byteOrderMark)
+         || (readUInt32(headerFileSizeOffset) != m_file.getSize()))
+        {
+            m_file.close();
+            throw Exception{U"'" + fullFilename + U"' is not a theme that was compiled with this version of TGUI on this platform."};
+        }
+
+        m_globalPropertiesOffset = readUInt32(headerGlobalPropertiesOffset);
+        m_sectionCount = readUInt32(headerSectionCountOffset);
+        m_sectionsOffset = readUInt32(headerSectionsOffset);
+
+        m_resourcePath.clear();
+        const auto slashPos = filename.find_last_of("/\\");
+        if (slashPos != String::npos)
+            m_resourcePath = filename.substr(0, slashPos+1);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<String> CompiledTheme::getSectionNames() const
+    {
+        std::vector<String> names;
+        names.reserve(m_sectionCount);
+        for (std::uint32_t i = 0; i < m_sectionCount; ++i)
+            names.push_back(readString(m_sectionsOffset, static_cast<std::uint64_t>(i) * sectionEntrySize));
+
+        return names;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool CompiledTheme::hasSection(const String& name) const
+    {
+        return findSection(name) != 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<RendererData> CompiledTheme::createRenderer(const String& name) const
+    {
+        const std::uint32_t offset = findSection(name);
+        if (offset == 0)
+            return nullptr;
+
+        return readRendererData(offset);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::map<String, ObjectConverter> CompiledTheme::getGlobalProperties() const
+    {
+        if (!m_file.isOpen())
+            return {};
+
+        const auto rendererData = readRendererData(m_globalPropertiesOffset);
+
+        std::map<String, ObjectConverter> properties;
+        for (const auto& pair : rendererData->propertyValuePairs)
+            properties[pair.first.getName()] = pair.second;
+
+        return properties;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const char* CompiledTheme::readBytes(std::uint32_t offset, std::uint64_t fieldOffset, std::uint32_t size) const
+    {
+        // The sum can't overflow, the offsets and size are 32-bit and the field offsets are much smaller than 64-bit
+        const std::uint64_t position = static_cast<std::uint64_t>(offset) + fieldOffset;
+        if (position + size > m_file.getSize())
+            throw Exception{U"Compiled theme is corrupt, it refers to data outside the file."};
+
+        return m_file.getData() + static_cast<std::size_t>(position);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::uint32_t CompiledTheme::readUInt32(std::uint32_t offset, std::uint64_t fieldOffset) const
+    {
+        std::uint32_t value;
+        std::memcpy(&value, readBytes(offset, fieldOffset, sizeof(value)), sizeof(value));
+        return value;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float CompiledTheme::readFloat(std::uint32_t offset, std::uint64_t fieldOffset) const
+    {
+        float value;
+        std::memcpy(&value, readBytes(offset, fieldOffset, sizeof(value)), sizeof(value));
+        return value;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    String CompiledTheme::readString(std::uint32_t offset, std::uint64_t fieldOffset) const
+    {
+        const std::uint32_t length = readUInt32(offset, fieldOffset + 4);
+        const char* str = readBytes(readUInt32(offset, fieldOffset), 0, length);
+        return utf::convertUtf8toUtf32(str, str + length);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::uint32_t CompiledTheme::findSection(const String& name) const
+    {
+        const std::string utf8Name = name.toStdString();
+
+        std::uint32_t first = 0;
+        std::uint32_t last = m_sectionCount;
+        while (first < last)
+        {
+            const std::uint32_t middle = first + (last - first) / 2;
+            const std::uint64_t entryOffset = static_cast<std::uint64_t>(middle) * sectionEntrySize;
+            const std::uint32_t nameLength = readUInt32(m_sectionsOffset, entryOffset + 4);
+            const char* sectionName = readBytes(readUInt32(m_sectionsOffset, entryOffset), 0, nameLength);
+
+            int result = std::memcmp(sectionName, utf8Name.data(), std::min<std::size_t>(nameLength, utf8Name.size()));
+            if (result == 0)
+            {
+                if (nameLength == utf8Name.size())
+                    return readUInt32(m_sectionsOffset, entryOffset + 8);
+
+                result = (nameLength < utf8Name.size()) ? -1 : 1;
+            }
+
+            if (result < 0)
+                first = middle + 1;
+            else
+                last = middle;
+        }
+
+        return 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<RendererData> CompiledTheme::readRendererData(std::uint32_t offset, unsigned int depth) const
+    {
+        if (depth > maxRendererDataDepth)
+            throw Exception{U"Compiled theme is corrupt, it contains a property list that contains itself."};
+
+        auto rendererData = RendererData::create();
+
+        const std::uint32_t propertyCount = readUInt32(offset);
+        for (std::uint32_t i = 0; i < propertyCount; ++i)
+        {
+            const std::uint64_t entryOffset = 4 + (static_cast<std::uint64_t>(i) * propertyEntrySize);
+            const String property = readString(offset, entryOffset);
+            rendererData->propertyValuePairs[property] = readValue(property, readUInt32(offset, entryOffset + 8), readUInt32(offset, entryOffset + 12), depth);
+        }
+
+        return rendererData;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ObjectConverter CompiledTheme::readValue(const String& property, std::uint32_t type, std::uint32_t offset, unsigned int depth) const
+    {
+        switch (static_cast<ValueType>(type))
+        {
+        case ValueType::String:
+        {
+            String value = readString(offset);
+            BaseThemeLoader::injectThemePathInValue(property, value, m_resourcePath);
+            return {value};
+        }
+        case ValueType::Bool:
+            return {readUInt32(offset) != 0};
+        case ValueType::Number:
+            return {readFloat(offset)};
+        case ValueType::Color:
+        {
+            if (readUInt32(offset, 4) == 0)
+                return {Color{}};
+
+            const std::uint32_t rgba = readUInt32(offset);
+            return {Color{static_cast<std::uint8_t>(rgba & 0xFF), static_cast<std::uint8_t>((rgba >> 8) & 0xFF),
+                          static_cast<std::uint8_t>((rgba >> 16) & 0xFF), static_cast<std::uint8_t>(rgba >> 24)}};
+        }
+        case ValueType::Outline:
+            return {Outline{readFloat(offset), readFloat(offset, 4), readFloat(offset, 8), readFloat(offset, 12)}};
+        case ValueType::TextStyle:
+        {
+            if (readUInt32(offset, 4) == 0)
+                return {TextStyles{}};
+
+            return {TextStyles{readUInt32(offset)}};
+        }
+        case ValueType::Font:
+        {
+            String filename = readString(offset);
+            if (filename.empty())
+                return {Font{}};
+
+            BaseThemeLoader::injectThemePathInValue(property, filename, m_resourcePath);
+            return {Font{filename}};
+        }
+        case ValueType::Texture:
+        {
+            const auto source = static_cast<TextureSource>(readUInt32(offset));
+            if (source == TextureSource::None)
+                return {Texture{}};
+
+            const UIntRect partRect{readUInt32(offset, 12), readUInt32(offset, 16), readUInt32(offset, 20), readUInt32(offset, 24)};
+            const UIntRect middleRect{readUInt32(offset, 28), readUInt32(offset, 32), readUInt32(offset, 36), readUInt32(offset, 40)};
+            const bool smooth = (readUInt32(offset, 44) != 0);
+            if (source == TextureSource::Embedded)
+            {
+                const std::uint32_t dataSize = readUInt32(offset, 8);
+                const auto* imageData = reinterpret_cast<const std::uint8_t*>(readBytes(readUInt32(offset, 4), 0, dataSize));
+
+                Texture texture;
+                texture.loadFromMemory(imageData, dataSize, partRect, middleRect, smooth);
+                return {texture};
+            }
+
+            String filename = readString(offset, 4);
+            BaseThemeLoader::injectThemePathInValue(property, filename, m_resourcePath);
+            return {Texture{filename, partRect, middleRect, smooth}};
+        }
+        case ValueType::RendererData:
+            return {readRendererData(offset, depth + 1)};
+        default:
+            throw Exception{U"Compiled theme is corrupt, it contains a value of an unknown type."};
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
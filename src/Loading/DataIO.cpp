@@ -31,7 +31,10 @@
     #include <stdio.h> // EOF
 #else
     #include <cctype> // isspace
+    #include <cstring> // memchr
+    #include <cstdint> // uintptr_t
     #include <algorithm>
+    #include <memory> // uninitialized_copy
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -39,40 +42,16 @@
 #define REMOVE_WHITESPACE_AND_COMMENTS(ReturnErrorOnEOF) \
     for (;;) \
     { \
-        stream >> std::ws; \
-        if (stream.peek() == EOF) \
+        input.skipWhitespace(); \
+        if (input.atEnd()) \
             break; \
         \
-        if (stream.peek() == '/') \
+        if (*input.pos == '/') \
         { \
-            char c; \
-            stream.read(&c, 1); \
-            if (stream.peek() == '/') \
-            { \
-                while (stream.peek() != EOF) \
-                { \
-                    stream.read(&c, 1); \
-                    if (c == '\n') \
-                        break; \
-                } \
-            } \
-            else if (stream.peek() == '*') \
-            { \
-                while (stream.peek() != EOF) \
-                { \
-                    stream.read(&c, 1); \
-                    if (stream.peek() == '*') \
-                    { \
-                        stream.read(&c, 1); \
-                        if (stream.peek() == '/') \
-                        { \
-                            stream.read(&c, 1); \
-                            break; \
-                        } \
-                    } \
-                } \
-                continue; \
-            } \
+            if (input.peek(1) == '/') \
+                input.skipLineComment(); \
+            else if (input.peek(1) == '*') \
+                input.skipBlockComment(); \
             else \
                 return "Unexpected '/' found."; \
             \
@@ -81,7 +60,7 @@
         break; \
     } \
     \
-    if (stream.peek() == EOF) \
+    if (input.atEnd()) \
     { \
         if (ReturnErrorOnEOF) \
             return "Unexpected EOF while parsing."; \
@@ -95,77 +74,137 @@ namespace tgui
 {
     namespace
     {
-        // Forward declare one of the functions to solve circular dependency
-        String parseSection(std::stringstream& stream, const std::unique_ptr<DataIO::Node>& node, const String& sectionName);
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Read position in the contiguous memory that is being parsed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct InputBuffer
+        {
+            TGUI_NODISCARD bool atEnd() const
+            {
+                return pos == end;
+            }
+
+            // Returns the character at the given offset from the read position, or EOF when it lies past the end of the input
+            TGUI_NODISCARD int peek(std::size_t offset = 0) const
+            {
+                if (offset < static_cast<std::size_t>(end - pos))
+                    return static_cast<unsigned char>(pos[offset]);
+                else
+                    return EOF;
+            }
+
+            void skipWhitespace()
+            {
+                while ((pos != end) && std::isspace(static_cast<unsigned char>(*pos)))
+                    ++pos;
+            }
+
+            // Skips past the end of the line, the read position has to be on the "//" that starts the comment
+            void skipLineComment()
+            {
+                const char* newline = static_cast<const char*>(std::memchr(pos, '\n', static_cast<std::size_t>(end - pos)));
+                pos = newline ? newline + 1 : end;
+            }
+
+            // Skips past the "*/" that ends the comment, the read position has to be on the "/*" that starts the comment
+            void skipBlockComment()
+            {
+                pos += 2;
+                while (pos != end)
+                {
+                    const char* star = static_cast<const char*>(std::memchr(pos, '*', static_cast<std::size_t>(end - pos)));
+                    if (!star)
+                        break;
+
+                    pos = star + 1;
+                    if ((pos != end) && (*pos == '/'))
+                    {
+                        ++pos;
+                        return;
+                    }
+                }
+
+                pos = end;
+            }
+
+            // Skips past the closing quote of a string, the read position has to be right after the opening quote.
+            // Returns false if the end of the input was reached without finding the closing quote.
+            bool skipQuotedString()
+            {
+                bool backslash = false;
+                while (pos != end)
+                {
+                    const char c = *pos++;
+                    if ((c == '"') && !backslash)
+                        return true;
+
+                    backslash = ((c == '\\') && !backslash);
+                }
+
+                return false;
+            }
+
+            const char* begin = nullptr;
+            const char* pos = nullptr;
+            const char* end = nullptr;
+        };
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        String readWord(std::stringstream& stream)
+        TGUI_NODISCARD bool isWordCharacter(char c)
         {
-            String word = "";
-            while (stream.peek() != EOF)
+            return !std::isspace(static_cast<unsigned char>(c)) && (c != '=') && (c != ';') && (c != ':') && (c != '{') && (c != '}');
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::string readWord(InputBuffer& input)
+        {
+            // Parts of the word are copied directly from the input, comments in the middle of the word are left out
+            std::string word;
+            while (!input.atEnd())
             {
-                char c = static_cast<char>(stream.peek());
+                const char c = *input.pos;
                 if (c == '\r')
                 {
-                    stream.read(&c, 1);
+                    ++input.pos;
                     return word;
                 }
-                else if (!std::isspace(static_cast<unsigned char>(c)) && (c != '=') && (c != ';') && (c != ':') && (c != '{') && (c != '}'))
-                {
-                    stream.read(&c, 1);
+                else if (!isWordCharacter(c))
+                    return word;
 
-                    if ((c == '/') && (stream.peek() == '/'))
-                    {
-                        while (stream.peek() != EOF)
-                        {
-                            stream.read(&c, 1);
-                            if (c == '\n')
-                            {
-                                TGUI_ASSERT(!word.empty(), "There is no known case in which you can pass here with an empty word "
-                                                           "(comment would have been skipped earlier)");
-                                return word;
-                            }
-                        }
-                    }
-                    else if ((c == '/') && (stream.peek() == '*'))
+                if ((c == '/') && (input.peek(1) == '/'))
+                {
+                    const char* newline = static_cast<const char*>(std::memchr(input.pos, '\n', static_cast<std::size_t>(input.end - input.pos)));
+                    if (!newline)
                     {
-                        while (stream.peek() != EOF)
-                        {
-                            stream.read(&c, 1);
-                            if (c == '*')
-                            {
-                                if (stream.peek() == '/')
-                                {
-                                    stream.read(&c, 1);
-                                    break;
-                                }
-                            }
-                        }
+                        input.pos = input.end;
+                        break;
                     }
-                    else if (c == '"')
-                    {
-                        word.push_back(c);
-                        bool backslash = false;
-                        while (stream.peek() != EOF)
-                        {
-                            stream.read(&c, 1);
-                            word.push_back(c);
 
-                            if (c == '"' && !backslash)
-                                break;
-
-                            if (c == '\\' && !backslash)
-                                backslash = true;
-                            else
-                                backslash = false;
-                        }
-                    }
-                    else
-                        word.push_back(c);
+                    input.pos = newline + 1;
+                    TGUI_ASSERT(!word.empty(), "There is no known case in which you can pass here with an empty word "
+                                               "(comment would have been skipped earlier)");
+                    return word;
+                }
+                else if ((c == '/') && (input.peek(1) == '*'))
+                {
+                    input.skipBlockComment();
+                }
+                else if (c == '"')
+                {
+                    const char* wordStart = input.pos++;
+                    input.skipQuotedString();
+                    word.append(wordStart, input.pos);
                 }
                 else
-                    return word;
+                {
+                    const char* wordStart = input.pos++;
+                    while (!input.atEnd() && isWordCharacter(*input.pos) && (*input.pos != '/') && (*input.pos != '"') && (*input.pos != '\r'))
+                        ++input.pos;
+
+                    word.append(wordStart, input.pos);
+                }
             }
 
             return "";
@@ -173,79 +212,35 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        String readLine(std::stringstream& stream)
+        std::string readLine(InputBuffer& input)
         {
             std::string line;
             bool whitespaceFound = false;
-            while (stream.peek() != EOF)
+            while (!input.atEnd())
             {
-                char c = static_cast<char>(stream.peek());
-
+                const char c = *input.pos;
                 if (c == '/')
                 {
-                    stream.read(&c, 1);
-                    if (stream.peek() == '/')
-                    {
-                        while (stream.peek() != EOF)
-                        {
-                            stream.read(&c, 1);
-                            if (c == '\n')
-                                break;
-                        }
-                    }
-                    else if (stream.peek() == '*')
-                    {
-                        while (stream.peek() != EOF)
-                        {
-                            stream.read(&c, 1);
-                            if (stream.peek() == '*')
-                            {
-                                stream.read(&c, 1);
-                                if (stream.peek() == '/')
-                                {
-                                    stream.read(&c, 1);
-                                    break;
-                                }
-                            }
-                        }
-                        continue;
-                    }
+                    if (input.peek(1) == '/')
+                        input.skipLineComment();
+                    else if (input.peek(1) == '*')
+                        input.skipBlockComment();
                     else // The slash is part of the value
                     {
+                        ++input.pos;
                         whitespaceFound = false;
                         line.push_back(c);
                     }
-
-                    continue;
                 }
-
-                if (c == '"')
+                else if (c == '"')
                 {
-                    stream.read(&c, 1);
-                    line.push_back(c);
-
-                    bool backslash = false;
-                    while (stream.peek() != EOF)
-                    {
-                        stream.read(&c, 1);
-                        line.push_back(c);
-
-                        if (c == '"' && !backslash)
-                            break;
-
-                        if (c == '\\' && !backslash)
-                            backslash = true;
-                        else
-                            backslash = false;
-                    }
-
-                    if (stream.peek() == EOF)
+                    const char* stringStart = input.pos++;
+                    if (!input.skipQuotedString())
                         return "";
 
-                    c = static_cast<char>(stream.peek());
+                    line.append(stringStart, input.pos);
                 }
-
-                if ((c == '=') || (c == '{'))
+                else if ((c == '=') || (c == '{'))
                     return "";
                 else if ((c == ';') || (c == '}'))
                 {
@@ -253,9 +248,9 @@ namespace tgui
                     line.erase(line.find_last_not_of(" \n\r\t")+1);
                     return line;
                 }
-                else if (::isspace(c))
+                else if (std::isspace(static_cast<unsigned char>(c)))
                 {
-                    stream.read(&c, 1);
+                    ++input.pos;
                     if (!whitespaceFound)
                     {
                         whitespaceFound = true;
@@ -264,9 +259,20 @@ namespace tgui
                 }
                 else
                 {
+                    // Copy all characters until the next one that requires special handling
+                    const char* partStart = input.pos++;
+                    while (!input.atEnd())
+                    {
+                        const char nextChar = *input.pos;
+                        if ((nextChar == '/') || (nextChar == '"') || (nextChar == '=') || (nextChar == '{') || (nextChar == ';')
+                         || (nextChar == '}') || std::isspace(static_cast<unsigned char>(nextChar)))
+                            break;
+
+                        ++input.pos;
+                    }
+
                     whitespaceFound = false;
-                    line.push_back(c);
-                    stream.read(&c, 1);
+                    line.append(partStart, input.pos);
                 }
             }
 
@@ -275,29 +281,41 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        String parseKeyValue(std::stringstream& stream, std::unique_ptr<DataIO::Node>& node, const String& key)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Removes the whitespace at both sides of the string
+        void trimWhitespace(std::string& str)
         {
-            // Read the assignment symbol from the stream and remove the whitespace behind it
-            char chr;
-            stream.read(&chr, 1);
+            const auto firstPos = str.find_first_not_of(" \t\n\v\f\r");
+            if (firstPos == std::string::npos)
+            {
+                str.clear();
+                return;
+            }
 
-            REMOVE_WHITESPACE_AND_COMMENTS(true)
+            str.erase(str.find_last_not_of(" \t\n\v\f\r") + 1);
+            str.erase(0, firstPos);
+        }
 
-            // Check for subsection as value
-            if (stream.peek() == '{')
-                return parseSection(stream, node, key);
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Builds the tree of DataIO::Node objects while the input is being parsed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class NodeTreeBuilder
+        {
+        public:
+            using Section = const DataIO::Node*;
 
-            // Read the value
-            String line = readLine(stream).trim();
-            if (!line.empty())
+            explicit NodeTreeBuilder(DataIO::Node& root) :
+                m_node(&root)
             {
-                // Remove the ';' if it is there
-                if (stream.peek() == ';')
-                    stream.read(&chr, 1);
+            }
 
+            void addProperty(const std::string& key, const std::string& value)
+            {
                 // Create a value node to store the value
                 auto valueNode = std::make_unique<DataIO::ValueNode>();
-                valueNode->value = line;
+                valueNode->value = value;
+                const String& line = valueNode->value;
 
                 // It might be a list node
                 if ((line.size() >= 2) && (line[0] == '[') && (line.back() == ']'))
@@ -351,16 +369,108 @@ namespace tgui
                     }
                 }
 
-                node->propertyValuePairs[key] = std::move(valueNode);
+                m_node->propertyValuePairs[key] = std::move(valueNode);
+            }
+
+            void beginSection(const std::string& name)
+            {
+                auto sectionNode = std::make_unique<DataIO::Node>();
+                sectionNode->parent = m_node;
+                sectionNode->name = name;
+
+                m_node = sectionNode.get();
+                m_openSections.push_back(std::move(sectionNode));
+            }
+
+            void endSection(Section baseSection)
+            {
+                std::unique_ptr<DataIO::Node> sectionNode = std::move(m_openSections.back());
+                m_openSections.pop_back();
+                m_node = sectionNode->parent;
+
+                if (baseSection)
+                {
+                    // Copy properties that aren't overwritten
+                    for (const auto& pair : baseSection->propertyValuePairs)
+                    {
+                        const String& propertyName = pair.first;
+                        if (sectionNode->propertyValuePairs.find(propertyName) == sectionNode->propertyValuePairs.end())
+                            sectionNode->propertyValuePairs[propertyName] = std::make_unique<DataIO::ValueNode>(*pair.second);
+                    }
+
+                    // Copy children that aren't overwritten
+                    for (const auto& baseChildNode : baseSection->children)
+                    {
+                        const auto it = std::find_if(sectionNode->children.begin(), sectionNode->children.end(),
+                            [&](const std::unique_ptr<DataIO::Node>& childNode){ return childNode->name == baseChildNode->name; });
+                        if (it == sectionNode->children.end())
+                            sectionNode->children.push_back(std::make_unique<DataIO::Node>(*baseChildNode));
+                    }
+                }
+
+                m_node->children.push_back(std::move(sectionNode));
+            }
+
+            // Searches the finished sections inside the section that is being parsed and inside the sections around it
+            TGUI_NODISCARD Section findSection(const std::string& name) const
+            {
+                const String sectionName = name;
+                for (const DataIO::Node* parentNode = m_node; parentNode; parentNode = parentNode->parent)
+                {
+                    for (const auto& childNode : parentNode->children)
+                    {
+                        if (childNode->name == sectionName)
+                            return childNode.get();
+                    }
+                }
+
+                return nullptr;
+            }
+
+        private:
+            DataIO::Node* m_node; // Node to which properties and sections are currently added
+            std::vector<std::unique_ptr<DataIO::Node>> m_openSections; // Sections are only added to their parent once they are finished
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Forward declare one of the functions to solve circular dependency
+        template <typename TreeBuilder>
+        String parseSection(InputBuffer& input, TreeBuilder& builder, const std::string& sectionName, typename TreeBuilder::Section baseSection);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        template <typename TreeBuilder>
+        String parseKeyValue(InputBuffer& input, TreeBuilder& builder, const std::string& key)
+        {
+            // Skip the assignment symbol and the whitespace behind it
+            ++input.pos;
+
+            REMOVE_WHITESPACE_AND_COMMENTS(true)
+
+            // Check for subsection as value
+            if (input.peek() == '{')
+                return parseSection(input, builder, key, nullptr);
+
+            // Read the value
+            std::string line = readLine(input);
+            trimWhitespace(line);
+            if (!line.empty())
+            {
+                // Remove the ';' if it is there
+                if (input.peek() == ';')
+                    ++input.pos;
+
+                builder.addProperty(key, line);
                 return "";
             }
             else
             {
-                if (stream.peek() == EOF)
+                if (input.atEnd())
                     return "Found EOF while trying to read a value.";
                 else
                 {
-                    chr = static_cast<char>(stream.peek());
+                    const char chr = *input.pos;
                     if (chr == '=')
                         return "Found '=' while trying to read a value.";
                     else if (chr == '{')
@@ -373,127 +483,87 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        String parseInheritance(std::stringstream& stream, const std::unique_ptr<DataIO::Node>& node, const String& sectionName)
+        template <typename TreeBuilder>
+        String parseInheritance(InputBuffer& input, TreeBuilder& builder, const std::string& sectionName)
         {
-            // Read the colon from the stream
-            char chr;
-            stream.read(&chr, 1);
+            // Skip the colon
+            ++input.pos;
             REMOVE_WHITESPACE_AND_COMMENTS(true)
 
-            String baseSectionName = readWord(stream);
+            const std::string baseSectionName = readWord(input);
             if (baseSectionName.empty())
                 return "Expected name of base section to inherit from after ':'.";
 
-            const DataIO::Node* parentNode = node.get();
-            const DataIO::Node* baseSectionNode = nullptr;
-            while (!baseSectionNode && parentNode)
-            {
-                for (const auto& prevSections : parentNode->children)
-                {
-                    if (prevSections->name != baseSectionName)
-                        continue;
-
-                    baseSectionNode = prevSections.get();
-                    break;
-                }
-
-                parentNode = parentNode->parent;
-            }
-
-            if (!baseSectionNode)
-                return "Failed to find base section '" + baseSectionName + "' to inherit from.";
+            const auto baseSection = builder.findSection(baseSectionName);
+            if (!baseSection)
+                return "Failed to find base section '" + String(baseSectionName) + "' to inherit from.";
 
             REMOVE_WHITESPACE_AND_COMMENTS(true)
-            if (stream.peek() != '{')
+            if (input.peek() != '{')
                 return "Expected '{' after specifying base section to inherit from.";
 
-            const auto& error = parseSection(stream, node, sectionName);
-            if (!error.empty())
-                return error;
-
-            const auto& sectionNode = node->children.back(); // This node was added by parseSection
-
-            // Copy properties that aren't overwritten
-            for (const auto& pair : baseSectionNode->propertyValuePairs)
-            {
-                const String& propertyName = pair.first;
-                if (sectionNode->propertyValuePairs.find(propertyName) == sectionNode->propertyValuePairs.end())
-                    sectionNode->propertyValuePairs[propertyName] = std::make_unique<DataIO::ValueNode>(*pair.second);
-            }
-
-            // Copy children that aren't overwritten
-            for (const auto& baseChildNode : baseSectionNode->children)
-            {
-                const auto it = std::find_if(sectionNode->children.begin(), sectionNode->children.end(),
-                    [&](const std::unique_ptr<DataIO::Node>& childNode){ return childNode->name == baseChildNode->name; });
-                if (it == sectionNode->children.end())
-                    sectionNode->children.push_back(std::make_unique<DataIO::Node>(*baseChildNode));
-            }
-
-            return "";
+            return parseSection(input, builder, sectionName, baseSection);
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        String parseSection(std::stringstream& stream, const std::unique_ptr<DataIO::Node>& node, const String& sectionName)
+        template <typename TreeBuilder>
+        String parseSection(InputBuffer& input, TreeBuilder& builder, const std::string& sectionName, typename TreeBuilder::Section baseSection)
         {
             // Create a new node for this section
-            auto sectionNode = std::make_unique<DataIO::Node>();
-            sectionNode->parent = node.get();
-            sectionNode->name = sectionName;
+            builder.beginSection(sectionName);
 
-            // Read the brace from the stream
-            char chr;
-            stream.read(&chr, 1);
+            // Skip the brace
+            ++input.pos;
 
-            while (stream.peek() != EOF)
+            while (!input.atEnd())
             {
                 REMOVE_WHITESPACE_AND_COMMENTS(true)
 
-                String word = readWord(stream);
-                if (word == U"")
+                const std::string word = readWord(input);
+                if (word.empty())
                 {
-                    if (stream.peek() == EOF)
+                    if (input.atEnd())
                         return "Found EOF while trying to read property or nested section name.";
-                    else if (stream.peek() == '}')
+                    else if (*input.pos == '}')
                     {
-                        node->children.push_back(std::move(sectionNode));
+                        builder.endSection(baseSection);
 
-                        stream.read(&chr, 1);
+                        ++input.pos;
 
                         // Ignore semicolon behind closing brace
                         REMOVE_WHITESPACE_AND_COMMENTS(false)
-                        if (stream.peek() == ';')
-                            stream.read(&chr, 1);
+                        if (*input.pos == ';')
+                            ++input.pos;
 
                         REMOVE_WHITESPACE_AND_COMMENTS(false)
                         return "";
                     }
-                    else if (stream.peek() != '{')
-                        return "Expected property or nested section name, found '" + String(1, static_cast<char>(stream.peek())) + "' instead.";
+                    else if (*input.pos != '{')
+                        return "Expected property or nested section name, found '" + String(1, *input.pos) + "' instead.";
                 }
 
                 REMOVE_WHITESPACE_AND_COMMENTS(true)
-                if (stream.peek() == '{')
+                if (*input.pos == '{')
                 {
-                    String error = parseSection(stream, sectionNode, word);
+                    String error = parseSection(input, builder, word, nullptr);
                     if (!error.empty())
                         return error;
                 }
-                else if (stream.peek() == '=')
+                else if (*input.pos == '=')
                 {
-                    String error = parseKeyValue(stream, sectionNode, word);
+                    String error = parseKeyValue(input, builder, word);
                     if (!error.empty())
                         return error;
                 }
-                else if (stream.peek() == ':')
+                else if (*input.pos == ':')
                 {
-                    String error = parseInheritance(stream, sectionNode, word);
+                    String error = parseInheritance(input, builder, word);
                     if (!error.empty())
                         return error;
                 }
                 else
-                    return "Expected '{', '=' or ':', found '" + String(1, static_cast<char>(stream.peek())) + "' instead.";
+                    return "Expected '{', '=' or ':', found '" + String(1, *input.pos) + "' instead.";
             }
 
             return "Found EOF while reading section.";
@@ -501,27 +571,50 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        String parseRootSection(std::stringstream& stream, std::unique_ptr<DataIO::Node>& root)
+        template <typename TreeBuilder>
+        String parseRootSection(InputBuffer& input, TreeBuilder& builder)
         {
             REMOVE_WHITESPACE_AND_COMMENTS(false)
 
-            String word = readWord(stream);
-            if (word == U"")
+            const std::string word = readWord(input);
+            if (word.empty())
             {
                 REMOVE_WHITESPACE_AND_COMMENTS(true)
-                if (stream.peek() != '{')
-                    return "Expected section name, found '" + String(1, static_cast<char>(stream.peek())) + "' instead.";
+                if (*input.pos != '{')
+                    return "Expected section name, found '" + String(1, *input.pos) + "' instead.";
             }
 
             REMOVE_WHITESPACE_AND_COMMENTS(true)
-            if (stream.peek() == '{')
-                return parseSection(stream, root, word);
-            else if (stream.peek() == '=')
-                return parseKeyValue(stream, root, word);
-            else if (stream.peek() == ':')
-                return parseInheritance(stream, root, word);
+            if (*input.pos == '{')
+                return parseSection(input, builder, word, nullptr);
+            else if (*input.pos == '=')
+                return parseKeyValue(input, builder, word);
+            else if (*input.pos == ':')
+                return parseInheritance(input, builder, word);
             else
-                return "Expected '{', '=' or ':', found '" + String(1, static_cast<char>(stream.peek())) + "' instead.";
+                return "Expected '{', '=' or ':', found '" + String(1, *input.pos) + "' instead.";
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        template <typename TreeBuilder>
+        void parseInput(CharStringView data, TreeBuilder& builder)
+        {
+            InputBuffer input;
+            input.begin = data.data();
+            input.pos = input.begin;
+            input.end = input.begin + data.length();
+
+            String error;
+            while (!input.atEnd())
+            {
+                error = parseRootSection(input, builder);
+                if (!error.empty())
+                {
+                    const auto lineNumber = std::count(input.begin, input.pos, '\n') + 1;
+                    throw Exception{U"Error while parsing input at line " + String::fromNumber(lineNumber) + U". " + error};
+                }
+            }
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -568,34 +661,214 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-    std::unique_ptr<DataIO::Node> DataIO::parse(std::stringstream& stream)
+    // Builds a document while the input is being parsed. The nodes of a section are collected in reusable buffers and are
+    // only copied into the memory of the document once the section is finished and the amount of nodes is known.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class DataIO::Document::Builder
     {
-        auto root = std::make_unique<Node>();
+    public:
+        using Section = const NodeView*;
 
-        String error;
-        while (stream.peek() != EOF)
+        explicit Builder(Document& document) :
+            m_document(document),
+            m_openSections(1)
         {
-            error = parseRootSection(stream, root);
-            if (!error.empty())
+        }
+
+        void addProperty(const std::string& key, const std::string& value)
+        {
+            m_openSections[m_depth - 1].properties.push_back({storeString(key), storeString(value)});
+        }
+
+        void beginSection(const std::string& name)
+        {
+            // The buffers of sections that were finished earlier are reused
+            if (m_depth == m_openSections.size())
+                m_openSections.emplace_back();
+
+            OpenSection& section = m_openSections[m_depth++];
+            section.name = storeString(name);
+            section.properties.clear();
+            section.children.clear();
+        }
+
+        void endSection(Section baseSection)
+        {
+            // The base section is copied before the new node is added, as it may be stored in the buffer of the parent
+            const NodeView node = finishSection(m_openSections[--m_depth], baseSection);
+            m_openSections[m_depth - 1].children.push_back(node);
+        }
+
+        // Searches the finished sections inside the section that is being parsed and inside the sections around it
+        TGUI_NODISCARD Section findSection(const std::string& name) const
+        {
+            const CharStringView sectionName{name.data(), name.length()};
+            for (std::size_t depth = m_depth; depth > 0; --depth)
             {
-                const auto position = stream.tellg();
-                if (position != std::stringstream::pos_type(-1))
+                for (const auto& childNode : m_openSections[depth - 1].children)
                 {
-                    String str = stream.str();
-                    auto lineNumber = std::count(str.begin(), str.begin() + static_cast<std::ptrdiff_t>(position), U'\n') + 1;
-                    throw Exception{U"Error while parsing input at line " + String::fromNumber(lineNumber) + U". " + error};
+                    if (childNode.name == sectionName)
+                        return &childNode;
                 }
-                else
-                    throw Exception{U"Error while parsing input. " + error};
             }
+
+            return nullptr;
+        }
+
+        TGUI_NODISCARD NodeView finishRoot()
+        {
+            TGUI_ASSERT(m_depth == 1, "All sections have to be finished before the root node can be finished");
+            return finishSection(m_openSections[0], nullptr);
+        }
+
+    private:
+        struct OpenSection
+        {
+            CharStringView name;
+            std::vector<PropertyView> properties;
+            std::vector<NodeView> children;
+        };
+
+        NodeView finishSection(OpenSection& section, Section baseSection)
+        {
+            // Sort the properties like the map in DataIO::Node. When a property was assigned more than once then the last value
+            // is kept, the same as when the value in the map is overwritten.
+            const auto compareNames = [](const PropertyView& left, const PropertyView& right){ return left.name < right.name; };
+            auto& properties = section.properties;
+            std::stable_sort(properties.begin(), properties.end(), compareNames);
+
+            std::size_t propertyCount = 0;
+            for (std::size_t i = 0; i < properties.size(); ++i)
+            {
+                if ((i + 1 < properties.size()) && (properties[i + 1].name == properties[i].name))
+                    continue;
+
+                properties[propertyCount++] = properties[i];
+            }
+            properties.resize(propertyCount);
+
+            if (baseSection)
+            {
+                // Copy properties that aren't overwritten, their strings are shared with the base section
+                for (std::size_t i = 0; i < baseSection->propertyCount; ++i)
+                {
+                    if (!std::binary_search(properties.begin(), properties.begin() + static_cast<std::ptrdiff_t>(propertyCount), baseSection->properties[i], compareNames))
+                        properties.push_back(baseSection->properties[i]);
+                }
+                std::inplace_merge(properties.begin(), properties.begin() + static_cast<std::ptrdiff_t>(propertyCount), properties.end(), compareNames);
+
+                // Copy children that aren't overwritten, their properties and children are shared with the base section
+                for (std::size_t i = 0; i < baseSection->childCount; ++i)
+                {
+                    const NodeView& baseChildNode = baseSection->children[i];
+                    const auto it = std::find_if(section.children.begin(), section.children.end(),
+                        [&](const NodeView& childNode){ return childNode.name == baseChildNode.name; });
+                    if (it == section.children.end())
+                        section.children.push_back(baseChildNode);
+                }
+            }
+
+            NodeView node;
+            node.name = section.name;
+            node.properties = storeArray(properties);
+            node.propertyCount = properties.size();
+            node.children = storeArray(section.children);
+            node.childCount = section.children.size();
+            return node;
+        }
+
+        template <typename T>
+        TGUI_NODISCARD const T* storeArray(const std::vector<T>& elements)
+        {
+            if (elements.empty())
+                return nullptr;
+
+            T* memory = static_cast<T*>(allocate(sizeof(T) * elements.size(), alignof(T)));
+            std::uninitialized_copy(elements.begin(), elements.end(), memory);
+            return memory;
+        }
+
+        TGUI_NODISCARD CharStringView storeString(const std::string& str)
+        {
+            if (str.empty())
+                return {};
+
+            char* memory = static_cast<char*>(allocate(str.length(), 1));
+            std::memcpy(memory, str.data(), str.length());
+            return {memory, str.length()};
+        }
+
+        TGUI_NODISCARD void* allocate(std::size_t size, std::size_t alignment)
+        {
+            std::size_t padding = (alignment - (reinterpret_cast<std::uintptr_t>(m_blockPos) % alignment)) % alignment;
+            if (!m_blockPos || (padding + size > m_blockSpaceLeft))
+            {
+                // Each block is twice as large as the previous one, up to a maximum. Only data that is larger than the
+                // maximum block size gets a block of its own.
+                const std::size_t blockSize = std::max(size + alignment, m_nextBlockSize);
+                m_nextBlockSize = std::min<std::size_t>(m_nextBlockSize * 2, 1024 * 1024);
+
+                m_document.m_memoryBlocks.push_back(MakeUniqueForOverwrite<char[]>(blockSize));
+                m_blockPos = m_document.m_memoryBlocks.back().get();
+                m_blockSpaceLeft = blockSize;
+                padding = (alignment - (reinterpret_cast<std::uintptr_t>(m_blockPos) % alignment)) % alignment;
+            }
+
+            void* memory = m_blockPos + padding;
+            m_blockPos += padding + size;
+            m_blockSpaceLeft -= padding + size;
+            return memory;
         }
 
+    private:
+        Document& m_document;
+        std::vector<OpenSection> m_openSections; // Buffers for the root and the sections that are being parsed, reused between sections
+        std::size_t m_depth = 1; // Amount of open sections, including the root
+        char* m_blockPos = nullptr; // Position in the last memory block where the next data is placed
+        std::size_t m_blockSpaceLeft = 0;
+        std::size_t m_nextBlockSize = 4096;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::unique_ptr<DataIO::Node> DataIO::parse(std::stringstream& stream)
+    {
+        const auto position = stream.tellg();
+        if (position == std::stringstream::pos_type(-1))
+            return std::make_unique<Node>();
+
+        // Parse the remaining contents of the stream from memory and leave the stream at the end, as if it was read completely
+        const std::string contents = stream.str();
+        const std::size_t offset = std::min(static_cast<std::size_t>(position), contents.size());
+        stream.seekg(0, std::ios::end);
+        (void)stream.peek();
+
+        return parse(CharStringView{contents.data() + offset, contents.size() - offset});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::unique_ptr<DataIO::Node> DataIO::parse(CharStringView data)
+    {
+        auto root = std::make_unique<Node>();
+        NodeTreeBuilder builder(*root);
+        parseInput(data, builder);
         return root;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    DataIO::Document DataIO::parseDocument(CharStringView data)
+    {
+        Document document;
+        Document::Builder builder(document);
+        parseInput(data, builder);
+        document.m_root = builder.finishRoot();
+        return document;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void DataIO::emit(const std::unique_ptr<Node>& rootNode, std::stringstream& stream)
     {
         for (const auto& pair : rootNode->propertyValuePairs)
@@ -301,19 +301,19 @@ namespace tgui
         String serializeRendererData(ObjectConverter&& value)
         {
             auto node = std::make_unique<DataIO::Node>();
-            for (const auto& pair : value.getRenderer()->propertyValuePairs)
+            for (const auto& pair : value.getRenderer()->getMergedPropertyValuePairs())
             {
                 String strValue;
                 if (pair.second.getType() == ObjectConverter::Type::RendererData)
                 {
                     std::stringstream ss{ObjectConverter{pair.second}.getString().toStdString()};
                     node->children.push_back(DataIO::parse(ss));
-                    node->children.back()->name = pair.first;
+                    node->children.back()->name = pair.first.getName();
                 }
                 else
                 {
                     strValue = ObjectConverter{pair.second}.getString();
-                    node->propertyValuePairs[pair.first] = std::make_unique<DataIO::ValueNode>(strValue);
+                    node->propertyValuePairs[pair.first.getName()] = std::make_unique<DataIO::ValueNode>(strValue);
                 }
             }
 
@@ -25,14 +25,43 @@
 
 #include <TGUI/Loading/Theme.hpp>
 #include <TGUI/Loading/Serializer.hpp>
+#include <TGUI/Loading/WidgetFactory.hpp>
 #include <TGUI/Widget.hpp>
 
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
     namespace
     {
+        // Converts the serialized textures and fonts in the renderer, so that their files are loaded now instead of when a
+        // widget first uses the renderer
+        void loadRendererResources(RendererData& renderer)
+        {
+            for (auto& pair : renderer.propertyValuePairs)
+            {
+                ObjectConverter& value = pair.second;
+                if (value.getType() == ObjectConverter::Type::RendererData)
+                    loadRendererResources(*value.getRenderer());
+                else if (value.getType() == ObjectConverter::Type::String)
+                {
+                    const String& property = pair.first.getName();
+                    if (property.starts_with(U"Texture"))
+                        (void)value.getTexture();
+                    else if (property == U"Font")
+                        (void)value.getFont();
+                    else if (!value.getString().empty() && (value.getString()[0] == '{'))
+                        loadRendererResources(*value.getRenderer());
+                }
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
         struct DefaultTheme : public Theme
         {
             DefaultTheme()
@@ -546,7 +575,8 @@ namespace tgui
     Theme::Theme(const Theme& other) :
         m_renderers       {},
         m_globalProperties{other.m_globalProperties},
-        m_primary         {other.m_primary}
+        m_primary         {other.m_primary},
+        m_compiledTheme   {other.m_compiledTheme}
     {
         for (const auto& pair : other.m_renderers)
         {
@@ -563,7 +593,8 @@ namespace tgui
     Theme::Theme(Theme&& other) noexcept :
         m_renderers       {std::move(other.m_renderers)},
         m_globalProperties{std::move(other.m_globalProperties)},
-        m_primary         {std::move(other.m_primary)}
+        m_primary         {std::move(other.m_primary)},
+        m_compiledTheme   {std::move(other.m_compiledTheme)}
     {
         for (const auto& pair : m_renderers)
             pair.second->connectedTheme = this;
@@ -580,6 +611,7 @@ namespace tgui
             std::swap(m_renderers,        temp.m_renderers);
             std::swap(m_globalProperties, temp.m_globalProperties);
             std::swap(m_primary,          temp.m_primary);
+            std::swap(m_compiledTheme,    temp.m_compiledTheme);
 
             for (const auto& pair : m_renderers)
                 pair.second->connectedTheme = this;
@@ -597,6 +629,7 @@ namespace tgui
             m_renderers = std::move(other.m_renderers);
             m_globalProperties = std::move(other.m_globalProperties);
             m_primary = std::move(other.m_primary);
+            m_compiledTheme = std::move(other.m_compiledTheme);
 
             for (const auto& pair : m_renderers)
                 pair.second->connectedTheme = this;
@@ -617,6 +650,7 @@ namespace tgui
     void Theme::load(const String& primary)
     {
         m_primary = primary;
+        m_compiledTheme = nullptr;
         m_themeLoader->preload(primary);
 
         // Load the new global properties
@@ -648,6 +682,33 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Theme::loadCompiled(const String& filename)
+    {
+        auto compiledTheme = std::make_shared<CompiledTheme>();
+        compiledTheme->open(filename);
+
+        m_primary = filename;
+        m_compiledTheme = std::move(compiledTheme);
+        m_globalProperties = m_compiledTheme->getGlobalProperties();
+
+        // Update the existing widgets that were using renderers from this theme
+        for (auto& pair : m_renderers)
+        {
+            auto newRenderer = createRendererFromCompiledTheme(pair.first);
+            if (!newRenderer)
+                continue;
+
+            auto& renderer = pair.second;
+            newRenderer->observers = std::move(renderer->observers);
+            renderer = std::move(newRenderer);
+
+            for (auto& observer : renderer->observers)
+                observer->setRenderer(renderer);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     std::shared_ptr<RendererData> Theme::getRenderer(const String& id)
     {
         // If we already have this renderer in cache then just return it
@@ -655,6 +716,16 @@ namespace tgui
         if (it != m_renderers.end())
             return it->second;
 
+        if (m_compiledTheme)
+        {
+            auto renderer = createRendererFromCompiledTheme(id);
+            if (!renderer)
+                throw Exception{U"No section '" + id + U"' was found in compiled theme '" + m_primary + U"'."};
+
+            m_renderers[id] = renderer;
+            return renderer;
+        }
+
         m_renderers[id] = RendererData::create();
         m_renderers[id]->connectedTheme = this;
         auto& properties = m_themeLoader->load(m_primary, id);
@@ -673,6 +744,15 @@ namespace tgui
         if (it != m_renderers.end())
             return it->second;
 
+        if (m_compiledTheme)
+        {
+            auto renderer = createRendererFromCompiledTheme(id);
+            if (renderer)
+                m_renderers[id] = renderer;
+
+            return renderer;
+        }
+
         if (!m_themeLoader->canLoad(m_primary, id))
             return nullptr;
 
@@ -688,6 +768,14 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Theme::preloadRenderers(const std::vector<String>& ids)
+    {
+        for (const auto& id : ids)
+            loadRendererResources(*getRenderer(id));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     ObjectConverter Theme::getGlobalProperty(const String& property)
     {
         auto propertyIt = m_globalProperties.find(property);
@@ -827,6 +915,24 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<RendererData> Theme::createRendererFromCompiledTheme(const String& id)
+    {
+        auto renderer = m_compiledTheme->createRenderer(id);
+        if (!renderer)
+        {
+            const auto widgetTypes = WidgetFactory::getWidgetTypes();
+            if (std::find(widgetTypes.begin(), widgetTypes.end(), id) == widgetTypes.end())
+                return nullptr;
+
+            renderer = RendererData::create();
+        }
+
+        renderer->connectedTheme = this;
+        return renderer;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -28,6 +28,7 @@
 #include <TGUI/Loading/WidgetFactory.hpp>
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
     #include <sstream>
     #include <fstream>
 #endif
@@ -41,10 +42,78 @@
 
 namespace tgui
 {
+    namespace
+    {
+        String getFullFilename(const String& filename)
+        {
+#ifdef TGUI_SYSTEM_WINDOWS
+            if ((filename[0] != '/') && (filename[0] != '\\') && ((filename.size() <= 1) || (filename[1] != ':')))
+#else
+            if (filename[0] != '/')
+#endif
+                return (getResourcePath() / filename).asString();
+            else
+                return filename;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Returns the directory of the theme file, ending with a slash, or an empty string if the filename has no directory
+        String getThemeDirectory(const String& filename)
+        {
+            const auto slashPos = filename.find_last_of("/\\");
+            if (slashPos != String::npos)
+                return filename.substr(0, slashPos+1);
+            else
+                return "";
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool isWidgetType(const String& type)
+        {
+            const auto widgetTypes = WidgetFactory::getWidgetTypes();
+            return std::find(widgetTypes.begin(), widgetTypes.end(), type) != widgetTypes.end();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Stores the properties of a section, nested sections are stored in their serialized form
+        void cacheSection(std::map<String, String>& properties, const DataIO::Node& node)
+        {
+            for (const auto& pair : node.propertyValuePairs)
+                properties[pair.first] = pair.second->value;
+
+            for (const auto& nestedProperty : node.children)
+            {
+                std::stringstream ss;
+                DataIO::emit(nestedProperty, ss);
+                properties[nestedProperty->name] = "{\n" + ss.str() + "}";
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Adds the names of the sections that are referenced inside the node to the list
+        void findReferences(const DataIO::Node& node, std::vector<String>& references)
+        {
+            for (const auto& pair : node.propertyValuePairs)
+            {
+                if (!pair.second->value.empty() && (pair.second->value[0] == '&'))
+                    references.push_back(Deserializer::deserialize(ObjectConverter::Type::String, pair.second->value.substr(1)).getString());
+            }
+
+            for (const auto& child : node.children)
+                findReferences(*child, references);
+        }
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     std::map<String, std::map<String, std::map<String, String>>> DefaultThemeLoader::m_propertiesCache;
     std::map<String, std::map<String, String>> DefaultThemeLoader::m_globalPropertiesCache;
+    std::map<String, DefaultThemeLoader::LazyThemeFile> DefaultThemeLoader::m_lazyFiles;
+    bool DefaultThemeLoader::m_lazyLoading = false;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -64,46 +133,51 @@ namespace tgui
     void BaseThemeLoader::injectThemePath(const std::unique_ptr<DataIO::Node>& node, const String& path) const
     {
         for (const auto& pair : node->propertyValuePairs)
-        {
-            if (((pair.first.size() >= 7) && (pair.first.substr(0, 7) == U"Texture")) || (pair.first == U"Font") || (pair.first == U"Image") || (pair.first == U"Icon"))
-            {
-                if (pair.second->value.empty() || viewEqualIgnoreCase(pair.second->value, U"none") || viewEqualIgnoreCase(pair.second->value, U"null") || viewEqualIgnoreCase(pair.second->value, U"nullptr"))
-                    continue;
+            injectThemePathInValue(pair.first, pair.second->value, path);
 
-                // Insert the path into the filename unless the filename is already an absolute path or if the data is embedded.
-                // We can't just deserialize the value to get rid of the quotes as it may contain things behind the filename.
-                if (pair.second->value[0] != '"')
-                {
-                    if (pair.second->value.starts_with(U"data:"))
-                        continue;
+        for (const auto& child : node->children)
+            injectThemePath(child, path);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BaseThemeLoader::injectThemePathInValue(const String& property, String& value, const String& path)
+    {
+        if (((property.size() < 7) || (property.substr(0, 7) != U"Texture")) && (property != U"Font") && (property != U"Image") && (property != U"Icon"))
+            return;
+
+        if (value.empty() || viewEqualIgnoreCase(value, U"none") || viewEqualIgnoreCase(value, U"null") || viewEqualIgnoreCase(value, U"nullptr"))
+            return;
+
+        // Insert the path into the filename unless the filename is already an absolute path or if the data is embedded.
+        // We can't just deserialize the value to get rid of the quotes as it may contain things behind the filename.
+        if (value[0] != '"')
+        {
+            if (value.starts_with(U"data:"))
+                return;
 
 #ifdef TGUI_SYSTEM_WINDOWS
-                    if ((pair.second->value[0] != '/') && (pair.second->value[0] != '\\') && ((pair.second->value.size() <= 1) || (pair.second->value[1] != ':')))
+            if ((value[0] != '/') && (value[0] != '\\') && ((value.size() <= 1) || (value[1] != ':')))
 #else
-                    if (pair.second->value[0] != '/')
+            if (value[0] != '/')
 #endif
-                        pair.second->value = path + pair.second->value;
-                }
-                else // The filename is between quotes
-                {
-                    if (pair.second->value.size() <= 1)
-                        continue;
+                value = path + value;
+        }
+        else // The filename is between quotes
+        {
+            if (value.size() <= 1)
+                return;
 
-                    if ((pair.second->value.size() >= 7) && (pair.second->value.substr(1, 5) == U"data:"))
-                        continue;
+            if ((value.size() >= 7) && (value.substr(1, 5) == U"data:"))
+                return;
 
 #ifdef TGUI_SYSTEM_WINDOWS
-                    if ((pair.second->value[1] != '/') && (pair.second->value[1] != '\\') && ((pair.second->value.size() <= 2) || (pair.second->value[2] != ':')))
+            if ((value[1] != '/') && (value[1] != '\\') && ((value.size() <= 2) || (value[2] != ':')))
 #else
-                    if (pair.second->value[1] != '/')
+            if (value[1] != '/')
 #endif
-                        pair.second->value = '"' + path + pair.second->value.substr(1);
-                }
-            }
+                value = '"' + path + value.substr(1);
         }
-
-        for (const auto& child : node->children)
-            injectThemePath(child, path);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -155,16 +229,32 @@ namespace tgui
         {
             m_propertiesCache.erase(filename);
             m_globalPropertiesCache.erase(filename);
+            m_lazyFiles.erase(filename);
         }
         else
         {
             m_propertiesCache.clear();
             m_globalPropertiesCache.clear();
+            m_lazyFiles.clear();
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void DefaultThemeLoader::setLazyLoading(bool lazy)
+    {
+        m_lazyLoading = lazy;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool DefaultThemeLoader::getLazyLoading()
+    {
+        return m_lazyLoading;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void DefaultThemeLoader::preload(const String& filename)
     {
         if (filename == U"")
@@ -173,6 +263,27 @@ namespace tgui
         // Load the file when not already in cache
         if (m_propertiesCache.find(filename) == m_propertiesCache.end())
         {
+            if (m_lazyLoading)
+            {
+                LazyThemeFile file;
+                file.contents = readFileContents(filename);
+                file.resourcePath = getThemeDirectory(filename);
+
+                // Only the global properties are parsed, the sections are parsed when they are requested
+                const std::string globalPropertiesText = findSections(file.contents, file.sections);
+                const std::unique_ptr<DataIO::Node> root = DataIO::parse(CharStringView{globalPropertiesText.data(), globalPropertiesText.size()});
+                if (!file.resourcePath.empty())
+                    injectThemePath(root, file.resourcePath);
+
+                auto& globalProperties = m_globalPropertiesCache[filename];
+                for (const auto& pair : root->propertyValuePairs)
+                    globalProperties[pair.first] = pair.second->value;
+
+                m_lazyFiles[filename] = std::move(file);
+                m_propertiesCache[filename] = {};
+                return;
+            }
+
             std::unique_ptr<DataIO::Node> root = readFile(filename);
             if (!root)
                 throw Exception{U"DefaultThemeLoader::preload failed to load file, readFile returned nullptr."};
@@ -197,19 +308,7 @@ namespace tgui
 
             // Cache all propery value pairs
             for (const auto& section : sections)
-            {
-                const auto& child = section.second;
-                const String& name = section.first;
-                for (const auto& pair : child.get()->propertyValuePairs)
-                    m_propertiesCache[filename][name][pair.first] = pair.second->value;
-
-                for (const auto& nestedProperty : child.get()->children)
-                {
-                    std::stringstream ss;
-                    DataIO::emit(nestedProperty, ss);
-                    m_propertiesCache[filename][name][nestedProperty->name] = "{\n" + ss.str() + "}";
-                }
-            }
+                cacheSection(m_propertiesCache[filename][section.first], *section.second.get());
         }
     }
 
@@ -231,10 +330,24 @@ namespace tgui
         if (filename.empty())
             return m_propertiesCache[""][section];
 
-        if (m_propertiesCache[filename].find(section) == m_propertiesCache[filename].end())
-            throw Exception{U"No section '" + section + U"' was found in file '" + filename + "'."};
+        auto& fileCache = m_propertiesCache[filename];
+        if (fileCache.find(section) == fileCache.end())
+        {
+            // Sections of lazily loaded files are parsed on first use
+            const auto lazyFileIt = m_lazyFiles.find(filename);
+            if (lazyFileIt != m_lazyFiles.end())
+            {
+                if (lazyFileIt->second.sections.find(section) != lazyFileIt->second.sections.end())
+                    loadLazySection(filename, section);
+                else if (isWidgetType(section))
+                    fileCache[section] = {};
+            }
+
+            if (fileCache.find(section) == fileCache.end())
+                throw Exception{U"No section '" + section + U"' was found in file '" + filename + "'."};
+        }
 
-        return m_propertiesCache[filename][section];
+        return fileCache[section];
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -243,8 +356,15 @@ namespace tgui
     {
         if (filename.empty())
             return true;
-        else
-            return m_propertiesCache[filename].find(section) != m_propertiesCache[filename].end();
+
+        if (m_propertiesCache[filename].find(section) != m_propertiesCache[filename].end())
+            return true;
+
+        const auto lazyFileIt = m_lazyFiles.find(filename);
+        if (lazyFileIt == m_lazyFiles.end())
+            return false;
+
+        return (lazyFileIt->second.sections.find(section) != lazyFileIt->second.sections.end()) || isWidgetType(section);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -254,32 +374,17 @@ namespace tgui
         if (filename.empty())
             return nullptr;
 
-        String fullFilename;
-#ifdef TGUI_SYSTEM_WINDOWS
-        if ((filename[0] != '/') && (filename[0] != '\\') && ((filename.size() <= 1) || (filename[1] != ':')))
-#else
-        if (filename[0] != '/')
-#endif
-            fullFilename = (getResourcePath() / filename).asString();
-        else
-            fullFilename = filename;
+        const String fullFilename = getFullFilename(filename);
 
         std::size_t fileSize;
         auto fileContents = readFileToMemory(fullFilename, fileSize);
         if (!fileContents)
             throw Exception{U"Failed to open theme file '" + fullFilename + U"'."};
 
-        std::stringstream stream;
-        stream.write(reinterpret_cast<char*>(fileContents.get()), static_cast<std::streamsize>(fileSize));
-
-        std::unique_ptr<DataIO::Node> root = DataIO::parse(stream);
-
-        String resourcePath;
-        auto slashPos = filename.find_last_of("/\\");
-        if (slashPos != String::npos)
-            resourcePath = filename.substr(0, slashPos+1);
+        std::unique_ptr<DataIO::Node> root = DataIO::parse(CharStringView{reinterpret_cast<const char*>(fileContents.get()), fileSize});
 
         // Turn texture and font filenames into paths relative to the theme file
+        const String resourcePath = getThemeDirectory(filename);
         if (!resourcePath.empty())
             injectThemePath(root, resourcePath);
 
@@ -287,6 +392,187 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::string DefaultThemeLoader::readFileContents(const String& filename) const
+    {
+        const String fullFilename = getFullFilename(filename);
+
+        std::size_t fileSize;
+        const auto fileContents = readFileToMemory(fullFilename, fileSize);
+        if (!fileContents)
+            throw Exception{U"Failed to open theme file '" + fullFilename + U"'."};
+
+        return std::string(reinterpret_cast<const char*>(fileContents.get()), fileSize);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DefaultThemeLoader::loadLazySection(const String& filename, const String& section)
+    {
+        auto& file = m_lazyFiles[filename];
+
+        // Parse the section and all sections that it references, directly or indirectly
+        std::map<String, std::reference_wrapper<const std::unique_ptr<DataIO::Node>>> sections;
+        std::vector<String> sectionsToLoad{section};
+        while (!sectionsToLoad.empty())
+        {
+            const String name = std::move(sectionsToLoad.back());
+            sectionsToLoad.pop_back();
+            if (sections.find(name) != sections.end())
+                continue;
+
+            // References to names that aren't sections are either global properties or errors, resolveReferences handles them
+            const auto sectionIt = file.sections.find(name);
+            if (sectionIt == file.sections.end())
+                continue;
+
+            auto parsedIt = file.parsedSections.find(name);
+            if (parsedIt == file.parsedSections.end())
+            {
+                // A section that inherits from another one is parsed together with its base sections, which must be
+                // located earlier in the file, so that the parser can copy the inherited properties
+                std::string text;
+                const LazySection* location = &sectionIt->second;
+                while (true)
+                {
+                    text.insert(0, location->name + (location->baseName.empty() ? "" : " : " + location->baseName) + ' '
+                                   + file.contents.substr(location->begin, location->end - location->begin) + '\n');
+                    if (location->baseName.empty())
+                        break;
+
+                    const String baseName = Deserializer::deserialize(ObjectConverter::Type::String, String(location->baseName)).getString();
+                    const auto baseIt = file.sections.find(baseName);
+                    if ((baseIt == file.sections.end()) || (baseIt->second.begin >= location->begin))
+                        break; // The parser will report that the base section doesn't exist
+
+                    location = &baseIt->second;
+                }
+
+                std::unique_ptr<DataIO::Node> root = DataIO::parse(CharStringView{text.data(), text.size()});
+                if (root->children.empty())
+                    throw Exception{U"Failed to parse section '" + name + U"' in theme file '" + filename + U"'."};
+
+                if (!file.resourcePath.empty())
+                    injectThemePath(root->children.back(), file.resourcePath);
+
+                parsedIt = file.parsedSections.emplace(name, std::move(root->children.back())).first;
+            }
+
+            sections.emplace(name, std::cref(parsedIt->second));
+            findReferences(*parsedIt->second, sectionsToLoad);
+        }
+
+        const auto& node = file.parsedSections[section];
+        resolveReferences(sections, m_globalPropertiesCache[filename], node);
+        cacheSection(m_propertiesCache[filename][section], *node);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::string DefaultThemeLoader::findSections(const std::string& contents, std::map<String, LazySection>& sections)
+    {
+        std::string globalPropertiesText;
+        std::string statement; // Text at the top level since the end of the previous property or section
+        std::size_t colonPos = std::string::npos; // Position in the statement of a colon that separates a base section name
+        bool sectionClosed = false; // Was the last statement at the top level a section?
+        LazySection section;
+        unsigned int depth = 0;
+
+        std::size_t i = 0;
+        while (i < contents.size())
+        {
+            const char c = contents[i];
+            if ((c == '/') && (i + 1 < contents.size()) && ((contents[i+1] == '/') || (contents[i+1] == '*')))
+            {
+                // Skip comments, they are removed from the text in the same way as the parser does
+                if (contents[i+1] == '/')
+                    i = std::min(contents.find('\n', i), contents.size());
+                else
+                    i = std::min(contents.find("*/", i + 2), contents.size() - 2) + 2;
+
+                continue;
+            }
+
+            if (c == '"')
+            {
+                // Skip strings, as they may contain brackets
+                std::size_t endPos = i + 1;
+                while ((endPos < contents.size()) && (contents[endPos] != '"'))
+                    endPos += (contents[endPos] == '\\') ? 2u : 1u;
+
+                endPos = std::min(endPos + 1, contents.size());
+                if (depth == 0)
+                    statement.append(contents, i, endPos - i);
+
+                i = endPos;
+                continue;
+            }
+
+            if (depth == 0)
+            {
+                if (c == '{')
+                {
+                    if (colonPos != std::string::npos)
+                    {
+                        section.name = String(statement.substr(0, colonPos)).trim().toStdString();
+                        section.baseName = String(statement.substr(colonPos + 1)).trim().toStdString();
+                    }
+                    else
+                    {
+                        section.name = String(statement).trim().toStdString();
+                        section.baseName.clear();
+                    }
+
+                    section.begin = i;
+                    statement.clear();
+                    colonPos = std::string::npos;
+                    depth = 1;
+                }
+                else if (c == ';')
+                {
+                    // A semicolon behind the closing bracket of a section is ignored by the parser
+                    if (!sectionClosed || !String(statement).trim().empty())
+                    {
+                        globalPropertiesText += statement;
+                        globalPropertiesText += c;
+                    }
+
+                    statement.clear();
+                    colonPos = std::string::npos;
+                    sectionClosed = false;
+                }
+                else
+                {
+                    if (c == ':')
+                        colonPos = statement.size();
+
+                    statement += c;
+                }
+            }
+            else if (c == '{')
+                ++depth;
+            else if (c == '}')
+            {
+                --depth;
+                if (depth == 0)
+                {
+                    section.end = i + 1;
+                    sectionClosed = true;
+                    const String name = Deserializer::deserialize(ObjectConverter::Type::String, String(section.name)).getString();
+                    sections.emplace(name, section);
+                }
+            }
+
+            ++i;
+        }
+
+        if (depth > 0)
+            throw Exception{U"Failed to parse theme file, no closing bracket found for section '" + String(section.name) + U"'."};
+
+        return globalPropertiesText + statement;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,202 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2023 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/MappedFile.hpp>
+#include <TGUI/Filesystem.hpp>
+#include <TGUI/Global.hpp>
+
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <limits>
+#endif
+
+#if defined(TGUI_SYSTEM_WINDOWS)
+    #include <TGUI/extlibs/IncludeWindows.hpp>
+#elif !defined(TGUI_SYSTEM_ANDROID)
+    #include <sys/mman.h> // mmap, munmap
+    #include <sys/stat.h> // fstat
+    #include <fcntl.h> // open
+    #include <unistd.h> // close
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    MappedFile::~MappedFile()
+    {
+        close();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool MappedFile::open(const String& filename)
+    {
+        close();
+
+        if (!mapFile(filename))
+        {
+            // Read the file instead of mapping it. This also happens for empty files as they can't be mapped.
+            std::size_t fileSize = 0;
+            m_readData = readFileToMemory(filename, fileSize);
+            if (m_readData)
+            {
+                m_data = reinterpret_cast<const char*>(m_readData.get());
+                m_size = fileSize;
+            }
+            else if (!Filesystem::fileExists(filename))
+                return false;
+        }
+
+        m_opened = true;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void MappedFile::close()
+    {
+        unmapFile();
+        m_readData = nullptr;
+
+        m_opened = false;
+        m_data = nullptr;
+        m_size = 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool MappedFile::isOpen() const
+    {
+        return m_opened;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const char* MappedFile::getData() const
+    {
+        return m_data;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t MappedFile::getSize() const
+    {
+        return m_size;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool MappedFile::isMapped() const
+    {
+        return m_mappedMemory != nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool MappedFile::mapFile(const String& filename)
+    {
+#if defined(TGUI_SYSTEM_WINDOWS)
+        HANDLE file = CreateFileW(filename.toWideString().c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr,
+                                  OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+            return false;
+
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(file, &fileSize) || (fileSize.QuadPart <= 0)
+         || (static_cast<unsigned long long>(fileSize.QuadPart) > static_cast<unsigned long long>(std::numeric_limits<std::size_t>::max())))
+        {
+            CloseHandle(file);
+            return false;
+        }
+
+        HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(file);
+        if (!mapping)
+            return false;
+
+        // The view keeps the mapping alive, so the handle can already be closed
+        m_mappedMemory = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(mapping);
+        if (!m_mappedMemory)
+            return false;
+
+        m_data = static_cast<const char*>(m_mappedMemory);
+        m_size = static_cast<std::size_t>(fileSize.QuadPart);
+        return true;
+
+#elif !defined(TGUI_SYSTEM_ANDROID)
+        const int file = ::open(filename.toStdString().c_str(), O_RDONLY);
+        if (file < 0)
+            return false;
+
+        struct stat fileInfo;
+        if ((fstat(file, &fileInfo) != 0) || !S_ISREG(fileInfo.st_mode) || (fileInfo.st_size <= 0)
+         || (static_cast<unsigned long long>(fileInfo.st_size) > static_cast<unsigned long long>(std::numeric_limits<std::size_t>::max())))
+        {
+            ::close(file);
+            return false;
+        }
+
+        // The mapping remains valid after closing the file descriptor
+        const auto fileSize = static_cast<std::size_t>(fileInfo.st_size);
+        void* memory = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, file, 0);
+        ::close(file);
+        if (memory == MAP_FAILED)
+            return false;
+
+        m_mappedMemory = memory;
+        m_data = static_cast<const char*>(m_mappedMemory);
+        m_size = fileSize;
+        return true;
+
+#else
+        // Files on Android are often stored in the assets, which can't be mapped
+        (void)filename;
+        return false;
+#endif
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void MappedFile::unmapFile()
+    {
+        if (!m_mappedMemory)
+            return;
+
+#if defined(TGUI_SYSTEM_WINDOWS)
+        UnmapViewOfFile(m_mappedMemory);
+#elif !defined(TGUI_SYSTEM_ANDROID)
+        munmap(m_mappedMemory, m_size);
+#endif
+
+        m_mappedMemory = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,189 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2023 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/MappedTextFile.hpp>
+#include <TGUI/Global.hpp>
+#include <TGUI/Utf.hpp>
+
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
+    #include <cstring>
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        const std::size_t linesPerIndexEntry = 64;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    MappedTextFile::~MappedTextFile()
+    {
+        close();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool MappedTextFile::open(const String& filename)
+    {
+        close();
+
+        if (!m_file.open(filename))
+            return false;
+
+        m_data = m_file.getData();
+        m_size = m_file.getSize();
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void MappedTextFile::close()
+    {
+        m_file.close();
+
+        m_data = nullptr;
+        m_size = 0;
+
+        m_lineOffsets.assign(1, 0);
+        m_indexedLineCount = 1;
+        m_lastIndexedLineOffset = 0;
+        m_fullyIndexed = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool MappedTextFile::isOpen() const
+    {
+        return m_file.isOpen();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t MappedTextFile::getSize() const
+    {
+        return m_size;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t MappedTextFile::getLineCount() const
+    {
+        if (m_fullyIndexed || (m_lastIndexedLineOffset == 0))
+            return m_indexedLineCount;
+
+        // Assume that the lines in the rest of the file have the same average length as the lines that were already scanned
+        const double bytesPerLine = static_cast<double>(m_lastIndexedLineOffset) / static_cast<double>(m_indexedLineCount - 1);
+        const auto estimatedLineCount = static_cast<std::size_t>(static_cast<double>(m_size) / bytesPerLine) + 1;
+        return std::max(estimatedLineCount, m_indexedLineCount);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool MappedTextFile::isFullyIndexed() const
+    {
+        return m_fullyIndexed;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void MappedTextFile::indexLines(std::size_t lineCount) const
+    {
+        while (!m_fullyIndexed && (m_indexedLineCount < lineCount))
+        {
+            const char* newline = nullptr;
+            if (m_lastIndexedLineOffset < m_size)
+                newline = static_cast<const char*>(std::memchr(m_data + m_lastIndexedLineOffset, '\n', m_size - m_lastIndexedLineOffset));
+
+            if (!newline)
+            {
+                m_fullyIndexed = true;
+                break;
+            }
+
+            m_lastIndexedLineOffset = static_cast<std::size_t>(newline - m_data) + 1;
+            if (m_indexedLineCount % linesPerIndexEntry == 0)
+                m_lineOffsets.push_back(m_lastIndexedLineOffset);
+
+            ++m_indexedLineCount;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    String MappedTextFile::getLine(std::size_t lineIndex) const
+    {
+        indexLines(lineIndex + 1);
+        if (lineIndex >= m_indexedLineCount)
+            return {};
+
+        const std::size_t lineStart = getLineOffset(lineIndex);
+        const char* lineEnd = m_data + m_size;
+        if (lineStart < m_size)
+        {
+            const char* newline = static_cast<const char*>(std::memchr(m_data + lineStart, '\n', m_size - lineStart));
+            if (newline)
+            {
+                // A '\r' is only part of the line ending when it is followed by the '\n'
+                lineEnd = newline;
+                if ((lineEnd > m_data + lineStart) && (*(lineEnd - 1) == '\r'))
+                    --lineEnd;
+            }
+        }
+
+        return utf::convertUtf8toUtf32(m_data + lineStart, lineEnd);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    String MappedTextFile::getText() const
+    {
+        String text = utf::convertUtf8toUtf32(m_data, m_data + m_size);
+        text.replace(U"\r\n", U"\n");
+        return text;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t MappedTextFile::getLineOffset(std::size_t lineIndex) const
+    {
+        TGUI_ASSERT(lineIndex < m_indexedLineCount, "MappedTextFile::getLineOffset can only be called for lines that were indexed");
+
+        // Start from the nearest line that is stored in the index and skip the remaining lines
+        std::size_t offset = m_lineOffsets[lineIndex / linesPerIndexEntry];
+        for (std::size_t i = lineIndex % linesPerIndexEntry; i > 0; --i)
+            offset = static_cast<std::size_t>(static_cast<const char*>(std::memchr(m_data + offset, '\n', m_size - offset)) - m_data) + 1;
+
+        return offset;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
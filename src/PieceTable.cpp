@@ -0,0 +1,465 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2023 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/PieceTable.hpp>
+
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        // The buffers are only compacted when they are larger than this, so that small texts are never copied
+        const std::size_t minimumCompactionSize = 1 << 16;
+
+        void addNewlinePositions(const std::u32string& buffer, std::size_t start, std::vector<std::size_t>& newlines)
+        {
+            for (std::size_t i = start; i < buffer.length(); ++i)
+            {
+                if (buffer[i] == U'\n')
+                    newlines.push_back(i);
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    PieceTable::PieceTable(const String& text)
+    {
+        setText(text);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void PieceTable::setText(const String& text)
+    {
+        m_originalBuffer = text.toUtf32();
+        m_originalBufferNewlines.clear();
+        addNewlinePositions(m_originalBuffer, 0, m_originalBufferNewlines);
+
+        m_addBuffer.clear();
+        m_addBufferNewlines.clear();
+
+        m_nodes.resize(1);
+        m_freeNodes.clear();
+        m_root = 0;
+        if (!m_originalBuffer.empty())
+            m_root = createNode(false, 0, m_originalBuffer.length());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    String PieceTable::getText() const
+    {
+        return substr(0);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    String PieceTable::substr(std::size_t index, std::size_t count) const
+    {
+        TGUI_ASSERT(index <= length(), "Index passed to PieceTable::substr can't be beyond the end of the text");
+        count = std::min(count, length() - index);
+
+        std::u32string result;
+        result.reserve(count);
+        appendCharacters(m_root, index, index + count, result);
+        return result;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    char32_t PieceTable::getCharacter(std::size_t index) const
+    {
+        TGUI_ASSERT(index < length(), "Index passed to PieceTable::getCharacter must be smaller than the length of the text");
+
+        std::size_t node = m_root;
+        while (node != 0)
+        {
+            const Node& n = m_nodes[node];
+            const std::size_t leftLength = m_nodes[n.left].subtreeLength;
+            if (index < leftLength)
+                node = n.left;
+            else if (index < leftLength + n.length)
+            {
+                const std::u32string& buffer = n.inAddBuffer ? m_addBuffer : m_originalBuffer;
+                return buffer[n.start + index - leftLength];
+            }
+            else
+            {
+                index -= leftLength + n.length;
+                node = n.right;
+            }
+        }
+
+        return 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t PieceTable::length() const
+    {
+        return m_nodes[m_root].subtreeLength;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool PieceTable::empty() const
+    {
+        return m_root == 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void PieceTable::insert(std::size_t index, const String& text)
+    {
+        TGUI_ASSERT(index <= length(), "Index passed to PieceTable::insert can't be beyond the end of the text");
+        if (text.empty())
+            return;
+
+        const std::size_t addStart = m_addBuffer.length();
+        m_addBuffer += text.toUtf32();
+        addNewlinePositions(m_addBuffer, addStart, m_addBufferNewlines);
+
+        const auto trees = split(m_root, index);
+
+        // When typing, each character is placed directly behind the previous one. In that case the piece that ends at the
+        // insertion point also ends at the end of the add buffer, and it can simply be extended instead of adding a piece.
+        std::vector<std::size_t> path;
+        for (std::size_t node = trees.first; node != 0; node = m_nodes[node].right)
+            path.push_back(node);
+
+        if (!path.empty() && m_nodes[path.back()].inAddBuffer && (m_nodes[path.back()].start + m_nodes[path.back()].length == addStart))
+        {
+            Node& lastNode = m_nodes[path.back()];
+            lastNode.length += text.length();
+            lastNode.newlineCount = countNewlines(true, lastNode.start, lastNode.length);
+            for (auto it = path.rbegin(); it != path.rend(); ++it)
+                updateNode(*it);
+
+            m_root = merge(trees.first, trees.second);
+        }
+        else
+            m_root = merge(merge(trees.first, createNode(true, addStart, text.length())), trees.second);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void PieceTable::append(const String& text)
+    {
+        insert(length(), text);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void PieceTable::erase(std::size_t index, std::size_t count)
+    {
+        TGUI_ASSERT(index <= length(), "Index passed to PieceTable::erase can't be beyond the end of the text");
+        count = std::min(count, length() - index);
+        if (count == 0)
+            return;
+
+        const auto treesBefore = split(m_root, index);
+        const auto treesAfter = split(treesBefore.second, count);
+        freeTree(treesAfter.first);
+        m_root = merge(treesBefore.first, treesAfter.second);
+
+        compactIfNeeded();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t PieceTable::getLineCount() const
+    {
+        return m_nodes[m_root].subtreeNewlineCount + 1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t PieceTable::getLineStart(std::size_t lineIndex) const
+    {
+        TGUI_ASSERT(lineIndex < getLineCount(), "Line passed to PieceTable::getLineStart must be smaller than getLineCount()");
+        if (lineIndex == 0)
+            return 0;
+
+        // Search for the newline that ends the previous line. The line starts directly behind it.
+        std::size_t newlinesToSkip = lineIndex - 1;
+        std::size_t position = 0;
+        std::size_t node = m_root;
+        while (node != 0)
+        {
+            const Node& n = m_nodes[node];
+            const Node& leftNode = m_nodes[n.left];
+            if (newlinesToSkip < leftNode.subtreeNewlineCount)
+            {
+                node = n.left;
+                continue;
+            }
+
+            newlinesToSkip -= leftNode.subtreeNewlineCount;
+            position += leftNode.subtreeLength;
+            if (newlinesToSkip < n.newlineCount)
+            {
+                const std::vector<std::size_t>& newlines = n.inAddBuffer ? m_addBufferNewlines : m_originalBufferNewlines;
+                const auto firstNewlineIt = std::lower_bound(newlines.begin(), newlines.end(), n.start);
+                return position + (*(firstNewlineIt + static_cast<std::ptrdiff_t>(newlinesToSkip)) - n.start) + 1;
+            }
+
+            newlinesToSkip -= n.newlineCount;
+            position += n.length;
+            node = n.right;
+        }
+
+        return length();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t PieceTable::getLineLength(std::size_t lineIndex) const
+    {
+        const std::size_t lineStart = getLineStart(lineIndex);
+        if (lineIndex + 1 < getLineCount())
+            return getLineStart(lineIndex + 1) - 1 - lineStart;
+        else
+            return length() - lineStart;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t PieceTable::getLineOfIndex(std::size_t index) const
+    {
+        TGUI_ASSERT(index <= length(), "Index passed to PieceTable::getLineOfIndex can't be beyond the end of the text");
+
+        std::size_t lineIndex = 0;
+        std::size_t node = m_root;
+        while (node != 0)
+        {
+            const Node& n = m_nodes[node];
+            const Node& leftNode = m_nodes[n.left];
+            if (index < leftNode.subtreeLength)
+            {
+                node = n.left;
+                continue;
+            }
+
+            lineIndex += leftNode.subtreeNewlineCount;
+            index -= leftNode.subtreeLength;
+            if (index < n.length)
+                return lineIndex + countNewlines(n.inAddBuffer, n.start, index);
+
+            lineIndex += n.newlineCount;
+            index -= n.length;
+            node = n.right;
+        }
+
+        return lineIndex;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t PieceTable::getPieceCount() const
+    {
+        return m_nodes.size() - 1 - m_freeNodes.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t PieceTable::createNode(bool inAddBuffer, std::size_t start, std::size_t length)
+    {
+        // Generate a pseudo-random priority with xorshift
+        m_randomState ^= m_randomState << 13;
+        m_randomState ^= m_randomState >> 17;
+        m_randomState ^= m_randomState << 5;
+
+        Node newNode;
+        newNode.inAddBuffer = inAddBuffer;
+        newNode.start = start;
+        newNode.length = length;
+        newNode.newlineCount = countNewlines(inAddBuffer, start, length);
+        newNode.subtreeLength = length;
+        newNode.subtreeNewlineCount = newNode.newlineCount;
+        newNode.priority = m_randomState;
+
+        if (!m_freeNodes.empty())
+        {
+            const std::size_t node = m_freeNodes.back();
+            m_freeNodes.pop_back();
+            m_nodes[node] = newNode;
+            return node;
+        }
+
+        m_nodes.push_back(newNode);
+        return m_nodes.size() - 1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void PieceTable::updateNode(std::size_t node)
+    {
+        Node& n = m_nodes[node];
+        n.subtreeLength = m_nodes[n.left].subtreeLength + n.length + m_nodes[n.right].subtreeLength;
+        n.subtreeNewlineCount = m_nodes[n.left].subtreeNewlineCount + n.newlineCount + m_nodes[n.right].subtreeNewlineCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::pair<std::size_t, std::size_t> PieceTable::split(std::size_t node, std::size_t index)
+    {
+        if (node == 0)
+            return {0, 0};
+
+        const std::size_t leftLength = m_nodes[m_nodes[node].left].subtreeLength;
+        if (index <= leftLength)
+        {
+            const auto trees = split(m_nodes[node].left, index);
+            m_nodes[node].left = trees.second;
+            updateNode(node);
+            return {trees.first, node};
+        }
+
+        if (index >= leftLength + m_nodes[node].length)
+        {
+            const auto trees = split(m_nodes[node].right, index - leftLength - m_nodes[node].length);
+            m_nodes[node].right = trees.first;
+            updateNode(node);
+            return {node, trees.second};
+        }
+
+        // The split point lies inside the piece of this node, so the piece is cut in two. The second part gets the same
+        // priority as the original node, which keeps the heap order valid when it becomes the parent of the right subtree.
+        const std::size_t offset = index - leftLength;
+        const std::size_t tailNode = createNode(m_nodes[node].inAddBuffer, m_nodes[node].start + offset, m_nodes[node].length - offset);
+
+        Node& n = m_nodes[node];
+        m_nodes[tailNode].priority = n.priority;
+        m_nodes[tailNode].right = n.right;
+        n.right = 0;
+        n.length = offset;
+        n.newlineCount -= m_nodes[tailNode].newlineCount;
+        updateNode(node);
+        updateNode(tailNode);
+        return {node, tailNode};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t PieceTable::merge(std::size_t left, std::size_t right)
+    {
+        if (left == 0)
+            return right;
+        if (right == 0)
+            return left;
+
+        if (m_nodes[left].priority > m_nodes[right].priority)
+        {
+            const std::size_t mergedRight = merge(m_nodes[left].right, right);
+            m_nodes[left].right = mergedRight;
+            updateNode(left);
+            return left;
+        }
+        else
+        {
+            const std::size_t mergedLeft = merge(left, m_nodes[right].left);
+            m_nodes[right].left = mergedLeft;
+            updateNode(right);
+            return right;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void PieceTable::freeTree(std::size_t node)
+    {
+        std::vector<std::size_t> nodesToFree;
+        if (node != 0)
+            nodesToFree.push_back(node);
+
+        while (!nodesToFree.empty())
+        {
+            const std::size_t freedNode = nodesToFree.back();
+            nodesToFree.pop_back();
+
+            if (m_nodes[freedNode].left != 0)
+                nodesToFree.push_back(m_nodes[freedNode].left);
+            if (m_nodes[freedNode].right != 0)
+                nodesToFree.push_back(m_nodes[freedNode].right);
+
+            m_freeNodes.push_back(freedNode);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void PieceTable::appendCharacters(std::size_t node, std::size_t first, std::size_t last, std::u32string& result) const
+    {
+        if ((node == 0) || (first >= last))
+            return;
+
+        const Node& n = m_nodes[node];
+        const std::size_t leftLength = m_nodes[n.left].subtreeLength;
+        if (first < leftLength)
+            appendCharacters(n.left, first, std::min(last, leftLength), result);
+
+        const std::size_t pieceEnd = leftLength + n.length;
+        if ((first < pieceEnd) && (last > leftLength))
+        {
+            const std::size_t from = std::max(first, leftLength) - leftLength;
+            const std::size_t to = std::min(last, pieceEnd) - leftLength;
+            const std::u32string& buffer = n.inAddBuffer ? m_addBuffer : m_originalBuffer;
+            result.append(buffer, n.start + from, to - from);
+        }
+
+        if (last > pieceEnd)
+            appendCharacters(n.right, std::max(first, pieceEnd) - pieceEnd, last - pieceEnd, result);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t PieceTable::countNewlines(bool inAddBuffer, std::size_t start, std::size_t length) const
+    {
+        const std::vector<std::size_t>& newlines = inAddBuffer ? m_addBufferNewlines : m_originalBufferNewlines;
+        const auto firstIt = std::lower_bound(newlines.begin(), newlines.end(), start);
+        const auto lastIt = std::lower_bound(firstIt, newlines.end(), start + length);
+        return static_cast<std::size_t>(lastIt - firstIt);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void PieceTable::compactIfNeeded()
+    {
+        // Erased characters remain in the buffers. Once they take up most of the memory, the text is copied to a new buffer.
+        const std::size_t bufferSize = m_originalBuffer.length() + m_addBuffer.length();
+        if ((bufferSize > minimumCompactionSize) && (bufferSize > 2 * length()))
+            setText(getText());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,116 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2023 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/PropertyId.hpp>
+
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <unordered_map>
+    #include <deque>
+    #include <mutex>
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        struct PropertyNameTable
+        {
+            PropertyNameTable()
+            {
+#define TGUI_BUILTIN_PROPERTY_NAME(NAME) add(#NAME);
+                TGUI_BUILTIN_RENDERER_PROPERTIES(TGUI_BUILTIN_PROPERTY_NAME)
+#undef TGUI_BUILTIN_PROPERTY_NAME
+            }
+
+            std::uint32_t add(const String& name)
+            {
+                const auto index = static_cast<std::uint32_t>(names.size());
+                names.push_back(name);
+                indices[name.toUtf32()] = index;
+                return index;
+            }
+
+            std::deque<String> names; // Deque so that references to the names remain valid when adding new ones
+            std::unordered_map<std::u32string, std::uint32_t> indices;
+            std::mutex mutex; // The table is shared by all threads, e.g. when widgets are loaded on a background thread
+        };
+
+        PropertyNameTable& getPropertyNameTable()
+        {
+            static PropertyNameTable table;
+            return table;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    PropertyId::PropertyId(const String& name)
+    {
+        auto& table = getPropertyNameTable();
+        const std::u32string key = name.toUtf32();
+
+        const std::lock_guard<std::mutex> lock(table.mutex);
+        const auto it = table.indices.find(key);
+        if (it != table.indices.end())
+            m_index = it->second;
+        else
+            m_index = table.add(name);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    PropertyId PropertyId::find(const String& name)
+    {
+        auto& table = getPropertyNameTable();
+        const std::u32string key = name.toUtf32();
+
+        const std::lock_guard<std::mutex> lock(table.mutex);
+        const auto it = table.indices.find(key);
+        if (it != table.indices.end())
+            return PropertyId{it->second};
+        else
+            return {};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const String& PropertyId::getName() const
+    {
+        static const String emptyName;
+        if (!isValid())
+            return emptyName;
+
+        // The reference remains valid after unlocking, the deque doesn't move its elements when names are added
+        auto& table = getPropertyNameTable();
+        const std::lock_guard<std::mutex> lock(table.mutex);
+        return table.names[m_index];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
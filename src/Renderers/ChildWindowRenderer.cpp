@@ -56,14 +56,14 @@ namespace tgui
 
     float ChildWindowRenderer::getTitleBarHeight() const
     {
-        auto it = m_data->propertyValuePairs.find("TitleBarHeight");
-        if (it != m_data->propertyValuePairs.end())
-            return it->second.getNumber();
+        ObjectConverter* value = m_data->findProperty(Property::TitleBarHeight);
+        if (value)
+            return value->getNumber();
         else
         {
-            it = m_data->propertyValuePairs.find("TextureTitleBar");
-            if (it != m_data->propertyValuePairs.end() && it->second.getTexture().getData())
-                return static_cast<float>(it->second.getTexture().getImageSize().y);
+            value = m_data->findProperty(Property::TextureTitleBar);
+            if (value && value->getTexture().getData())
+                return static_cast<float>(value->getTexture().getImageSize().y);
             else
                 return 20;
         }
@@ -73,7 +73,7 @@ namespace tgui
 
     void ChildWindowRenderer::setTitleBarHeight(float number)
     {
-        setProperty("TitleBarHeight", ObjectConverter{number});
+        setProperty(Property::TitleBarHeight, ObjectConverter{number});
     }
 }
 
@@ -27,19 +27,115 @@
 #include <TGUI/RendererDefines.hpp>
 #include <TGUI/Widget.hpp>
 
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    RendererPropertyMap::RendererPropertyMap(const std::map<String, ObjectConverter>& pairs)
+    {
+        m_pairs.reserve(pairs.size());
+        for (const auto& pair : pairs)
+            m_pairs.emplace_back(PropertyId{pair.first}, pair.second);
+
+        // Properties that aren't built-in don't have their ids in alphabetical order
+        std::sort(m_pairs.begin(), m_pairs.end(), [](const value_type& left, const value_type& right){ return left.first < right.first; });
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererPropertyMap::iterator RendererPropertyMap::find(PropertyId property)
+    {
+        const auto it = std::lower_bound(m_pairs.begin(), m_pairs.end(), property, [](const value_type& pair, PropertyId id){ return pair.first < id; });
+        if ((it != m_pairs.end()) && (it->first == property))
+            return it;
+        else
+            return m_pairs.end();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererPropertyMap::const_iterator RendererPropertyMap::find(PropertyId property) const
+    {
+        const auto it = std::lower_bound(m_pairs.begin(), m_pairs.end(), property, [](const value_type& pair, PropertyId id){ return pair.first < id; });
+        if ((it != m_pairs.end()) && (it->first == property))
+            return it;
+        else
+            return m_pairs.end();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererPropertyMap::iterator RendererPropertyMap::find(const String& property)
+    {
+        const PropertyId id = PropertyId::find(property);
+        return id.isValid() ? find(id) : m_pairs.end();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererPropertyMap::const_iterator RendererPropertyMap::find(const String& property) const
+    {
+        const PropertyId id = PropertyId::find(property);
+        return id.isValid() ? find(id) : m_pairs.end();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ObjectConverter& RendererPropertyMap::operator[](PropertyId property)
+    {
+        const auto it = std::lower_bound(m_pairs.begin(), m_pairs.end(), property, [](const value_type& pair, PropertyId id){ return pair.first < id; });
+        if ((it != m_pairs.end()) && (it->first == property))
+            return it->second;
+        else
+            return m_pairs.emplace(it, property, ObjectConverter{})->second;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ObjectConverter& RendererPropertyMap::operator[](const String& property)
+    {
+        return (*this)[PropertyId{property}];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t RendererPropertyMap::erase(PropertyId property)
+    {
+        const auto it = find(property);
+        if (it == m_pairs.end())
+            return 0;
+
+        m_pairs.erase(it);
+        return 1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererPropertyMap::iterator RendererPropertyMap::erase(const_iterator it)
+    {
+        return m_pairs.erase(it);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     RendererData::RendererData(const RendererData& other) :
         propertyValuePairs{other.propertyValuePairs},
+        base{other.base},
+        layers{},
         observers{other.observers},
         connectedTheme{nullptr},
         themePropertiesInherited{false},
         shared{false}
     {
+        if (base)
+            base->layers.insert(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -55,6 +151,13 @@ namespace tgui
             std::swap(connectedTheme,           temp.connectedTheme);
             std::swap(themePropertiesInherited, temp.themePropertiesInherited);
             std::swap(shared,                   temp.shared);
+
+            // The base isn't swapped, as the base keeps track of the addresses of its layers
+            if (base)
+                base->layers.erase(this);
+            base = other.base;
+            if (base)
+                base->layers.insert(this);
         }
 
         return *this;
@@ -62,6 +165,14 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    RendererData::~RendererData()
+    {
+        if (base)
+            base->layers.erase(this);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     std::shared_ptr<RendererData> RendererData::create(const std::map<String, ObjectConverter>& init)
     {
         auto data = std::make_shared<RendererData>();
@@ -91,6 +202,99 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::shared_ptr<RendererData> RendererData::createLayer(const std::shared_ptr<RendererData>& data)
+    {
+        auto layer = std::make_shared<RendererData>();
+        layer->shared = false;
+
+        // Layers are never stacked, a layer on top of another layer uses the same base and copies the changed properties
+        if (data->base)
+        {
+            layer->base = data->base;
+            layer->propertyValuePairs = data->propertyValuePairs;
+        }
+        else
+            layer->base = data;
+
+        layer->base->layers.insert(layer.get());
+        return layer;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ObjectConverter* RendererData::findProperty(PropertyId property)
+    {
+        const auto it = propertyValuePairs.find(property);
+        if (it != propertyValuePairs.end())
+            return &it->second;
+        else if (base)
+            return base->findProperty(property);
+        else
+            return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const ObjectConverter* RendererData::findProperty(PropertyId property) const
+    {
+        const auto it = propertyValuePairs.find(property);
+        if (it != propertyValuePairs.end())
+            return &it->second;
+        else if (base)
+            return base->findProperty(property);
+        else
+            return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererPropertyMap RendererData::getMergedPropertyValuePairs() const
+    {
+        if (!base)
+            return propertyValuePairs;
+
+        RendererPropertyMap mergedPairs = base->getMergedPropertyValuePairs();
+        for (const auto& pair : propertyValuePairs)
+            mergedPairs[pair.first] = pair.second;
+
+        return mergedPairs;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RendererData::detachLayers()
+    {
+        if (layers.empty())
+            return;
+
+        // All layers share a single copy, so the properties only have to be copied once
+        auto frozenData = std::make_shared<RendererData>();
+        frozenData->propertyValuePairs = propertyValuePairs;
+        frozenData->base = base;
+        if (frozenData->base)
+            frozenData->base->layers.insert(frozenData.get());
+
+        frozenData->layers = std::move(layers);
+        layers.clear();
+        for (RendererData* layer : frozenData->layers)
+            layer->base = frozenData;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RendererData::mergeBase()
+    {
+        if (!base)
+            return;
+
+        propertyValuePairs = getMergedPropertyValuePairs();
+
+        base->layers.erase(this);
+        base = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     TGUI_RENDERER_PROPERTY_BOOL(WidgetRenderer, TransparentTexture, false)
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -99,7 +303,7 @@ namespace tgui
 
     void WidgetRenderer::setOpacity(float opacity)
     {
-        setProperty("Opacity", ObjectConverter{std::max(0.f, std::min(1.f, opacity))});
+        setProperty(Property::Opacity, ObjectConverter{std::max(0.f, std::min(1.f, opacity))});
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -109,9 +313,9 @@ namespace tgui
     void WidgetRenderer::setOpacityDisabled(float opacity)
     {
         if (opacity != -1.f)
-            setProperty("OpacityDisabled", ObjectConverter{std::max(0.f, std::min(1.f, opacity))});
+            setProperty(Property::OpacityDisabled, ObjectConverter{std::max(0.f, std::min(1.f, opacity))});
         else
-            setProperty("OpacityDisabled", ObjectConverter{-1.f});
+            setProperty(Property::OpacityDisabled, ObjectConverter{-1.f});
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -145,16 +349,16 @@ namespace tgui
 
     void WidgetRenderer::setFont(const Font& font)
     {
-        setProperty("Font", font);
+        setProperty(Property::Font, font);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Font WidgetRenderer::getFont() const
     {
-        auto it = m_data->propertyValuePairs.find("Font");
-        if (it != m_data->propertyValuePairs.end())
-            return it->second.getFont();
+        ObjectConverter* value = m_data->findProperty(Property::Font);
+        if (value)
+            return value->getFont();
         else
             return {};
     }
@@ -163,16 +367,16 @@ namespace tgui
 
     void WidgetRenderer::setTextSize(unsigned int size)
     {
-        setProperty("TextSize", static_cast<float>(size));
+        setProperty(Property::TextSize, static_cast<float>(size));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     unsigned int WidgetRenderer::getTextSize() const
     {
-        auto it = m_data->propertyValuePairs.find("TextSize");
-        if (it != m_data->propertyValuePairs.end())
-            return static_cast<unsigned int>(it->second.getNumber());
+        ObjectConverter* value = m_data->findProperty(Property::TextSize);
+        if (value)
+            return static_cast<unsigned int>(value->getNumber());
         else
             return 0;
     }
@@ -181,11 +385,30 @@ namespace tgui
 
     void WidgetRenderer::setProperty(const String& property, ObjectConverter&& value)
     {
-        if (m_data->propertyValuePairs[property] == value)
+        setProperty(PropertyId{property}, std::move(value));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void WidgetRenderer::setProperty(PropertyId property, ObjectConverter&& value)
+    {
+        // Nothing has to happen if the value doesn't change, even when the value is currently only stored in the base data
+        const ObjectConverter* currentValue = m_data->findProperty(property);
+        if (currentValue && (*currentValue == value))
             return;
 
-        const ObjectConverter oldValue = m_data->propertyValuePairs[property];
-        m_data->propertyValuePairs[property] = value;
+        m_data->detachLayers();
+
+        const auto it = m_data->propertyValuePairs.find(property);
+        const bool hadValue = (it != m_data->propertyValuePairs.end());
+        ObjectConverter oldValue;
+        if (hadValue)
+        {
+            oldValue = std::move(it->second);
+            it->second = std::move(value);
+        }
+        else
+            m_data->propertyValuePairs[property] = std::move(value);
 
         try
         {
@@ -194,7 +417,11 @@ namespace tgui
         }
         catch (const Exception&)
         {
-            m_data->propertyValuePairs[property] = oldValue;
+            if (hadValue)
+                m_data->propertyValuePairs[property] = std::move(oldValue);
+            else
+                m_data->propertyValuePairs.erase(property);
+
             throw;
         }
     }
@@ -203,22 +430,38 @@ namespace tgui
 
     ObjectConverter WidgetRenderer::getProperty(const String& property) const
     {
-        auto it = m_data->propertyValuePairs.find(property);
-        if (it != m_data->propertyValuePairs.end())
-            return it->second;
+        const PropertyId id = PropertyId::find(property);
+        return id.isValid() ? getProperty(id) : ObjectConverter{};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ObjectConverter WidgetRenderer::getProperty(PropertyId property) const
+    {
+        const ObjectConverter* value = m_data->findProperty(property);
+        if (value)
+            return *value;
         else
             return {};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    const std::map<String, ObjectConverter>& WidgetRenderer::getPropertyValuePairs() const
+    const RendererPropertyMap& WidgetRenderer::getPropertyValuePairs() const
     {
+        m_data->mergeBase();
         return m_data->propertyValuePairs;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    RendererPropertyMap WidgetRenderer::getMergedPropertyValuePairs() const
+    {
+        return m_data->getMergedPropertyValuePairs();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void WidgetRenderer::subscribe(Widget* widget)
     {
         m_data->observers.insert(widget);
@@ -249,9 +492,8 @@ namespace tgui
 
     std::shared_ptr<RendererData> WidgetRenderer::clone() const
     {
-        auto data = std::make_shared<RendererData>(*m_data);
-        data->observers = {};
-        data->connectedTheme = nullptr;
+        auto data = std::make_shared<RendererData>();
+        data->propertyValuePairs = m_data->getMergedPropertyValuePairs();
         data->shared = false;
         return data;
     }
@@ -389,7 +389,7 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     String::String(const std::string& str) :
-        m_string(utf::convertUtf8toUtf32(str.begin(), str.end()))
+        m_string(utf::convertUtf8toUtf32(str.data(), str.data() + str.length()))
     {
     }
 
@@ -399,7 +399,7 @@ namespace tgui
     }
 
     String::String(const std::u16string& str) :
-        m_string(utf::convertUtf16toUtf32(str.begin(), str.end()))
+        m_string(utf::convertUtf16toUtf32(str.data(), str.data() + str.length()))
     {
     }
 
@@ -464,7 +464,7 @@ namespace tgui
     }
 
     String::String(const std::string& str, std::size_t pos) :
-        m_string(utf::convertUtf8toUtf32(str.begin() + static_cast<std::ptrdiff_t>(pos), str.end()))
+        m_string(utf::convertUtf8toUtf32(str.data() + pos, str.data() + str.length()))
     {
     }
 
@@ -474,7 +474,7 @@ namespace tgui
     }
 
     String::String(const std::u16string& str, std::size_t pos) :
-        m_string(utf::convertUtf16toUtf32(str.begin() + static_cast<std::ptrdiff_t>(pos), str.end()))
+        m_string(utf::convertUtf16toUtf32(str.data() + pos, str.data() + str.length()))
     {
     }
 
@@ -484,8 +484,8 @@ namespace tgui
     }
 
     String::String(const std::string& str, std::size_t pos, std::size_t count) :
-        m_string(utf::convertUtf8toUtf32(str.begin() + static_cast<std::ptrdiff_t>(pos),
-                                         ((count != npos) && (pos + count < str.length())) ? (str.begin() + static_cast<std::ptrdiff_t>(pos + count)) : str.end()))
+        m_string(utf::convertUtf8toUtf32(str.data() + pos,
+                                         ((count != npos) && (pos + count < str.length())) ? (str.data() + pos + count) : (str.data() + str.length())))
     {
     }
 
@@ -496,8 +496,8 @@ namespace tgui
     }
 
     String::String(const std::u16string& str, std::size_t pos, std::size_t count) :
-        m_string(utf::convertUtf16toUtf32(str.begin() + static_cast<std::ptrdiff_t>(pos),
-                                          ((count != npos) && (pos + count < str.length())) ? (str.begin() + static_cast<std::ptrdiff_t>(pos + count)) : str.end()))
+        m_string(utf::convertUtf16toUtf32(str.data() + pos,
+                                          ((count != npos) && (pos + count < str.length())) ? (str.data() + pos + count) : (str.data() + str.length())))
     {
     }
 
@@ -189,7 +189,7 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void SubwidgetContainer::rendererChanged(const String& property)
+    void SubwidgetContainer::rendererChanged(PropertyId property)
     {
         // If the property matches the name of a child widget then the value should be a renderer object to be passed to that widget
         for (const auto& widget : m_container->getWidgets())
@@ -208,11 +208,12 @@ namespace tgui
         }
 
         // If the property starts with "WidgetName." then the part behind the dot is the property name for that widget
-        const auto dotPos = property.find(U'.');
+        const String& propertyName = property.getName();
+        const auto dotPos = propertyName.find(U'.');
         if (dotPos != String::npos)
         {
-            const String& nameToSearch = property.substr(0, dotPos);
-            const String& propertyForChild = property.substr(dotPos + 1);
+            const String& nameToSearch = propertyName.substr(0, dotPos);
+            const String& propertyForChild = propertyName.substr(dotPos + 1);
             for (const auto& widget : m_container->getWidgets())
             {
                 const String& name = widget->getWidgetName();
@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Text.hpp>
+#include <TGUI/GlyphRunCache.hpp>
 #include <TGUI/Backend/Window/Backend.hpp>
 #include <TGUI/Backend/Renderer/BackendText.hpp>
 
@@ -286,28 +287,7 @@ namespace tgui
             return 0.0f;
 
         const bool bold = (textStyle & TextStyle::Bold) != 0;
-
-        float width = 0.0f;
-        char32_t prevChar = 0;
-        for (const char32_t curChar : text)
-        {
-            float charWidth;
-            if (curChar == '\n')
-                break;
-            else if (curChar == U'\r')
-                continue; // Skip carriage return characters which aren't rendered (we only use line feed characters to indicate a new line)
-            else if (curChar == '\t')
-                charWidth = font.getGlyph(' ', characterSize, bold).advance * 4.0f;
-            else
-                charWidth = font.getGlyph(curChar, characterSize, bold).advance;
-
-            const float kerning = font.getKerning(prevChar, curChar, characterSize, bold);
-
-            width += charWidth + kerning;
-            prevChar = curChar;
-        }
-
-        return width;
+        return GlyphRunCache::getGlyphRun(text, *font.getBackendFont(), characterSize, bold)->width;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -356,6 +336,8 @@ namespace tgui
         if (font == nullptr)
             return U"";
 
+        const auto run = GlyphRunCache::getGlyphRun(text, *font.getBackendFont(), textSize, bold);
+
         String result;
         std::size_t index = 0;
         while (index < text.length())
@@ -367,7 +349,6 @@ namespace tgui
             char32_t prevChar = 0;
             for (std::size_t i = index; i < text.length(); ++i)
             {
-                float charWidth;
                 const char32_t curChar = text[i];
                 if (curChar == U'\n')
                 {
@@ -380,12 +361,11 @@ namespace tgui
                     index++;
                     continue;
                 }
-                else if (curChar == U'\t')
-                    charWidth = font.getGlyph(U' ', textSize, bold).advance * 4;
-                else
-                    charWidth = font.getGlyph(curChar, textSize, bold).advance;
 
-                const float kerning = font.getKerning(prevChar, curChar, textSize, bold);
+                // The kerning in the run is relative to the previous character in the string. That is only the correct
+                // value if that character is on the same line. The first character of a line has no kerning.
+                const float charWidth = run->advances[i];
+                const float kerning = (prevChar != 0) ? run->kernings[i] : 0;
                 const bool charIsWhitespace = (curChar == U' ') || (curChar == U'\t');
 
                 // We add the character to the line, unless a non-whitespace character exceeds the line length.
@@ -497,9 +477,9 @@ namespace tgui
                         const bool boldStyle = ((inputPiece.style & TextStyle::Bold) != 0);
                         TGUI_ASSERT(curChar != U'\n' && curChar != U'\r', "Newline characters must be removed before calling Text::wordWrap with blueprints")
                         if (curChar == U'\t')
-                            charWidth = font.getGlyph(U' ', inputPiece.characterSize, boldStyle).advance * 4;
+                            charWidth = font.getGlyphAdvance(U' ', inputPiece.characterSize, boldStyle) * 4;
                         else
-                            charWidth = font.getGlyph(curChar, inputPiece.characterSize, boldStyle).advance;
+                            charWidth = font.getGlyphAdvance(curChar, inputPiece.characterSize, boldStyle);
 
                         if (pieceCharIndex > 0)
                             kerning = font.getKerning(prevChar, curChar, inputPiece.characterSize, boldStyle);
@@ -643,7 +623,7 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    std::shared_ptr<BackendText> Text::getBackendText() const
+    const std::shared_ptr<BackendText>& Text::getBackendText() const
     {
         return m_backendText;
     }
@@ -0,0 +1,315 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2023 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/Utf.hpp>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #define TGUI_UTF_USE_SSE2 1
+    #include <emmintrin.h>
+#else
+    #define TGUI_UTF_USE_SSE2 0
+#endif
+
+#if !TGUI_UTF_USE_SSE2 && (defined(__aarch64__) || defined(_M_ARM64))
+    #define TGUI_UTF_USE_NEON 1
+    #include <arm_neon.h>
+#else
+    #define TGUI_UTF_USE_NEON 0
+#endif
+
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <cstdint>
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+namespace utf
+{
+    // SSE2 is always available on x86-64 and NEON is always available on ARM64, so there is no need to check the CPU at runtime.
+    // On other platforms all characters are converted one by one.
+    namespace
+    {
+        const char16_t* decodeCharUtf16(const char16_t* inputCharIt, const char16_t* inputEndIt, std::u32string& outStrUtf32)
+        {
+            const char16_t first = *inputCharIt++;
+
+            // Copy the character if it isn't a surrogate pair
+            if ((first < 0xD800) || (first > 0xDBFF))
+            {
+                outStrUtf32.push_back(static_cast<char32_t>(first));
+                return inputCharIt;
+            }
+
+            // We need to read another character
+            if (inputCharIt == inputEndIt)
+                return inputEndIt;
+
+            const char16_t second = *inputCharIt++;
+            if ((second >= 0xDC00) && (second <= 0xDFFF))
+                outStrUtf32.push_back(((static_cast<char32_t>(first) - 0xD800) << 10) + (static_cast<char32_t>(second) - 0xDC00) + 0x0010000);
+
+            return inputCharIt;
+        }
+
+        void encodeCharUtf16(char32_t codepoint, std::u16string& outStrUtf16)
+        {
+            // If the codepoint fitst inside 2 bytes and it would represent a valid character then just copy it
+            if (codepoint <= 0xFFFF)
+            {
+                if ((codepoint < 0xD800) || (codepoint > 0xDFFF))
+                    outStrUtf16.push_back(static_cast<char16_t>(codepoint));
+
+                return;
+            }
+            else if (codepoint > 0x0010FFFF)
+                return; // Invalid character (greater than the maximum Unicode value)
+
+            // The input character needs be converted to two UTF-16 elements
+            outStrUtf16.push_back(static_cast<char16_t>(((codepoint - 0x0010000) >> 10)     + 0xD800));
+            outStrUtf16.push_back(static_cast<char16_t>(((codepoint - 0x0010000) & 0x3FFUL) + 0xDC00));
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::u32string convertUtf8toUtf32(const char* inputBegin, const char* inputEnd)
+    {
+        std::u32string outStrUtf32;
+        outStrUtf32.reserve(static_cast<std::size_t>((inputEnd - inputBegin) + 1));
+
+        const char* it = inputBegin;
+#if TGUI_UTF_USE_SSE2 || TGUI_UTF_USE_NEON
+        char32_t chunk[16];
+        while (inputEnd - it >= 16)
+        {
+    #if TGUI_UTF_USE_SSE2
+            const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it));
+            const bool isAscii = (_mm_movemask_epi8(bytes) == 0);
+    #else
+            const uint8x16_t bytes = vld1q_u8(reinterpret_cast<const std::uint8_t*>(it));
+            const bool isAscii = (vmaxvq_u8(bytes) < 0x80);
+    #endif
+            if (!isAscii)
+            {
+                // Decode the chunk one character at a time. The last character may extend past the end of the chunk.
+                for (const char* const chunkEnd = it + 16; it < chunkEnd;)
+                    it = decodeCharUtf8(it, inputEnd, outStrUtf32);
+
+                continue;
+            }
+
+    #if TGUI_UTF_USE_SSE2
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i low = _mm_unpacklo_epi8(bytes, zero);
+            const __m128i high = _mm_unpackhi_epi8(bytes, zero);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(&chunk[0]), _mm_unpacklo_epi16(low, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(&chunk[4]), _mm_unpackhi_epi16(low, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(&chunk[8]), _mm_unpacklo_epi16(high, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(&chunk[12]), _mm_unpackhi_epi16(high, zero));
+    #else
+            const uint16x8_t low = vmovl_u8(vget_low_u8(bytes));
+            const uint16x8_t high = vmovl_u8(vget_high_u8(bytes));
+            vst1q_u32(reinterpret_cast<std::uint32_t*>(&chunk[0]), vmovl_u16(vget_low_u16(low)));
+            vst1q_u32(reinterpret_cast<std::uint32_t*>(&chunk[4]), vmovl_u16(vget_high_u16(low)));
+            vst1q_u32(reinterpret_cast<std::uint32_t*>(&chunk[8]), vmovl_u16(vget_low_u16(high)));
+            vst1q_u32(reinterpret_cast<std::uint32_t*>(&chunk[12]), vmovl_u16(vget_high_u16(high)));
+    #endif
+            outStrUtf32.append(chunk, 16);
+            it += 16;
+        }
+#endif
+
+        while (it < inputEnd)
+            it = decodeCharUtf8(it, inputEnd, outStrUtf32);
+
+        return outStrUtf32;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::u32string convertUtf16toUtf32(const char16_t* inputBegin, const char16_t* inputEnd)
+    {
+        std::u32string outStrUtf32;
+        outStrUtf32.reserve(static_cast<std::size_t>((inputEnd - inputBegin) + 1));
+
+        const char16_t* it = inputBegin;
+#if TGUI_UTF_USE_SSE2 || TGUI_UTF_USE_NEON
+        char32_t chunk[8];
+        while (inputEnd - it >= 8)
+        {
+    #if TGUI_UTF_USE_SSE2
+            const __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it));
+            const __m128i surrogates = _mm_cmpeq_epi16(_mm_and_si128(_mm_sub_epi16(values, _mm_set1_epi16(static_cast<short>(0xD800))),
+                                                                     _mm_set1_epi16(static_cast<short>(0xF800))),
+                                                       _mm_setzero_si128());
+            const bool hasSurrogates = (_mm_movemask_epi8(surrogates) != 0);
+    #else
+            const uint16x8_t values = vld1q_u16(reinterpret_cast<const std::uint16_t*>(it));
+            const bool hasSurrogates = (vmaxvq_u16(vandq_u16(vceqq_u16(vandq_u16(values, vdupq_n_u16(0xF800)), vdupq_n_u16(0xD800)), vdupq_n_u16(1))) != 0);
+    #endif
+            if (hasSurrogates)
+            {
+                // A surrogate pair may cross the end of the chunk, in which case one character more is consumed
+                for (const char16_t* const chunkEnd = it + 8; it < chunkEnd;)
+                    it = decodeCharUtf16(it, inputEnd, outStrUtf32);
+
+                continue;
+            }
+
+    #if TGUI_UTF_USE_SSE2
+            const __m128i zero = _mm_setzero_si128();
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(&chunk[0]), _mm_unpacklo_epi16(values, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(&chunk[4]), _mm_unpackhi_epi16(values, zero));
+    #else
+            vst1q_u32(reinterpret_cast<std::uint32_t*>(&chunk[0]), vmovl_u16(vget_low_u16(values)));
+            vst1q_u32(reinterpret_cast<std::uint32_t*>(&chunk[4]), vmovl_u16(vget_high_u16(values)));
+    #endif
+            outStrUtf32.append(chunk, 8);
+            it += 8;
+        }
+#endif
+
+        while (it < inputEnd)
+            it = decodeCharUtf16(it, inputEnd, outStrUtf32);
+
+        return outStrUtf32;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::string convertUtf32toStdStringUtf8(const std::u32string& strUtf32)
+    {
+        std::string outStrUtf8;
+        outStrUtf8.reserve(strUtf32.length() + 1);
+
+        const char32_t* it = strUtf32.data();
+        const char32_t* const inputEnd = it + strUtf32.length();
+#if TGUI_UTF_USE_SSE2 || TGUI_UTF_USE_NEON
+        char chunk[16];
+        while (inputEnd - it >= 16)
+        {
+    #if TGUI_UTF_USE_SSE2
+            const __m128i values1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it));
+            const __m128i values2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it + 4));
+            const __m128i values3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it + 8));
+            const __m128i values4 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it + 12));
+            const __m128i combined = _mm_or_si128(_mm_or_si128(values1, values2), _mm_or_si128(values3, values4));
+            const bool isAscii = (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(combined, _mm_set1_epi32(~0x7F)), _mm_setzero_si128())) == 0xFFFF);
+    #else
+            const uint32x4_t values1 = vld1q_u32(reinterpret_cast<const std::uint32_t*>(it));
+            const uint32x4_t values2 = vld1q_u32(reinterpret_cast<const std::uint32_t*>(it + 4));
+            const uint32x4_t values3 = vld1q_u32(reinterpret_cast<const std::uint32_t*>(it + 8));
+            const uint32x4_t values4 = vld1q_u32(reinterpret_cast<const std::uint32_t*>(it + 12));
+            const uint32x4_t combined = vorrq_u32(vorrq_u32(values1, values2), vorrq_u32(values3, values4));
+            const bool isAscii = (vmaxvq_u32(combined) < 0x80);
+    #endif
+            if (!isAscii)
+            {
+                for (const char32_t* const chunkEnd = it + 16; it < chunkEnd; ++it)
+                    encodeCharUtf8(*it, outStrUtf8);
+
+                continue;
+            }
+
+    #if TGUI_UTF_USE_SSE2
+            const __m128i packed = _mm_packus_epi16(_mm_packs_epi32(values1, values2), _mm_packs_epi32(values3, values4));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(chunk), packed);
+    #else
+            const uint16x8_t narrowed1 = vcombine_u16(vmovn_u32(values1), vmovn_u32(values2));
+            const uint16x8_t narrowed2 = vcombine_u16(vmovn_u32(values3), vmovn_u32(values4));
+            vst1q_u8(reinterpret_cast<std::uint8_t*>(chunk), vcombine_u8(vmovn_u16(narrowed1), vmovn_u16(narrowed2)));
+    #endif
+            outStrUtf8.append(chunk, 16);
+            it += 16;
+        }
+#endif
+
+        for (; it < inputEnd; ++it)
+            encodeCharUtf8(*it, outStrUtf8);
+
+        return outStrUtf8;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::u16string convertUtf32toUtf16(const std::u32string& strUtf32)
+    {
+        std::u16string outStrUtf16;
+        outStrUtf16.reserve(strUtf32.length() + 1);
+
+        const char32_t* it = strUtf32.data();
+        const char32_t* const inputEnd = it + strUtf32.length();
+#if TGUI_UTF_USE_SSE2 || TGUI_UTF_USE_NEON
+        char16_t chunk[8];
+        while (inputEnd - it >= 8)
+        {
+    #if TGUI_UTF_USE_SSE2
+            // Flipping the sign bit allows using a signed comparison to check that the unsigned values are below 0xD800
+            const __m128i values1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it));
+            const __m128i values2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it + 4));
+            const __m128i signBit = _mm_set1_epi32(static_cast<int>(0x80000000u));
+            const __m128i limit = _mm_set1_epi32(static_cast<int>(0x80000000u + 0xD800u));
+            const __m128i belowLimit = _mm_and_si128(_mm_cmplt_epi32(_mm_xor_si128(values1, signBit), limit),
+                                                     _mm_cmplt_epi32(_mm_xor_si128(values2, signBit), limit));
+            const bool fitsInSingleElement = (_mm_movemask_epi8(belowLimit) == 0xFFFF);
+    #else
+            const uint32x4_t values1 = vld1q_u32(reinterpret_cast<const std::uint32_t*>(it));
+            const uint32x4_t values2 = vld1q_u32(reinterpret_cast<const std::uint32_t*>(it + 4));
+            const bool fitsInSingleElement = (vmaxvq_u32(vmaxq_u32(values1, values2)) < 0xD800);
+    #endif
+            if (!fitsInSingleElement)
+            {
+                for (const char32_t* const chunkEnd = it + 8; it < chunkEnd; ++it)
+                    encodeCharUtf16(*it, outStrUtf16);
+
+                continue;
+            }
+
+    #if TGUI_UTF_USE_SSE2
+            // There is no instruction to pack with unsigned saturation, so the values are shifted to the signed range and back
+            const __m128i offset32 = _mm_set1_epi32(0x8000);
+            const __m128i packed = _mm_packs_epi32(_mm_sub_epi32(values1, offset32), _mm_sub_epi32(values2, offset32));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(chunk), _mm_add_epi16(packed, _mm_set1_epi16(static_cast<short>(0x8000))));
+    #else
+            vst1q_u16(reinterpret_cast<std::uint16_t*>(chunk), vcombine_u16(vmovn_u32(values1), vmovn_u32(values2)));
+    #endif
+            outStrUtf16.append(chunk, 8);
+            it += 8;
+        }
+#endif
+
+        for (; it < inputEnd; ++it)
+            encodeCharUtf16(*it, outStrUtf16);
+
+        return outStrUtf16;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+} // namespace utf
+} // namespace tgui
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -62,6 +62,23 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+        // Returns the transform with which the widget is drawn inside its parent, when the widget would have the given position and size
+        TGUI_NODISCARD Transform getTransformInParent(const Widget& widget, Vector2f position, Vector2f size)
+        {
+            const Vector2f origin{widget.getOrigin().x * size.x, widget.getOrigin().y * size.y};
+
+            Transform transform;
+            transform.translate(position - origin);
+            if (widget.getRotation() != 0)
+                transform.rotate(widget.getRotation(), {widget.getRotationOrigin().x * size.x, widget.getRotationOrigin().y * size.y});
+            if ((widget.getScale().x != 1) || (widget.getScale().y != 1))
+                transform.scale(widget.getScale(), {widget.getScaleOrigin().x * size.x, widget.getScaleOrigin().y * size.y});
+
+            return transform;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
         TGUI_NODISCARD static Layout2d parseLayout(String str)
         {
             if (str.empty())
@@ -467,41 +484,58 @@ namespace tgui
         m_renderer->subscribe(this);
         rendererData->shared = true;
 
-        // Tell the widget about all the updated properties, both new ones and old ones that were now reset to their default value
-        auto oldIt = oldData->propertyValuePairs.begin();
-        auto newIt = rendererData->propertyValuePairs.begin();
-        while (oldIt != oldData->propertyValuePairs.end() && newIt != rendererData->propertyValuePairs.end())
+        // Layers only store part of the properties, so the properties of their base have to be merged with them
+        RendererPropertyMap oldMergedPairs;
+        RendererPropertyMap newMergedPairs;
+        const RendererPropertyMap& oldPairs = oldData->base ? (oldMergedPairs = oldData->getMergedPropertyValuePairs())
+                                                            : oldData->propertyValuePairs;
+        const RendererPropertyMap& newPairs = rendererData->base ? (newMergedPairs = rendererData->getMergedPropertyValuePairs())
+                                                                 : rendererData->propertyValuePairs;
+
+        // Tell the widget about all the updated properties, both new ones and old ones that were now reset to their default value.
+        // Properties that have the same value in both renderers are skipped.
+        // The ids are collected first, because the getters of the renderer may add default values to the renderer data.
+        std::vector<PropertyId> changedProperties;
+        changedProperties.reserve(oldPairs.size() + newPairs.size());
+        auto oldIt = oldPairs.begin();
+        auto newIt = newPairs.begin();
+        while (oldIt != oldPairs.end() && newIt != newPairs.end())
         {
             if (oldIt->first < newIt->first)
             {
                 // Update values that no longer exist in the new renderer and are now reset to the default value
-                rendererChanged(oldIt->first);
+                changedProperties.push_back(oldIt->first);
                 ++oldIt;
             }
+            else if (newIt->first < oldIt->first)
+            {
+                // Update new properties
+                changedProperties.push_back(newIt->first);
+                ++newIt;
+            }
             else
             {
-                // Update changed and new properties
-                rendererChanged(newIt->first);
+                // Update changed properties
+                if (!(oldIt->second == newIt->second))
+                    changedProperties.push_back(newIt->first);
 
-                if (newIt->first < oldIt->first)
-                    ++newIt;
-                else
-                {
-                    ++oldIt;
-                    ++newIt;
-                }
+                ++oldIt;
+                ++newIt;
             }
         }
-        while (oldIt != oldData->propertyValuePairs.end())
+        while (oldIt != oldPairs.end())
         {
-            rendererChanged(oldIt->first);
+            changedProperties.push_back(oldIt->first);
             ++oldIt;
         }
-        while (newIt != rendererData->propertyValuePairs.end())
+        while (newIt != newPairs.end())
         {
-            rendererChanged(newIt->first);
+            changedProperties.push_back(newIt->first);
             ++newIt;
         }
+
+        for (const PropertyId property : changedProperties)
+            rendererChanged(property);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -523,10 +557,11 @@ namespace tgui
 
     WidgetRenderer* Widget::getRenderer()
     {
+        // Instead of copying the shared renderer, a layer is created that only stores the properties that are changed later
         if (m_renderer->getData()->shared)
         {
             m_renderer->unsubscribe(this);
-            m_renderer->setData(m_renderer->clone());
+            m_renderer->setData(RendererData::createLayer(m_renderer->getData()));
             m_renderer->subscribe(this);
         }
 
@@ -543,6 +578,13 @@ namespace tgui
 
         if (getPosition() != m_prevPosition)
         {
+            // Both the area that the widget occupied before and the area that it occupies now have to be redrawn
+            if (isInvalidationTracked())
+            {
+                m_parent->invalidateChildArea(getTransformInParent(*this, m_prevPosition, getSize()).transformRect({getWidgetOffset(), getFullSize()}));
+                invalidateRect({getWidgetOffset(), getFullSize()}); // Not invalidate(), moving doesn't change the contents of a render cache
+            }
+
             m_prevPosition = getPosition();
             onPositionChange.emit(this, getPosition());
 
@@ -563,6 +605,14 @@ namespace tgui
 
         if (getSize() != m_prevSize)
         {
+            // Both the area that the widget occupied before and the area that it occupies now have to be redrawn
+            if (isInvalidationTracked())
+            {
+                const Vector2f prevFullSize = getFullSize() - getSize() + m_prevSize;
+                m_parent->invalidateChildArea(getTransformInParent(*this, getPosition(), m_prevSize).transformRect({getWidgetOffset(), prevFullSize}));
+                invalidate();
+            }
+
             m_prevSize = getSize();
             onSizeChange.emit(this, getSize());
 
@@ -627,23 +677,29 @@ namespace tgui
 
     void Widget::setOrigin(Vector2f origin)
     {
+        invalidate();
         m_origin = origin;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Widget::setScale(Vector2f scaleFactors)
     {
+        invalidate();
         m_scaleFactors = scaleFactors;
         m_scaleOrigin.reset();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Widget::setScale(Vector2f scaleFactors, Vector2f origin)
     {
+        invalidate();
         m_scaleFactors = scaleFactors;
         m_scaleOrigin = origin;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -660,16 +716,20 @@ namespace tgui
 
     void Widget::setRotation(float angle)
     {
+        invalidate();
         m_rotationDeg = angle;
         m_rotationOrigin.reset();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Widget::setRotation(float angle, Vector2f origin)
     {
+        invalidate();
         m_rotationDeg = angle;
         m_rotationOrigin = origin;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -945,7 +1005,17 @@ namespace tgui
 
     void Widget::setVisible(bool visible)
     {
-        m_visible = visible;
+        if (m_visible != visible)
+        {
+            // The widget has to be invalidated while it is visible, otherwise the change is ignored
+            if (!visible)
+                invalidate();
+
+            m_visible = visible;
+
+            if (visible)
+                invalidate();
+        }
 
         // If the widget is hiden while still focused then it must be unfocused
         if (!visible)
@@ -978,7 +1048,9 @@ namespace tgui
 
         // Refresh widget opacity if there is a different value set for enabled and disabled widgets
         if (getSharedRenderer()->getOpacityDisabled() != -1)
-            rendererChanged("OpacityDisabled");
+            rendererChanged(Property::OpacityDisabled);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -997,12 +1069,14 @@ namespace tgui
                 if (m_parent)
                     m_parent->childWidgetFocused(shared_from_this());
 
+                invalidate();
                 onFocus.emit(this);
             }
         }
         else // Unfocusing widget
         {
             m_focused = false;
+            invalidate();
             onUnfocus.emit(this);
         }
     }
@@ -1042,7 +1116,8 @@ namespace tgui
     void Widget::setInheritedFont(const Font& font)
     {
         m_inheritedFont = font;
-        rendererChanged("Font");
+        rendererChanged(Property::Font);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1057,7 +1132,8 @@ namespace tgui
     void Widget::setInheritedOpacity(float opacity)
     {
         m_inheritedOpacity = opacity;
-        rendererChanged("Opacity");
+        rendererChanged(Property::Opacity);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1079,6 +1155,7 @@ namespace tgui
             m_textSizeCached = m_textSize;
 
         updateTextSize();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1403,16 +1480,16 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Widget::rendererChanged(const String& property)
+    void Widget::rendererChanged(PropertyId property)
     {
-        if ((property == U"Opacity") || (property == U"OpacityDisabled"))
+        if ((property == Property::Opacity) || (property == Property::OpacityDisabled))
         {
             if (!m_enabled && (getSharedRenderer()->getOpacityDisabled() != -1))
                 m_opacityCached = getSharedRenderer()->getOpacityDisabled() * m_inheritedOpacity;
             else
                 m_opacityCached = getSharedRenderer()->getOpacity() * m_inheritedOpacity;
         }
-        else if (property == U"Font")
+        else if (property == Property::Font)
         {
             if (getSharedRenderer()->getFont())
                 m_fontCached = getSharedRenderer()->getFont();
@@ -1421,7 +1498,7 @@ namespace tgui
             else
                 m_fontCached = Font::getGlobalFont();
         }
-        else if (property == U"TextSize")
+        else if (property == Property::TextSize)
         {
             if (getSharedRenderer()->getTextSize())
                 m_textSizeCached = getSharedRenderer()->getTextSize();
@@ -1430,12 +1507,19 @@ namespace tgui
 
             updateTextSize();
         }
-        else if (property == U"TransparentTexture")
+        else if (property == Property::TransparentTexture)
         {
             m_transparentTextureCached = getSharedRenderer()->getTransparentTexture();
         }
         else
-            throw Exception{U"Could not set property '" + property + U"', widget of type '" + getWidgetType() + U"' does not has this property."};
+            throw Exception{U"Could not set property '" + property.getName() + U"', widget of type '" + getWidgetType() + U"' does not has this property."};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::rendererChanged(const String& property)
+    {
+        rendererChanged(PropertyId{property});
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1700,6 +1784,7 @@ namespace tgui
             m_parentGui->requestMouseCursor(m_mouseCursor);
 
         m_mouseHover = true;
+        invalidate();
         onMouseEnter.emit(this);
     }
 
@@ -1711,14 +1796,54 @@ namespace tgui
             m_parentGui->requestMouseCursor(m_parent->getMouseCursor());
 
         m_mouseHover = false;
+        invalidate();
         onMouseLeave.emit(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Widget::rendererChangedCallback(const String& property)
+    void Widget::rendererChangedCallback(PropertyId property)
     {
         rendererChanged(property);
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::invalidate()
+    {
+        invalidateRect({getWidgetOffset(), getFullSize()});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::invalidateRect(FloatRect rect)
+    {
+        if (!isInvalidationTracked())
+            return;
+
+        m_parent->invalidateChildArea(getTransformInParent(*this, getPosition(), getSize()).transformRect(rect));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Widget::isInvalidationTracked() const
+    {
+        if (!m_visible || !m_parent)
+            return false;
+
+        // The changed area only has to be passed on when the gui redraws the changed regions of the screen
+        // or when the parent (or one of its parents) caches its contents in a texture
+        if (m_parentGui && m_parentGui->isPartialRedrawEnabled())
+            return true;
+
+        for (const Container* parent = m_parent; parent; parent = parent->getParent())
+        {
+            if (parent->isRenderCacheEnabled())
+                return true;
+        }
+
+        return false;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -176,9 +176,9 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void BitmapButton::rendererChanged(const String& property)
+    void BitmapButton::rendererChanged(PropertyId property)
     {
-        if ((property == U"Opacity") || (property == U"OpacityDisabled"))
+        if ((property == Property::Opacity) || (property == Property::OpacityDisabled))
         {
             Button::rendererChanged(property);
             m_imageComponent->setOpacity(m_opacityCached);
@@ -307,6 +307,8 @@ namespace tgui
                                        m_textPosition.y.getValue() - m_textOrigin.y * contentSize.y + (contentSize.y - m_imageComponent->getSize().y) / 2.f});
         m_textComponent->setPosition({m_imageComponent->getPosition().x + m_imageComponent->getSize().x + distanceBetweenTextAndImage,
                                       m_textPosition.y.getValue() - m_textOrigin.y * contentSize.y + (contentSize.y - m_textComponent->getSize().y) / 2.f});
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -131,14 +131,14 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void BoxLayout::rendererChanged(const String& property)
+    void BoxLayout::rendererChanged(PropertyId property)
     {
-        if (property == U"SpaceBetweenWidgets")
+        if (property == Property::SpaceBetweenWidgets)
         {
             m_spaceBetweenWidgetsCached = getSharedRenderer()->getSpaceBetweenWidgets();
             updateWidgets();
         }
-        else if (property == U"Padding")
+        else if (property == Property::Padding)
         {
             Group::rendererChanged(property);
 
@@ -216,6 +216,7 @@ namespace tgui
         m_textComponent->setString(caption);
 
         updateTextSize();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -322,113 +323,113 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ButtonBase::rendererChanged(const String& property)
+    void ButtonBase::rendererChanged(PropertyId property)
     {
-        if (property == U"Borders")
+        if (property == Property::Borders)
         {
             background.borders = getSharedRenderer()->getBorders();
             updateSize();
         }
-        else if (property == U"RoundedBorderRadius")
+        else if (property == Property::RoundedBorderRadius)
         {
             background.roundedBorderRadius = getSharedRenderer()->getRoundedBorderRadius();
         }
-        else if (property == U"TextColor")
+        else if (property == Property::TextColor)
             priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColor(), priv::dev::ComponentState::Normal);
-        else if (property == U"TextColorDown")
+        else if (property == Property::TextColorDown)
             priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorDown(), priv::dev::ComponentState::Active);
-        else if (property == U"TextColorHover")
+        else if (property == Property::TextColorHover)
             priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorHover(), priv::dev::ComponentState::Hover);
-        else if (property == U"TextColorDownHover")
+        else if (property == Property::TextColorDownHover)
             priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorDownHover(), priv::dev::ComponentState::ActiveHover);
-        else if (property == U"TextColorDisabled")
+        else if (property == Property::TextColorDisabled)
             priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorDisabled(), priv::dev::ComponentState::Disabled);
-        else if (property == U"TextColorDownDisabled")
+        else if (property == Property::TextColorDownDisabled)
             priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorDownDisabled(), priv::dev::ComponentState::DisabledActive);
-        else if (property == U"TextColorFocused")
+        else if (property == Property::TextColorFocused)
             priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorFocused(), priv::dev::ComponentState::Focused);
-        else if (property == U"TextColorDownFocused")
+        else if (property == Property::TextColorDownFocused)
             priv::dev::setOptionalPropertyValue(text.color, getSharedRenderer()->getTextColorDownFocused(), priv::dev::ComponentState::FocusedActive);
-        else if (property == U"TextStyle")
+        else if (property == Property::TextStyle)
             priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyle(), priv::dev::ComponentState::Normal);
-        else if (property == U"TextStyleDown")
+        else if (property == Property::TextStyleDown)
             priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleDown(), priv::dev::ComponentState::Active);
-        else if (property == U"TextStyleHover")
+        else if (property == Property::TextStyleHover)
             priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleHover(), priv::dev::ComponentState::Hover);
-        else if (property == U"TextStyleDownHover")
+        else if (property == Property::TextStyleDownHover)
             priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleDownHover(), priv::dev::ComponentState::ActiveHover);
-        else if (property == U"TextStyleDisabled")
+        else if (property == Property::TextStyleDisabled)
             priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleDisabled(), priv::dev::ComponentState::Disabled);
-        else if (property == U"TextStyleDownDisabled")
+        else if (property == Property::TextStyleDownDisabled)
             priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleDownDisabled(), priv::dev::ComponentState::DisabledActive);
-        else if (property == U"TextStyleFocused")
+        else if (property == Property::TextStyleFocused)
             priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleFocused(), priv::dev::ComponentState::Focused);
-        else if (property == U"TextStyleDownFocused")
+        else if (property == Property::TextStyleDownFocused)
             priv::dev::setOptionalPropertyValue(text.style, getSharedRenderer()->getTextStyleDownFocused(), priv::dev::ComponentState::FocusedActive);
-        else if (property == U"Texture")
+        else if (property == Property::Texture)
             priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTexture(), priv::dev::ComponentState::Normal);
-        else if (property == U"TextureDown")
+        else if (property == Property::TextureDown)
             priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureDown(), priv::dev::ComponentState::Active);
-        else if (property == U"TextureHover")
+        else if (property == Property::TextureHover)
             priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureHover(), priv::dev::ComponentState::Hover);
-        else if (property == U"TextureDownHover")
+        else if (property == Property::TextureDownHover)
             priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureDownHover(), priv::dev::ComponentState::ActiveHover);
-        else if (property == U"TextureDisabled")
+        else if (property == Property::TextureDisabled)
             priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureDisabled(), priv::dev::ComponentState::Disabled);
-        else if (property == U"TextureDownDisabled")
+        else if (property == Property::TextureDownDisabled)
             priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureDownDisabled(), priv::dev::ComponentState::Disabled);
-        else if (property == U"TextureFocused")
+        else if (property == Property::TextureFocused)
             priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureFocused(), priv::dev::ComponentState::Focused);
-        else if (property == U"TextureDownFocused")
+        else if (property == Property::TextureDownFocused)
             priv::dev::setOptionalPropertyValue(background.texture, getSharedRenderer()->getTextureDownFocused(), priv::dev::ComponentState::FocusedActive);
-        else if (property == U"BorderColor")
+        else if (property == Property::BorderColor)
             priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColor(), priv::dev::ComponentState::Normal);
-        else if (property == U"BorderColorDown")
+        else if (property == Property::BorderColorDown)
             priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorDown(), priv::dev::ComponentState::Active);
-        else if (property == U"BorderColorHover")
+        else if (property == Property::BorderColorHover)
             priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorHover(), priv::dev::ComponentState::Hover);
-        else if (property == U"BorderColorDownHover")
+        else if (property == Property::BorderColorDownHover)
             priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorDownHover(), priv::dev::ComponentState::ActiveHover);
-        else if (property == U"BorderColorDisabled")
+        else if (property == Property::BorderColorDisabled)
             priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorDisabled(), priv::dev::ComponentState::Disabled);
-        else if (property == U"BorderColorDownDisabled")
+        else if (property == Property::BorderColorDownDisabled)
             priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorDownDisabled(), priv::dev::ComponentState::DisabledActive);
-        else if (property == U"BorderColorFocused")
+        else if (property == Property::BorderColorFocused)
             priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorFocused(), priv::dev::ComponentState::Focused);
-        else if (property == U"BorderColorDownFocused")
+        else if (property == Property::BorderColorDownFocused)
             priv::dev::setOptionalPropertyValue(background.borderColor, getSharedRenderer()->getBorderColorDownFocused(), priv::dev::ComponentState::FocusedActive);
-        else if (property == U"BackgroundColor")
+        else if (property == Property::BackgroundColor)
             priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColor(), priv::dev::ComponentState::Normal);
-        else if (property == U"BackgroundColorDown")
+        else if (property == Property::BackgroundColorDown)
             priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorDown(), priv::dev::ComponentState::Active);
-        else if (property == U"BackgroundColorHover")
+        else if (property == Property::BackgroundColorHover)
             priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorHover(), priv::dev::ComponentState::Hover);
-        else if (property == U"BackgroundColorDownHover")
+        else if (property == Property::BackgroundColorDownHover)
             priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorDownHover(), priv::dev::ComponentState::ActiveHover);
-        else if (property == U"BackgroundColorDisabled")
+        else if (property == Property::BackgroundColorDisabled)
             priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorDisabled(), priv::dev::ComponentState::Disabled);
-        else if (property == U"BackgroundColorDownDisabled")
+        else if (property == Property::BackgroundColorDownDisabled)
             priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorDownDisabled(), priv::dev::ComponentState::DisabledActive);
-        else if (property == U"BackgroundColorFocused")
+        else if (property == Property::BackgroundColorFocused)
             priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorFocused(), priv::dev::ComponentState::Focused);
-        else if (property == U"BackgroundColorDownFocused")
+        else if (property == Property::BackgroundColorDownFocused)
             priv::dev::setOptionalPropertyValue(background.color, getSharedRenderer()->getBackgroundColorDownFocused(), priv::dev::ComponentState::FocusedActive);
-        else if (property == U"TextOutlineThickness")
+        else if (property == Property::TextOutlineThickness)
         {
             m_textComponent->setOutlineThickness(getSharedRenderer()->getTextOutlineThickness());
             updateTextPosition();
         }
-        else if (property == U"TextOutlineColor")
+        else if (property == Property::TextOutlineColor)
         {
             m_textComponent->setOutlineColor(getSharedRenderer()->getTextOutlineColor());
         }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
+        else if ((property == Property::Opacity) || (property == Property::OpacityDisabled))
         {
             ClickableWidget::rendererChanged(property);
             m_textComponent->setOpacity(m_opacityCached);
             m_backgroundComponent->setOpacity(m_opacityCached);
         }
-        else if (property == U"Font")
+        else if (property == Property::Font)
         {
             ClickableWidget::rendererChanged(property);
 
@@ -477,6 +478,7 @@ namespace tgui
 
         m_backgroundComponent->setComponentState(m_state);
         m_textComponent->setComponentState(m_state);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -508,6 +510,7 @@ namespace tgui
 
         m_textComponent->setPosition({m_textPosition.x.getValue() - m_textOrigin.x * m_textComponent->getSize().x,
                                       m_textPosition.y.getValue() - m_textOrigin.y * m_textComponent->getSize().y});
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
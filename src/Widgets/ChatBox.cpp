@@ -291,6 +291,7 @@ namespace tgui
     void ChatBox::setLinesStartFromTop(bool startFromTop)
     {
         m_linesStartFromTop = startFromTop;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -305,6 +306,7 @@ namespace tgui
     void ChatBox::setNewLinesBelowOthers(bool newLinesBelowOthers)
     {
         m_newLinesBelowOthers = newLinesBelowOthers;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -319,6 +321,7 @@ namespace tgui
     void ChatBox::setScrollbarValue(unsigned int value)
     {
         m_scroll->setValue(value);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -350,6 +353,9 @@ namespace tgui
         // Pass the event to the scrollbar
         if (m_scroll->isMouseOnWidget(pos - getPosition()))
             m_scroll->leftMousePressed(pos - getPosition());
+
+        if (m_scroll->wasInvalidated())
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -358,6 +364,9 @@ namespace tgui
     {
         if (m_scroll->isMouseDown())
             m_scroll->leftMouseReleased(pos - getPosition());
+
+        if (m_scroll->wasInvalidated())
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -372,6 +381,9 @@ namespace tgui
             m_scroll->mouseMoved(pos - getPosition());
         else
             m_scroll->mouseNoLongerOnWidget();
+
+        if (m_scroll->wasInvalidated())
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -380,6 +392,9 @@ namespace tgui
     {
         Widget::mouseNoLongerOnWidget();
         m_scroll->mouseNoLongerOnWidget();
+
+        if (m_scroll->wasInvalidated())
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -388,16 +403,23 @@ namespace tgui
     {
         Widget::leftMouseButtonNoLongerDown();
         m_scroll->leftMouseButtonNoLongerDown();
+
+        if (m_scroll->wasInvalidated())
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool ChatBox::scrolled(float delta, Vector2f pos, bool touch)
     {
-        if (m_scroll->getViewportSize() < m_scroll->getMaximum())
-            return m_scroll->scrolled(delta, pos - getPosition(), touch);
+        if (m_scroll->getViewportSize() >= m_scroll->getMaximum())
+            return false;
 
-        return false;
+        const bool scrollbarMoved = m_scroll->scrolled(delta, pos - getPosition(), touch);
+        if (m_scroll->wasInvalidated())
+            invalidate();
+
+        return scrollbarMoved;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -445,27 +467,30 @@ namespace tgui
                 m_scroll->setValue(m_scroll->getMaximum() - m_scroll->getViewportSize());
             }
         }
+
+        // The lines changed, so the widget has to be drawn again
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ChatBox::rendererChanged(const String& property)
+    void ChatBox::rendererChanged(PropertyId property)
     {
-        if (property == U"Borders")
+        if (property == Property::Borders)
         {
             m_bordersCached = getSharedRenderer()->getBorders();
             setSize(m_size);
         }
-        else if (property == U"Padding")
+        else if (property == Property::Padding)
         {
             m_paddingCached = getSharedRenderer()->getPadding();
             setSize(m_size);
         }
-        else if (property == U"TextureBackground")
+        else if (property == Property::TextureBackground)
         {
             m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
         }
-        else if (property == U"Scrollbar")
+        else if (property == Property::Scrollbar)
         {
             m_scroll->setRenderer(getSharedRenderer()->getScrollbar());
 
@@ -476,21 +501,21 @@ namespace tgui
                 setSize(m_size);
             }
         }
-        else if (property == U"ScrollbarWidth")
+        else if (property == Property::ScrollbarWidth)
         {
             const float width = (getSharedRenderer()->getScrollbarWidth() != 0) ? getSharedRenderer()->getScrollbarWidth() : m_scroll->getDefaultWidth();
             m_scroll->setSize({width, m_scroll->getSize().y});
             setSize(m_size);
         }
-        else if (property == U"BorderColor")
+        else if (property == Property::BorderColor)
         {
             m_borderColorCached = getSharedRenderer()->getBorderColor();
         }
-        else if (property == U"BackgroundColor")
+        else if (property == Property::BackgroundColor)
         {
             m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
         }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
+        else if ((property == Property::Opacity) || (property == Property::OpacityDisabled))
         {
             Widget::rendererChanged(property);
 
@@ -500,7 +525,7 @@ namespace tgui
             for (auto& line : m_lines)
                 line.text.setOpacity(m_opacityCached);
         }
-        else if (property == U"Font")
+        else if (property == Property::Font)
         {
             Widget::rendererChanged(property);
 
@@ -155,6 +155,7 @@ namespace tgui
             else
                 m_text.setStyle(m_textStyleCached);
 
+            invalidate();
             onCheck.emit(this, true);
             onChange.emit(this, true);
         }
@@ -186,11 +187,11 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void CheckBox::rendererChanged(const String& property)
+    void CheckBox::rendererChanged(PropertyId property)
     {
-        if (property == U"TextureUnchecked")
+        if (property == Property::TextureUnchecked)
             m_textureUncheckedCached = getSharedRenderer()->getTextureUnchecked();
-        else if (property == U"TextureChecked")
+        else if (property == Property::TextureChecked)
             m_textureCheckedCached = getSharedRenderer()->getTextureChecked();
 
         RadioButton::rendererChanged(property);
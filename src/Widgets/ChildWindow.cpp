@@ -465,6 +465,7 @@ namespace tgui
 
         // Reposition the images and text
         setPosition(m_position);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -504,6 +505,7 @@ namespace tgui
 
         // Reposition the images and text
         setPosition(m_position);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -741,6 +743,7 @@ namespace tgui
                 if (button->isVisible() && button->isMouseOnWidget(pos))
                 {
                     button->leftMousePressed(pos);
+                    invalidate();
                     return;
                 }
             }
@@ -783,6 +786,7 @@ namespace tgui
                     if (button->isVisible() && button->isMouseOnWidget(pos))
                     {
                         button->leftMouseReleased(pos);
+                        invalidate();
                         break;
                     }
                 }
@@ -962,7 +966,12 @@ namespace tgui
         for (const auto& button : {m_closeButton.get(), m_maximizeButton.get(), m_minimizeButton.get()})
         {
             if (button->isVisible())
+            {
+                if (button->isMouseDown())
+                    invalidate();
+
                 button->leftMouseButtonNoLongerDown();
+            }
         }
     }
 
@@ -995,6 +1004,7 @@ namespace tgui
 
         // Reposition the images and text
         setPosition(m_position);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1063,9 +1073,9 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ChildWindow::rendererChanged(const String& property)
+    void ChildWindow::rendererChanged(PropertyId property)
     {
-        if (property == U"Borders")
+        if (property == Property::Borders)
         {
             m_bordersCached = getSharedRenderer()->getBorders();
 
@@ -1076,15 +1086,15 @@ namespace tgui
 
             setSize(m_size);
         }
-        else if (property == U"TitleColor")
+        else if (property == Property::TitleColor)
         {
             m_titleText.setColor(getSharedRenderer()->getTitleColor());
         }
-        else if ((property == U"TextureTitleBar") || (property == U"TitleBarHeight"))
+        else if ((property == Property::TextureTitleBar) || (property == Property::TitleBarHeight))
         {
             const float oldTitleBarHeight = m_titleBarHeightCached;
 
-            if (property == U"TextureTitleBar")
+            if (property == Property::TextureTitleBar)
                 m_spriteTitleBar.setTexture(getSharedRenderer()->getTextureTitleBar());
 
             m_titleBarHeightCached = getSharedRenderer()->getTitleBarHeight();
@@ -1100,36 +1110,36 @@ namespace tgui
                     layout->recalculateValue();
             }
         }
-        else if (property == U"TextureBackground")
+        else if (property == Property::TextureBackground)
         {
             m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
         }
-        else if (property == U"BorderBelowTitleBar")
+        else if (property == Property::BorderBelowTitleBar)
         {
             m_borderBelowTitleBarCached = getSharedRenderer()->getBorderBelowTitleBar();
             if (m_decorationLayoutY && (m_decorationLayoutY == m_size.y.getRightOperand()))
                 m_decorationLayoutY->replaceValue(m_bordersCached.getTop() + m_bordersCached.getBottom() + m_titleBarHeightCached + m_borderBelowTitleBarCached);
         }
-        else if (property == U"DistanceToSide")
+        else if (property == Property::DistanceToSide)
         {
             m_distanceToSideCached = getSharedRenderer()->getDistanceToSide();
             setPosition(m_position);
         }
-        else if (property == U"PaddingBetweenButtons")
+        else if (property == Property::PaddingBetweenButtons)
         {
             m_paddingBetweenButtonsCached = getSharedRenderer()->getPaddingBetweenButtons();
             setPosition(m_position);
         }
-        else if (property == U"MinimumResizableBorderWidth")
+        else if (property == Property::MinimumResizableBorderWidth)
         {
             m_minimumResizableBorderWidthCached = getSharedRenderer()->getMinimumResizableBorderWidth();
         }
-        else if (property == U"ShowTextOnTitleButtons")
+        else if (property == Property::ShowTextOnTitleButtons)
         {
             m_showTextOnTitleButtonsCached = getSharedRenderer()->getShowTextOnTitleButtons();
             setTitleButtons(m_titleButtons);
         }
-        else if (property == U"CloseButton")
+        else if (property == Property::CloseButton)
         {
             if (m_closeButton->isVisible())
             {
@@ -1139,7 +1149,7 @@ namespace tgui
 
             updateTitleBarHeight();
         }
-        else if (property == U"MaximizeButton")
+        else if (property == Property::MaximizeButton)
         {
             if (m_maximizeButton->isVisible())
             {
@@ -1153,7 +1163,7 @@ namespace tgui
 
             updateTitleBarHeight();
         }
-        else if (property == U"MinimizeButton")
+        else if (property == Property::MinimizeButton)
         {
             if (m_minimizeButton->isVisible())
             {
@@ -1167,23 +1177,23 @@ namespace tgui
 
             updateTitleBarHeight();
         }
-        else if (property == U"BackgroundColor")
+        else if (property == Property::BackgroundColor)
         {
             m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
         }
-        else if (property == U"TitleBarColor")
+        else if (property == Property::TitleBarColor)
         {
             m_titleBarColorCached = getSharedRenderer()->getTitleBarColor();
         }
-        else if (property == U"BorderColor")
+        else if (property == Property::BorderColor)
         {
             m_borderColorCached = getSharedRenderer()->getBorderColor();
         }
-        else if (property == U"BorderColorFocused")
+        else if (property == Property::BorderColorFocused)
         {
             m_borderColorFocusedCached = getSharedRenderer()->getBorderColorFocused();
         }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
+        else if ((property == Property::Opacity) || (property == Property::OpacityDisabled))
         {
             Container::rendererChanged(property);
 
@@ -1197,7 +1207,7 @@ namespace tgui
             m_spriteTitleBar.setOpacity(m_opacityCached);
             m_spriteBackground.setOpacity(m_opacityCached);
         }
-        else if (property == U"Font")
+        else if (property == Property::Font)
         {
             Container::rendererChanged(property);
 
@@ -1460,6 +1470,16 @@ namespace tgui
         m_maximizeButton->onPress([this]{ onMaximize.emit(this); });
         m_minimizeButton->onPress([this]{ onMinimize.emit(this); });
         m_closeButton->onPress([this]{ close(); });
+
+        // The title buttons aren't added to the child window, so their hover state can't invalidate the window themselves
+        for (auto& button : {m_closeButton.get(), m_maximizeButton.get(), m_minimizeButton.get()})
+        {
+            button->onMouseEnter.disconnectAll();
+            button->onMouseLeave.disconnectAll();
+
+            button->onMouseEnter([this]{ invalidate(); });
+            button->onMouseLeave([this]{ invalidate(); });
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -536,9 +536,9 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ColorPicker::rendererChanged(const String& property)
+    void ColorPicker::rendererChanged(PropertyId property)
     {
-        if (property == U"Button")
+        if (property == Property::Button)
         {
             const auto& renderer = getSharedRenderer()->getButton();
 
@@ -551,7 +551,7 @@ namespace tgui
                 get<Button>("#TGUI_INTERNAL$ColorPickerCancel#")->setRenderer(renderer);
             }
         }
-        else if (property == U"Label")
+        else if (property == Property::Label)
         {
             const auto& renderer = getSharedRenderer()->getLabel();
 
@@ -562,7 +562,7 @@ namespace tgui
                     label->setRenderer(renderer);
             }
         }
-        else if (property == U"Slider")
+        else if (property == Property::Slider)
         {
             const auto& renderer = getSharedRenderer()->getSlider();
 
@@ -573,7 +573,7 @@ namespace tgui
 
             m_value->setRenderer(renderer);
         }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
+        else if ((property == Property::Opacity) || (property == Property::OpacityDisabled))
         {
             ChildWindow::rendererChanged(property);
             m_colorWheelSprite.setOpacity(m_opacityCached);
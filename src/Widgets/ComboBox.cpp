@@ -295,6 +295,7 @@ namespace tgui
 
         const bool ret = m_listBox->setSelectedItem(itemName);
         m_text.setString(m_listBox->getSelectedItem());
+        invalidate();
 
         if (previousSelectedItemIndex != m_listBox->getSelectedItemIndex())
             onItemSelect.emit(this, m_listBox->getSelectedItemIndex(), m_listBox->getSelectedItem(), m_listBox->getSelectedItemId());
@@ -310,6 +311,7 @@ namespace tgui
 
         const bool ret = m_listBox->setSelectedItemById(id);
         m_text.setString(m_listBox->getSelectedItem());
+        invalidate();
 
         if (previousSelectedItemIndex != m_listBox->getSelectedItemIndex())
             onItemSelect.emit(this, m_listBox->getSelectedItemIndex(), m_listBox->getSelectedItem(), m_listBox->getSelectedItemId());
@@ -325,6 +327,7 @@ namespace tgui
 
         const bool ret = m_listBox->setSelectedItemByIndex(index);
         m_text.setString(m_listBox->getSelectedItem());
+        invalidate();
 
         if (previousSelectedItemIndex != m_listBox->getSelectedItemIndex())
             onItemSelect.emit(this, m_listBox->getSelectedItemIndex(), m_listBox->getSelectedItem(), m_listBox->getSelectedItemId());
@@ -337,6 +340,7 @@ namespace tgui
     void ComboBox::deselectItem()
     {
         m_text.setString("");
+        invalidate();
         m_listBox->deselectItem();
     }
 
@@ -349,6 +353,7 @@ namespace tgui
         const bool ret = m_listBox->removeItem(itemName);
 
         m_text.setString(m_listBox->getSelectedItem());
+        invalidate();
 
         // Shrink the list size
         if ((m_nrOfItemsToDisplay == 0) || (m_listBox->getItemCount() < m_nrOfItemsToDisplay))
@@ -378,6 +383,7 @@ namespace tgui
         const bool ret = m_listBox->removeItemByIndex(index);
 
         m_text.setString(m_listBox->getSelectedItem());
+        invalidate();
 
         // Shrink the list size
         if ((m_nrOfItemsToDisplay == 0) || (m_listBox->getItemCount() < m_nrOfItemsToDisplay))
@@ -391,6 +397,7 @@ namespace tgui
     void ComboBox::removeAllItems()
     {
         m_text.setString("");
+        invalidate();
         m_listBox->removeAllItems();
 
         updateListBoxHeight();
@@ -430,6 +437,7 @@ namespace tgui
     {
         const bool ret = m_listBox->changeItem(originalValue, newValue);
         m_text.setString(m_listBox->getSelectedItem());
+        invalidate();
         return ret;
     }
 
@@ -439,6 +447,7 @@ namespace tgui
     {
         const bool ret = m_listBox->changeItemById(id, newValue);
         m_text.setString(m_listBox->getSelectedItem());
+        invalidate();
         return ret;
     }
 
@@ -448,6 +457,7 @@ namespace tgui
     {
         const bool ret = m_listBox->changeItemByIndex(index, newValue);
         m_text.setString(m_listBox->getSelectedItem());
+        invalidate();
         return ret;
     }
 
@@ -493,6 +503,7 @@ namespace tgui
     void ComboBox::setDefaultText(const String& defaultText)
     {
         m_defaultText.setString(defaultText);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -615,6 +626,7 @@ namespace tgui
             {
                 m_listBox->setSelectedItemByIndex(nextIndex);
                 m_text.setString(m_listBox->getSelectedItem());
+                invalidate();
                 onItemSelect.emit(this, m_listBox->getSelectedItemIndex(), m_listBox->getSelectedItem(), m_listBox->getSelectedItemId());
             }
         }
@@ -625,6 +637,7 @@ namespace tgui
             {
                 m_listBox->setSelectedItemByIndex(static_cast<std::size_t>(m_listBox->getSelectedItemIndex() - 1));
                 m_text.setString(m_listBox->getSelectedItem());
+                invalidate();
                 onItemSelect.emit(this, m_listBox->getSelectedItemIndex(), m_listBox->getSelectedItem(), m_listBox->getSelectedItemId());
             }
         }
@@ -644,19 +657,19 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ComboBox::rendererChanged(const String& property)
+    void ComboBox::rendererChanged(PropertyId property)
     {
-        if (property == U"Borders")
+        if (property == Property::Borders)
         {
             m_bordersCached = getSharedRenderer()->getBorders();
             setSize(m_size);
         }
-        else if (property == U"Padding")
+        else if (property == Property::Padding)
         {
             m_paddingCached = getSharedRenderer()->getPadding();
             setSize(m_size);
         }
-        else if (property == U"TextColor")
+        else if (property == Property::TextColor)
         {
             m_textColorCached = getSharedRenderer()->getTextColor();
             if (m_enabled || !m_textColorDisabledCached.isSet())
@@ -664,94 +677,94 @@ namespace tgui
             if (!getSharedRenderer()->getDefaultTextColor().isSet())
                 m_defaultText.setColor(getSharedRenderer()->getTextColor());
         }
-        else if (property == U"TextColorDisabled")
+        else if (property == Property::TextColorDisabled)
         {
             m_textColorDisabledCached = getSharedRenderer()->getTextColorDisabled();
             if (!m_enabled && m_textColorDisabledCached.isSet())
                 m_text.setColor(m_textColorDisabledCached);
         }
-        else if (property == U"TextStyle")
+        else if (property == Property::TextStyle)
         {
             m_text.setStyle(getSharedRenderer()->getTextStyle());
             if (!getSharedRenderer()->getDefaultTextStyle().isSet())
                 m_defaultText.setStyle(getSharedRenderer()->getTextStyle());
         }
-        else if (property == U"DefaultTextColor")
+        else if (property == Property::DefaultTextColor)
         {
             if (getSharedRenderer()->getDefaultTextColor().isSet())
                 m_defaultText.setColor(getSharedRenderer()->getDefaultTextColor());
             else
                 m_defaultText.setColor(getSharedRenderer()->getTextColor());
         }
-        else if (property == U"DefaultTextStyle")
+        else if (property == Property::DefaultTextStyle)
         {
             if (getSharedRenderer()->getDefaultTextStyle().isSet())
                 m_defaultText.setStyle(getSharedRenderer()->getDefaultTextStyle());
             else
                 m_defaultText.setStyle(getSharedRenderer()->getTextStyle());
         }
-        else if (property == U"TextureBackground")
+        else if (property == Property::TextureBackground)
         {
             m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
         }
-        else if (property == U"TextureBackgroundDisabled")
+        else if (property == Property::TextureBackgroundDisabled)
         {
             m_spriteBackgroundDisabled.setTexture(getSharedRenderer()->getTextureBackgroundDisabled());
         }
-        else if (property == U"TextureArrow")
+        else if (property == Property::TextureArrow)
         {
             m_spriteArrow.setTexture(getSharedRenderer()->getTextureArrow());
             setSize(m_size);
         }
-        else if (property == U"TextureArrowHover")
+        else if (property == Property::TextureArrowHover)
         {
             m_spriteArrowHover.setTexture(getSharedRenderer()->getTextureArrowHover());
         }
-        else if (property == U"TextureArrowDisabled")
+        else if (property == Property::TextureArrowDisabled)
         {
             m_spriteArrowDisabled.setTexture(getSharedRenderer()->getTextureArrowDisabled());
         }
-        else if (property == U"ListBox")
+        else if (property == Property::ListBox)
         {
             m_listBox->setRenderer(getSharedRenderer()->getListBox());
         }
-        else if (property == U"BorderColor")
+        else if (property == Property::BorderColor)
         {
             m_borderColorCached = getSharedRenderer()->getBorderColor();
         }
-        else if (property == U"BackgroundColor")
+        else if (property == Property::BackgroundColor)
         {
             m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
         }
-        else if (property == U"BackgroundColorDisabled")
+        else if (property == Property::BackgroundColorDisabled)
         {
             m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
         }
-        else if (property == U"ArrowBackgroundColor")
+        else if (property == Property::ArrowBackgroundColor)
         {
             m_arrowBackgroundColorCached = getSharedRenderer()->getArrowBackgroundColor();
         }
-        else if (property == U"ArrowBackgroundColorHover")
+        else if (property == Property::ArrowBackgroundColorHover)
         {
             m_arrowBackgroundColorHoverCached = getSharedRenderer()->getArrowBackgroundColorHover();
         }
-        else if (property == U"ArrowBackgroundColorDisabled")
+        else if (property == Property::ArrowBackgroundColorDisabled)
         {
             m_arrowBackgroundColorDisabledCached = getSharedRenderer()->getArrowBackgroundColorDisabled();
         }
-        else if (property == U"ArrowColor")
+        else if (property == Property::ArrowColor)
         {
             m_arrowColorCached = getSharedRenderer()->getArrowColor();
         }
-        else if (property == U"ArrowColorHover")
+        else if (property == Property::ArrowColorHover)
         {
             m_arrowColorHoverCached = getSharedRenderer()->getArrowColorHover();
         }
-        else if (property == U"ArrowColorDisabled")
+        else if (property == Property::ArrowColorDisabled)
         {
             m_arrowColorDisabledCached = getSharedRenderer()->getArrowColorDisabled();
         }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
+        else if ((property == Property::Opacity) || (property == Property::OpacityDisabled))
         {
             Widget::rendererChanged(property);
 
@@ -764,7 +777,7 @@ namespace tgui
             m_text.setOpacity(m_opacityCached);
             m_defaultText.setOpacity(m_opacityCached);
         }
-        else if (property == U"Font")
+        else if (property == Property::Font)
         {
             Widget::rendererChanged(property);
 
@@ -969,6 +982,7 @@ namespace tgui
         if (selectedItemIndex != m_previousSelectedItemIndex)
         {
             m_text.setString(m_listBox->getSelectedItem());
+            invalidate();
             onItemSelect.emit(this, m_listBox->getSelectedItemIndex(), m_listBox->getSelectedItem(), m_listBox->getSelectedItemId());
         }
     }
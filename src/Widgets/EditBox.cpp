@@ -159,6 +159,7 @@ namespace tgui
 
         // Set the password character again to trigger some other text updates
         setPasswordCharacter(m_passwordChar);
+        invalidate();
 
         onTextChange.emit(this, m_text);
     }
@@ -175,6 +176,7 @@ namespace tgui
     void EditBox::setDefaultText(const String& text)
     {
         m_defaultText.setString(text);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -303,6 +305,8 @@ namespace tgui
             if (m_selEnd > m_displayedText.length())
                 setCaretPosition(m_selEnd);
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -605,6 +609,7 @@ namespace tgui
         // The caret should be visible again
         m_caretVisible = true;
         m_animationTimeElapsed = {};
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -691,14 +696,14 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void EditBox::rendererChanged(const String& property)
+    void EditBox::rendererChanged(PropertyId property)
     {
-        if (property == U"Borders")
+        if (property == Property::Borders)
         {
             m_bordersCached = getSharedRenderer()->getBorders();
             setSize(m_size);
         }
-        else if (property == U"Padding")
+        else if (property == Property::Padding)
         {
             m_paddingCached = getSharedRenderer()->getPadding();
             m_paddingCached.updateParentSize(getSize());
@@ -706,40 +711,40 @@ namespace tgui
 
             m_caret.setSize({m_caret.getSize().x, getInnerSize().y - m_paddingCached.getBottom() - m_paddingCached.getTop()});
         }
-        else if (property == U"CaretWidth")
+        else if (property == Property::CaretWidth)
         {
             m_caret.setPosition({m_caret.getPosition().x + ((m_caret.getSize().x - getSharedRenderer()->getCaretWidth()) / 2.0f), m_caret.getPosition().y});
             m_caret.setSize({getSharedRenderer()->getCaretWidth(), getInnerSize().y - m_paddingCached.getBottom() - m_paddingCached.getTop()});
         }
-        else if ((property == U"TextColor") || (property == U"TextColorDisabled") || (property == U"TextColorFocused"))
+        else if ((property == Property::TextColor) || (property == Property::TextColorDisabled) || (property == Property::TextColorFocused))
         {
             updateTextColor();
         }
-        else if (property == U"SelectedTextColor")
+        else if (property == Property::SelectedTextColor)
         {
             m_textSelection.setColor(getSharedRenderer()->getSelectedTextColor());
         }
-        else if (property == U"DefaultTextColor")
+        else if (property == Property::DefaultTextColor)
         {
             m_defaultText.setColor(getSharedRenderer()->getDefaultTextColor());
         }
-        else if (property == U"Texture")
+        else if (property == Property::Texture)
         {
             m_sprite.setTexture(getSharedRenderer()->getTexture());
         }
-        else if (property == U"TextureHover")
+        else if (property == Property::TextureHover)
         {
             m_spriteHover.setTexture(getSharedRenderer()->getTextureHover());
         }
-        else if (property == U"TextureDisabled")
+        else if (property == Property::TextureDisabled)
         {
             m_spriteDisabled.setTexture(getSharedRenderer()->getTextureDisabled());
         }
-        else if (property == U"TextureFocused")
+        else if (property == Property::TextureFocused)
         {
             m_spriteFocused.setTexture(getSharedRenderer()->getTextureFocused());
         }
-        else if (property == U"TextStyle")
+        else if (property == Property::TextStyle)
         {
             const TextStyles style = getSharedRenderer()->getTextStyle();
             m_textBeforeSelection.setStyle(style);
@@ -751,59 +756,59 @@ namespace tgui
             // The width of the text can be different, which requires the text to be realigned if it was centered or right-aligned
             updateTextSize();
         }
-        else if (property == U"DefaultTextStyle")
+        else if (property == Property::DefaultTextStyle)
         {
             m_defaultText.setStyle(getSharedRenderer()->getDefaultTextStyle());
         }
-        else if (property == U"BorderColor")
+        else if (property == Property::BorderColor)
         {
             m_borderColorCached = getSharedRenderer()->getBorderColor();
         }
-        else if (property == U"BorderColorHover")
+        else if (property == Property::BorderColorHover)
         {
             m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
         }
-        else if (property == U"BorderColorDisabled")
+        else if (property == Property::BorderColorDisabled)
         {
             m_borderColorDisabledCached = getSharedRenderer()->getBorderColorDisabled();
         }
-        else if (property == U"BorderColorFocused")
+        else if (property == Property::BorderColorFocused)
         {
             m_borderColorFocusedCached = getSharedRenderer()->getBorderColorFocused();
         }
-        else if (property == U"BackgroundColor")
+        else if (property == Property::BackgroundColor)
         {
             m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
         }
-        else if (property == U"BackgroundColorHover")
+        else if (property == Property::BackgroundColorHover)
         {
             m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
         }
-        else if (property == U"BackgroundColorDisabled")
+        else if (property == Property::BackgroundColorDisabled)
         {
             m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
         }
-        else if (property == U"BackgroundColorFocused")
+        else if (property == Property::BackgroundColorFocused)
         {
             m_backgroundColorFocusedCached = getSharedRenderer()->getBackgroundColorFocused();
         }
-        else if (property == U"CaretColor")
+        else if (property == Property::CaretColor)
         {
             m_caretColorCached = getSharedRenderer()->getCaretColor();
         }
-        else if (property == U"CaretColorHover")
+        else if (property == Property::CaretColorHover)
         {
             m_caretColorHoverCached = getSharedRenderer()->getCaretColorHover();
         }
-        else if (property == U"CaretColorFocused")
+        else if (property == Property::CaretColorFocused)
         {
             m_caretColorFocusedCached = getSharedRenderer()->getCaretColorFocused();
         }
-        else if (property == U"SelectedTextBackgroundColor")
+        else if (property == Property::SelectedTextBackgroundColor)
         {
             m_selectedTextBackgroundColorCached = getSharedRenderer()->getSelectedTextBackgroundColor();
         }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
+        else if ((property == Property::Opacity) || (property == Property::OpacityDisabled))
         {
             ClickableWidget::rendererChanged(property);
 
@@ -818,7 +823,7 @@ namespace tgui
             m_spriteDisabled.setOpacity(m_opacityCached);
             m_spriteFocused.setOpacity(m_opacityCached);
         }
-        else if (property == U"Font")
+        else if (property == Property::Font)
         {
             ClickableWidget::rendererChanged(property);
 
@@ -997,9 +1002,9 @@ namespace tgui
                 continue;
             }
             else if (curChar == '\t')
-                charWidth = static_cast<float>(m_fontCached.getGlyph(' ', textSize, bold).advance) * 4;
+                charWidth = m_fontCached.getGlyphAdvance(' ', textSize, bold) * 4;
             else
-                charWidth = static_cast<float>(m_fontCached.getGlyph(curChar, textSize, bold).advance);
+                charWidth = m_fontCached.getGlyphAdvance(curChar, textSize, bold);
 
             const float kerning = m_fontCached.getKerning(prevChar, curChar, textSize, bold);
             if (width + charWidth < posX)
@@ -1130,6 +1135,7 @@ namespace tgui
         // Set the position of the caret
         caretLeft += m_textFull.findCharacterPos(m_selEnd).x - (m_caret.getSize().x * 0.5f);
         m_caret.setPosition({caretLeft, m_paddingCached.getTop()});
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1211,6 +1217,8 @@ namespace tgui
             m_textAfterSelection.setColor(getSharedRenderer()->getTextColor());
             m_textSuffix.setColor(getSharedRenderer()->getTextColor());
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
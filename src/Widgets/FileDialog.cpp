@@ -615,6 +615,7 @@ namespace tgui
         if (oldSelectedItem >= 0)
             m_listView->setSelectedItem(static_cast<std::size_t>(oldSelectedItem));
 
+        invalidate();
         return true;
     }
 
@@ -1051,19 +1052,19 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void FileDialog::rendererChanged(const String& property)
+    void FileDialog::rendererChanged(PropertyId property)
     {
-        if (property == U"ListView")
+        if (property == Property::ListView)
         {
             m_listView->setRenderer(getSharedRenderer()->getListView());
         }
-        else if (property == U"EditBox")
+        else if (property == Property::EditBox)
         {
             const auto& renderer = getSharedRenderer()->getEditBox();
             m_editBoxFilename->setRenderer(renderer);
             m_editBoxPath->setRenderer(renderer);
         }
-        else if (property == U"Button")
+        else if (property == Property::Button)
         {
             const auto& renderer = getSharedRenderer()->getButton();
             m_buttonCancel->setRenderer(renderer);
@@ -1076,36 +1077,36 @@ namespace tgui
             if (!getSharedRenderer()->getUpButton())
                 m_buttonUp->setRenderer(renderer);
         }
-        else if (property == U"BackButton")
+        else if (property == Property::BackButton)
         {
             if (getSharedRenderer()->getBackButton())
                 m_buttonBack->setRenderer(getSharedRenderer()->getBackButton());
             else
                 m_buttonBack->setRenderer(getSharedRenderer()->getButton());
         }
-        else if (property == U"ForwardButton")
+        else if (property == Property::ForwardButton)
         {
             if (getSharedRenderer()->getForwardButton())
                 m_buttonForward->setRenderer(getSharedRenderer()->getForwardButton());
             else
                 m_buttonForward->setRenderer(getSharedRenderer()->getButton());
         }
-        else if (property == U"UpButton")
+        else if (property == Property::UpButton)
         {
             if (getSharedRenderer()->getUpButton())
                 m_buttonUp->setRenderer(getSharedRenderer()->getUpButton());
             else
                 m_buttonUp->setRenderer(getSharedRenderer()->getButton());
         }
-        else if (property == U"FilenameLabel")
+        else if (property == Property::FilenameLabel)
         {
             m_labelFilename->setRenderer(getSharedRenderer()->getFilenameLabel());
         }
-        else if (property == U"FileTypeComboBox")
+        else if (property == Property::FileTypeComboBox)
         {
             m_comboBoxFileTypes->setRenderer(getSharedRenderer()->getFileTypeComboBox());
         }
-        else if (property == U"ArrowsOnNavigationButtonsVisible")
+        else if (property == Property::ArrowsOnNavigationButtonsVisible)
         {
             if (getSharedRenderer()->getArrowsOnNavigationButtonsVisible())
             {
@@ -1120,7 +1121,7 @@ namespace tgui
                 m_buttonUp->setText(U"");
             }
         }
-        else if (property == U"Font")
+        else if (property == Property::Font)
         {
             ChildWindow::rendererChanged(property);
 
@@ -133,9 +133,9 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Group::rendererChanged(const String& property)
+    void Group::rendererChanged(PropertyId property)
     {
-        if (property == U"Padding")
+        if (property == Property::Padding)
         {
             m_paddingCached = getSharedRenderer()->getPadding();
             setSize(m_size);
@@ -456,6 +456,8 @@ namespace tgui
             m_angle = m_startRotation - (m_value - m_minimum) / (m_maximum - m_minimum) * allowedAngle;
         else // counter-clockwise
             m_angle = (((m_value - m_minimum) / (m_maximum - m_minimum)) * allowedAngle) + m_startRotation;
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -470,40 +472,40 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Knob::rendererChanged(const String& property)
+    void Knob::rendererChanged(PropertyId property)
     {
-        if (property == U"Borders")
+        if (property == Property::Borders)
         {
             m_bordersCached = getSharedRenderer()->getBorders();
             setSize(m_size);
         }
-        else if (property == U"TextureBackground")
+        else if (property == Property::TextureBackground)
         {
             m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
             setSize(m_size);
         }
-        else if (property == U"TextureForeground")
+        else if (property == Property::TextureForeground)
         {
             m_spriteForeground.setTexture(getSharedRenderer()->getTextureForeground());
             setSize(m_size);
         }
-        else if (property == U"BorderColor")
+        else if (property == Property::BorderColor)
         {
             m_borderColorCached = getSharedRenderer()->getBorderColor();
         }
-        else if (property == U"BackgroundColor")
+        else if (property == Property::BackgroundColor)
         {
             m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
         }
-        else if (property == U"ThumbColor")
+        else if (property == Property::ThumbColor)
         {
             m_thumbColorCached = getSharedRenderer()->getThumbColor();
         }
-        else if (property == U"ImageRotation")
+        else if (property == Property::ImageRotation)
         {
             m_imageRotationCached = getSharedRenderer()->getImageRotation();
         }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
+        else if ((property == Property::Opacity) || (property == Property::OpacityDisabled))
         {
             Widget::rendererChanged(property);
 
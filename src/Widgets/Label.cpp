@@ -120,7 +120,9 @@ namespace tgui
     void Label::setText(const String& string)
     {
         m_string = string;
+        m_wordWrapper.setText(m_string);
         rearrangeText();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -143,6 +145,7 @@ namespace tgui
     {
         m_horizontalAlignment = alignment;
         rearrangeText();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -158,6 +161,7 @@ namespace tgui
     {
         m_verticalAlignment = alignment;
         rearrangeText();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -176,6 +180,8 @@ namespace tgui
         // The policy only has an effect when not auto-sizing
         if (!m_autoSize)
             rearrangeText();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -190,6 +196,7 @@ namespace tgui
     void Label::setScrollbarValue(unsigned int value)
     {
         m_scrollbar->setValue(value);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -208,6 +215,7 @@ namespace tgui
 
         m_autoSize = autoSize;
         rearrangeText();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -226,6 +234,7 @@ namespace tgui
 
         m_maximumTextWidth = maximumWidth;
         rearrangeText();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -289,6 +298,9 @@ namespace tgui
         }
         else
             ClickableWidget::leftMousePressed(pos);
+
+        if (m_scrollbar->wasInvalidated())
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -322,6 +334,9 @@ namespace tgui
 
         if (m_scrollbar->isShown())
             m_scrollbar->leftMouseReleased(pos - getPosition());
+
+        if (m_scrollbar->wasInvalidated())
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -337,16 +352,23 @@ namespace tgui
             if (m_scrollbar->isShown())
                 m_scrollbar->mouseNoLongerOnWidget();
         }
+
+        if (m_scrollbar->wasInvalidated())
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool Label::scrolled(float delta, Vector2f pos, bool touch)
     {
-        if (!m_autoSize && m_scrollbar->isShown())
-            return m_scrollbar->scrolled(delta, pos - getPosition(), touch);
+        if (m_autoSize || !m_scrollbar->isShown())
+            return false;
 
-        return false;
+        const bool scrollbarMoved = m_scrollbar->scrolled(delta, pos - getPosition(), touch);
+        if (m_scrollbar->wasInvalidated())
+            invalidate();
+
+        return scrollbarMoved;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -356,6 +378,9 @@ namespace tgui
         ClickableWidget::mouseNoLongerOnWidget();
         m_scrollbar->mouseNoLongerOnWidget();
         m_possibleDoubleClick = false;
+
+        if (m_scrollbar->wasInvalidated())
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -364,6 +389,9 @@ namespace tgui
     {
         ClickableWidget::leftMouseButtonNoLongerDown();
         m_scrollbar->leftMouseButtonNoLongerDown();
+
+        if (m_scrollbar->wasInvalidated())
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -378,9 +406,9 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Label::rendererChanged(const String& property)
+    void Label::rendererChanged(PropertyId property)
     {
-        if (property == U"Borders")
+        if (property == Property::Borders)
         {
             m_bordersCached = getSharedRenderer()->getBorders();
             m_bordersCached.updateParentSize(getSize());
@@ -388,18 +416,18 @@ namespace tgui
                                         getSize().y - m_bordersCached.getTop() - m_bordersCached.getBottom()});
             rearrangeText();
         }
-        else if (property == U"Padding")
+        else if (property == Property::Padding)
         {
             m_paddingCached = getSharedRenderer()->getPadding();
             m_paddingCached.updateParentSize(getSize());
             rearrangeText();
         }
-        else if (property == U"TextStyle")
+        else if (property == Property::TextStyle)
         {
             m_textStyleCached = getSharedRenderer()->getTextStyle();
             rearrangeText();
         }
-        else if (property == U"TextColor")
+        else if (property == Property::TextColor)
         {
             m_textColorCached = getSharedRenderer()->getTextColor();
             for (auto& line : m_lines)
@@ -408,24 +436,24 @@ namespace tgui
                     textPiece.setColor(m_textColorCached);
             }
         }
-        else if (property == U"BorderColor")
+        else if (property == Property::BorderColor)
         {
             m_borderColorCached = getSharedRenderer()->getBorderColor();
         }
-        else if (property == U"BackgroundColor")
+        else if (property == Property::BackgroundColor)
         {
             m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
         }
-        else if (property == U"TextureBackground")
+        else if (property == Property::TextureBackground)
         {
             m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
         }
-        else if (property == U"TextOutlineThickness")
+        else if (property == Property::TextOutlineThickness)
         {
             m_textOutlineThicknessCached = getSharedRenderer()->getTextOutlineThickness();
             rearrangeText();
         }
-        else if (property == U"TextOutlineColor")
+        else if (property == Property::TextOutlineColor)
         {
             m_textOutlineColorCached = getSharedRenderer()->getTextOutlineColor();
             for (auto& line : m_lines)
@@ -434,7 +462,7 @@ namespace tgui
                     textPiece.setOutlineColor(m_textOutlineColorCached);
             }
         }
-        else if (property == U"Scrollbar")
+        else if (property == Property::Scrollbar)
         {
             m_scrollbar->setRenderer(getSharedRenderer()->getScrollbar());
 
@@ -445,18 +473,18 @@ namespace tgui
                 rearrangeText();
             }
         }
-        else if (property == U"ScrollbarWidth")
+        else if (property == Property::ScrollbarWidth)
         {
             const float width = (getSharedRenderer()->getScrollbarWidth() != 0) ? getSharedRenderer()->getScrollbarWidth() : m_scrollbar->getDefaultWidth();
             m_scrollbar->setSize({width, m_scrollbar->getSize().y});
             rearrangeText();
         }
-        else if (property == U"Font")
+        else if (property == Property::Font)
         {
             Widget::rendererChanged(property);
             rearrangeText();
         }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
+        else if ((property == Property::Opacity) || (property == Property::OpacityDisabled))
         {
             Widget::rendererChanged(property);
 
@@ -624,41 +652,38 @@ namespace tgui
                 return;
         }
 
-        // Fit the text in the available space
-        Optional<String> wordWrappedString = (maxWidth > 0)
-            ? Text::wordWrap(maxWidth, m_string, m_fontCached, m_textSizeCached, m_textStyleCached & TextStyle::Bold)
-            : Optional<String>();
-        String* stringPtr = wordWrappedString.has_value() ? &wordWrappedString.value() : &m_string;
-
         const Outline outline = {m_paddingCached.getLeft() + m_bordersCached.getLeft(),
                                  m_paddingCached.getTop() + m_bordersCached.getTop(),
                                  m_paddingCached.getRight() + m_bordersCached.getRight(),
                                  m_paddingCached.getBottom() + m_bordersCached.getBottom()};
 
-        const auto lineCount = std::count(stringPtr->begin(), stringPtr->end(), U'\n') + 1;
-        float requiredTextHeight = (lineCount - 1) * m_fontCached.getLineSpacing(m_textSizeCached)
-                                 + std::max(m_fontCached.getFontHeight(m_textSizeCached), m_fontCached.getLineSpacing(m_textSizeCached))
-                                 + Text::getExtraVerticalPadding(m_textSizeCached);
+        const float lineSpacing = m_fontCached.getLineSpacing(m_textSizeCached);
+        const float lineHeight = std::max(m_fontCached.getFontHeight(m_textSizeCached), lineSpacing);
+        const float extraVerticalPadding = Text::getExtraVerticalPadding(m_textSizeCached);
+        const auto getRequiredTextHeight = [=](std::size_t lineCount){ return static_cast<float>(lineCount - 1) * lineSpacing + lineHeight + extraVerticalPadding; };
 
-        // Check if a scrollbar should be added
-        if (!m_autoSize)
+        // Fit the text in the available space. The word-wrapper keeps the lines, so they are only recalculated when the
+        // text or the available width changed.
+        const bool bold = m_textStyleCached & TextStyle::Bold;
+        const bool scrollbarMayBeNeeded = !m_autoSize && (m_scrollbarPolicy == Scrollbar::Policy::Automatic);
+        const float availableTextHeight = getSize().y - outline.getTop() - outline.getBottom();
+        m_wordWrapper.setWrapping(maxWidth, m_fontCached, m_textSizeCached, bold);
+
+        // If the text doesn't fit in the label then we need to run the word-wrap again, but this time taking the scrollbar into account
+        if (scrollbarMayBeNeeded && (getRequiredTextHeight(m_wordWrapper.getLineCount()) > availableTextHeight))
         {
-            // If the text doesn't fit in the label then we need to run the word-wrap again, but this time taking the scrollbar into account
-            if ((m_scrollbarPolicy == Scrollbar::Policy::Automatic) && (requiredTextHeight > getSize().y - outline.getTop() - outline.getBottom()))
-            {
-                maxWidth -= m_scrollbar->getSize().x;
-                if (maxWidth <= 0)
-                    return;
+            maxWidth -= m_scrollbar->getSize().x;
+            if (maxWidth <= 0)
+                return;
 
-                wordWrappedString = Text::wordWrap(maxWidth, m_string, m_fontCached, m_textSizeCached, m_textStyleCached & TextStyle::Bold);
-                stringPtr = &wordWrappedString.value();
+            m_wordWrapper.setWrapping(maxWidth, m_fontCached, m_textSizeCached, bold);
+        }
 
-                const auto newLineCount = std::count(stringPtr->begin(), stringPtr->end(), U'\n') + 1;
-                requiredTextHeight = (newLineCount - 1) * m_fontCached.getLineSpacing(m_textSizeCached)
-                                   + std::max(m_fontCached.getFontHeight(m_textSizeCached), m_fontCached.getLineSpacing(m_textSizeCached))
-                                   + Text::getExtraVerticalPadding(m_textSizeCached);
-            }
+        const std::vector<String> lines = m_wordWrapper.getLines();
+        const float requiredTextHeight = getRequiredTextHeight(lines.size());
 
+        if (!m_autoSize)
+        {
             m_scrollbar->setSize(m_scrollbar->getSize().x, static_cast<unsigned int>(getSize().y - m_bordersCached.getTop() - m_bordersCached.getBottom()));
             m_scrollbar->setViewportSize(static_cast<unsigned int>(getSize().y - outline.getTop() - outline.getBottom()));
             m_scrollbar->setMaximum(static_cast<unsigned int>(requiredTextHeight));
@@ -666,14 +691,10 @@ namespace tgui
             m_scrollbar->setScrollAmount(m_textSizeCached);
         }
 
-        // Split the string in multiple lines
+        // Create a text piece for every line
         float width = 0;
-        std::size_t searchPosStart = 0;
-        std::size_t newLinePos = 0;
-        while (newLinePos != String::npos)
+        for (const auto& lineString : lines)
         {
-            newLinePos = stringPtr->find('\n', searchPosStart);
-
             TGUI_EMPLACE_BACK(line, m_lines)
             TGUI_EMPLACE_BACK(textPiece, line)
             textPiece.setCharacterSize(getTextSize());
@@ -683,16 +704,10 @@ namespace tgui
             textPiece.setOpacity(m_opacityCached);
             textPiece.setOutlineColor(m_textOutlineColorCached);
             textPiece.setOutlineThickness(m_textOutlineThicknessCached);
-
-            if (newLinePos != String::npos)
-                textPiece.setString(stringPtr->substr(searchPosStart, newLinePos - searchPosStart));
-            else
-                textPiece.setString(stringPtr->substr(searchPosStart));
+            textPiece.setString(lineString);
 
             if (textPiece.getSize().x > width)
                 width = textPiece.getSize().x;
-
-            searchPosStart = newLinePos + 1;
         }
 
         // Update the size of the label
@@ -128,20 +128,12 @@ namespace tgui
             triggerOnScroll();
         }
 
-        // Create the new item
-        Text newItem;
-        newItem.setFont(m_fontCached);
-        newItem.setColor(m_textColorCached);
-        newItem.setOpacity(m_opacityCached);
-        newItem.setStyle(m_textStyleCached);
-        newItem.setCharacterSize(m_textSizeCached);
-        newItem.setString(itemName);
-        newItem.setPosition({0, (m_items.size() * m_itemHeight) + ((m_itemHeight - newItem.getSize().y) / 2.0f)});
-
-        // Add the new item to the list
+        // Add the new item to the list. The text that displays it is only created when the item becomes visible.
         m_items.emplace_back();
-        m_items.back().text = std::move(newItem);
+        m_items.back().caption = itemName;
         m_items.back().id = id;
+        m_visibleItemTextsValid = false;
+        invalidate();
         return m_items.size() - 1;
     }
 
@@ -151,7 +143,7 @@ namespace tgui
     {
         for (std::size_t i = 0; i < m_items.size(); ++i)
         {
-            if (m_items[i].text.getString() == itemName)
+            if (m_items[i].caption == itemName)
                 return setSelectedItemByIndex(i);
         }
 
@@ -199,6 +191,7 @@ namespace tgui
             triggerOnScroll();
         }
 
+        invalidate();
         return true;
     }
 
@@ -215,7 +208,7 @@ namespace tgui
     {
         for (std::size_t i = 0; i < m_items.size(); ++i)
         {
-            if (m_items[i].text.getString() == itemName)
+            if (m_items[i].caption == itemName)
                 return removeItemByIndex(i);
         }
 
@@ -274,6 +267,8 @@ namespace tgui
 
         // Clear the list, remove all items
         m_items.clear();
+        m_visibleItemTextsValid = false;
+        invalidate();
 
         m_scroll->setMaximum(0);
         triggerOnScroll();
@@ -286,7 +281,7 @@ namespace tgui
         for (const auto& item : m_items)
         {
             if (item.id == id)
-                return item.text.getString();
+                return item.caption.toString();
         }
 
         return "";
@@ -299,7 +294,7 @@ namespace tgui
         if (index >= m_items.size())
             return "";
 
-        return m_items[index].text.getString();
+        return m_items[index].caption.toString();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -322,21 +317,21 @@ namespace tgui
         if (index >= m_items.size())
             return "";
 
-        return m_items[index].id;
+        return m_items[index].id.toString();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     String ListBox::getSelectedItem() const
     {
-        return (m_selectedItem >= 0) ? m_items[static_cast<std::size_t>(m_selectedItem)].text.getString() : "";
+        return (m_selectedItem >= 0) ? m_items[static_cast<std::size_t>(m_selectedItem)].caption.toString() : "";
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     String ListBox::getSelectedItemId() const
     {
-        return (m_selectedItem >= 0) ? m_items[static_cast<std::size_t>(m_selectedItem)].id : "";
+        return (m_selectedItem >= 0) ? m_items[static_cast<std::size_t>(m_selectedItem)].id.toString() : "";
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -352,7 +347,7 @@ namespace tgui
     {
         for (std::size_t i = 0; i < m_items.size(); ++i)
         {
-            if (m_items[i].text.getString() == originalValue)
+            if (m_items[i].caption == originalValue)
                 return changeItemByIndex(i, newValue);
         }
 
@@ -379,7 +374,9 @@ namespace tgui
         if (index >= m_items.size())
             return false;
 
-        m_items[index].text.setString(newValue);
+        m_items[index].caption = newValue;
+        m_visibleItemTextsValid = false;
+        invalidate();
         return true;
     }
 
@@ -396,7 +393,7 @@ namespace tgui
     {
         std::vector<String> items;
         for (const auto& item : m_items)
-            items.push_back(item.text.getString());
+            items.push_back(item.caption.toString());
 
         return items;
     }
@@ -407,7 +404,7 @@ namespace tgui
     {
         std::vector<String> ids;
         for (const auto& item : m_items)
-            ids.push_back(item.id);
+            ids.push_back(item.id.toString());
 
         return ids;
     }
@@ -433,11 +430,7 @@ namespace tgui
         m_itemHeight = itemHeight;
 
         if ((m_textSize == 0) && !getSharedRenderer()->getTextSize())
-        {
             m_textSizeCached = Text::findBestTextSize(m_fontCached, m_itemHeight * 0.8f);
-            for (auto& item : m_items)
-                item.text.setCharacterSize(m_textSizeCached);
-        }
 
         m_scroll->setScrollAmount(m_itemHeight);
         m_scroll->setMaximum(static_cast<unsigned int>(m_items.size() * m_itemHeight));
@@ -459,9 +452,6 @@ namespace tgui
         if ((m_textSize == 0) && !getSharedRenderer()->getTextSize())
             m_textSizeCached = Text::findBestTextSize(m_fontCached, m_itemHeight * 0.8f);
 
-        for (auto& item : m_items)
-            item.text.setCharacterSize(m_textSizeCached);
-
         updateItemPositions();
     }
 
@@ -515,6 +505,7 @@ namespace tgui
     void ListBox::setTextAlignment(TextAlignment alignment)
     {
         m_textAlignment = alignment;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -528,7 +519,7 @@ namespace tgui
 
     bool ListBox::contains(const String& itemStr) const
     {
-        return std::find_if(m_items.begin(), m_items.end(), [itemStr](const Item& item){ return item.text.getString() == itemStr; }) != m_items.end();
+        return std::find_if(m_items.begin(), m_items.end(), [itemStr](const Item& item){ return item.caption == itemStr; }) != m_items.end();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -544,6 +535,7 @@ namespace tgui
     {
         m_scroll->setValue(value);
         triggerOnScroll();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -604,7 +596,7 @@ namespace tgui
                 if (m_selectedItem >= 0)
                 {
                     const Item& selectedItem = m_items[static_cast<std::size_t>(m_selectedItem)];
-                    onMousePress.emit(this, m_selectedItem, selectedItem.text.getString(), selectedItem.id);
+                    onMousePress.emit(this, m_selectedItem, selectedItem.caption.toString(), selectedItem.id.toString());
                 }
             }
         }
@@ -619,7 +611,7 @@ namespace tgui
             if (m_selectedItem >= 0)
             {
                 const Item& selectedItem = m_items[static_cast<std::size_t>(m_selectedItem)];
-                onMouseRelease.emit(this, m_selectedItem, selectedItem.text.getString(), selectedItem.id);
+                onMouseRelease.emit(this, m_selectedItem, selectedItem.caption.toString(), selectedItem.id.toString());
             }
 
             // Check if you double-clicked
@@ -630,7 +622,7 @@ namespace tgui
                 if (m_selectedItem >= 0)
                 {
                     const Item& selectedItem = m_items[static_cast<std::size_t>(m_selectedItem)];
-                    onDoubleClick.emit(this, m_selectedItem, selectedItem.text.getString(), selectedItem.id);
+                    onDoubleClick.emit(this, m_selectedItem, selectedItem.caption.toString(), selectedItem.id.toString());
                 }
             }
             else // This is the first click
@@ -692,6 +684,9 @@ namespace tgui
                 }
             }
         }
+
+        if (m_scroll->wasInvalidated())
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -721,6 +716,9 @@ namespace tgui
         updateHoveringItem(-1);
 
         m_possibleDoubleClick = false;
+
+        if (m_scroll->wasInvalidated())
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -768,65 +766,53 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ListBox::rendererChanged(const String& property)
+    void ListBox::rendererChanged(PropertyId property)
     {
-        if (property == U"Borders")
+        if (property == Property::Borders)
         {
             m_bordersCached = getSharedRenderer()->getBorders();
             setSize(m_size);
         }
-        else if (property == U"Padding")
+        else if (property == Property::Padding)
         {
             m_paddingCached = getSharedRenderer()->getPadding();
             setSize(m_size);
         }
-        else if (property == U"TextColor")
+        else if (property == Property::TextColor)
         {
             m_textColorCached = getSharedRenderer()->getTextColor();
             updateItemColorsAndStyle();
         }
-        else if (property == U"TextColorHover")
+        else if (property == Property::TextColorHover)
         {
             m_textColorHoverCached = getSharedRenderer()->getTextColorHover();
             updateItemColorsAndStyle();
         }
-        else if (property == U"SelectedTextColor")
+        else if (property == Property::SelectedTextColor)
         {
             m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
             updateItemColorsAndStyle();
         }
-        else if (property == U"SelectedTextColorHover")
+        else if (property == Property::SelectedTextColorHover)
         {
             m_selectedTextColorHoverCached = getSharedRenderer()->getSelectedTextColorHover();
             updateItemColorsAndStyle();
         }
-        else if (property == U"TextureBackground")
+        else if (property == Property::TextureBackground)
         {
             m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
         }
-        else if (property == U"TextStyle")
+        else if (property == Property::TextStyle)
         {
             m_textStyleCached = getSharedRenderer()->getTextStyle();
-
-            for (auto& item : m_items)
-                item.text.setStyle(m_textStyleCached);
-
-            if ((m_selectedItem >= 0) && m_selectedTextStyleCached.isSet())
-                m_items[static_cast<std::size_t>(m_selectedItem)].text.setStyle(m_selectedTextStyleCached);
+            updateItemColorsAndStyle();
         }
-        else if (property == U"SelectedTextStyle")
+        else if (property == Property::SelectedTextStyle)
         {
             m_selectedTextStyleCached = getSharedRenderer()->getSelectedTextStyle();
-
-            if (m_selectedItem >= 0)
-            {
-                if (m_selectedTextStyleCached.isSet())
-                    m_items[static_cast<std::size_t>(m_selectedItem)].text.setStyle(m_selectedTextStyleCached);
-                else
-                    m_items[static_cast<std::size_t>(m_selectedItem)].text.setStyle(m_textStyleCached);
-            }
+            updateItemColorsAndStyle();
         }
-        else if (property == U"Scrollbar")
+        else if (property == Property::Scrollbar)
         {
             m_scroll->setRenderer(getSharedRenderer()->getScrollbar());
 
@@ -837,55 +823,47 @@ namespace tgui
                 setSize(m_size);
             }
         }
-        else if (property == U"ScrollbarWidth")
+        else if (property == Property::ScrollbarWidth)
         {
             const float width = (getSharedRenderer()->getScrollbarWidth() != 0) ? getSharedRenderer()->getScrollbarWidth() : m_scroll->getDefaultWidth();
             m_scroll->setSize({width, m_scroll->getSize().y});
             setSize(m_size);
         }
-        else if (property == U"BorderColor")
+        else if (property == Property::BorderColor)
         {
             m_borderColorCached = getSharedRenderer()->getBorderColor();
         }
-        else if (property == U"BackgroundColor")
+        else if (property == Property::BackgroundColor)
         {
             m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
         }
-        else if (property == U"BackgroundColorHover")
+        else if (property == Property::BackgroundColorHover)
         {
             m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
         }
-        else if (property == U"SelectedBackgroundColor")
+        else if (property == Property::SelectedBackgroundColor)
         {
             m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
         }
-        else if (property == U"SelectedBackgroundColorHover")
+        else if (property == Property::SelectedBackgroundColorHover)
         {
             m_selectedBackgroundColorHoverCached = getSharedRenderer()->getSelectedBackgroundColorHover();
         }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
+        else if ((property == Property::Opacity) || (property == Property::OpacityDisabled))
         {
             Widget::rendererChanged(property);
 
             m_scroll->setInheritedOpacity(m_opacityCached);
             m_spriteBackground.setOpacity(m_opacityCached);
-            for (auto& item : m_items)
-                item.text.setOpacity(m_opacityCached);
+            m_visibleItemTextsValid = false;
         }
-        else if (property == U"Font")
+        else if (property == Property::Font)
         {
             Widget::rendererChanged(property);
 
-            for (auto& item : m_items)
-                item.text.setFont(m_fontCached);
-
             // Recalculate the text size with the new font
             if ((m_textSize == 0) && !getSharedRenderer()->getTextSize())
-            {
                 m_textSizeCached = Text::findBestTextSize(m_fontCached, m_itemHeight * 0.8f);
-                for (auto& item : m_items)
-                    item.text.setCharacterSize(m_textSizeCached);
-            }
 
             updateItemPositions();
         }
@@ -1010,46 +988,25 @@ namespace tgui
 
     void ListBox::updateItemPositions()
     {
-        for (std::size_t i = 0; i < m_items.size(); ++i)
-            m_items[i].text.setPosition({0, (i * m_itemHeight) + ((m_itemHeight - m_items[i].text.getSize().y) / 2.0f)});
-
         m_scroll->setPosition(getSize().x - m_bordersCached.getRight() - m_scroll->getSize().x, m_bordersCached.getTop());
+        m_visibleItemTextsValid = false;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void ListBox::updateSelectedAndHoveringItemColorsAndStyle()
     {
-        if (m_selectedItem >= 0)
-        {
-            Item& selectedItem = m_items[static_cast<std::size_t>(m_selectedItem)];
-            if ((m_selectedItem == m_hoveringItem) && m_selectedTextColorHoverCached.isSet())
-                selectedItem.text.setColor(m_selectedTextColorHoverCached);
-            else if (m_selectedTextColorCached.isSet())
-                selectedItem.text.setColor(m_selectedTextColorCached);
-
-            if (m_selectedTextStyleCached.isSet())
-                selectedItem.text.setStyle(m_selectedTextStyleCached);
-        }
-
-        if ((m_hoveringItem >= 0) && (m_selectedItem != m_hoveringItem))
-        {
-            if (m_textColorHoverCached.isSet())
-                m_items[static_cast<std::size_t>(m_hoveringItem)].text.setColor(m_textColorHoverCached);
-        }
+        updateItemColorsAndStyle();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void ListBox::updateItemColorsAndStyle()
     {
-        for (auto& item : m_items)
-        {
-            item.text.setColor(m_textColorCached);
-            item.text.setStyle(m_textStyleCached);
-        }
-
-        updateSelectedAndHoveringItemColorsAndStyle();
+        // Only the visible items have a text that needs to be updated, so they are simply recreated when drawing
+        m_visibleItemTextsValid = false;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1058,17 +1015,8 @@ namespace tgui
     {
         if (m_hoveringItem != item)
         {
-            if (m_hoveringItem >= 0)
-            {
-                if ((m_selectedItem == m_hoveringItem) && m_selectedTextColorCached.isSet())
-                    m_items[static_cast<std::size_t>(m_hoveringItem)].text.setColor(m_selectedTextColorCached);
-                else
-                    m_items[static_cast<std::size_t>(m_hoveringItem)].text.setColor(m_textColorCached);
-            }
-
             m_hoveringItem = item;
-
-            updateSelectedAndHoveringItemColorsAndStyle();
+            updateItemColorsAndStyle();
         }
     }
 
@@ -1079,33 +1027,62 @@ namespace tgui
         if (m_selectedItem == item)
             return;
 
-        if (m_selectedItem >= 0)
-        {
-            Item& selectedItem = m_items[static_cast<std::size_t>(m_selectedItem)];
-            if ((m_selectedItem == m_hoveringItem) && m_textColorHoverCached.isSet())
-                selectedItem.text.setColor(m_textColorHoverCached);
-            else
-                selectedItem.text.setColor(m_textColorCached);
-
-            selectedItem.text.setStyle(m_textStyleCached);
-        }
-
         m_selectedItem = item;
         if (m_selectedItem >= 0)
         {
             const Item& selectedItem = m_items[static_cast<std::size_t>(m_selectedItem)];
-            onItemSelect.emit(this, m_selectedItem, selectedItem.text.getString(), selectedItem.id);
+            onItemSelect.emit(this, m_selectedItem, selectedItem.caption.toString(), selectedItem.id.toString());
         }
         else
             onItemSelect.emit(this, m_selectedItem, "", "");
 
-        updateSelectedAndHoveringItemColorsAndStyle();
+        updateItemColorsAndStyle();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::updateVisibleItemTexts(std::size_t firstItem, std::size_t lastItem) const
+    {
+        m_visibleItemTexts.resize(lastItem - firstItem);
+        for (std::size_t i = firstItem; i < lastItem; ++i)
+        {
+            Color color = m_textColorCached;
+            TextStyles style = m_textStyleCached;
+            if (static_cast<int>(i) == m_selectedItem)
+            {
+                if ((m_selectedItem == m_hoveringItem) && m_selectedTextColorHoverCached.isSet())
+                    color = m_selectedTextColorHoverCached;
+                else if (m_selectedTextColorCached.isSet())
+                    color = m_selectedTextColorCached;
+
+                if (m_selectedTextStyleCached.isSet())
+                    style = m_selectedTextStyleCached;
+            }
+            else if ((static_cast<int>(i) == m_hoveringItem) && m_textColorHoverCached.isSet())
+                color = m_textColorHoverCached;
+
+            Text& text = m_visibleItemTexts[i - firstItem];
+            text.setFont(m_fontCached);
+            text.setColor(color);
+            text.setOpacity(m_opacityCached);
+            text.setStyle(style);
+            text.setCharacterSize(m_textSizeCached);
+            text.setString(m_items[i].caption.toString());
+            text.setPosition({0, (i * m_itemHeight) + ((m_itemHeight - text.getSize().y) / 2.0f)});
+        }
+
+        m_visibleItemTextsFirstItem = firstItem;
+        m_visibleItemTextsValid = true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void ListBox::triggerOnScroll()
     {
+        // The scrollbar isn't a child widget, so its changes have to be reported by the list box
+        if (m_scroll->wasInvalidated())
+            invalidate();
+
         const unsigned int currentScrollbarValue = m_scroll->getValue();
         if (currentScrollbarValue == m_lastScrollbarValue)
             return;
@@ -1167,8 +1144,13 @@ namespace tgui
                 // Show another item when the scrollbar is standing between two items
                 if ((m_scroll->getValue() + m_scroll->getViewportSize()) % m_itemHeight != 0)
                     ++lastItem;
+
+                lastItem = std::min(lastItem, m_items.size());
             }
 
+            if (!m_visibleItemTextsValid || (firstItem != m_visibleItemTextsFirstItem) || (lastItem - firstItem != m_visibleItemTexts.size()))
+                updateVisibleItemTexts(firstItem, lastItem);
+
             states.transform.translate({m_paddingCached.getLeft(), m_paddingCached.getTop() - m_scroll->getValue()});
 
             // Draw the background of the selected item
@@ -1197,29 +1179,29 @@ namespace tgui
             if (m_textAlignment == ListBox::TextAlignment::Right)
             {
                 const float textPadding = Text::getExtraHorizontalPadding(m_fontCached, m_textSizeCached);
-                for (std::size_t i = firstItem; i < lastItem; ++i)
+                for (const auto& text : m_visibleItemTexts)
                 {
-                    const float textWidth = m_items[i].text.getSize().x;
+                    const float textWidth = text.getSize().x;
                     states.transform.translate({maxItemWidth - textPadding - textWidth, 0});
-                    target.drawText(states, m_items[i].text);
+                    target.drawText(states, text);
                     states.transform.translate({-maxItemWidth + textPadding + textWidth, 0});
                 }
             }
             else if (m_textAlignment == ListBox::TextAlignment::Center)
             {
-                for (std::size_t i = firstItem; i < lastItem; ++i)
+                for (const auto& text : m_visibleItemTexts)
                 {
-                    const float textWidth = m_items[i].text.getSize().x;
+                    const float textWidth = text.getSize().x;
                     states.transform.translate({(maxItemWidth - textWidth) / 2.f, 0});
-                    target.drawText(states, m_items[i].text);
+                    target.drawText(states, text);
                     states.transform.translate({-(maxItemWidth - textWidth) / 2.f, 0});
                 }
             }
             else // m_textAlignment == ListBox::TextAlignment::Left
             {
                 states.transform.translate({Text::getExtraHorizontalPadding(m_fontCached, m_textSizeCached), 0});
-                for (std::size_t i = firstItem; i < lastItem; ++i)
-                    target.drawText(states, m_items[i].text);
+                for (const auto& text : m_visibleItemTexts)
+                    target.drawText(states, text);
             }
 
             target.removeClippingLayer();
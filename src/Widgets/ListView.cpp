@@ -257,7 +257,10 @@ namespace tgui
     void ListView::setColumnAlignment(std::size_t columnIndex, ColumnAlignment alignment)
     {
         if (columnIndex < m_columns.size())
+        {
             m_columns[columnIndex].alignment = alignment;
+            invalidate();
+        }
         else
         {
             TGUI_PRINT_WARNING("setColumnAlignment called with invalid columnIndex.");
@@ -297,12 +300,13 @@ namespace tgui
     std::size_t ListView::addItem(const String& text)
     {
         TGUI_EMPLACE_BACK(item, m_items)
-        item.texts.push_back(createText(text));
+        item.texts.push_back(text);
         item.icon.setOpacity(m_opacityCached);
 
         const bool updatedLastColumnMaxItemWidth = updateLastColumnMaxItemWidthWithNewItem(item);
         if (updatedLastColumnMaxItemWidth)
             updateHorizontalScrollbarMaximum();
+        m_visibleItemTextsValid = false;
         updateVerticalScrollbarMaximum();
 
         // Scroll down when auto-scrolling is enabled
@@ -319,13 +323,14 @@ namespace tgui
         TGUI_EMPLACE_BACK(item, m_items)
         item.texts.reserve(itemTexts.size());
         for (const auto& text : itemTexts)
-            item.texts.push_back(createText(text));
+            item.texts.push_back(text);
 
         item.icon.setOpacity(m_opacityCached);
 
         const bool updatedLastColumnMaxItemWidth = updateLastColumnMaxItemWidthWithNewItem(item);
         if (updatedLastColumnMaxItemWidth)
             updateHorizontalScrollbarMaximum();
+        m_visibleItemTextsValid = false;
         updateVerticalScrollbarMaximum();
 
         // Scroll down when auto-scrolling is enabled
@@ -346,7 +351,7 @@ namespace tgui
             TGUI_EMPLACE_BACK(item, m_items)
             item.texts.reserve(itemToInsert.size());
             for (const auto& text : itemToInsert)
-                item.texts.push_back(createText(text));
+                item.texts.push_back(text);
 
             item.icon.setOpacity(m_opacityCached);
 
@@ -355,6 +360,7 @@ namespace tgui
 
         if (updatedLastColumnMaxItemWidth)
             updateHorizontalScrollbarMaximum();
+        m_visibleItemTextsValid = false;
         updateVerticalScrollbarMaximum();
 
         // Scroll down when auto-scrolling is enabled
@@ -373,12 +379,13 @@ namespace tgui
         }
 
         auto& item = *m_items.emplace(m_items.begin() + static_cast<std::ptrdiff_t>(index));
-        item.texts.push_back(createText(text));
+        item.texts.push_back(text);
         item.icon.setOpacity(m_opacityCached);
 
         const bool updatedLastColumnMaxItemWidth = updateLastColumnMaxItemWidthWithNewItem(item);
         if (updatedLastColumnMaxItemWidth)
             updateHorizontalScrollbarMaximum();
+        m_visibleItemTextsValid = false;
         updateVerticalScrollbarMaximum();
 
         // Scroll to the item when auto-scrolling is enabled
@@ -399,13 +406,14 @@ namespace tgui
         auto& item = *m_items.emplace(m_items.begin() + static_cast<std::ptrdiff_t>(index));
         item.texts.reserve(itemTexts.size());
         for (const auto& text : itemTexts)
-            item.texts.push_back(createText(text));
+            item.texts.push_back(text);
 
         item.icon.setOpacity(m_opacityCached);
 
         const bool updatedLastColumnMaxItemWidth = updateLastColumnMaxItemWidthWithNewItem(item);
         if (updatedLastColumnMaxItemWidth)
             updateHorizontalScrollbarMaximum();
+        m_visibleItemTextsValid = false;
         updateVerticalScrollbarMaximum();
 
         // Scroll to the item when auto-scrolling is enabled
@@ -430,7 +438,7 @@ namespace tgui
             auto& item = *m_items.emplace(m_items.begin() + static_cast<std::ptrdiff_t>(index + i));
             item.texts.reserve(items[i].size());
             for (const auto& text : items[i])
-                item.texts.push_back(createText(text));
+                item.texts.push_back(text);
 
             item.icon.setOpacity(m_opacityCached);
 
@@ -439,6 +447,7 @@ namespace tgui
 
         if (updatedLastColumnMaxItemWidth)
             updateHorizontalScrollbarMaximum();
+        m_visibleItemTextsValid = false;
         updateVerticalScrollbarMaximum();
 
         // Scroll to the item when auto-scrolling is enabled
@@ -462,7 +471,7 @@ namespace tgui
             item.texts.clear();
             item.texts.reserve(itemTexts.size());
             for (const auto& text : itemTexts)
-                item.texts.push_back(createText(text));
+                item.texts.push_back(text);
 
             const bool updatedLastColumnMaxItemWidth = updateLastColumnMaxItemWidthWithModifiedItem(item, oldDesiredWidthInLastColumn);
             if (updatedLastColumnMaxItemWidth)
@@ -473,22 +482,11 @@ namespace tgui
             item.texts.clear();
             item.texts.reserve(itemTexts.size());
             for (const auto& text : itemTexts)
-                item.texts.push_back(createText(text));
+                item.texts.push_back(text);
         }
 
-        // Update the text color in case the changed item was selected
-        if (m_selectedItems.find(index) != m_selectedItems.end())
-        {
-            if ((static_cast<int>(index) == m_hoveredItem) && m_selectedTextColorHoverCached.isSet())
-                setItemColor(index, m_selectedTextColorHoverCached);
-            else if (m_selectedTextColorCached.isSet())
-                setItemColor(index, m_selectedTextColorCached);
-            else if ((static_cast<int>(index) == m_hoveredItem) && m_textColorHoverCached.isSet())
-                setItemColor(index, m_textColorHoverCached);
-        }
-        else if ((static_cast<int>(index) == m_hoveredItem) && m_textColorHoverCached.isSet())
-            setItemColor(index, m_textColorHoverCached);
-
+        // The text of the item has to be recreated if it is visible
+        m_visibleItemTextsValid = false;
         return true;
     }
 
@@ -508,7 +506,7 @@ namespace tgui
             if (column >= item.texts.size())
                 item.texts.resize(column + 1);
 
-            item.texts[column] = createText(itemText);
+            item.texts[column] = itemText;
 
             const bool updatedLastColumnMaxItemWidth = updateLastColumnMaxItemWidthWithModifiedItem(item, oldDesiredWidthInLastColumn);
             if (updatedLastColumnMaxItemWidth)
@@ -519,22 +517,11 @@ namespace tgui
             if (column >= item.texts.size())
                 item.texts.resize(column + 1);
 
-            item.texts[column] = createText(itemText);
-        }
-
-        // Update the text color in case the changed item was selected
-        if (m_selectedItems.find(index) != m_selectedItems.end())
-        {
-            if ((static_cast<int>(index) == m_hoveredItem) && m_selectedTextColorHoverCached.isSet())
-                setItemColor(index, m_selectedTextColorHoverCached);
-            else if (m_selectedTextColorCached.isSet())
-                setItemColor(index, m_selectedTextColorCached);
-            else if ((static_cast<int>(index) == m_hoveredItem) && m_textColorHoverCached.isSet())
-                setItemColor(index, m_textColorHoverCached);
+            item.texts[column] = itemText;
         }
-        else if ((static_cast<int>(index) == m_hoveredItem) && m_textColorHoverCached.isSet())
-            setItemColor(index, m_textColorHoverCached);
 
+        // The text of the item has to be recreated if it is visible
+        m_visibleItemTextsValid = false;
         return true;
     }
 
@@ -647,6 +634,7 @@ namespace tgui
 
         if (updatedLastColumnMaxItemWidth)
             updateHorizontalScrollbarMaximum();
+        m_visibleItemTextsValid = false;
         updateVerticalScrollbarMaximum();
 
         return true;
@@ -667,6 +655,7 @@ namespace tgui
        const bool updatedLastColumnMaxItemWidth = updateLastColumnMaxItemWidth();
        if (updatedLastColumnMaxItemWidth)
             updateHorizontalScrollbarMaximum();
+        m_visibleItemTextsValid = false;
         updateVerticalScrollbarMaximum();
     }
 
@@ -687,6 +676,8 @@ namespace tgui
             m_verticalScrollbar->setValue(static_cast<unsigned int>(index * getItemHeight()));
         else if (static_cast<unsigned int>(index + 1) * getItemHeight() > m_verticalScrollbar->getValue() + m_verticalScrollbar->getViewportSize())
             m_verticalScrollbar->setValue(static_cast<unsigned int>(index + 1) * getItemHeight() - m_verticalScrollbar->getViewportSize());
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -867,7 +858,7 @@ namespace tgui
             return "";
 
         if (columnIndex < m_items[rowIndex].texts.size())
-            return m_items[rowIndex].texts[columnIndex].getString();
+            return m_items[rowIndex].texts[columnIndex].toString();
 
         return "";
     }
@@ -882,7 +873,7 @@ namespace tgui
         if (m_items[index].texts.empty())
             return "";
 
-        return m_items[index].texts[0].getString();
+        return m_items[index].texts[0].toString();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -893,7 +884,7 @@ namespace tgui
         if (index < m_items.size())
         {
             for (const auto& text : m_items[index].texts)
-                row.push_back(text.getString());
+                row.push_back(text.toString());
         }
 
         row.resize(std::max<std::size_t>(1, m_columns.size()));
@@ -912,14 +903,17 @@ namespace tgui
             {
                 String s1;
                 if (index < a.texts.size())
-                    s1 = a.texts[index].getString();
+                    s1 = a.texts[index].toString();
 
                 String s2;
                 if (index < b.texts.size())
-                    s2 = b.texts[index].getString();
+                    s2 = b.texts[index].toString();
 
                 return cmp(s1, s2);
             });
+
+        m_visibleItemTextsValid = false;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -944,7 +938,7 @@ namespace tgui
         {
             std::vector<String> row;
             for (const auto& text : item.texts)
-                row.push_back(text.getString());
+                row.push_back(text.toString());
 
             row.resize(std::max<std::size_t>(1, m_columns.size()));
             rows.push_back(std::move(row));
@@ -980,11 +974,7 @@ namespace tgui
         if ((m_textSize == 0) && !getSharedRenderer()->getTextSize())
             m_textSizeCached = Text::findBestTextSize(m_fontCached, m_itemHeight * 0.8f);
 
-        for (auto& item : m_items)
-        {
-            for (auto& text : item.texts)
-                text.setCharacterSize(m_textSizeCached);
-        }
+        m_visibleItemTextsValid = false;
 
         if (!m_headerTextSize)
         {
@@ -1212,6 +1202,7 @@ namespace tgui
     void ListView::setVerticalScrollbarValue(unsigned int value)
     {
         m_verticalScrollbar->setValue(value);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1226,6 +1217,7 @@ namespace tgui
     void ListView::setHorizontalScrollbarValue(unsigned int value)
     {
         m_horizontalScrollbar->setValue(value);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1268,6 +1260,8 @@ namespace tgui
             item.icon.setSize(iconSize);
             m_maxIconWidth = std::max(m_maxIconWidth, iconSize.x);
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1368,6 +1362,9 @@ namespace tgui
         {
             m_mouseOnHeaderIndex = getColumnIndexBelowMouse(pos.x);
         }
+
+        if (m_verticalScrollbar->wasInvalidated() || m_horizontalScrollbar->wasInvalidated())
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1394,6 +1391,9 @@ namespace tgui
 
             m_mouseOnHeaderIndex = -1;
         }
+
+        if (m_verticalScrollbar->wasInvalidated() || m_horizontalScrollbar->wasInvalidated())
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1535,6 +1535,9 @@ namespace tgui
             if (m_parentGui)
                 m_parentGui->requestMouseCursor(wantedCursor);
         }
+
+        if (m_verticalScrollbar->wasInvalidated() || m_horizontalScrollbar->wasInvalidated())
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1556,6 +1559,9 @@ namespace tgui
         if (scrollbarMoved)
             mouseMoved(pos); // Update on which item the mouse is hovered
 
+        if (m_verticalScrollbar->wasInvalidated() || m_horizontalScrollbar->wasInvalidated())
+            invalidate();
+
         return scrollbarMoved;
     }
 
@@ -1570,6 +1576,9 @@ namespace tgui
         updateHoveredItem(-1);
 
         m_possibleDoubleClick = false;
+
+        if (m_verticalScrollbar->wasInvalidated() || m_horizontalScrollbar->wasInvalidated())
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1581,6 +1590,9 @@ namespace tgui
         m_horizontalScrollbar->leftMouseButtonNoLongerDown();
         m_mouseOnHeaderIndex = -1;
         m_resizingColumn = 0;
+
+        if (m_verticalScrollbar->wasInvalidated() || m_horizontalScrollbar->wasInvalidated())
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1629,7 +1641,7 @@ namespace tgui
             {
                 String temp;
                 for (const auto& text : m_items[index].texts)
-                    temp.append(text.getString() + '\t');
+                    temp.append(text.toString() + '\t');
 
                 if (*temp.rbegin() == '\t')
                     temp.pop_back();
@@ -1659,27 +1671,27 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ListView::rendererChanged(const String& property)
+    void ListView::rendererChanged(PropertyId property)
     {
-        if (property == U"Borders")
+        if (property == Property::Borders)
         {
             m_bordersCached = getSharedRenderer()->getBorders();
             setSize(m_size);
         }
-        else if (property == U"Padding")
+        else if (property == Property::Padding)
         {
             m_paddingCached = getSharedRenderer()->getPadding();
             setSize(m_size);
         }
-        else if (property == U"TextureHeaderBackground")
+        else if (property == Property::TextureHeaderBackground)
         {
             m_spriteHeaderBackground.setTexture(getSharedRenderer()->getTextureHeaderBackground());
         }
-        else if (property == U"TextureBackground")
+        else if (property == Property::TextureBackground)
         {
             m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
         }
-        else if (property == U"TextColor")
+        else if (property == Property::TextColor)
         {
             m_textColorCached = getSharedRenderer()->getTextColor();
             updateItemColors();
@@ -1687,22 +1699,22 @@ namespace tgui
             if (!m_headerTextColorCached.isSet())
                 updateHeaderTextsColor();
         }
-        else if (property == U"TextColorHover")
+        else if (property == Property::TextColorHover)
         {
             m_textColorHoverCached = getSharedRenderer()->getTextColorHover();
             updateItemColors();
         }
-        else if (property == U"SelectedTextColor")
+        else if (property == Property::SelectedTextColor)
         {
             m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
             updateItemColors();
         }
-        else if (property == U"SelectedTextColorHover")
+        else if (property == Property::SelectedTextColorHover)
         {
             m_selectedTextColorHoverCached = getSharedRenderer()->getSelectedTextColorHover();
             updateItemColors();
         }
-        else if (property == U"Scrollbar")
+        else if (property == Property::Scrollbar)
         {
             m_verticalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
             m_horizontalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
@@ -1715,51 +1727,51 @@ namespace tgui
                 setSize(m_size);
             }
         }
-        else if (property == U"ScrollbarWidth")
+        else if (property == Property::ScrollbarWidth)
         {
             const float width = (getSharedRenderer()->getScrollbarWidth() != 0) ? getSharedRenderer()->getScrollbarWidth() : m_verticalScrollbar->getDefaultWidth();
             m_verticalScrollbar->setSize({width, m_verticalScrollbar->getSize().y});
             m_horizontalScrollbar->setSize({m_verticalScrollbar->getSize().x, width});
             setSize(m_size);
         }
-        else if (property == U"BorderColor")
+        else if (property == Property::BorderColor)
         {
             m_borderColorCached = getSharedRenderer()->getBorderColor();
         }
-        else if (property == U"SeparatorColor")
+        else if (property == Property::SeparatorColor)
         {
             m_separatorColorCached = getSharedRenderer()->getSeparatorColor();
         }
-        else if (property == U"GridLinesColor")
+        else if (property == Property::GridLinesColor)
         {
             m_gridLinesColorCached = getSharedRenderer()->getGridLinesColor();
         }
-        else if (property == U"HeaderTextColor")
+        else if (property == Property::HeaderTextColor)
         {
             m_headerTextColorCached = getSharedRenderer()->getHeaderTextColor();
             updateHeaderTextsColor();
         }
-        else if (property == U"HeaderBackgroundColor")
+        else if (property == Property::HeaderBackgroundColor)
         {
             m_headerBackgroundColorCached = getSharedRenderer()->getHeaderBackgroundColor();
         }
-        else if (property == U"BackgroundColor")
+        else if (property == Property::BackgroundColor)
         {
             m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
         }
-        else if (property == U"BackgroundColorHover")
+        else if (property == Property::BackgroundColorHover)
         {
             m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
         }
-        else if (property == U"SelectedBackgroundColor")
+        else if (property == Property::SelectedBackgroundColor)
         {
             m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
         }
-        else if (property == U"SelectedBackgroundColorHover")
+        else if (property == Property::SelectedBackgroundColorHover)
         {
             m_selectedBackgroundColorHoverCached = getSharedRenderer()->getSelectedBackgroundColorHover();
         }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
+        else if ((property == Property::Opacity) || (property == Property::OpacityDisabled))
         {
             Widget::rendererChanged(property);
 
@@ -1773,25 +1785,18 @@ namespace tgui
                 column.text.setOpacity(m_opacityCached);
 
             for (auto& item : m_items)
-            {
-                for (auto& text : item.texts)
-                    text.setOpacity(m_opacityCached);
-
                 item.icon.setOpacity(m_opacityCached);
-            }
+
+            m_visibleItemTextsValid = false;
         }
-        else if (property == U"Font")
+        else if (property == Property::Font)
         {
             Widget::rendererChanged(property);
 
             for (auto& column : m_columns)
                 column.text.setFont(m_fontCached);
 
-            for (auto& item : m_items)
-            {
-                for (auto& text : item.texts)
-                    text.setFont(m_fontCached);
-            }
+            m_visibleItemTextsValid = false;
 
             if ((m_textSize == 0) && !getSharedRenderer()->getTextSize())
             {
@@ -1843,9 +1848,9 @@ namespace tgui
 
             if (!item.texts.empty())
             {
-                String textsList = "[" + Serializer::serialize(item.texts[0].getString());
+                String textsList = "[" + Serializer::serialize(item.texts[0].toString());
                 for (std::size_t i = 1; i < item.texts.size(); ++i)
-                    textsList += ", " + Serializer::serialize(item.texts[i].getString());
+                    textsList += ", " + Serializer::serialize(item.texts[i].toString());
                 textsList += "]";
 
                 itemNode->propertyValuePairs[U"Texts"] = std::make_unique<DataIO::ValueNode>(textsList);
@@ -2089,7 +2094,7 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Text ListView::createText(const String& caption)
+    Text ListView::createText(const String& caption) const
     {
         Text text;
         text.setFont(m_fontCached);
@@ -2122,8 +2127,55 @@ namespace tgui
 
     void ListView::setItemColor(std::size_t index, const Color& color)
     {
-        for (auto& text : m_items[index].texts)
+        if (!m_visibleItemTextsValid || (index < m_visibleItemTextsFirstItem) || (index >= m_visibleItemTextsFirstItem + m_visibleItemTexts.size()))
+            return;
+
+        for (auto& text : m_visibleItemTexts[index - m_visibleItemTextsFirstItem])
             text.setColor(color);
+
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float ListView::getItemTextWidth(const CompactString& caption) const
+    {
+        return Text::getLineWidth(caption.toString(), m_fontCached, m_textSizeCached);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::updateVisibleItemTexts(std::size_t firstItem, std::size_t lastItem) const
+    {
+        m_visibleItemTexts.resize(lastItem - firstItem);
+        for (std::size_t i = firstItem; i < lastItem; ++i)
+        {
+            Color color = m_textColorCached;
+            const bool hovered = (static_cast<int>(i) == m_hoveredItem);
+            if (m_selectedItems.find(i) != m_selectedItems.end())
+            {
+                if (hovered && m_selectedTextColorHoverCached.isSet())
+                    color = m_selectedTextColorHoverCached;
+                else if (m_selectedTextColorCached.isSet())
+                    color = m_selectedTextColorCached;
+                else if (hovered && m_textColorHoverCached.isSet())
+                    color = m_textColorHoverCached;
+            }
+            else if (hovered && m_textColorHoverCached.isSet())
+                color = m_textColorHoverCached;
+
+            auto& texts = m_visibleItemTexts[i - firstItem];
+            texts.clear();
+            texts.reserve(m_items[i].texts.size());
+            for (const auto& caption : m_items[i].texts)
+            {
+                texts.push_back(createText(caption.toString()));
+                texts.back().setColor(color);
+            }
+        }
+
+        m_visibleItemTextsFirstItem = firstItem;
+        m_visibleItemTextsValid = true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -2150,16 +2202,17 @@ namespace tgui
             if (m_textColorHoverCached.isSet())
                 setItemColor(static_cast<std::size_t>(m_hoveredItem), m_textColorHoverCached);
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void ListView::updateItemColors()
     {
-        for (std::size_t i = 0; i < m_items.size(); ++i)
-            setItemColor(i, m_textColorCached);
-
-        updateSelectedAndhoveredItemColors();
+        // The colors of the visible items will be set when their texts are recreated
+        m_visibleItemTextsValid = false;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -2271,7 +2324,7 @@ namespace tgui
             for (const auto& item : m_items)
             {
                 const float iconWidth = item.icon.isSet() ? item.icon.getSize().x + textPadding : 0;
-                const float itemWidth = item.texts[0].getSize().x + (textPadding * 2) + iconWidth;
+                const float itemWidth = getItemTextWidth(item.texts[0]) + (textPadding * 2) + iconWidth;
                 if (itemWidth > m_maxItemWidth)
                 {
                     m_maxItemWidth = itemWidth;
@@ -2287,7 +2340,7 @@ namespace tgui
                 if (item.texts.size() >= m_columns.size())
                 {
                     const float iconWidth = item.icon.isSet() ? item.icon.getSize().x + textPadding : 0;
-                    const float itemWidth = item.texts[0].getSize().x + (textPadding * 2) + iconWidth;
+                    const float itemWidth = getItemTextWidth(item.texts[0]) + (textPadding * 2) + iconWidth;
                     if (itemWidth > m_columns[0].maxItemWidth)
                     {
                         m_columns[0].maxItemWidth = itemWidth;
@@ -2306,7 +2359,7 @@ namespace tgui
                 if (item.texts.size() < m_columns.size())
                     continue;
 
-                const float itemWidth = item.texts[lastColumnIndex].getSize().x + (textPadding * 2);
+                const float itemWidth = getItemTextWidth(item.texts[lastColumnIndex]) + (textPadding * 2);
                 if (itemWidth > m_columns[lastColumnIndex].maxItemWidth)
                 {
                     m_columns[lastColumnIndex].maxItemWidth = itemWidth;
@@ -2428,6 +2481,8 @@ namespace tgui
             onItemSelect.emit(this, static_cast<int>(*m_selectedItems.begin()));
         else
             onItemSelect.emit(this, -1);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -2467,7 +2522,7 @@ namespace tgui
 
         const float textPadding = Text::getExtraHorizontalOffset(m_fontCached, m_textSizeCached);
         const float iconWidth = ((m_columns.empty() || m_columns.size() == 1) && columnIndex == 0 && item.icon.isSet()) ? item.icon.getSize().x + textPadding : 0;
-        return item.texts[columnIndex].getSize().x + (textPadding * 2) + iconWidth;
+        return getItemTextWidth(item.texts[columnIndex]) + (textPadding * 2) + iconWidth;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -2600,6 +2655,7 @@ namespace tgui
         if (m_verticalScrollbar->isShown())
             headerWidth -= m_verticalScrollbar->getSize().x;
         m_spriteHeaderBackground.setSize({headerWidth, getCurrentHeaderHeight()});
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -2724,7 +2780,8 @@ namespace tgui
         states.transform.translate({0, (requiredItemHeight * firstItem) - static_cast<float>(m_verticalScrollbar->getValue())});
         for (std::size_t i = firstItem; i < lastItem; ++i)
         {
-            if (column >= m_items[i].texts.size())
+            const auto& texts = m_visibleItemTexts[i - m_visibleItemTextsFirstItem];
+            if (column >= texts.size())
             {
                 states.transform.translate({0, static_cast<float>(requiredItemHeight)});
                 continue;
@@ -2734,12 +2791,12 @@ namespace tgui
             if ((column >= m_columns.size()) || (m_columns[column].alignment == ColumnAlignment::Left))
                 translateX = textPadding;
             else if (m_columns[column].alignment == ColumnAlignment::Center)
-                translateX = (columnWidth - m_items[i].texts[column].getSize().x) / 2.f;
+                translateX = (columnWidth - texts[column].getSize().x) / 2.f;
             else // if (m_columns[column].alignment == ColumnAlignment::Right)
-                translateX = columnWidth - textPadding - m_items[i].texts[column].getSize().x;
+                translateX = columnWidth - textPadding - texts[column].getSize().x;
 
             states.transform.translate({translateX, verticalTextOffset});
-            target.drawText(states, m_items[i].texts[column]);
+            target.drawText(states, texts[column]);
             states.transform.translate({-translateX, static_cast<float>(requiredItemHeight) - verticalTextOffset});
         }
 
@@ -2793,6 +2850,9 @@ namespace tgui
                 lastItem = m_items.size();
         }
 
+        if (!m_visibleItemTextsValid || (firstItem != m_visibleItemTextsFirstItem) || (lastItem - firstItem != m_visibleItemTexts.size()))
+            updateVisibleItemTexts(firstItem, lastItem);
+
         states.transform.translate({m_paddingCached.getLeft(), m_paddingCached.getTop()});
 
         // Draw the scrollbars
@@ -348,9 +348,20 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void MenuBar::invalidate()
+    {
+        Widget::invalidate();
+
+        // The open menu is drawn by the placeholder, which only has a parent while the menu is open
+        m_menuWidgetPlaceholder->invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void MenuBar::addMenu(const String& text)
     {
         createMenu(m_menus, text);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -382,6 +393,7 @@ namespace tgui
             return false;
 
         createMenu(menu->menuItems, hierarchy.back());
+        invalidate();
         return true;
     }
 
@@ -397,6 +409,7 @@ namespace tgui
             return false;
 
         menu->text.setString(text);
+        invalidate();
         return true;
     }
 
@@ -405,6 +418,7 @@ namespace tgui
     void MenuBar::removeAllMenus()
     {
         m_menus.clear();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -418,6 +432,7 @@ namespace tgui
 
             closeMenu();
             m_menus.erase(m_menus.begin() + static_cast<std::ptrdiff_t>(i));
+            invalidate();
             return true;
         }
 
@@ -439,7 +454,11 @@ namespace tgui
         if (hierarchy.size() < 2)
             return false;
 
-        return removeMenuImpl(hierarchy, removeParentsWhenEmpty, 0, m_menus);
+        if (!removeMenuImpl(hierarchy, removeParentsWhenEmpty, 0, m_menus))
+            return false;
+
+        invalidate();
+        return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -456,7 +475,11 @@ namespace tgui
         if (hierarchy.empty())
             return false;
 
-        return removeSubMenusImpl(hierarchy, 0, m_menus);
+        if (!removeSubMenusImpl(hierarchy, 0, m_menus))
+            return false;
+
+        invalidate();
+        return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -574,6 +597,7 @@ namespace tgui
     void MenuBar::setInvertedMenuDirection(bool invertDirection)
     {
         m_invertedMenuDirection = invertDirection;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -750,70 +774,70 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void MenuBar::rendererChanged(const String& property)
+    void MenuBar::rendererChanged(PropertyId property)
     {
-        if (property == U"TextColor")
+        if (property == Property::TextColor)
         {
             m_textColorCached = getSharedRenderer()->getTextColor();
             updateTextColors(m_menus, m_visibleMenu);
         }
-        else if (property == U"SelectedTextColor")
+        else if (property == Property::SelectedTextColor)
         {
             m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
             updateTextColors(m_menus, m_visibleMenu);
         }
-        else if (property == U"TextColorDisabled")
+        else if (property == Property::TextColorDisabled)
         {
             m_textColorDisabledCached = getSharedRenderer()->getTextColorDisabled();
             updateTextColors(m_menus, m_visibleMenu);
         }
-        else if (property == U"TextureBackground")
+        else if (property == Property::TextureBackground)
         {
             m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
         }
-        else if (property == U"TextureItemBackground")
+        else if (property == Property::TextureItemBackground)
         {
             m_spriteItemBackground.setTexture(getSharedRenderer()->getTextureItemBackground());
         }
-        else if (property == U"TextureSelectedItemBackground")
+        else if (property == Property::TextureSelectedItemBackground)
         {
             m_spriteSelectedItemBackground.setTexture(getSharedRenderer()->getTextureSelectedItemBackground());
         }
-        else if (property == U"BackgroundColor")
+        else if (property == Property::BackgroundColor)
         {
             m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
         }
-        else if (property == U"SelectedBackgroundColor")
+        else if (property == Property::SelectedBackgroundColor)
         {
             m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
         }
-        else if (property == U"DistanceToSide")
+        else if (property == Property::DistanceToSide)
         {
             m_distanceToSideCached = getSharedRenderer()->getDistanceToSide();
         }
-        else if (property == U"SeparatorColor")
+        else if (property == Property::SeparatorColor)
         {
             m_separatorColorCached = getSharedRenderer()->getSeparatorColor();
         }
-        else if (property == U"SeparatorThickness")
+        else if (property == Property::SeparatorThickness)
         {
             m_separatorThicknessCached = getSharedRenderer()->getSeparatorThickness();
         }
-        else if (property == U"SeparatorVerticalPadding")
+        else if (property == Property::SeparatorVerticalPadding)
         {
             m_separatorVerticalPaddingCached = getSharedRenderer()->getSeparatorVerticalPadding();
         }
-        else if (property == U"SeparatorSidePadding")
+        else if (property == Property::SeparatorSidePadding)
         {
             m_separatorSidePaddingCached = getSharedRenderer()->getSeparatorSidePadding();
         }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
+        else if ((property == Property::Opacity) || (property == Property::OpacityDisabled))
         {
             Widget::rendererChanged(property);
             updateTextOpacity(m_menus);
             m_spriteBackground.setOpacity(m_opacityCached);
         }
-        else if (property == U"Font")
+        else if (property == Property::Font)
         {
             Widget::rendererChanged(property);
             updateTextFont(m_menus);
@@ -1106,6 +1130,8 @@ namespace tgui
             menu.text.setColor(m_selectedTextColorCached);
         else
             menu.text.setColor(m_textColorCached);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
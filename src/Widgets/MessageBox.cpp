@@ -403,19 +403,19 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void MessageBox::rendererChanged(const String& property)
+    void MessageBox::rendererChanged(PropertyId property)
     {
-        if (property == U"TextColor")
+        if (property == Property::TextColor)
         {
             m_label->getRenderer()->setTextColor(getSharedRenderer()->getTextColor());
         }
-        else if (property == U"Button")
+        else if (property == Property::Button)
         {
             const auto& renderer = getSharedRenderer()->getButton();
             for (auto& button : m_buttons)
                 button->setRenderer(renderer);
         }
-        else if (property == U"Font")
+        else if (property == Property::Font)
         {
             ChildWindow::rendererChanged(property);
 
@@ -175,18 +175,18 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Picture::rendererChanged(const String& property)
+    void Picture::rendererChanged(PropertyId property)
     {
-        if (property == U"Texture")
+        if (property == Property::Texture)
         {
-            const auto& texture = getSharedRenderer()->getTexture();
+            const Texture texture = getSharedRenderer()->getTexture(); // Copy, setSize could change the renderer data
 
             if (!m_sprite.isSet() && m_size.x.isConstant() && m_size.y.isConstant() && (getSize() == Vector2f{0,0}))
                 setSize(Vector2f{texture.getImageSize()});
 
             m_sprite.setTexture(texture);
         }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
+        else if ((property == Property::Opacity) || (property == Property::OpacityDisabled))
         {
             Widget::rendererChanged(property);
             m_sprite.setOpacity(m_opacityCached);
@@ -214,6 +214,7 @@ namespace tgui
         m_textFront.setString(text);
 
         updateTextSize();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -265,14 +266,14 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ProgressBar::rendererChanged(const String& property)
+    void ProgressBar::rendererChanged(PropertyId property)
     {
-        if (property == U"Borders")
+        if (property == Property::Borders)
         {
             m_bordersCached = getSharedRenderer()->getBorders();
             setSize(m_size);
         }
-        else if ((property == U"TextColor") || (property == U"TextColorFilled"))
+        else if ((property == Property::TextColor) || (property == Property::TextColorFilled))
         {
             m_textBack.setColor(getSharedRenderer()->getTextColor());
 
@@ -281,33 +282,33 @@ namespace tgui
             else
                 m_textFront.setColor(getSharedRenderer()->getTextColor());
         }
-        else if (property == U"TextureBackground")
+        else if (property == Property::TextureBackground)
         {
             m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
         }
-        else if (property == U"TextureFill")
+        else if (property == Property::TextureFill)
         {
             m_spriteFill.setTexture(getSharedRenderer()->getTextureFill());
             recalculateFillSize();
         }
-        else if (property == U"TextStyle")
+        else if (property == Property::TextStyle)
         {
             m_textBack.setStyle(getSharedRenderer()->getTextStyle());
             m_textFront.setStyle(getSharedRenderer()->getTextStyle());
         }
-        else if (property == U"BorderColor")
+        else if (property == Property::BorderColor)
         {
             m_borderColorCached = getSharedRenderer()->getBorderColor();
         }
-        else if (property == U"BackgroundColor")
+        else if (property == Property::BackgroundColor)
         {
             m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
         }
-        else if (property == U"FillColor")
+        else if (property == Property::FillColor)
         {
             m_fillColorCached = getSharedRenderer()->getFillColor();
         }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
+        else if ((property == Property::Opacity) || (property == Property::OpacityDisabled))
         {
             Widget::rendererChanged(property);
 
@@ -317,7 +318,7 @@ namespace tgui
             m_textBack.setOpacity(m_opacityCached);
             m_textFront.setOpacity(m_opacityCached);
         }
-        else if (property == U"Font")
+        else if (property == Property::Font)
         {
             Widget::rendererChanged(property);
 
@@ -458,6 +459,8 @@ namespace tgui
 
         if (m_spriteFill.isSet())
             m_spriteFill.setVisibleRect(m_frontRect);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
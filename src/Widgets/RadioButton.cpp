@@ -163,6 +163,8 @@ namespace tgui
             m_text.setStyle(m_textStyleCheckedCached);
         else
             m_text.setStyle(m_textStyleCached);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -170,6 +172,7 @@ namespace tgui
     void RadioButton::setText(const String& text)
     {
         m_text.setString(text);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -287,20 +290,20 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void RadioButton::rendererChanged(const String& property)
+    void RadioButton::rendererChanged(PropertyId property)
     {
-        if (property == U"Borders")
+        if (property == Property::Borders)
         {
             m_bordersCached = getSharedRenderer()->getBorders();
             m_bordersCached.updateParentSize(getSize());
             updateTextureSizes();
         }
-        else if ((property == U"TextColor") || (property == U"TextColorHover") || (property == U"TextColorDisabled")
-              || (property == U"TextColorChecked") || (property == U"TextColorCheckedHover") || (property == U"TextColorCheckedDisabled"))
+        else if ((property == Property::TextColor) || (property == Property::TextColorHover) || (property == Property::TextColorDisabled)
+              || (property == Property::TextColorChecked) || (property == Property::TextColorCheckedHover) || (property == Property::TextColorCheckedDisabled))
         {
             updateTextColor();
         }
-        else if (property == U"TextStyle")
+        else if (property == Property::TextStyle)
         {
             m_textStyleCached = getSharedRenderer()->getTextStyle();
 
@@ -309,7 +312,7 @@ namespace tgui
             else
                 m_text.setStyle(m_textStyleCached);
         }
-        else if (property == U"TextStyleChecked")
+        else if (property == Property::TextStyleChecked)
         {
             m_textStyleCheckedCached = getSharedRenderer()->getTextStyleChecked();
 
@@ -318,113 +321,113 @@ namespace tgui
             else
                 m_text.setStyle(m_textStyleCached);
         }
-        else if (property == U"TextureUnchecked")
+        else if (property == Property::TextureUnchecked)
         {
             m_spriteUnchecked.setTexture(getSharedRenderer()->getTextureUnchecked());
             updateTextureSizes();
         }
-        else if (property == U"TextureChecked")
+        else if (property == Property::TextureChecked)
         {
             m_spriteChecked.setTexture(getSharedRenderer()->getTextureChecked());
             updateTextureSizes();
         }
-        else if (property == U"TextureUncheckedHover")
+        else if (property == Property::TextureUncheckedHover)
         {
             m_spriteUncheckedHover.setTexture(getSharedRenderer()->getTextureUncheckedHover());
         }
-        else if (property == U"TextureCheckedHover")
+        else if (property == Property::TextureCheckedHover)
         {
             m_spriteCheckedHover.setTexture(getSharedRenderer()->getTextureCheckedHover());
         }
-        else if (property == U"TextureUncheckedDisabled")
+        else if (property == Property::TextureUncheckedDisabled)
         {
             m_spriteUncheckedDisabled.setTexture(getSharedRenderer()->getTextureUncheckedDisabled());
         }
-        else if (property == U"TextureCheckedDisabled")
+        else if (property == Property::TextureCheckedDisabled)
         {
             m_spriteCheckedDisabled.setTexture(getSharedRenderer()->getTextureCheckedDisabled());
         }
-        else if (property == U"TextureUncheckedFocused")
+        else if (property == Property::TextureUncheckedFocused)
         {
             m_spriteUncheckedFocused.setTexture(getSharedRenderer()->getTextureUncheckedFocused());
         }
-        else if (property == U"TextureCheckedFocused")
+        else if (property == Property::TextureCheckedFocused)
         {
             m_spriteCheckedFocused.setTexture(getSharedRenderer()->getTextureCheckedFocused());
         }
-        else if (property == U"CheckColor")
+        else if (property == Property::CheckColor)
         {
             m_checkColorCached = getSharedRenderer()->getCheckColor();
         }
-        else if (property == U"CheckColorHover")
+        else if (property == Property::CheckColorHover)
         {
             m_checkColorHoverCached = getSharedRenderer()->getCheckColorHover();
         }
-        else if (property == U"CheckColorDisabled")
+        else if (property == Property::CheckColorDisabled)
         {
             m_checkColorDisabledCached = getSharedRenderer()->getCheckColorDisabled();
         }
-        else if (property == U"BorderColor")
+        else if (property == Property::BorderColor)
         {
             m_borderColorCached = getSharedRenderer()->getBorderColor();
         }
-        else if (property == U"BorderColorHover")
+        else if (property == Property::BorderColorHover)
         {
             m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
         }
-        else if (property == U"BorderColorDisabled")
+        else if (property == Property::BorderColorDisabled)
         {
             m_borderColorDisabledCached = getSharedRenderer()->getBorderColorDisabled();
         }
-        else if (property == U"BorderColorFocused")
+        else if (property == Property::BorderColorFocused)
         {
             m_borderColorFocusedCached = getSharedRenderer()->getBorderColorFocused();
         }
-        else if (property == U"BorderColorChecked")
+        else if (property == Property::BorderColorChecked)
         {
             m_borderColorCheckedCached = getSharedRenderer()->getBorderColorChecked();
         }
-        else if (property == U"BorderColorCheckedHover")
+        else if (property == Property::BorderColorCheckedHover)
         {
             m_borderColorCheckedHoverCached = getSharedRenderer()->getBorderColorCheckedHover();
         }
-        else if (property == U"BorderColorCheckedDisabled")
+        else if (property == Property::BorderColorCheckedDisabled)
         {
             m_borderColorCheckedDisabledCached = getSharedRenderer()->getBorderColorCheckedDisabled();
         }
-        else if (property == U"BorderColorCheckedFocused")
+        else if (property == Property::BorderColorCheckedFocused)
         {
             m_borderColorCheckedFocusedCached = getSharedRenderer()->getBorderColorCheckedFocused();
         }
-        else if (property == U"BackgroundColor")
+        else if (property == Property::BackgroundColor)
         {
             m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
         }
-        else if (property == U"BackgroundColorHover")
+        else if (property == Property::BackgroundColorHover)
         {
             m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
         }
-        else if (property == U"BackgroundColorDisabled")
+        else if (property == Property::BackgroundColorDisabled)
         {
             m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
         }
-        else if (property == U"BackgroundColorChecked")
+        else if (property == Property::BackgroundColorChecked)
         {
             m_backgroundColorCheckedCached = getSharedRenderer()->getBackgroundColorChecked();
         }
-        else if (property == U"BackgroundColorCheckedHover")
+        else if (property == Property::BackgroundColorCheckedHover)
         {
             m_backgroundColorCheckedHoverCached = getSharedRenderer()->getBackgroundColorCheckedHover();
         }
-        else if (property == U"BackgroundColorCheckedDisabled")
+        else if (property == Property::BackgroundColorCheckedDisabled)
         {
             m_backgroundColorCheckedDisabledCached = getSharedRenderer()->getBackgroundColorCheckedDisabled();
         }
-        else if (property == U"TextDistanceRatio")
+        else if (property == Property::TextDistanceRatio)
         {
             m_textDistanceRatioCached = getSharedRenderer()->getTextDistanceRatio();
         }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
+        else if ((property == Property::Opacity) || (property == Property::OpacityDisabled))
         {
             Widget::rendererChanged(property);
 
@@ -439,7 +442,7 @@ namespace tgui
 
             m_text.setOpacity(m_opacityCached);
         }
-        else if (property == U"Font")
+        else if (property == Property::Font)
         {
             Widget::rendererChanged(property);
 
@@ -480,6 +480,9 @@ namespace tgui
                         m_thumbs.second.left = (getSize().x / (m_maximum - m_minimum) * (m_selectionEnd - m_minimum)) - (m_thumbs.second.width / 2.0f);
                 }
             }
+
+            // The thumb moves with the mouse, even when the selection didn't change
+            invalidate();
         }
         else // Normal mouse move
         {
@@ -524,14 +527,14 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void RangeSlider::rendererChanged(const String& property)
+    void RangeSlider::rendererChanged(PropertyId property)
     {
-        if (property == U"Borders")
+        if (property == Property::Borders)
         {
             m_bordersCached = getSharedRenderer()->getBorders();
             setSize(m_size);
         }
-        else if (property == U"TextureTrack")
+        else if (property == Property::TextureTrack)
         {
             m_spriteTrack.setTexture(getSharedRenderer()->getTextureTrack());
 
@@ -542,63 +545,63 @@ namespace tgui
 
             setSize(m_size);
         }
-        else if (property == U"TextureTrackHover")
+        else if (property == Property::TextureTrackHover)
         {
             m_spriteTrackHover.setTexture(getSharedRenderer()->getTextureTrackHover());
         }
-        else if (property == U"TextureThumb")
+        else if (property == Property::TextureThumb)
         {
             m_spriteThumb.setTexture(getSharedRenderer()->getTextureThumb());
             setSize(m_size);
         }
-        else if (property == U"TextureThumbHover")
+        else if (property == Property::TextureThumbHover)
         {
             m_spriteThumbHover.setTexture(getSharedRenderer()->getTextureThumbHover());
             setSize(m_size);
         }
-        else if (property == U"TextureSelectedTrack")
+        else if (property == Property::TextureSelectedTrack)
         {
             m_spriteSelectedTrack.setTexture(getSharedRenderer()->getTextureSelectedTrack());
             setSize(m_size);
         }
-        else if (property == U"TextureSelectedTrackHover")
+        else if (property == Property::TextureSelectedTrackHover)
         {
             m_spriteSelectedTrackHover.setTexture(getSharedRenderer()->getTextureSelectedTrackHover());
             setSize(m_size);
         }
-        else if (property == U"TrackColor")
+        else if (property == Property::TrackColor)
         {
             m_trackColorCached = getSharedRenderer()->getTrackColor();
         }
-        else if (property == U"TrackColorHover")
+        else if (property == Property::TrackColorHover)
         {
             m_trackColorHoverCached = getSharedRenderer()->getTrackColorHover();
         }
-        else if (property == U"SelectedTrackColor")
+        else if (property == Property::SelectedTrackColor)
         {
             m_selectedTrackColorCached = getSharedRenderer()->getSelectedTrackColor();
         }
-        else if (property == U"SelectedTrackColorHover")
+        else if (property == Property::SelectedTrackColorHover)
         {
             m_selectedTrackColorHoverCached = getSharedRenderer()->getSelectedTrackColorHover();
         }
-        else if (property == U"ThumbColor")
+        else if (property == Property::ThumbColor)
         {
             m_thumbColorCached = getSharedRenderer()->getThumbColor();
         }
-        else if (property == U"ThumbColorHover")
+        else if (property == Property::ThumbColorHover)
         {
             m_thumbColorHoverCached = getSharedRenderer()->getThumbColorHover();
         }
-        else if (property == U"BorderColor")
+        else if (property == Property::BorderColor)
         {
             m_borderColorCached = getSharedRenderer()->getBorderColor();
         }
-        else if (property == U"BorderColorHover")
+        else if (property == Property::BorderColorHover)
         {
             m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
         }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
+        else if ((property == Property::Opacity) || (property == Property::OpacityDisabled))
         {
             Widget::rendererChanged(property);
 
@@ -697,6 +700,8 @@ namespace tgui
             if (m_spriteSelectedTrackHover.isSet())
                 m_spriteSelectedTrackHover.setVisibleRect(m_spriteSelectedTrack.getVisibleRect());
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -76,9 +76,9 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void RichTextLabel::rendererChanged(const String& property)
+    void RichTextLabel::rendererChanged(PropertyId property)
     {
-        if (property == U"TextColor")
+        if (property == Property::TextColor)
         {
             m_textColorCached = getSharedRenderer()->getTextColor();
             rearrangeText();
@@ -441,6 +441,7 @@ namespace tgui
     void ScrollablePanel::setVerticalScrollbarValue(unsigned int value)
     {
         m_verticalScrollbar->setValue(value);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -455,6 +456,7 @@ namespace tgui
     void ScrollablePanel::setHorizontalScrollbarValue(unsigned int value)
     {
         m_horizontalScrollbar->setValue(value);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -488,6 +490,9 @@ namespace tgui
             Panel::leftMousePressed({pos.x + static_cast<float>(m_horizontalScrollbar->getValue()),
                                      pos.y + static_cast<float>(m_verticalScrollbar->getValue())});
         }
+
+        if (m_verticalScrollbar->wasInvalidated() || m_horizontalScrollbar->wasInvalidated())
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -503,6 +508,9 @@ namespace tgui
             Panel::leftMouseReleased({pos.x + static_cast<float>(m_horizontalScrollbar->getValue()),
                                       pos.y + static_cast<float>(m_verticalScrollbar->getValue())});
         }
+
+        if (m_verticalScrollbar->wasInvalidated() || m_horizontalScrollbar->wasInvalidated())
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -529,6 +537,9 @@ namespace tgui
             m_verticalScrollbar->mouseNoLongerOnWidget();
             m_horizontalScrollbar->mouseNoLongerOnWidget();
         }
+
+        if (m_verticalScrollbar->wasInvalidated() || m_horizontalScrollbar->wasInvalidated())
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -580,6 +591,9 @@ namespace tgui
             m_lastSuccessfulScrollTime = std::chrono::steady_clock::now();
         }
 
+        if (m_verticalScrollbar->wasInvalidated() || m_horizontalScrollbar->wasInvalidated())
+            invalidate();
+
         return scrollbarMoved;
     }
 
@@ -590,6 +604,9 @@ namespace tgui
         Panel::mouseNoLongerOnWidget();
         m_verticalScrollbar->mouseNoLongerOnWidget();
         m_horizontalScrollbar->mouseNoLongerOnWidget();
+
+        if (m_verticalScrollbar->wasInvalidated() || m_horizontalScrollbar->wasInvalidated())
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -599,6 +616,9 @@ namespace tgui
         Panel::leftMouseButtonNoLongerDown();
         m_verticalScrollbar->leftMouseButtonNoLongerDown();
         m_horizontalScrollbar->leftMouseButtonNoLongerDown();
+
+        if (m_verticalScrollbar->wasInvalidated() || m_horizontalScrollbar->wasInvalidated())
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -692,9 +712,9 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ScrollablePanel::rendererChanged(const String& property)
+    void ScrollablePanel::rendererChanged(PropertyId property)
     {
-        if (property == U"Scrollbar")
+        if (property == Property::Scrollbar)
         {
             m_verticalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
             m_horizontalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
@@ -708,7 +728,7 @@ namespace tgui
                 updateScrollbars();
             }
         }
-        else if (property == U"ScrollbarWidth")
+        else if (property == Property::ScrollbarWidth)
         {
             const float width = (getSharedRenderer()->getScrollbarWidth() != 0) ? getSharedRenderer()->getScrollbarWidth() : m_verticalScrollbar->getDefaultWidth();
             m_verticalScrollbar->setSize({width, m_verticalScrollbar->getSize().y});
@@ -835,6 +855,8 @@ namespace tgui
 
         if (m_horizontalScrollAmount == 0)
             setHorizontalScrollAmount(0);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -116,6 +116,7 @@ namespace tgui
 
         // Recalculate the size and position of the thumb image
         updateSize();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -143,6 +144,7 @@ namespace tgui
 
             // Recalculate the size and position of the thumb image
             updateSize();
+            invalidate();
         }
     }
 
@@ -168,6 +170,7 @@ namespace tgui
 
         // Recalculate the size and position of the thumb image
         updateSize();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -196,6 +199,7 @@ namespace tgui
     void Scrollbar::setAutoHide(bool autoHide)
     {
         m_autoHide = autoHide;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -403,6 +407,9 @@ namespace tgui
 
     void Scrollbar::mouseMoved(Vector2f pos)
     {
+        const Part oldHoverPart = m_mouseHoverOverPart;
+        const FloatRect oldThumb = m_thumb;
+
         // When dragging the scrollbar we can pass here without the mouse being on top of the scrollbar
         if (isMouseOnWidget(pos))
         {
@@ -581,6 +588,10 @@ namespace tgui
             m_mouseHoverOverPart = Part::ArrowUp;
         else if (FloatRect{m_arrowDown.left, m_arrowDown.top, m_arrowDown.width, m_arrowDown.height}.contains(pos))
             m_mouseHoverOverPart = Part::ArrowDown;
+
+        // The thumb can move while dragging without the value changing
+        if ((m_mouseHoverOverPart != oldHoverPart) || (m_thumb != oldThumb))
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -795,9 +806,9 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Scrollbar::rendererChanged(const String& property)
+    void Scrollbar::rendererChanged(PropertyId property)
     {
-        if (property == U"TextureTrack")
+        if (property == Property::TextureTrack)
         {
             m_spriteTrack.setTexture(getSharedRenderer()->getTextureTrack());
             if (m_sizeSet)
@@ -812,70 +823,70 @@ namespace tgui
                 m_sizeSet = false;
             }
         }
-        else if (property == U"TextureTrackHover")
+        else if (property == Property::TextureTrackHover)
         {
             m_spriteTrackHover.setTexture(getSharedRenderer()->getTextureTrackHover());
         }
-        else if (property == U"TextureThumb")
+        else if (property == Property::TextureThumb)
         {
             m_spriteThumb.setTexture(getSharedRenderer()->getTextureThumb());
             updateSize();
         }
-        else if (property == U"TextureThumbHover")
+        else if (property == Property::TextureThumbHover)
         {
             m_spriteThumbHover.setTexture(getSharedRenderer()->getTextureThumbHover());
         }
-        else if (property == U"TextureArrowUp")
+        else if (property == Property::TextureArrowUp)
         {
             m_spriteArrowUp.setTexture(getSharedRenderer()->getTextureArrowUp());
             updateSize();
         }
-        else if (property == U"TextureArrowUpHover")
+        else if (property == Property::TextureArrowUpHover)
         {
             m_spriteArrowUpHover.setTexture(getSharedRenderer()->getTextureArrowUpHover());
         }
-        else if (property == U"TextureArrowDown")
+        else if (property == Property::TextureArrowDown)
         {
             m_spriteArrowDown.setTexture(getSharedRenderer()->getTextureArrowDown());
             updateSize();
         }
-        else if (property == U"TextureArrowDownHover")
+        else if (property == Property::TextureArrowDownHover)
         {
             m_spriteArrowDownHover.setTexture(getSharedRenderer()->getTextureArrowDownHover());
         }
-        else if (property == U"TrackColor")
+        else if (property == Property::TrackColor)
         {
             m_trackColorCached = getSharedRenderer()->getTrackColor();
         }
-        else if (property == U"TrackColorHover")
+        else if (property == Property::TrackColorHover)
         {
             m_trackColorHoverCached = getSharedRenderer()->getTrackColorHover();
         }
-        else if (property == U"ThumbColor")
+        else if (property == Property::ThumbColor)
         {
             m_thumbColorCached = getSharedRenderer()->getThumbColor();
         }
-        else if (property == U"ThumbColorHover")
+        else if (property == Property::ThumbColorHover)
         {
             m_thumbColorHoverCached = getSharedRenderer()->getThumbColorHover();
         }
-        else if (property == U"ArrowBackgroundColor")
+        else if (property == Property::ArrowBackgroundColor)
         {
             m_arrowBackgroundColorCached = getSharedRenderer()->getArrowBackgroundColor();
         }
-        else if (property == U"ArrowBackgroundColorHover")
+        else if (property == Property::ArrowBackgroundColorHover)
         {
             m_arrowBackgroundColorHoverCached = getSharedRenderer()->getArrowBackgroundColorHover();
         }
-        else if (property == U"ArrowColor")
+        else if (property == Property::ArrowColor)
         {
             m_arrowColorCached = getSharedRenderer()->getArrowColor();
         }
-        else if (property == U"ArrowColorHover")
+        else if (property == Property::ArrowColorHover)
         {
             m_arrowColorHoverCached = getSharedRenderer()->getArrowColorHover();
         }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
+        else if ((property == Property::Opacity) || (property == Property::OpacityDisabled))
         {
             Widget::rendererChanged(property);
 
@@ -945,6 +956,8 @@ namespace tgui
             else
                 m_thumb.left = m_track.left;
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1095,6 +1108,23 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ScrollbarChildWidget::invalidate()
+    {
+        m_invalidated = true;
+        Scrollbar::invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ScrollbarChildWidget::wasInvalidated()
+    {
+        const bool invalidated = m_invalidated;
+        m_invalidated = false;
+        return invalidated;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ScrollbarChildWidget::draw(BackendRenderTarget& target, RenderStates states) const
     {
         states.transform.translate(getPosition());
@@ -87,9 +87,9 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void SeparatorLine::rendererChanged(const String& property)
+    void SeparatorLine::rendererChanged(PropertyId property)
     {
-        if (property == U"Color")
+        if (property == Property::Color)
             m_colorCached = getSharedRenderer()->getColor();
     }
 
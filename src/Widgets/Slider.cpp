@@ -481,6 +481,9 @@ namespace tgui
             else
                 updateThumbPosition();
         }
+
+        // The thumb moves with the mouse, even when the value didn't change
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -539,14 +542,14 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Slider::rendererChanged(const String& property)
+    void Slider::rendererChanged(PropertyId property)
     {
-        if (property == U"Borders")
+        if (property == Property::Borders)
         {
             m_bordersCached = getSharedRenderer()->getBorders();
             setSize(m_size);
         }
-        else if (property == U"TextureTrack")
+        else if (property == Property::TextureTrack)
         {
             m_spriteTrack.setTexture(getSharedRenderer()->getTextureTrack());
 
@@ -557,49 +560,49 @@ namespace tgui
 
             setSize(m_size);
         }
-        else if (property == U"TextureTrackHover")
+        else if (property == Property::TextureTrackHover)
         {
             m_spriteTrackHover.setTexture(getSharedRenderer()->getTextureTrackHover());
         }
-        else if (property == U"TextureThumb")
+        else if (property == Property::TextureThumb)
         {
             m_spriteThumb.setTexture(getSharedRenderer()->getTextureThumb());
             setSize(m_size);
         }
-        else if (property == U"TextureThumbHover")
+        else if (property == Property::TextureThumbHover)
         {
             m_spriteThumbHover.setTexture(getSharedRenderer()->getTextureThumbHover());
         }
-        else if (property == U"TrackColor")
+        else if (property == Property::TrackColor)
         {
             m_trackColorCached = getSharedRenderer()->getTrackColor();
         }
-        else if (property == U"TrackColorHover")
+        else if (property == Property::TrackColorHover)
         {
             m_trackColorHoverCached = getSharedRenderer()->getTrackColorHover();
         }
-        else if (property == U"ThumbColor")
+        else if (property == Property::ThumbColor)
         {
             m_thumbColorCached = getSharedRenderer()->getThumbColor();
         }
-        else if (property == U"ThumbColorHover")
+        else if (property == Property::ThumbColorHover)
         {
             m_thumbColorHoverCached = getSharedRenderer()->getThumbColorHover();
         }
-        else if (property == U"BorderColor")
+        else if (property == Property::BorderColor)
         {
             m_borderColorCached = getSharedRenderer()->getBorderColor();
         }
-        else if (property == U"BorderColorHover")
+        else if (property == Property::BorderColorHover)
         {
             m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
         }
-        else if (property == U"ThumbWithinTrack")
+        else if (property == Property::ThumbWithinTrack)
         {
             m_thumbWithinTrackCached = getSharedRenderer()->getThumbWithinTrack();
             updateThumbPosition();
         }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
+        else if ((property == Property::Opacity) || (property == Property::OpacityDisabled))
         {
             Widget::rendererChanged(property);
 
@@ -682,6 +685,8 @@ namespace tgui
             if (m_invertedDirection)
                 m_thumb.left = getSize().x - m_thumb.left - m_thumb.width;
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
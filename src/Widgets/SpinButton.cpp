@@ -283,6 +283,8 @@ namespace tgui
 
     void SpinButton::mouseMoved(Vector2f pos)
     {
+        const bool wasHoverOnTopArrow = m_mouseHoverOnTopArrow;
+
         // Check if the mouse is on top of the upper/right arrow
         if (m_verticalScroll)
         {
@@ -301,6 +303,8 @@ namespace tgui
 
         if (!m_mouseHover)
             mouseEnteredWidget();
+        else if (m_mouseHoverOnTopArrow != wasHoverOnTopArrow)
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -315,55 +319,55 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void SpinButton::rendererChanged(const String& property)
+    void SpinButton::rendererChanged(PropertyId property)
     {
-        if (property == U"Borders")
+        if (property == Property::Borders)
         {
             m_bordersCached = getSharedRenderer()->getBorders();
             setSize(m_size);
         }
-        else if (property == U"BorderBetweenArrows")
+        else if (property == Property::BorderBetweenArrows)
         {
             m_borderBetweenArrowsCached = getSharedRenderer()->getBorderBetweenArrows();
             setSize(m_size);
         }
-        else if (property == U"TextureArrowUp")
+        else if (property == Property::TextureArrowUp)
         {
             m_spriteArrowUp.setTexture(getSharedRenderer()->getTextureArrowUp());
         }
-        else if (property == U"TextureArrowUpHover")
+        else if (property == Property::TextureArrowUpHover)
         {
             m_spriteArrowUpHover.setTexture(getSharedRenderer()->getTextureArrowUpHover());
         }
-        else if (property == U"TextureArrowDown")
+        else if (property == Property::TextureArrowDown)
         {
             m_spriteArrowDown.setTexture(getSharedRenderer()->getTextureArrowDown());
         }
-        else if (property == U"TextureArrowDownHover")
+        else if (property == Property::TextureArrowDownHover)
         {
             m_spriteArrowDownHover.setTexture(getSharedRenderer()->getTextureArrowDownHover());
         }
-        else if (property == U"BorderColor")
+        else if (property == Property::BorderColor)
         {
             m_borderColorCached = getSharedRenderer()->getBorderColor();
         }
-        else if (property == U"BackgroundColor")
+        else if (property == Property::BackgroundColor)
         {
             m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
         }
-        else if (property == U"BackgroundColorHover")
+        else if (property == Property::BackgroundColorHover)
         {
             m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
         }
-        else if (property == U"ArrowColor")
+        else if (property == Property::ArrowColor)
         {
             m_arrowColorCached = getSharedRenderer()->getArrowColor();
         }
-        else if (property == U"ArrowColorHover")
+        else if (property == Property::ArrowColorHover)
         {
             m_arrowColorHoverCached = getSharedRenderer()->getArrowColorHover();
         }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
+        else if ((property == Property::Opacity) || (property == Property::OpacityDisabled))
         {
             Widget::rendererChanged(property);
 
@@ -538,6 +538,7 @@ namespace tgui
         }
 
         m_bordersCached.updateParentSize(getSize());
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -552,100 +553,100 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Tabs::rendererChanged(const String& property)
+    void Tabs::rendererChanged(PropertyId property)
     {
-        if (property == U"Borders")
+        if (property == Property::Borders)
         {
             m_bordersCached = getSharedRenderer()->getBorders();
             recalculateTabsWidth();
         }
-        else if (property == U"TextColor")
+        else if (property == Property::TextColor)
         {
             m_textColorCached = getSharedRenderer()->getTextColor();
             updateTextColors();
         }
-        else if (property == U"TextColorHover")
+        else if (property == Property::TextColorHover)
         {
             m_textColorHoverCached = getSharedRenderer()->getTextColorHover();
             updateTextColors();
         }
-        else if (property == U"TextColorDisabled")
+        else if (property == Property::TextColorDisabled)
         {
             m_textColorDisabledCached = getSharedRenderer()->getTextColorDisabled();
             updateTextColors();
         }
-        else if (property == U"SelectedTextColor")
+        else if (property == Property::SelectedTextColor)
         {
             m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
             updateTextColors();
         }
-        else if (property == U"SelectedTextColorHover")
+        else if (property == Property::SelectedTextColorHover)
         {
             m_selectedTextColorHoverCached = getSharedRenderer()->getSelectedTextColorHover();
             updateTextColors();
         }
-        else if (property == U"TextureTab")
+        else if (property == Property::TextureTab)
         {
             m_spriteTab.setTexture(getSharedRenderer()->getTextureTab());
         }
-        else if (property == U"TextureTabHover")
+        else if (property == Property::TextureTabHover)
         {
             m_spriteTabHover.setTexture(getSharedRenderer()->getTextureTabHover());
         }
-        else if (property == U"TextureSelectedTab")
+        else if (property == Property::TextureSelectedTab)
         {
             m_spriteSelectedTab.setTexture(getSharedRenderer()->getTextureSelectedTab());
         }
-        else if (property == U"TextureSelectedTabHover")
+        else if (property == Property::TextureSelectedTabHover)
         {
             m_spriteSelectedTabHover.setTexture(getSharedRenderer()->getTextureSelectedTabHover());
         }
-        else if (property == U"TextureDisabledTab")
+        else if (property == Property::TextureDisabledTab)
         {
             m_spriteDisabledTab.setTexture(getSharedRenderer()->getTextureDisabledTab());
         }
-        else if (property == U"DistanceToSide")
+        else if (property == Property::DistanceToSide)
         {
             m_distanceToSideCached = getSharedRenderer()->getDistanceToSide();
             recalculateTabsWidth();
         }
-        else if (property == U"BackgroundColor")
+        else if (property == Property::BackgroundColor)
         {
             m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
         }
-        else if (property == U"BackgroundColorHover")
+        else if (property == Property::BackgroundColorHover)
         {
             m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
         }
-        else if (property == U"BackgroundColorDisabled")
+        else if (property == Property::BackgroundColorDisabled)
         {
             m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
         }
-        else if (property == U"SelectedBackgroundColor")
+        else if (property == Property::SelectedBackgroundColor)
         {
             m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
         }
-        else if (property == U"SelectedBackgroundColorHover")
+        else if (property == Property::SelectedBackgroundColorHover)
         {
             m_selectedBackgroundColorHoverCached = getSharedRenderer()->getSelectedBackgroundColorHover();
         }
-        else if (property == U"BorderColor")
+        else if (property == Property::BorderColor)
         {
             m_borderColorCached = getSharedRenderer()->getBorderColor();
         }
-        else if (property == U"BorderColorHover")
+        else if (property == Property::BorderColorHover)
         {
             m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
         }
-        else if (property == U"SelectedBorderColor")
+        else if (property == Property::SelectedBorderColor)
         {
             m_selectedBorderColorCached = getSharedRenderer()->getSelectedBorderColor();
         }
-        else if (property == U"SelectedBorderColorHover")
+        else if (property == Property::SelectedBorderColorHover)
         {
             m_selectedBorderColorHoverCached = getSharedRenderer()->getSelectedBorderColorHover();
         }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
+        else if ((property == Property::Opacity) || (property == Property::OpacityDisabled))
         {
             Widget::rendererChanged(property);
 
@@ -658,7 +659,7 @@ namespace tgui
             for (auto& tab : m_tabs)
                 tab.text.setOpacity(m_opacityCached);
         }
-        else if (property == U"Font")
+        else if (property == Property::Font)
         {
             Widget::rendererChanged(property);
 
@@ -799,6 +800,8 @@ namespace tgui
                     m_tabs[static_cast<std::size_t>(m_hoveringTab)].text.setColor(m_textColorHoverCached);
             }
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
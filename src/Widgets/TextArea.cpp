@@ -29,6 +29,7 @@
 
 #if !TGUI_EXPERIMENTAL_USE_STD_MODULE
     #include <cmath>
+    #include <limits>
 #endif
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -137,27 +138,80 @@ namespace tgui
 
         // Remove all the excess characters when a character limit is set
         if ((m_maxChars > 0) && (text.length() > m_maxChars))
-            m_text = text.toUtf32().substr(0, m_maxChars);
-        else
-            m_text = text.toUtf32();
+            text.erase(m_maxChars);
 
+        m_mappedFile = nullptr;
+        m_wordWrapper.setText(text);
         rearrangeText(false);
 
-        onTextChange.emit(this, m_text);
+        onTextChange.emit(this, text);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void TextArea::addText(String text)
     {
-        setText(m_text + std::move(text));
+        if (m_mappedFile)
+            return;
+
+        // Don't allow the text to contain carriage returns
+        text.replace('\r', U"");
+
+        // Remove all the excess characters when a character limit is set
+        const std::size_t textLength = m_wordWrapper.getTextLength();
+        if ((m_maxChars > 0) && (textLength + text.length() > m_maxChars))
+            text.erase(m_maxChars - std::min(textLength, m_maxChars));
+
+        // Only the last paragraph and the new ones have to be word-wrapped
+        m_wordWrapper.appendText(text);
+        rearrangeText(false);
+
+        emitTextChange();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     String TextArea::getText() const
     {
-        return m_text;
+        if (m_mappedFile)
+            return m_mappedFile->getText();
+
+        return m_wordWrapper.getText();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextArea::openFile(const String& filename)
+    {
+        auto file = std::make_shared<MappedTextFile>();
+        if (!file->open(filename))
+            throw Exception{U"Failed to open '" + filename + U"' in TextArea."};
+
+        m_mappedFile = std::move(file);
+        m_wordWrapper.setText(U"");
+        m_maxLineWidth = 0;
+
+        m_verticalScrollbar->setValue(0);
+        m_horizontalScrollbar->setValue(0);
+        rearrangeText(false);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextArea::closeFile()
+    {
+        if (!m_mappedFile)
+            return;
+
+        m_mappedFile = nullptr;
+        rearrangeText(false);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextArea::isFileOpen() const
+    {
+        return m_mappedFile != nullptr;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -165,6 +219,7 @@ namespace tgui
     void TextArea::setDefaultText(const String& text)
     {
         m_defaultText.setString(text);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -192,9 +247,9 @@ namespace tgui
         const std::size_t selStart = getSelectionStart();
         const std::size_t selEnd = getSelectionEnd();
         if (selStart <= selEnd)
-            return m_text.substr(selStart, selEnd - selStart);
+            return m_wordWrapper.getSubstring(selStart, selEnd - selStart);
         else
-            return m_text.substr(selEnd, selStart - selEnd);
+            return m_wordWrapper.getSubstring(selEnd, selStart - selEnd);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -243,10 +298,10 @@ namespace tgui
         m_maxChars = maxChars;
 
         // If there is a character limit then check if it is exceeded
-        if ((m_maxChars > 0) && (m_text.length() > m_maxChars))
+        if ((m_maxChars > 0) && (m_wordWrapper.getTextLength() > m_maxChars))
         {
             // Remove all the excess characters
-            m_text.erase(m_maxChars, String::npos);
+            m_wordWrapper.eraseText(m_maxChars);
             rearrangeText(false);
         }
     }
@@ -325,29 +380,13 @@ namespace tgui
     void TextArea::setCaretPosition(std::size_t charactersBeforeCaret)
     {
         // The caret position has to stay inside the string
-        if (charactersBeforeCaret > m_text.length())
-            charactersBeforeCaret = m_text.length();
+        if (charactersBeforeCaret > m_wordWrapper.getTextLength())
+            charactersBeforeCaret = m_wordWrapper.getTextLength();
 
         // Find the line and position on that line on which the caret is located
-        std::size_t count = 0;
-        for (std::size_t i = 0; i < m_lines.size(); ++i)
-        {
-            if (count + m_lines[i].length() < charactersBeforeCaret)
-            {
-                count += m_lines[i].length();
-                if ((count < m_text.length()) && (m_text[count] == U'\n'))
-                    count += 1;
-            }
-            else
-            {
-                m_selStart.y = i;
-                m_selStart.x = charactersBeforeCaret - count;
-
-                m_selEnd = m_selStart;
-                updateSelectionTexts();
-                break;
-            }
-        }
+        m_selStart = m_wordWrapper.getPositionOfIndex(charactersBeforeCaret);
+        m_selEnd = m_selStart;
+        updateSelectionTexts();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -375,7 +414,10 @@ namespace tgui
 
     std::size_t TextArea::getLinesCount() const
     {
-        return m_lines.size();
+        if (m_mappedFile)
+            return m_mappedFile->getLineCount();
+
+        return m_wordWrapper.getLineCount();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -419,6 +461,8 @@ namespace tgui
     void TextArea::setVerticalScrollbarValue(unsigned int value)
     {
         m_verticalScrollbar->setValue(value);
+        recalculateVisibleLines();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -433,6 +477,7 @@ namespace tgui
     void TextArea::setHorizontalScrollbarValue(unsigned int value)
     {
         m_horizontalScrollbar->setValue(value);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -472,11 +517,13 @@ namespace tgui
         else if (m_horizontalScrollbar->isShown() && m_horizontalScrollbar->isMouseOnWidget(pos))
         {
             m_horizontalScrollbar->leftMousePressed(pos);
+            if (m_horizontalScrollbar->wasInvalidated())
+                invalidate();
         }
         else // The click occurred on the text area
         {
-            // Don't continue when line height is 0
-            if (m_lineHeight == 0)
+            // Don't continue when line height is 0 or when there is no caret because a file is shown
+            if ((m_lineHeight == 0) || m_mappedFile)
                 return;
 
             const auto caretPosition = findCaretPosition(pos);
@@ -487,15 +534,17 @@ namespace tgui
                 // The next click is going to be a normal one again
                 m_possibleDoubleClick = false;
 
+                const String line = m_wordWrapper.getLine(m_selStart.y);
+
                 // If the click was to the right of the end of line then make sure to select the word on the left
-                if (m_lines[m_selStart.y].length() > 1 && (m_selStart.x == (m_lines[m_selStart.y].length()-1) || m_selStart.x == m_lines[m_selStart.y].length()))
+                if (line.length() > 1 && (m_selStart.x == (line.length()-1) || m_selStart.x == line.length()))
                 {
                     m_selStart.x--;
                     m_selEnd.x = m_selStart.x;
                 }
 
                 bool selectingWhitespace;
-                if (isWhitespace(m_lines[m_selStart.y][m_selStart.x]))
+                if (isWhitespace(line[m_selStart.x]))
                     selectingWhitespace = true;
                 else
                     selectingWhitespace = false;
@@ -503,7 +552,7 @@ namespace tgui
                 // Move start pointer to the beginning of the word/whitespace
                 for (std::size_t i = m_selStart.x; i > 0; --i)
                 {
-                    if (selectingWhitespace != isWhitespace(m_lines[m_selStart.y][i-1]))
+                    if (selectingWhitespace != isWhitespace(line[i-1]))
                     {
                         m_selStart.x = i;
                         break;
@@ -513,15 +562,15 @@ namespace tgui
                 }
 
                 // Move end pointer to the end of the word/whitespace
-                for (std::size_t i = m_selEnd.x; i < m_lines[m_selEnd.y].length(); ++i)
+                for (std::size_t i = m_selEnd.x; i < line.length(); ++i)
                 {
-                    if (selectingWhitespace != isWhitespace(m_lines[m_selEnd.y][i]))
+                    if (selectingWhitespace != isWhitespace(line[i]))
                     {
                         m_selEnd.x = i;
                         break;
                     }
                     else
-                        m_selEnd.x = m_lines[m_selEnd.y].length();
+                        m_selEnd.x = line.length();
                 }
             }
             else // No double clicking
@@ -564,6 +613,9 @@ namespace tgui
             if (m_horizontalScrollbar->isMouseDown())
                 m_horizontalScrollbar->leftMouseReleased(pos - getPosition());
         }
+
+        if (m_verticalScrollbar->wasInvalidated() || m_horizontalScrollbar->wasInvalidated())
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -592,7 +644,7 @@ namespace tgui
         }
 
         // If the mouse is held down then you are selecting text
-        else if (m_mouseDown)
+        else if (m_mouseDown && !m_mappedFile)
         {
             auto caretPosition = findCaretPosition(pos);
             if (caretPosition != m_selEnd)
@@ -619,6 +671,9 @@ namespace tgui
             m_verticalScrollbar->mouseNoLongerOnWidget();
             m_horizontalScrollbar->mouseNoLongerOnWidget();
         }
+
+        if (m_verticalScrollbar->wasInvalidated() || m_horizontalScrollbar->wasInvalidated())
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -633,6 +688,9 @@ namespace tgui
 
         if (m_horizontalScrollbar->isShown())
             m_horizontalScrollbar->mouseNoLongerOnWidget();
+
+        if (m_verticalScrollbar->wasInvalidated() || m_horizontalScrollbar->wasInvalidated())
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -646,12 +704,21 @@ namespace tgui
 
         if (m_horizontalScrollbar->isShown())
             m_horizontalScrollbar->leftMouseButtonNoLongerDown();
+
+        if (m_verticalScrollbar->wasInvalidated() || m_horizontalScrollbar->wasInvalidated())
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void TextArea::keyPressed(const Event::KeyEvent& event)
     {
+        if (m_mappedFile)
+        {
+            scrollFileWithKey(event);
+            return;
+        }
+
         if (event.code == tgui::Event::KeyboardKey::Tab)
             textEntered('\t');
         else if (event.code == tgui::Event::KeyboardKey::Enter)
@@ -690,11 +757,11 @@ namespace tgui
             else if (keyboard::isKeyPressMoveCaretLineStart(event))
                 m_selEnd.x = 0;
             else if (keyboard::isKeyPressMoveCaretLineEnd(event))
-                m_selEnd.x = m_lines[m_selEnd.y].length();
+                m_selEnd.x = m_wordWrapper.getLineLength(m_selEnd.y);
             else if (keyboard::isKeyPressMoveCaretDocumentBegin(event))
                 m_selEnd = {0, 0};
             else if (keyboard::isKeyPressMoveCaretDocumentEnd(event))
-                m_selEnd = {m_lines[m_lines.size()-1].length(), m_lines.size()-1};
+                m_selEnd = m_wordWrapper.getPositionOfIndex(m_wordWrapper.getTextLength());
             else
                 caretMoved = false;
 
@@ -710,13 +777,14 @@ namespace tgui
         // The caret should be visible again
         m_caretVisible = true;
         m_animationTimeElapsed = {};
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void TextArea::textEntered(char32_t key)
     {
-        if (m_readOnly)
+        if (m_readOnly || m_mappedFile)
             return;
 
         // Don't allow carriage return characters, they only cause trouble
@@ -724,7 +792,7 @@ namespace tgui
             return;
 
         // Make sure we don't exceed our maximum characters limit
-        if ((m_maxChars > 0) && (m_text.length() + 1 > m_maxChars))
+        if ((m_maxChars > 0) && (m_wordWrapper.getTextLength() + 1 > m_maxChars))
             return;
 
         auto insert = TGUI_LAMBDA_CAPTURE_EQ_THIS()
@@ -733,17 +801,11 @@ namespace tgui
 
             const std::size_t caretPosition = getSelectionEnd();
 
-            m_text.insert(caretPosition, 1, key);
-            m_lines[m_selEnd.y].insert(m_selEnd.x, 1, key);
-
-            // Increment the caret position, unless you type a newline at the start of a line while that line only existed due to word wrapping
-            if ((key != U'\n') || (m_selEnd.x > 0) || (m_selEnd.y == 0) || m_lines[m_selEnd.y-1].empty() || (m_text[caretPosition-1] == U'\n'))
-            {
-                m_selStart.x++;
-                m_selEnd.x++;
-            }
+            m_wordWrapper.insertText(caretPosition, String(1, key));
 
-            rearrangeText(true);
+            // The caret is placed behind the new character. When typing a newline at the start of a line that only existed due to
+            // word wrapping, the caret thus stays at the start of that line as the character index after the newline maps to it.
+            rearrangeText(caretPosition + 1, caretPosition + 1);
         };
 
         // If there is a scrollbar then inserting can't go wrong
@@ -754,21 +816,18 @@ namespace tgui
         else // There is no scrollbar, the text may not fit
         {
             // Store the data so that it can be reverted
-            const auto oldText = m_text;
-            const auto oldSelStart = m_selStart;
-            const auto oldSelEnd = m_selEnd;
+            const auto oldText = m_wordWrapper.getText();
+            const auto oldSelStart = getSelectionStart();
+            const auto oldSelEnd = getSelectionEnd();
 
             // Try to insert the character
             insert();
 
             // Undo the insert if the text does not fit
-            if (m_lines.size() > static_cast<std::size_t>(getInnerSize().y / m_lineHeight))
+            if (m_wordWrapper.getLineCount() > static_cast<std::size_t>(getInnerSize().y / m_lineHeight))
             {
-                m_text = oldText;
-                m_selStart = oldSelStart;
-                m_selEnd = oldSelEnd;
-
-                rearrangeText(true);
+                m_wordWrapper.setText(oldText);
+                rearrangeText(oldSelStart, oldSelEnd);
             }
         }
 
@@ -776,7 +835,7 @@ namespace tgui
         m_caretVisible = true;
         m_animationTimeElapsed = {};
 
-        onTextChange.emit(this, m_text);
+        emitTextChange();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -798,6 +857,9 @@ namespace tgui
         if (scrollbarMoved)
             recalculateVisibleLines();
 
+        if (m_verticalScrollbar->wasInvalidated() || m_horizontalScrollbar->wasInvalidated())
+            invalidate();
+
         return scrollbarMoved;
     }
 
@@ -809,8 +871,9 @@ namespace tgui
         position.y -= m_bordersCached.getTop() + m_paddingCached.getTop();
 
         // Don't continue when line height is 0 or when there is no font yet
+        const std::size_t lineCount = m_wordWrapper.getLineCount();
         if ((m_lineHeight == 0) || (m_fontCached == nullptr))
-            return {m_lines[m_lines.size()-1].size(), m_lines.size()-1};
+            return {m_wordWrapper.getLineLength(lineCount-1), lineCount-1};
 
         // Find on which line the mouse is
         std::size_t lineNumber;
@@ -830,23 +893,24 @@ namespace tgui
         }
 
         // Check if you clicked behind everything
-        if (lineNumber + 1 > m_lines.size())
-            return {m_lines[m_lines.size()-1].size(), m_lines.size()-1};
+        if (lineNumber + 1 > lineCount)
+            return {m_wordWrapper.getLineLength(lineCount-1), lineCount-1};
 
         // Find between which character the mouse is standing
+        const String line = m_wordWrapper.getLine(lineNumber);
         float width = Text::getExtraHorizontalPadding(m_fontCached, m_textSizeCached) - m_horizontalScrollbar->getValue();
         char32_t prevChar = 0;
-        for (std::size_t i = 0; i < m_lines[lineNumber].size(); ++i)
+        for (std::size_t i = 0; i < line.size(); ++i)
         {
             float charWidth;
-            const char32_t curChar = m_lines[lineNumber][i];
+            const char32_t curChar = line[i];
             //if (curChar == U'\n')
             //    return Vector2<std::size_t>(m_lines[lineNumber].getSize() - 1, lineNumber); // TextArea strips newlines but this code is kept for when this function is generalized
             //else
             if (curChar == U'\t')
-                charWidth = static_cast<float>(m_fontCached.getGlyph(' ', getTextSize(), false).advance) * 4;
+                charWidth = m_fontCached.getGlyphAdvance(' ', getTextSize(), false) * 4;
             else
-                charWidth = static_cast<float>(m_fontCached.getGlyph(curChar, getTextSize(), false).advance);
+                charWidth = m_fontCached.getGlyphAdvance(curChar, getTextSize(), false);
 
             const float kerning = m_fontCached.getKerning(prevChar, curChar, getTextSize(), false);
             if (width + charWidth + kerning <= position.x)
@@ -863,27 +927,18 @@ namespace tgui
         }
 
         // You clicked behind the last character
-        return {m_lines[lineNumber].length(), lineNumber};
+        return {line.length(), lineNumber};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     std::size_t TextArea::getIndexOfSelectionPos(Vector2<std::size_t> selectionPos) const
     {
-        auto findIndex = [this](std::size_t line)
-        {
-            std::size_t counter = 0;
-            for (std::size_t i = 0; i < line; ++i)
-            {
-                counter += m_lines[i].length();
-                if ((counter < m_text.length()) && (m_text[counter] == U'\n'))
-                    counter += 1;
-            }
+        // The selection can lie outside the text when the text was changed while it couldn't be rearranged (e.g. without font)
+        if (selectionPos.y >= m_wordWrapper.getLineCount())
+            return m_wordWrapper.getTextLength();
 
-            return counter;
-        };
-
-        return findIndex(selectionPos.y) + selectionPos.x;
+        return std::min(m_wordWrapper.getLineStartIndex(selectionPos.y) + selectionPos.x, m_wordWrapper.getTextLength());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -894,18 +949,9 @@ namespace tgui
         {
             const std::size_t selStart = getSelectionStart();
             const std::size_t selEnd = getSelectionEnd();
-            if (selStart <= selEnd)
-            {
-                m_text.erase(selStart, selEnd - selStart);
-                m_selEnd = m_selStart;
-            }
-            else
-            {
-                m_text.erase(selEnd, selStart - selEnd);
-                m_selStart = m_selEnd;
-            }
-
-            rearrangeText(true);
+            const std::size_t firstSelectedIndex = std::min(selStart, selEnd);
+            m_wordWrapper.eraseText(firstSelectedIndex, std::max(selStart, selEnd) - firstSelectedIndex);
+            rearrangeText(firstSelectedIndex, firstSelectedIndex);
         }
     }
 
@@ -930,7 +976,7 @@ namespace tgui
                 if (m_selEnd.y > 0)
                 {
                     m_selEnd.y--;
-                    m_selEnd.x = m_lines[m_selEnd.y].length();
+                    m_selEnd.x = m_wordWrapper.getLineLength(m_selEnd.y);
                 }
             }
         }
@@ -948,9 +994,9 @@ namespace tgui
         else
         {
             // Move to the next line if you are at the end of the line
-            if (m_selEnd.x == m_lines[m_selEnd.y].length())
+            if (m_selEnd.x == m_wordWrapper.getLineLength(m_selEnd.y))
             {
-                if (m_selEnd.y + 1 < m_lines.size())
+                if (m_selEnd.y + 1 < m_wordWrapper.getLineCount())
                 {
                     m_selEnd.y++;
                     m_selEnd.x = 0;
@@ -970,11 +1016,12 @@ namespace tgui
         bool done = false;
         for (std::size_t j = m_selEnd.y + 1; j > 0; --j)
         {
+            const String line = m_wordWrapper.getLine(m_selEnd.y);
             for (std::size_t i = m_selEnd.x; i > 0; --i)
             {
                 if (skippedWhitespace)
                 {
-                    if (isWhitespace(m_lines[m_selEnd.y][i-1]))
+                    if (isWhitespace(line[i-1]))
                     {
                         m_selEnd.x = i;
                         done = true;
@@ -983,7 +1030,7 @@ namespace tgui
                 }
                 else
                 {
-                    if (!isWhitespace(m_lines[m_selEnd.y][i-1]))
+                    if (!isWhitespace(line[i-1]))
                         skippedWhitespace = true;
                 }
             }
@@ -995,7 +1042,7 @@ namespace tgui
                     if (m_selEnd.y > 0)
                     {
                         m_selEnd.y--;
-                        m_selEnd.x = m_lines[m_selEnd.y].length();
+                        m_selEnd.x = m_wordWrapper.getLineLength(m_selEnd.y);
                     }
                 }
                 else
@@ -1016,13 +1063,15 @@ namespace tgui
         // Move to the end of the word (or to the end of the next word when already at the end)
         bool skippedWhitespace = false;
         bool done = false;
-        for (std::size_t j = m_selEnd.y; j < m_lines.size(); ++j)
+        const std::size_t lineCount = m_wordWrapper.getLineCount();
+        for (std::size_t j = m_selEnd.y; j < lineCount; ++j)
         {
-            for (std::size_t i = m_selEnd.x; i < m_lines[m_selEnd.y].length(); ++i)
+            const String line = m_wordWrapper.getLine(m_selEnd.y);
+            for (std::size_t i = m_selEnd.x; i < line.length(); ++i)
             {
                 if (skippedWhitespace)
                 {
-                    if (isWhitespace(m_lines[m_selEnd.y][i]))
+                    if (isWhitespace(line[i]))
                     {
                         m_selEnd.x = i;
                         done = true;
@@ -1031,7 +1080,7 @@ namespace tgui
                 }
                 else
                 {
-                    if (!isWhitespace(m_lines[m_selEnd.y][i]))
+                    if (!isWhitespace(line[i]))
                         skippedWhitespace = true;
                 }
             }
@@ -1040,7 +1089,7 @@ namespace tgui
             {
                 if (!skippedWhitespace)
                 {
-                    if (m_selEnd.y + 1 < m_lines.size())
+                    if (m_selEnd.y + 1 < lineCount)
                     {
                         m_selEnd.y++;
                         m_selEnd.x = 0;
@@ -1048,7 +1097,7 @@ namespace tgui
                 }
                 else
                 {
-                    m_selEnd.x = m_lines[m_selEnd.y].length();
+                    m_selEnd.x = line.length();
                     break;
                 }
             }
@@ -1082,21 +1131,22 @@ namespace tgui
     void TextArea::moveCaretPageDown()
     {
         // Move to the bottom line when not there already
-        if (m_topLine + m_visibleLines > m_lines.size())
-            m_selEnd.y = m_lines.size() - 1;
+        const std::size_t lineCount = m_wordWrapper.getLineCount();
+        if (m_topLine + m_visibleLines > lineCount)
+            m_selEnd.y = lineCount - 1;
         else if (m_selEnd.y != m_topLine + m_visibleLines - 1)
             m_selEnd.y = m_topLine + m_visibleLines - 1;
         else
         {
             // Scroll down when we already where at the bottom line
             const auto visibleLines = static_cast<std::size_t>((getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()) / m_lineHeight);
-            if (m_selEnd.y + visibleLines >= m_lines.size() + 2)
-                m_selEnd.y = m_lines.size() - 1;
+            if (m_selEnd.y + visibleLines >= lineCount + 2)
+                m_selEnd.y = lineCount - 1;
             else
                 m_selEnd.y = m_selEnd.y + visibleLines - 2;
         }
 
-        m_selEnd.x = m_lines[m_selEnd.y].length();
+        m_selEnd.x = m_wordWrapper.getLineLength(m_selEnd.y);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1112,35 +1162,8 @@ namespace tgui
             const std::size_t pos = getSelectionEnd();
             if (pos > 0)
             {
-                if (m_selEnd.x > 0)
-                {
-                    // There is a specific case that we have to watch out for. When we are removing the last character on
-                    // a line which was placed there by word wrap and a newline follows this character then the caret
-                    // has to be placed at the line above (before the newline) instead of at the same line (after the newline)
-                    if ((m_lines[m_selEnd.y].length() == 1) && (pos > 1) && (pos < m_text.length()) && (m_text[pos-2] != '\n') && (m_text[pos] == '\n') && (m_selEnd.y > 0))
-                    {
-                        m_selEnd.y--;
-                        m_selEnd.x = m_lines[m_selEnd.y].length();
-                    }
-                    else // Just remove the character normally
-                        --m_selEnd.x;
-                }
-                else // At the beginning of the line
-                {
-                    if (m_selEnd.y > 0)
-                    {
-                        --m_selEnd.y;
-                        m_selEnd.x = m_lines[m_selEnd.y].length();
-
-                        if ((m_text[pos-1] != '\n') && m_selEnd.x > 0)
-                            --m_selEnd.x;
-                    }
-                }
-
-                m_selStart = m_selEnd;
-
-                m_text.erase(pos - 1, 1);
-                rearrangeText(true);
+                m_wordWrapper.eraseText(pos - 1, 1);
+                rearrangeText(pos - 1, pos - 1);
             }
         }
         else // When you did select some characters then delete them
@@ -1150,7 +1173,7 @@ namespace tgui
         m_caretVisible = true;
         m_animationTimeElapsed = {};
 
-        onTextChange.emit(this, m_text);
+        emitTextChange();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1163,13 +1186,14 @@ namespace tgui
         // Check that we did not select any characters
         if (m_selStart == m_selEnd)
         {
-            m_text.erase(getSelectionEnd(), 1);
-            rearrangeText(true);
+            const std::size_t pos = getSelectionEnd();
+            m_wordWrapper.eraseText(pos, 1);
+            rearrangeText(pos, pos);
         }
         else // You did select some characters, so remove them
             deleteSelectedCharacters();
 
-        onTextChange.emit(this, m_text);
+        emitTextChange();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1179,9 +1203,9 @@ namespace tgui
         const std::size_t selStart = getSelectionStart();
         const std::size_t selEnd = getSelectionEnd();
         if (selStart <= selEnd)
-            getBackend()->setClipboard(m_text.substr(selStart, selEnd - selStart));
+            getBackend()->setClipboard(m_wordWrapper.getSubstring(selStart, selEnd - selStart));
         else
-            getBackend()->setClipboard(m_text.substr(selEnd, selStart - selEnd));
+            getBackend()->setClipboard(m_wordWrapper.getSubstring(selEnd, selStart - selEnd));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1198,7 +1222,7 @@ namespace tgui
 
     void TextArea::pasteTextFromClipboard()
     {
-        if (m_readOnly)
+        if (m_readOnly || m_mappedFile)
             return;
 
         String clipboardContents = getBackend()->getClipboard();
@@ -1211,14 +1235,11 @@ namespace tgui
         {
             deleteSelectedCharacters();
 
-            m_text.insert(getSelectionEnd(), clipboardContents);
-            m_lines[m_selEnd.y].insert(m_selEnd.x, clipboardContents);
-
-            m_selEnd.x += clipboardContents.length();
-            m_selStart = m_selEnd;
-            rearrangeText(true);
+            const std::size_t pos = getSelectionEnd();
+            m_wordWrapper.insertText(pos, clipboardContents);
+            rearrangeText(pos + clipboardContents.length(), pos + clipboardContents.length());
 
-            onTextChange.emit(this, m_text);
+            emitTextChange();
         }
     }
 
@@ -1227,154 +1248,118 @@ namespace tgui
     void TextArea::selectAllText()
     {
         m_selStart = {0, 0};
-        m_selEnd = Vector2<std::size_t>(m_lines[m_lines.size()-1].length(), m_lines.size()-1);
+        m_selEnd = m_wordWrapper.getPositionOfIndex(m_wordWrapper.getTextLength());
         updateSelectionTexts();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void TextArea::emitTextChange()
+    {
+        // Creating a copy of the text is avoided when nobody is listening, as the text can be very large
+        if (onTextChange.isConnected())
+            onTextChange.emit(this, m_wordWrapper.getText());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void TextArea::rearrangeText(bool keepSelection)
     {
+        if (keepSelection)
+            rearrangeText(getSelectionStart(), getSelectionEnd());
+        else // Set the caret at the back of the text
+            rearrangeText(m_wordWrapper.getTextLength(), m_wordWrapper.getTextLength());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextArea::rearrangeText(std::size_t selStart, std::size_t selEnd)
+    {
+        // There is no selection while a file is shown and its lines aren't word-wrapped
+        if (m_mappedFile)
+        {
+            m_selStart = {};
+            m_selEnd = {};
+            if ((m_lineHeight == 0) || (m_fontCached == nullptr))
+                return;
+
+            updateScrollbars();
+            updateScrollbarMaximums(m_mappedFile->getLineCount());
+            updateScrollbars();
+            recalculatePositions();
+            return;
+        }
+
         // Don't continue when line height is 0 or when there is no font yet
         if ((m_lineHeight == 0) || (m_fontCached == nullptr))
+        {
+            m_selStart = m_wordWrapper.getPositionOfIndex(std::min(selStart, m_wordWrapper.getTextLength()));
+            m_selEnd = m_wordWrapper.getPositionOfIndex(std::min(selEnd, m_wordWrapper.getTextLength()));
             return;
+        }
 
-        String string;
-        if (m_horizontalScrollbarPolicy != Scrollbar::Policy::Never)
-            string = m_text;
-        else
+        float maxLineWidth = 0;
+        if (m_horizontalScrollbarPolicy == Scrollbar::Policy::Never)
         {
             // Find the maximum width of one line
             const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSizeCached);
-            float maxLineWidth = getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight() - 2 * textOffset;
+            maxLineWidth = getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight() - 2 * textOffset;
             if (m_verticalScrollbar->isShown())
                 maxLineWidth -= m_verticalScrollbar->getSize().x;
 
             // Don't do anything when there is no room for the text
             if (maxLineWidth <= 0)
+            {
+                m_selStart = m_wordWrapper.getPositionOfIndex(std::min(selStart, m_wordWrapper.getTextLength()));
+                m_selEnd = m_wordWrapper.getPositionOfIndex(std::min(selEnd, m_wordWrapper.getTextLength()));
                 return;
-
-            string = Text::wordWrap(maxLineWidth, m_text, m_fontCached, m_textSizeCached, false);
+            }
         }
 
-        // Store the current selection position when we are keeping the selection
-        const std::size_t selStart = keepSelection ? getSelectionStart() : 0;
-        const std::size_t selEnd = keepSelection ? getSelectionEnd() : 0;
+        // Only the paragraphs that were edited since the last call have to be word-wrapped again
+        m_wordWrapper.setWrapping(maxLineWidth, m_fontCached, m_textSizeCached, false);
+        const std::size_t lineCount = m_wordWrapper.getLineCount();
 
-        // Split the string in multiple lines
+        // Find the longest line
         m_maxLineWidth = 0;
-        m_lines.clear();
-        std::size_t searchPosStart = 0;
-        std::size_t newLinePos = 0;
-        std::size_t longestLineCharCount = 0;
-        std::size_t longestLineIndex = 0;
-        while (newLinePos != String::npos)
+        if (m_horizontalScrollbarPolicy != Scrollbar::Policy::Never)
         {
-            newLinePos = string.find('\n', searchPosStart);
-
-            if (newLinePos != String::npos)
-                m_lines.push_back(string.substr(searchPosStart, newLinePos - searchPosStart));
-            else
-                m_lines.push_back(string.substr(searchPosStart));
-
-            if (m_horizontalScrollbarPolicy != Scrollbar::Policy::Never)
+            if (m_monospacedFontOptimizationEnabled)
             {
-                if (m_monospacedFontOptimizationEnabled)
+                std::size_t longestLineCharCount = 0;
+                std::size_t longestLineIndex = 0;
+                for (std::size_t i = 0; i < lineCount; ++i)
                 {
-                    if (m_lines.back().length() > longestLineCharCount)
+                    const std::size_t lineLength = m_wordWrapper.getLineLength(i);
+                    if (lineLength > longestLineCharCount)
                     {
-                        longestLineCharCount = m_lines.back().length();
-                        longestLineIndex = m_lines.size() - 1;
+                        longestLineCharCount = lineLength;
+                        longestLineIndex = i;
                     }
                 }
-                else // Not using optimization for monospaced font, so really calculate the width of every line
-                {
-                    float lineWidth = Text::getLineWidth(m_lines.back(), m_fontCached, m_textSizeCached);
-                    if (lineWidth > m_maxLineWidth)
-                        m_maxLineWidth = lineWidth;
-                }
-            }
-
-            searchPosStart = newLinePos + 1;
-        }
-
-        if ((m_horizontalScrollbarPolicy != Scrollbar::Policy::Never) && m_monospacedFontOptimizationEnabled)
-            m_maxLineWidth = Text::getLineWidth(m_lines[longestLineIndex], m_fontCached, m_textSizeCached);
 
-        // Check if we should try to keep our selection
-        if (keepSelection)
-        {
-            std::size_t index = 0;
-            Vector2<std::size_t> newSelStart;
-            Vector2<std::size_t> newSelEnd;
-            bool newSelStartFound = false;
-            bool newSelEndFound = false;
-
-            // Look for the new locations of our selection
-            for (std::size_t i = 0; i < m_lines.size(); ++i)
-            {
-                index += m_lines[i].length();
-
-                if (!newSelStartFound && (index >= selStart))
-                {
-                    newSelStart = Vector2<std::size_t>(m_lines[i].length() - (index - selStart), i);
-
-                    newSelStartFound = true;
-                    if (newSelEndFound)
-                        break;
-                }
-
-                if (!newSelEndFound && (index >= selEnd))
-                {
-                    newSelEnd = Vector2<std::size_t>(m_lines[i].length() - (index - selEnd), i);
-
-                    newSelEndFound = true;
-                    if (newSelStartFound)
-                        break;
-                }
-
-                // Skip newlines in the text
-                if (m_text[index] == U'\n')
-                    ++index;
-            }
-
-            // Keep the selection when possible
-            if (newSelStartFound && newSelEndFound)
-            {
-                m_selStart = newSelStart;
-                m_selEnd = newSelEnd;
-            }
-            else // The text has changed too much, the selection can't be kept
-            {
-                m_selStart = Vector2<std::size_t>(m_lines[m_lines.size()-1].length(), m_lines.size()-1);
-                m_selEnd = m_selStart;
+                m_maxLineWidth = Text::getLineWidth(m_wordWrapper.getLine(longestLineIndex), m_fontCached, m_textSizeCached);
             }
+            else // Not using optimization for monospaced font, so really calculate the width of the lines that changed
+                m_maxLineWidth = m_wordWrapper.getMaximumLineWidth();
         }
-        else // Set the caret at the back of the text
-        {
-            m_selStart = Vector2<std::size_t>(m_lines[m_lines.size()-1].length(), m_lines.size()-1);
-            m_selEnd = m_selStart;
-        }
+
+        // Find the line and position within the line of the selection
+        m_selStart = m_wordWrapper.getPositionOfIndex(std::min(selStart, m_wordWrapper.getTextLength()));
+        m_selEnd = m_wordWrapper.getPositionOfIndex(std::min(selEnd, m_wordWrapper.getTextLength()));
 
         updateScrollbars();
 
-        // Tell the scrollbars how many pixels the text contains
         const bool verticalScrollbarShown = m_verticalScrollbar->isShown();
         const bool horizontalScrollbarShown = m_horizontalScrollbar->isShown();
-
-        m_verticalScrollbar->setMaximum(static_cast<unsigned int>((m_lines.size() - 1) * m_lineHeight
-                                                                  + std::max(m_fontCached.getFontHeight(m_textSizeCached), m_lineHeight)
-                                                                  + Text::getExtraVerticalPadding(m_textSizeCached)));
-
-        m_horizontalScrollbar->setMaximum(static_cast<unsigned int>(m_maxLineWidth
-                                                                    + Text::getExtraHorizontalPadding(m_fontCached, m_textSizeCached) * 2));
+        updateScrollbarMaximums(lineCount);
 
         if (m_horizontalScrollbarPolicy == Scrollbar::Policy::Never)
         {
             // Word-wrap will have to be done again if the vertical scrollbar just appeared or disappeared
             if (verticalScrollbarShown != m_verticalScrollbar->isShown())
             {
-                rearrangeText(true);
+                rearrangeText(selStart, selEnd);
                 return;
             }
             else
@@ -1418,71 +1403,27 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void TextArea::updateSelectionTexts()
+    void TextArea::updateScrollbarMaximums(std::size_t lineCount)
     {
-        // If there is no selection then just put the whole text in m_textBeforeSelection
-        if (m_selStart == m_selEnd)
-        {
-            String displayedText;
-            for (const auto& line : m_lines)
-                displayedText += line + U"\n";
-
-            m_textBeforeSelection.setString(displayedText);
-            m_textSelection1.setString(U"");
-            m_textSelection2.setString(U"");
-            m_textAfterSelection1.setString(U"");
-            m_textAfterSelection2.setString(U"");
-        }
-        else // Some text is selected
-        {
-            auto selectionStart = m_selStart;
-            auto selectionEnd = m_selEnd;
-
-            if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
-                std::swap(selectionStart, selectionEnd);
-
-            // Set the text before the selection
-            if (selectionStart.y > 0)
-            {
-                String string;
-                for (std::size_t i = 0; i < selectionStart.y; ++i)
-                    string += m_lines[i] + U"\n";
+        // The height is limited to what the scrollbar can store, which could be exceeded by a huge file
+        const float textHeight = (lineCount - 1) * m_lineHeight
+                               + std::max(m_fontCached.getFontHeight(m_textSizeCached), m_lineHeight)
+                               + Text::getExtraVerticalPadding(m_textSizeCached);
+        m_verticalScrollbar->setMaximum(static_cast<unsigned int>(std::min(textHeight, static_cast<float>(std::numeric_limits<unsigned int>::max() / 2))));
 
-                string += m_lines[selectionStart.y].substr(0, selectionStart.x);
-                m_textBeforeSelection.setString(string);
-            }
-            else
-                m_textBeforeSelection.setString(m_lines[0].substr(0, selectionStart.x));
-
-            // Set the selected text
-            if (m_selStart.y == m_selEnd.y)
-            {
-                m_textSelection1.setString(m_lines[selectionStart.y].substr(selectionStart.x, selectionEnd.x - selectionStart.x));
-                m_textSelection2.setString(U"");
-            }
-            else
-            {
-                m_textSelection1.setString(m_lines[selectionStart.y].substr(selectionStart.x, m_lines[selectionStart.y].length() - selectionStart.x));
-
-                String string;
-                for (std::size_t i = selectionStart.y + 1; i < selectionEnd.y; ++i)
-                    string += m_lines[i] + U"\n";
-
-                string += m_lines[selectionEnd.y].substr(0, selectionEnd.x);
-
-                m_textSelection2.setString(string);
-            }
-
-            // Set the text after the selection
-            {
-                m_textAfterSelection1.setString(m_lines[selectionEnd.y].substr(selectionEnd.x, m_lines[selectionEnd.y].length() - selectionEnd.x));
+        m_horizontalScrollbar->setMaximum(static_cast<unsigned int>(m_maxLineWidth
+                                                                    + Text::getExtraHorizontalPadding(m_fontCached, m_textSizeCached) * 2));
+    }
 
-                String string;
-                for (std::size_t i = selectionEnd.y + 1; i < m_lines.size(); ++i)
-                    string += m_lines[i] + U"\n";
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-                m_textAfterSelection2.setString(string);
-            }
+    void TextArea::updateSelectionTexts()
+    {
+        // There is no caret or selection while showing a file
+        if (m_mappedFile)
+        {
+            recalculatePositions();
+            return;
         }
 
         // Check if the caret is located above or below the view
@@ -1499,18 +1440,15 @@ namespace tgui
 
         // Position the caret
         {
-            /// TODO: Implement a way to calculate text size without creating a text object?
             const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSizeCached);
-            Text tempText;
-            tempText.setFont(m_fontCached);
-            tempText.setCharacterSize(getTextSize());
-            tempText.setString(m_lines[m_selEnd.y].substr(0, m_selEnd.x));
+            const String line = m_wordWrapper.getLine(m_selEnd.y);
 
             float kerning = 0;
-            if ((m_selEnd.x > 0) && (m_selEnd.x < m_lines[m_selEnd.y].length()))
-                kerning = m_fontCached.getKerning(m_lines[m_selEnd.y][m_selEnd.x - 1], m_lines[m_selEnd.y][m_selEnd.x], m_textSizeCached, false);
+            if ((m_selEnd.x > 0) && (m_selEnd.x < line.length()))
+                kerning = m_fontCached.getKerning(line[m_selEnd.x - 1], line[m_selEnd.x], m_textSizeCached, false);
 
-            m_caretPosition = {textOffset + tempText.findCharacterPos(tempText.getString().length()).x + kerning, static_cast<float>(m_selEnd.y) * m_lineHeight};
+            m_caretPosition = {textOffset + Text::getLineWidth(line.substr(0, m_selEnd.x), m_fontCached, m_textSizeCached) + kerning,
+                               static_cast<float>(m_selEnd.y) * m_lineHeight};
         }
 
         if (m_horizontalScrollbarPolicy != Scrollbar::Policy::Never)
@@ -1586,95 +1524,14 @@ namespace tgui
             return;
 
         const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSizeCached);
-
-        // Calculate the position of the text objects
-        m_selectionRects.clear();
-        m_textBeforeSelection.setPosition({textOffset, 0});
         m_defaultText.setPosition({ textOffset, 0 });
 
-        if (m_selStart != m_selEnd)
-        {
-            auto selectionStart = m_selStart;
-            auto selectionEnd = m_selEnd;
-
-            if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
-                std::swap(selectionStart, selectionEnd);
-
-            float kerningSelectionStart = 0;
-            if ((selectionStart.x > 0) && (selectionStart.x < m_lines[selectionStart.y].length()))
-                kerningSelectionStart = m_fontCached.getKerning(m_lines[selectionStart.y][selectionStart.x-1], m_lines[selectionStart.y][selectionStart.x], m_textSizeCached, false);
-
-            float kerningSelectionEnd = 0;
-            if ((selectionEnd.x > 0) && (selectionEnd.x < m_lines[selectionEnd.y].length()))
-                kerningSelectionEnd = m_fontCached.getKerning(m_lines[selectionEnd.y][selectionEnd.x-1], m_lines[selectionEnd.y][selectionEnd.x], m_textSizeCached, false);
-
-            if (selectionStart.x > 0)
-            {
-                m_textSelection1.setPosition({textOffset + m_textBeforeSelection.findCharacterPos(m_textBeforeSelection.getString().length()).x + kerningSelectionStart,
-                                              m_textBeforeSelection.getPosition().y + (selectionStart.y * m_lineHeight)});
-            }
-            else
-                m_textSelection1.setPosition({textOffset, m_textBeforeSelection.getPosition().y + (selectionStart.y * m_lineHeight)});
-
-            m_textSelection2.setPosition({textOffset, static_cast<float>((selectionStart.y + 1) * m_lineHeight)});
-
-            if (!m_textSelection2.getString().empty() || (selectionEnd.x == 0))
-            {
-                m_textAfterSelection1.setPosition({textOffset + m_textSelection2.findCharacterPos(m_textSelection2.getString().length()).x + kerningSelectionEnd,
-                                                   m_textSelection2.getPosition().y + ((selectionEnd.y - selectionStart.y - 1) * m_lineHeight)});
-            }
-            else
-                m_textAfterSelection1.setPosition({m_textSelection1.getPosition().x + m_textSelection1.findCharacterPos(m_textSelection1.getString().length()).x + kerningSelectionEnd,
-                                                   m_textSelection1.getPosition().y});
-
-            m_textAfterSelection2.setPosition({textOffset, static_cast<float>(selectionEnd.y + 1) * m_lineHeight});
-
-            // Recalculate the selection rectangles
-            {
-                m_selectionRects.emplace_back(m_textSelection1.getPosition().x, static_cast<float>(selectionStart.y) * m_lineHeight, 0.f, m_lineHeight);
-
-                if (!m_lines[selectionStart.y].empty())
-                {
-                    m_selectionRects.back().width = m_textSelection1.findCharacterPos(m_textSelection1.getString().length()).x;
-
-                    // There is kerning when the selection is on just this line
-                    if (selectionStart.y == selectionEnd.y)
-                        m_selectionRects.back().width += kerningSelectionEnd;
-                }
-
-                /// TODO: Implement a way to calculate text size without creating a text object?
-                Text tempText;
-                tempText.setFont(m_fontCached);
-                tempText.setCharacterSize(getTextSize());
-                for (std::size_t i = selectionStart.y + 1; i < selectionEnd.y; ++i)
-                {
-                    m_selectionRects.back().width += textOffset;
-                    m_selectionRects.emplace_back(m_textSelection2.getPosition().x - textOffset, static_cast<float>(i) * m_lineHeight, textOffset, m_lineHeight);
-
-                    if (!m_lines[i].empty())
-                    {
-                        tempText.setString(m_lines[i]);
-                        m_selectionRects.back().width += tempText.findCharacterPos(tempText.getString().length()).x;
-                    }
-                }
-
-                if (selectionStart.y != selectionEnd.y)
-                {
-                    m_selectionRects.back().width += textOffset;
-
-                    if (m_textSelection2.getString() != U"")
-                    {
-                        tempText.setString(m_lines[selectionEnd.y].substr(0, selectionEnd.x));
-                        m_selectionRects.emplace_back(m_textSelection2.getPosition().x - textOffset, static_cast<float>(selectionEnd.y) * m_lineHeight,
-                                                      textOffset + tempText.findCharacterPos(tempText.getString().length()).x + kerningSelectionEnd, m_lineHeight);
-                    }
-                    else
-                        m_selectionRects.emplace_back(0.f, static_cast<float>(selectionEnd.y) * m_lineHeight, textOffset, m_lineHeight);
-                }
-            }
-        }
+        // The texts have to be recreated even if the same lines remain visible, because the lines or selection may have changed
+        m_visibleTextsFirstLine = 0;
+        m_visibleTextsLastLine = 0;
 
         recalculateVisibleLines();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1684,6 +1541,11 @@ namespace tgui
         if (m_lineHeight == 0)
             return;
 
+        // This function is called when the vertical scrollbar may have moved
+        invalidate();
+
+        const std::size_t lineCount = getLinesCount();
+
         float horiScrollOffset = 0.0f;
         if (m_horizontalScrollbar->isShown())
         {
@@ -1691,7 +1553,7 @@ namespace tgui
             m_horizontalScrollbar->setPosition(m_bordersCached.getLeft(), getSize().y - m_bordersCached.getBottom() - m_horizontalScrollbar->getSize().y);
         }
 
-        m_visibleLines = std::min(static_cast<std::size_t>((getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom() - horiScrollOffset) / m_lineHeight), m_lines.size());
+        m_visibleLines = std::min(static_cast<std::size_t>((getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom() - horiScrollOffset) / m_lineHeight), lineCount);
 
         // Store which area is visible
         if (m_verticalScrollbar->isShown())
@@ -1708,7 +1570,183 @@ namespace tgui
         else // There is no scrollbar
         {
             m_topLine = 0;
-            m_visibleLines = std::min(static_cast<std::size_t>((getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom() - horiScrollOffset) / m_lineHeight), m_lines.size());
+            m_visibleLines = std::min(static_cast<std::size_t>((getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom() - horiScrollOffset) / m_lineHeight), lineCount);
+        }
+
+        // Finding the visible lines of a file may change the estimated amount of lines in it
+        if (m_mappedFile && !m_mappedFile->isFullyIndexed())
+        {
+            m_mappedFile->indexLines(m_topLine + m_visibleLines + 1);
+            if (m_mappedFile->getLineCount() != lineCount)
+            {
+                updateScrollbarMaximums(m_mappedFile->getLineCount());
+                updateScrollbars();
+                recalculateVisibleLines();
+                return;
+            }
+        }
+
+        // Only the lines that are visible are placed in the texts. One extra line is included for a partially visible line.
+        const std::size_t firstLine = std::min(m_topLine, lineCount);
+        const std::size_t lastLine = std::min(m_topLine + m_visibleLines + 1, lineCount);
+        if ((firstLine != m_visibleTextsFirstLine) || (lastLine != m_visibleTextsLastLine))
+            updateVisibleTexts(firstLine, lastLine);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextArea::updateVisibleTexts(std::size_t firstLine, std::size_t lastLine)
+    {
+        m_visibleTextsFirstLine = firstLine;
+        m_visibleTextsLastLine = lastLine;
+        m_selectionRects.clear();
+
+        if (m_mappedFile)
+        {
+            updateVisibleFileTexts(firstLine, lastLine);
+            return;
+        }
+
+        const auto getLines = [this](std::size_t first, std::size_t last)
+        {
+            String lines;
+            for (std::size_t i = first; i < last; ++i)
+                lines += m_wordWrapper.getLine(i) + U"\n";
+
+            return lines;
+        };
+
+        const auto isVisible = [=](std::size_t line) { return (line >= firstLine) && (line < lastLine); };
+
+        const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSizeCached);
+
+        // If there is no selection then just put the visible lines in m_textBeforeSelection
+        if (m_selStart == m_selEnd)
+        {
+            m_textBeforeSelection.setString(getLines(firstLine, lastLine));
+            m_textBeforeSelection.setPosition({textOffset, static_cast<float>(firstLine) * m_lineHeight});
+            m_textSelection1.setString(U"");
+            m_textSelection2.setString(U"");
+            m_textAfterSelection1.setString(U"");
+            m_textAfterSelection2.setString(U"");
+            return;
+        }
+
+        auto selectionStart = m_selStart;
+        auto selectionEnd = m_selEnd;
+
+        if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
+            std::swap(selectionStart, selectionEnd);
+
+        const String selectionStartLine = m_wordWrapper.getLine(selectionStart.y);
+        const String selectionEndLine = m_wordWrapper.getLine(selectionEnd.y);
+        const String selectedPartOfStartLine = (selectionStart.y == selectionEnd.y)
+            ? selectionStartLine.substr(selectionStart.x, selectionEnd.x - selectionStart.x)
+            : selectionStartLine.substr(selectionStart.x);
+
+        float kerningSelectionStart = 0;
+        if ((selectionStart.x > 0) && (selectionStart.x < selectionStartLine.length()))
+            kerningSelectionStart = m_fontCached.getKerning(selectionStartLine[selectionStart.x-1], selectionStartLine[selectionStart.x], m_textSizeCached, false);
+
+        float kerningSelectionEnd = 0;
+        if ((selectionEnd.x > 0) && (selectionEnd.x < selectionEndLine.length()))
+            kerningSelectionEnd = m_fontCached.getKerning(selectionEndLine[selectionEnd.x-1], selectionEndLine[selectionEnd.x], m_textSizeCached, false);
+
+        // Set the text before the selection
+        {
+            String string = getLines(firstLine, std::min(selectionStart.y, lastLine));
+            if (isVisible(selectionStart.y))
+                string += selectionStartLine.substr(0, selectionStart.x);
+
+            m_textBeforeSelection.setString(string);
+            m_textBeforeSelection.setPosition({textOffset, static_cast<float>(firstLine) * m_lineHeight});
+        }
+
+        // Set the selected text
+        if (isVisible(selectionStart.y))
+            m_textSelection1.setString(selectedPartOfStartLine);
+        else
+            m_textSelection1.setString(U"");
+
+        if (selectionStart.x > 0)
+        {
+            m_textSelection1.setPosition({textOffset + Text::getLineWidth(selectionStartLine.substr(0, selectionStart.x), m_fontCached, m_textSizeCached) + kerningSelectionStart,
+                                          static_cast<float>(selectionStart.y) * m_lineHeight});
+        }
+        else
+            m_textSelection1.setPosition({textOffset, static_cast<float>(selectionStart.y) * m_lineHeight});
+
+        const std::size_t selection2FirstLine = std::max(selectionStart.y + 1, firstLine);
+        if (selectionStart.y != selectionEnd.y)
+        {
+            String string = getLines(selection2FirstLine, std::min(selectionEnd.y, lastLine));
+            if (isVisible(selectionEnd.y))
+                string += selectionEndLine.substr(0, selectionEnd.x);
+
+            m_textSelection2.setString(string);
+        }
+        else
+            m_textSelection2.setString(U"");
+
+        m_textSelection2.setPosition({textOffset, static_cast<float>(selection2FirstLine) * m_lineHeight});
+
+        // Set the text after the selection
+        if (isVisible(selectionEnd.y))
+            m_textAfterSelection1.setString(selectionEndLine.substr(selectionEnd.x));
+        else
+            m_textAfterSelection1.setString(U"");
+
+        if (selectionStart.y != selectionEnd.y)
+        {
+            m_textAfterSelection1.setPosition({textOffset + Text::getLineWidth(selectionEndLine.substr(0, selectionEnd.x), m_fontCached, m_textSizeCached) + kerningSelectionEnd,
+                                               static_cast<float>(selectionEnd.y) * m_lineHeight});
+        }
+        else
+            m_textAfterSelection1.setPosition({m_textSelection1.getPosition().x + Text::getLineWidth(selectedPartOfStartLine, m_fontCached, m_textSizeCached) + kerningSelectionEnd,
+                                               m_textSelection1.getPosition().y});
+
+        const std::size_t afterSelection2FirstLine = std::max(selectionEnd.y + 1, firstLine);
+        m_textAfterSelection2.setString(getLines(afterSelection2FirstLine, lastLine));
+        m_textAfterSelection2.setPosition({textOffset, static_cast<float>(afterSelection2FirstLine) * m_lineHeight});
+
+        // Recalculate the selection rectangles of the visible lines
+        if (isVisible(selectionStart.y))
+        {
+            m_selectionRects.emplace_back(m_textSelection1.getPosition().x, static_cast<float>(selectionStart.y) * m_lineHeight, 0.f, m_lineHeight);
+
+            if (!selectionStartLine.empty())
+            {
+                m_selectionRects.back().width = Text::getLineWidth(selectedPartOfStartLine, m_fontCached, m_textSizeCached);
+
+                // There is kerning when the selection is on just this line
+                if (selectionStart.y == selectionEnd.y)
+                    m_selectionRects.back().width += kerningSelectionEnd;
+            }
+
+            if (selectionStart.y != selectionEnd.y)
+                m_selectionRects.back().width += textOffset;
+        }
+
+        for (std::size_t i = selection2FirstLine; i < std::min(selectionEnd.y, lastLine); ++i)
+        {
+            m_selectionRects.emplace_back(0.f, static_cast<float>(i) * m_lineHeight, textOffset, m_lineHeight);
+
+            const String line = m_wordWrapper.getLine(i);
+            if (!line.empty())
+                m_selectionRects.back().width += Text::getLineWidth(line, m_fontCached, m_textSizeCached);
+
+            m_selectionRects.back().width += textOffset;
+        }
+
+        if ((selectionStart.y != selectionEnd.y) && isVisible(selectionEnd.y))
+        {
+            if ((selectionEnd.y > selectionStart.y + 1) || (selectionEnd.x > 0))
+            {
+                m_selectionRects.emplace_back(0.f, static_cast<float>(selectionEnd.y) * m_lineHeight,
+                                              textOffset + Text::getLineWidth(selectionEndLine.substr(0, selectionEnd.x), m_fontCached, m_textSizeCached) + kerningSelectionEnd, m_lineHeight);
+            }
+            else
+                m_selectionRects.emplace_back(0.f, static_cast<float>(selectionEnd.y) * m_lineHeight, textOffset, m_lineHeight);
         }
     }
 
@@ -1726,38 +1764,102 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void TextArea::rendererChanged(const String& property)
+    void TextArea::updateVisibleFileTexts(std::size_t firstLine, std::size_t lastLine)
+    {
+        // The width of the longest line is only known for lines that have been shown, so the horizontal scrollbar grows
+        // while scrolling through the file.
+        const float oldMaxLineWidth = m_maxLineWidth;
+
+        String lines;
+        for (std::size_t i = firstLine; i < lastLine; ++i)
+        {
+            const String line = m_mappedFile->getLine(i);
+            if (m_horizontalScrollbarPolicy != Scrollbar::Policy::Never)
+                m_maxLineWidth = std::max(m_maxLineWidth, Text::getLineWidth(line, m_fontCached, m_textSizeCached));
+
+            lines += line + U"\n";
+        }
+
+        m_textBeforeSelection.setString(lines);
+        m_textBeforeSelection.setPosition({Text::getExtraHorizontalPadding(m_fontCached, m_textSizeCached), static_cast<float>(firstLine) * m_lineHeight});
+        m_textSelection1.setString(U"");
+        m_textSelection2.setString(U"");
+        m_textAfterSelection1.setString(U"");
+        m_textAfterSelection2.setString(U"");
+
+        if (m_maxLineWidth != oldMaxLineWidth)
+        {
+            updateScrollbarMaximums(m_mappedFile->getLineCount());
+            updateScrollbars();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextArea::scrollFileWithKey(const Event::KeyEvent& event)
+    {
+        const unsigned int value = m_verticalScrollbar->getValue();
+        const unsigned int lineHeight = static_cast<unsigned int>(m_lineHeight);
+        const unsigned int pageHeight = m_verticalScrollbar->getViewportSize();
+
+        if (event.code == tgui::Event::KeyboardKey::PageUp)
+            m_verticalScrollbar->setValue((value > pageHeight) ? value - pageHeight : 0);
+        else if (event.code == tgui::Event::KeyboardKey::PageDown)
+            m_verticalScrollbar->setValue(value + pageHeight);
+        else if (keyboard::isKeyPressMoveCaretUp(event))
+            m_verticalScrollbar->setValue((value > lineHeight) ? value - lineHeight : 0);
+        else if (keyboard::isKeyPressMoveCaretDown(event))
+            m_verticalScrollbar->setValue(value + lineHeight);
+        else if (keyboard::isKeyPressMoveCaretDocumentBegin(event))
+            m_verticalScrollbar->setValue(0);
+        else if (keyboard::isKeyPressMoveCaretDocumentEnd(event))
+        {
+            // The end of the file can only be shown once the amount of lines is known exactly
+            m_mappedFile->indexLines(std::numeric_limits<std::size_t>::max());
+            updateScrollbarMaximums(m_mappedFile->getLineCount());
+            updateScrollbars();
+            m_verticalScrollbar->setValue(m_verticalScrollbar->getMaximum());
+        }
+        else
+            return;
+
+        recalculateVisibleLines();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextArea::rendererChanged(PropertyId property)
     {
-        if (property == U"Borders")
+        if (property == Property::Borders)
         {
             m_bordersCached = getSharedRenderer()->getBorders();
             setSize(m_size);
         }
-        else if (property == U"Padding")
+        else if (property == Property::Padding)
         {
             m_paddingCached = getSharedRenderer()->getPadding();
             setSize(m_size);
         }
-        else if (property == U"TextColor")
+        else if (property == Property::TextColor)
         {
             m_textBeforeSelection.setColor(getSharedRenderer()->getTextColor());
             m_textAfterSelection1.setColor(getSharedRenderer()->getTextColor());
             m_textAfterSelection2.setColor(getSharedRenderer()->getTextColor());
         }
-        else if (property == U"SelectedTextColor")
+        else if (property == Property::SelectedTextColor)
         {
             m_textSelection1.setColor(getSharedRenderer()->getSelectedTextColor());
             m_textSelection2.setColor(getSharedRenderer()->getSelectedTextColor());
         }
-        else if (property == U"DefaultTextColor")
+        else if (property == Property::DefaultTextColor)
         {
             m_defaultText.setColor(getSharedRenderer()->getDefaultTextColor());
         }
-        else if (property == U"TextureBackground")
+        else if (property == Property::TextureBackground)
         {
             m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
         }
-        else if (property == U"Scrollbar")
+        else if (property == Property::Scrollbar)
         {
             m_verticalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
             m_horizontalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
@@ -1770,34 +1872,34 @@ namespace tgui
                 setSize(m_size);
             }
         }
-        else if (property == U"ScrollbarWidth")
+        else if (property == Property::ScrollbarWidth)
         {
             const float width = (getSharedRenderer()->getScrollbarWidth() != 0) ? getSharedRenderer()->getScrollbarWidth() : m_verticalScrollbar->getDefaultWidth();
             m_verticalScrollbar->setSize({width, m_verticalScrollbar->getSize().y});
             m_horizontalScrollbar->setSize({m_horizontalScrollbar->getSize().x, width});
             setSize(m_size);
         }
-        else if (property == U"BackgroundColor")
+        else if (property == Property::BackgroundColor)
         {
             m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
         }
-        else if (property == U"SelectedTextBackgroundColor")
+        else if (property == Property::SelectedTextBackgroundColor)
         {
             m_selectedTextBackgroundColorCached = getSharedRenderer()->getSelectedTextBackgroundColor();
         }
-        else if (property == U"BorderColor")
+        else if (property == Property::BorderColor)
         {
             m_borderColorCached = getSharedRenderer()->getBorderColor();
         }
-        else if (property == U"CaretColor")
+        else if (property == Property::CaretColor)
         {
             m_caretColorCached = getSharedRenderer()->getCaretColor();
         }
-        else if (property == U"CaretWidth")
+        else if (property == Property::CaretWidth)
         {
             m_caretWidthCached = getSharedRenderer()->getCaretWidth();
         }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
+        else if ((property == Property::Opacity) || (property == Property::OpacityDisabled))
         {
             Widget::rendererChanged(property);
 
@@ -1811,7 +1913,7 @@ namespace tgui
             m_textSelection2.setOpacity(m_opacityCached);
             m_defaultText.setOpacity(m_opacityCached);
         }
-        else if (property == U"Font")
+        else if (property == Property::Font)
         {
             Widget::rendererChanged(property);
 
@@ -1832,7 +1934,7 @@ namespace tgui
     std::unique_ptr<DataIO::Node> TextArea::save(SavingRenderersMap& renderers) const
     {
         auto node = Widget::save(renderers);
-        node->propertyValuePairs[U"Text"] = std::make_unique<DataIO::ValueNode>(Serializer::serialize(m_text));
+        node->propertyValuePairs[U"Text"] = std::make_unique<DataIO::ValueNode>(Serializer::serialize(m_wordWrapper.getText()));
         if (!getDefaultText().empty())
             node->propertyValuePairs[U"DefaultText"] = std::make_unique<DataIO::ValueNode>(Serializer::serialize(getDefaultText()));
         node->propertyValuePairs[U"MaximumCharacters"] = std::make_unique<DataIO::ValueNode>(String::fromNumber(m_maxChars));
@@ -1946,7 +2048,7 @@ namespace tgui
             }
 
             // Draw the text
-            if (m_text.empty())
+            if ((m_wordWrapper.getTextLength() == 0) && !m_mappedFile)
                 target.drawText(states, m_defaultText);
             else
             {
@@ -1961,7 +2063,7 @@ namespace tgui
             }
 
             // Only draw the caret when needed
-            if (m_focused && m_caretVisible && (m_caretWidthCached > 0))
+            if (m_focused && m_caretVisible && (m_caretWidthCached > 0) && !m_mappedFile)
             {
                 const float caretHeight = std::max(m_fontCached.getFontHeight(m_textSizeCached), m_lineHeight);
                 states.transform.translate({std::ceil(m_caretPosition.x - (m_caretWidthCached / 2.f)), m_caretPosition.y});
@@ -37,42 +37,6 @@ namespace tgui
 {
     namespace
     {
-        void setTextSizeImpl(std::vector<std::shared_ptr<TreeView::Node>>& nodes, unsigned int textSize)
-        {
-            for (auto& node : nodes)
-            {
-                node->text.setCharacterSize(textSize);
-                if (!node->nodes.empty())
-                    setTextSizeImpl(node->nodes, textSize);
-            }
-        }
-
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-        void setTextOpacityImpl(std::vector<std::shared_ptr<TreeView::Node>>& nodes, float opacity)
-        {
-            for (auto& node : nodes)
-            {
-                node->text.setOpacity(opacity);
-                if (!node->nodes.empty())
-                    setTextOpacityImpl(node->nodes, opacity);
-            }
-        }
-
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-        void setTextFontImpl(std::vector<std::shared_ptr<TreeView::Node>>& nodes, const Font& font)
-        {
-            for (auto& node : nodes)
-            {
-                node->text.setFont(font);
-                if (!node->nodes.empty())
-                    setTextFontImpl(node->nodes, font);
-            }
-        }
-
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
         std::shared_ptr<TreeView::Node> cloneNode(const std::shared_ptr<TreeView::Node>& oldNode, TreeView::Node* parent)
         {
             auto newNode = std::make_shared<TreeView::Node>();
@@ -129,7 +93,7 @@ namespace tgui
         {
             for (auto it = nodes.begin(); it != nodes.end(); ++it)
             {
-                if ((*it)->text.getString() != hierarchy[parentIndex])
+                if ((*it)->text != hierarchy[parentIndex])
                     continue;
 
                 if (parentIndex + 1 == hierarchy.size())
@@ -168,7 +132,7 @@ namespace tgui
             {
                 TreeView::ConstNode constNode;
                 constNode.expanded = node->expanded;
-                constNode.text = node->text.getString();
+                constNode.text = node->text.toString();
                 constNode.nodes = convertNodesToConstNodes(node->nodes);
                 constNodes.push_back(std::move(constNode));
             }
@@ -181,7 +145,7 @@ namespace tgui
         {
             for (auto& node : nodes)
             {
-                if (node->text.getString() != hierarchy[parentIndex])
+                if (node->text != hierarchy[parentIndex])
                     continue;
                 else if (parentIndex + 1 == hierarchy.size())
                     return node.get();
@@ -201,7 +165,7 @@ namespace tgui
                 auto itemNode = std::make_unique<DataIO::Node>();
                 itemNode->name = "Item";
 
-                itemNode->propertyValuePairs[U"Text"] = std::make_unique<DataIO::ValueNode>(Serializer::serialize(item->text.getString()));
+                itemNode->propertyValuePairs[U"Text"] = std::make_unique<DataIO::ValueNode>(Serializer::serialize(item->text.toString()));
 
                 if (!item->nodes.empty())
                 {
@@ -220,9 +184,9 @@ namespace tgui
                         saveItems(itemNode, item->nodes);
                     else
                     {
-                        String itemList = "[" + Serializer::serialize(item->nodes[0]->text.getString());
+                        String itemList = "[" + Serializer::serialize(item->nodes[0]->text.toString());
                         for (std::size_t i = 1; i < item->nodes.size(); ++i)
-                            itemList += ", " + Serializer::serialize(item->nodes[i]->text.getString());
+                            itemList += ", " + Serializer::serialize(item->nodes[i]->text.toString());
                         itemList += "]";
 
                         itemNode->propertyValuePairs[U"Items"] = std::make_unique<DataIO::ValueNode>(itemList);
@@ -345,6 +309,8 @@ namespace tgui
             std::swap(m_selectedBackgroundColorHoverCached, temp.m_selectedBackgroundColorHoverCached);
             std::swap(m_backgroundColorHoverCached,         temp.m_backgroundColorHoverCached);
             std::swap(m_textStyleCached,                    temp.m_textStyleCached);
+
+            m_shownNodeTextsValid = false;
         }
 
         return *this;
@@ -519,7 +485,7 @@ namespace tgui
         assert(node != nullptr);
         while (node)
         {
-            hierarchy.insert(hierarchy.begin(), node->text.getString());
+            hierarchy.insert(hierarchy.begin(), node->text.toString());
             node = node->parent;
         }
 
@@ -541,7 +507,7 @@ namespace tgui
         assert(node != nullptr);
         while (node)
         {
-            hierarchy.insert(hierarchy.begin(), node->text.getString());
+            hierarchy.insert(hierarchy.begin(), node->text.toString());
             node = node->parent;
         }
 
@@ -618,7 +584,7 @@ namespace tgui
         if ((m_textSize == 0) && !getSharedRenderer()->getTextSize())
             m_textSizeCached = Text::findBestTextSize(m_fontCached, m_itemHeight * 0.8f);
 
-        setTextSizeImpl(m_nodes, m_textSizeCached);
+        m_shownNodeTextsValid = false;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -626,6 +592,7 @@ namespace tgui
     void TreeView::setVerticalScrollbarValue(unsigned int value)
     {
         m_verticalScrollbar->setValue(value);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -640,6 +607,7 @@ namespace tgui
     void TreeView::setHorizontalScrollbarValue(unsigned int value)
     {
         m_horizontalScrollbar->setValue(value);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -693,6 +661,9 @@ namespace tgui
                 updateSelectedItem(selectedItem);
             }
         }
+
+        if (m_verticalScrollbar->wasInvalidated() || m_horizontalScrollbar->wasInvalidated())
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -752,7 +723,7 @@ namespace tgui
                         assert(node != nullptr);
                         while (node)
                         {
-                            hierarchy.insert(hierarchy.begin(), node->text.getString());
+                            hierarchy.insert(hierarchy.begin(), node->text.toString());
                             node = node->parent;
                         }
 
@@ -770,6 +741,9 @@ namespace tgui
 
         m_verticalScrollbar->leftMouseReleased(childPos);
         m_horizontalScrollbar->leftMouseReleased(childPos);
+
+        if (m_verticalScrollbar->wasInvalidated() || m_horizontalScrollbar->wasInvalidated())
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -798,7 +772,7 @@ namespace tgui
                 assert(node != nullptr);
                 while (node)
                 {
-                    hierarchy.insert(hierarchy.begin(), node->text.getString());
+                    hierarchy.insert(hierarchy.begin(), node->text.toString());
                     node = node->parent;
                 }
 
@@ -844,6 +818,9 @@ namespace tgui
             else // Mouse is on top of padding or borders
                 updateHoveredItem(-1);
         }
+
+        if (m_verticalScrollbar->wasInvalidated() || m_horizontalScrollbar->wasInvalidated())
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -865,6 +842,9 @@ namespace tgui
         if (scrollbarMoved)
             mouseMoved(pos);
 
+        if (m_verticalScrollbar->wasInvalidated() || m_horizontalScrollbar->wasInvalidated())
+            invalidate();
+
         return scrollbarMoved;
     }
 
@@ -879,6 +859,9 @@ namespace tgui
         updateHoveredItem(-1);
         m_possibleDoubleClick = false;
         updateSelectedAndHoveringItemColors();
+
+        if (m_verticalScrollbar->wasInvalidated() || m_horizontalScrollbar->wasInvalidated())
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -888,6 +871,9 @@ namespace tgui
         Widget::leftMouseButtonNoLongerDown();
         m_verticalScrollbar->leftMouseButtonNoLongerDown();
         m_horizontalScrollbar->leftMouseButtonNoLongerDown();
+
+        if (m_verticalScrollbar->wasInvalidated() || m_horizontalScrollbar->wasInvalidated())
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -988,85 +974,81 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void TreeView::rendererChanged(const String& property)
+    void TreeView::rendererChanged(PropertyId property)
     {
-        if (property == U"Borders")
+        if (property == Property::Borders)
         {
             m_bordersCached = getSharedRenderer()->getBorders();
             setSize(m_size);
         }
-        else if (property == U"Padding")
+        else if (property == Property::Padding)
         {
             m_paddingCached = getSharedRenderer()->getPadding();
             setSize(m_size);
         }
-        else if (property == U"BackgroundColor")
+        else if (property == Property::BackgroundColor)
         {
             m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
         }
-        else if (property == U"SelectedBackgroundColor")
+        else if (property == Property::SelectedBackgroundColor)
         {
             m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
         }
-        else if (property == U"BackgroundColorHover")
+        else if (property == Property::BackgroundColorHover)
         {
             m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
         }
-        else if (property == U"SelectedBackgroundColorHover")
+        else if (property == Property::SelectedBackgroundColorHover)
         {
             m_selectedBackgroundColorHoverCached = getSharedRenderer()->getSelectedBackgroundColorHover();
         }
-        else if (property == U"BorderColor")
+        else if (property == Property::BorderColor)
         {
             m_borderColorCached = getSharedRenderer()->getBorderColor();
         }
-        else if (property == U"TextureBackground")
+        else if (property == Property::TextureBackground)
         {
             m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
         }
-        else if (property == U"TextureBranchExpanded")
+        else if (property == Property::TextureBranchExpanded)
         {
             m_spriteBranchExpanded.setTexture(getSharedRenderer()->getTextureBranchExpanded());
             updateIconBounds();
             markNodesDirty();
         }
-        else if (property == U"TextureBranchCollapsed")
+        else if (property == Property::TextureBranchCollapsed)
         {
             m_spriteBranchCollapsed.setTexture(getSharedRenderer()->getTextureBranchCollapsed());
             updateIconBounds();
             markNodesDirty();
         }
-        else if (property == U"TextureLeaf")
+        else if (property == Property::TextureLeaf)
         {
             m_spriteLeaf.setTexture(getSharedRenderer()->getTextureLeaf());
             updateIconBounds();
             markNodesDirty();
         }
-        else if (property == U"TextColor")
+        else if (property == Property::TextColor)
         {
             m_textColorCached = getSharedRenderer()->getTextColor();
-            updateTextColors(m_nodes);
             updateSelectedAndHoveringItemColors();
         }
-        else if (property == U"TextColorHover")
+        else if (property == Property::TextColorHover)
         {
             m_textColorHoverCached = getSharedRenderer()->getTextColorHover();
-            updateTextColors(m_nodes);
             updateSelectedAndHoveringItemColors();
         }
-        else if (property == U"SelectedTextColor")
+        else if (property == Property::SelectedTextColor)
         {
             m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
-            updateTextColors(m_nodes);
             updateSelectedAndHoveringItemColors();
         }
-        else if (property == U"SelectedTextColorHover")
+        else if (property == Property::SelectedTextColorHover)
         {
             m_selectedTextColorHoverCached = getSharedRenderer()->getSelectedTextColorHover();
-            updateTextColors(m_nodes);
             updateSelectedAndHoveringItemColors();
         }
-        else if (property == U"Scrollbar")
+        else if (property == Property::Scrollbar)
         {
             m_verticalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
             m_horizontalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
@@ -1080,18 +1062,18 @@ namespace tgui
                 markNodesDirty();
             }
         }
-        else if (property == U"ScrollbarWidth")
+        else if (property == Property::ScrollbarWidth)
         {
             const float width = (getSharedRenderer()->getScrollbarWidth() != 0) ? getSharedRenderer()->getScrollbarWidth() : m_verticalScrollbar->getDefaultWidth();
             m_verticalScrollbar->setSize({width, m_verticalScrollbar->getSize().y});
             m_horizontalScrollbar->setSize({m_horizontalScrollbar->getSize().x, width});
             markNodesDirty();
         }
-        else if ((property == U"Opacity") || (property == U"OpacityDisabled"))
+        else if ((property == Property::Opacity) || (property == Property::OpacityDisabled))
         {
             Widget::rendererChanged(property);
 
-            setTextOpacityImpl(m_nodes, m_opacityCached);
+            m_shownNodeTextsValid = false;
 
             m_spriteBackground.setOpacity(m_opacityCached);
             m_spriteBranchExpanded.setOpacity(m_opacityCached);
@@ -1101,10 +1083,10 @@ namespace tgui
             m_verticalScrollbar->setInheritedOpacity(m_opacityCached);
             m_horizontalScrollbar->setInheritedOpacity(m_opacityCached);
         }
-        else if (property == U"Font")
+        else if (property == Property::Font)
         {
             Widget::rendererChanged(property);
-            setTextFontImpl(m_nodes, m_fontCached);
+            m_shownNodeTextsValid = false;
         }
         else
             Widget::rendererChanged(property);
@@ -1200,10 +1182,9 @@ namespace tgui
 
             const float iconPadding = (m_iconBounds.x / 4.f);
             const float iconOffset = iconPadding + ((m_iconBounds.x + iconPadding) * node->depth);
-            node->text.setPosition({iconOffset + m_iconBounds.x + iconPadding + textPadding,
-                                    (pos * m_itemHeight) + ((m_itemHeight - node->text.getSize().y) / 2.f)});
+            const float textLeft = iconOffset + m_iconBounds.x + iconPadding + textPadding;
 
-            const float right = node->text.getPosition().x + node->text.getSize().x + m_paddingCached.getRight();
+            const float right = textLeft + Text::getLineWidth(node->text.toString(), m_fontCached, m_textSizeCached) + m_paddingCached.getRight();
             if (right > m_maxRight)
                 m_maxRight = right;
 
@@ -1229,6 +1210,7 @@ namespace tgui
         m_hoveredItem = -1;
         m_selectedItem = -1;
         m_visibleNodes.clear();
+        m_shownNodeTextsValid = false;
         updateVisibleNodes(m_nodes, selectedNode, Text::getExtraHorizontalPadding(m_fontCached, m_textSizeCached), 0);
 
         if (oldHoveredItem >= 0)
@@ -1236,7 +1218,6 @@ namespace tgui
             if (static_cast<std::size_t>(oldHoveredItem) < m_visibleNodes.size())
                 m_hoveredItem = oldHoveredItem;
 
-            updateTextColors(m_nodes);
             updateSelectedAndHoveringItemColors();
         }
 
@@ -1271,6 +1252,7 @@ namespace tgui
 
         m_verticalScrollbar->setPosition(getSize().x - m_bordersCached.getRight() - m_verticalScrollbar->getSize().x, m_bordersCached.getTop());
         m_horizontalScrollbar->setPosition(m_bordersCached.getLeft(), getSize().y - m_bordersCached.getBottom() - m_horizontalScrollbar->getSize().y);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1308,8 +1290,13 @@ namespace tgui
             // Show another item when the scrollbar is standing between two items
             if ((m_verticalScrollbar->getValue() + m_verticalScrollbar->getViewportSize()) % m_itemHeight != 0)
                 ++lastNode;
+
+            lastNode = std::min(lastNode, m_visibleNodes.size());
         }
 
+        if (!m_shownNodeTextsValid || (firstNode != m_shownNodeTextsFirstNode) || (lastNode - firstNode != m_shownNodeTexts.size()))
+            updateShownNodeTexts(firstNode, lastNode);
+
         states.transform.translate({m_paddingCached.getLeft() - m_horizontalScrollbar->getValue(), m_paddingCached.getTop() - m_verticalScrollbar->getValue()});
 
         // Draw the background of the selected item
@@ -1410,8 +1397,8 @@ namespace tgui
         }
 
         // Draw the texts
-        for (std::size_t i = firstNode; i < lastNode; ++i)
-            target.drawText(states, m_visibleNodes[i]->text);
+        for (const auto& text : m_shownNodeTexts)
+            target.drawText(states, text);
 
         target.removeClippingLayer();
 
@@ -1424,11 +1411,7 @@ namespace tgui
     void TreeView::createNode(std::vector<std::shared_ptr<Node>>& nodes, Node* parent, const String& text)
     {
         auto newNode = std::make_shared<Node>();
-        newNode->text.setFont(m_fontCached);
-        newNode->text.setColor(m_textColorCached);
-        newNode->text.setOpacity(m_opacityCached);
-        newNode->text.setCharacterSize(m_textSizeCached);
-        newNode->text.setString(text);
+        newNode->text = text;
         newNode->expanded = true;
         newNode->parent = parent;
 
@@ -1488,7 +1471,7 @@ namespace tgui
         {
             for (const auto& node : m_nodes)
             {
-                if (node->text.getString() != hierarchy.back())
+                if (node->text != hierarchy.back())
                     continue;
 
                 if (node->expanded != expandNode)
@@ -1506,32 +1489,48 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void TreeView::updateTextColors(std::vector<std::shared_ptr<Node>>& nodes)
+    void TreeView::updateSelectedAndHoveringItemColors()
     {
-        for (auto& node : nodes)
-        {
-            node->text.setColor(m_textColorCached);
-            updateTextColors(node->nodes);
-        }
+        // The colors are applied when the texts of the items on the screen are recreated
+        m_shownNodeTextsValid = false;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void TreeView::updateSelectedAndHoveringItemColors()
+    void TreeView::updateShownNodeTexts(std::size_t firstNode, std::size_t lastNode) const
     {
-        if (m_selectedItem >= 0)
-        {
-            if ((m_selectedItem == m_hoveredItem) && m_selectedTextColorHoverCached.isSet())
-                m_visibleNodes[static_cast<std::size_t>(m_selectedItem)]->text.setColor(m_selectedTextColorHoverCached);
-            else if (m_selectedTextColorCached.isSet())
-                m_visibleNodes[static_cast<std::size_t>(m_selectedItem)]->text.setColor(m_selectedTextColorCached);
-        }
+        const float textPadding = Text::getExtraHorizontalPadding(m_fontCached, m_textSizeCached);
+        const float iconPadding = (m_iconBounds.x / 4.f);
 
-        if ((m_hoveredItem >= 0) && (m_selectedItem != m_hoveredItem))
+        m_shownNodeTexts.resize(lastNode - firstNode);
+        for (std::size_t i = firstNode; i < lastNode; ++i)
         {
-            if (m_textColorHoverCached.isSet())
-                m_visibleNodes[static_cast<std::size_t>(m_hoveredItem)]->text.setColor(m_textColorHoverCached);
+            Color color = m_textColorCached;
+            if (static_cast<int>(i) == m_selectedItem)
+            {
+                if ((m_selectedItem == m_hoveredItem) && m_selectedTextColorHoverCached.isSet())
+                    color = m_selectedTextColorHoverCached;
+                else if (m_selectedTextColorCached.isSet())
+                    color = m_selectedTextColorCached;
+            }
+            else if ((static_cast<int>(i) == m_hoveredItem) && m_textColorHoverCached.isSet())
+                color = m_textColorHoverCached;
+
+            Text& text = m_shownNodeTexts[i - firstNode];
+            text.setFont(m_fontCached);
+            text.setColor(color);
+            text.setOpacity(m_opacityCached);
+            text.setCharacterSize(m_textSizeCached);
+            text.setString(m_visibleNodes[i]->text.toString());
+
+            const float iconOffset = iconPadding + ((m_iconBounds.x + iconPadding) * m_visibleNodes[i]->depth);
+            text.setPosition({iconOffset + m_iconBounds.x + iconPadding + textPadding,
+                              (i * m_itemHeight) + ((m_itemHeight - text.getSize().y) / 2.f)});
         }
+
+        m_shownNodeTextsFirstNode = firstNode;
+        m_shownNodeTextsValid = true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1541,14 +1540,6 @@ namespace tgui
         if (m_hoveredItem == item)
             return;
 
-        if (m_hoveredItem >= 0)
-        {
-            if ((m_selectedItem == m_hoveredItem) && m_selectedTextColorCached.isSet())
-                m_visibleNodes[static_cast<std::size_t>(m_hoveredItem)]->text.setColor(m_selectedTextColorCached);
-            else
-                m_visibleNodes[static_cast<std::size_t>(m_hoveredItem)]->text.setColor(m_textColorCached);
-        }
-
         m_hoveredItem = item;
         updateSelectedAndHoveringItemColors();
     }
@@ -1560,14 +1551,6 @@ namespace tgui
         if (m_selectedItem == item)
             return;
 
-        if (m_selectedItem >= 0)
-        {
-            if ((m_selectedItem == m_hoveredItem) && m_textColorHoverCached.isSet())
-                m_visibleNodes[static_cast<std::size_t>(m_selectedItem)]->text.setColor(m_textColorHoverCached);
-            else
-                m_visibleNodes[static_cast<std::size_t>(m_selectedItem)]->text.setColor(m_textColorCached);
-        }
-
         m_selectedItem = item;
         if (m_selectedItem >= 0)
         {
@@ -1576,7 +1559,7 @@ namespace tgui
             assert(node != nullptr);
             while (node)
             {
-                hierarchy.insert(hierarchy.begin(), node->text.getString());
+                hierarchy.insert(hierarchy.begin(), node->text.toString());
                 node = node->parent;
             }
 
@@ -1594,7 +1577,7 @@ namespace tgui
     {
         for (auto& node : nodes)
         {
-            if (node->text.getString() != hierarchy[parentIndex])
+            if (node->text != hierarchy[parentIndex])
                 continue;
             else if (parentIndex + 2 == hierarchy.size())
                 return node.get();
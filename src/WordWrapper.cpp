@@ -0,0 +1,518 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2023 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/WordWrapper.hpp>
+#include <TGUI/Text.hpp>
+#include <TGUI/Backend/Font/BackendFont.hpp>
+
+#if !TGUI_EXPERIMENTAL_USE_STD_MODULE
+    #include <algorithm>
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        // Returns the lowest set bit of a number, which determines the range that each element of a Fenwick tree covers
+        TGUI_NODISCARD std::size_t lowestBit(std::size_t value)
+        {
+            return value & (~value + 1);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void WordWrapper::setText(const String& text)
+    {
+        const String oldText = m_text.getText();
+
+        // Only the characters that differ from the current ones have to be replaced
+        std::size_t prefixLength = 0;
+        while ((prefixLength < oldText.length()) && (prefixLength < text.length()) && (oldText[prefixLength] == text[prefixLength]))
+            ++prefixLength;
+
+        if ((prefixLength == oldText.length()) && (prefixLength == text.length()))
+            return;
+
+        std::size_t suffixLength = 0;
+        while ((suffixLength < oldText.length() - prefixLength) && (suffixLength < text.length() - prefixLength)
+            && (oldText[oldText.length() - suffixLength - 1] == text[text.length() - suffixLength - 1]))
+        {
+            ++suffixLength;
+        }
+
+        if ((prefixLength == 0) && (suffixLength == 0))
+        {
+            // Nothing can be reused, so start over with a single piece that contains the entire text
+            m_text.setText(text);
+            m_paragraphs.assign(static_cast<std::size_t>(std::count(text.begin(), text.end(), U'\n')) + 1, Paragraph{});
+            m_allParagraphsDirty = true;
+            m_lineCountTreeValid = false;
+            return;
+        }
+
+        eraseText(prefixLength, oldText.length() - prefixLength - suffixLength);
+        insertText(prefixLength, text.substr(prefixLength, text.length() - prefixLength - suffixLength));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    String WordWrapper::getText() const
+    {
+        return m_text.getText();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    String WordWrapper::getSubstring(std::size_t index, std::size_t count) const
+    {
+        return m_text.substr(index, count);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t WordWrapper::getTextLength() const
+    {
+        return m_text.length();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void WordWrapper::appendText(const String& text)
+    {
+        insertText(m_text.length(), text);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void WordWrapper::insertText(std::size_t index, const String& text)
+    {
+        TGUI_ASSERT(index <= m_text.length(), "Index passed to WordWrapper::insertText can't be beyond the end of the text");
+        if (text.empty())
+            return;
+
+        // Inserting newlines splits the paragraph in multiple paragraphs
+        const std::size_t paragraphIndex = m_text.getLineOfIndex(index);
+        const auto newlineCount = static_cast<std::size_t>(std::count(text.begin(), text.end(), U'\n'));
+        m_text.insert(index, text);
+        replaceParagraphs(paragraphIndex, 1, newlineCount + 1);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void WordWrapper::eraseText(std::size_t index, std::size_t count)
+    {
+        TGUI_ASSERT(index <= m_text.length(), "Index passed to WordWrapper::eraseText can't be beyond the end of the text");
+        count = std::min(count, m_text.length() - index);
+        if (count == 0)
+            return;
+
+        // When the erased characters include newlines then paragraphs are merged
+        const std::size_t firstParagraphIndex = m_text.getLineOfIndex(index);
+        const std::size_t lastParagraphIndex = m_text.getLineOfIndex(index + count);
+        m_text.erase(index, count);
+        replaceParagraphs(firstParagraphIndex, lastParagraphIndex - firstParagraphIndex + 1, 1);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void WordWrapper::setWrapping(float maxWidth, const Font& font, unsigned int characterSize, bool bold)
+    {
+        const float fontScale = (font != nullptr) ? font.getBackendFont()->getFontScale() : 1;
+        if ((maxWidth == m_maxWidth) && (font == m_font) && (fontScale == m_fontScale) && (characterSize == m_characterSize) && (bold == m_bold))
+            return;
+
+        m_maxWidth = maxWidth;
+        m_font = font;
+        m_fontScale = fontScale;
+        m_characterSize = characterSize;
+        m_bold = bold;
+        m_allParagraphsDirty = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t WordWrapper::getLineCount() const
+    {
+        updateLines();
+        return getLineCountBeforeParagraph(m_paragraphs.size());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    String WordWrapper::getLine(std::size_t lineIndex) const
+    {
+        return m_text.substr(getLineStartIndex(lineIndex), getLineLength(lineIndex));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t WordWrapper::getLineLength(std::size_t lineIndex) const
+    {
+        updateLines();
+        const std::size_t paragraphIndex = findParagraphOfLine(lineIndex);
+        const auto& lineBreaks = m_paragraphs[paragraphIndex].lineBreaks;
+
+        const std::size_t lineStart = (lineIndex > 0) ? lineBreaks[lineIndex - 1] : 0;
+        const std::size_t lineEnd = (lineIndex < lineBreaks.size()) ? lineBreaks[lineIndex] : m_text.getLineLength(paragraphIndex);
+        return lineEnd - lineStart;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t WordWrapper::getLineStartIndex(std::size_t lineIndex) const
+    {
+        updateLines();
+        const std::size_t paragraphIndex = findParagraphOfLine(lineIndex);
+        const std::size_t paragraphStart = m_text.getLineStart(paragraphIndex);
+        if (lineIndex > 0)
+            return paragraphStart + m_paragraphs[paragraphIndex].lineBreaks[lineIndex - 1];
+        else
+            return paragraphStart;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Vector2<std::size_t> WordWrapper::getPositionOfIndex(std::size_t index) const
+    {
+        TGUI_ASSERT(index <= m_text.length(), "Index passed to WordWrapper::getPositionOfIndex can't be beyond the end of the text");
+        updateLines();
+
+        const std::size_t paragraphIndex = m_text.getLineOfIndex(index);
+        const std::size_t indexInParagraph = index - m_text.getLineStart(paragraphIndex);
+
+        // A character on a line break is considered to be at the end of the previous line
+        const auto& lineBreaks = m_paragraphs[paragraphIndex].lineBreaks;
+        const auto lineBreakIt = std::lower_bound(lineBreaks.begin(), lineBreaks.end(), indexInParagraph);
+        const auto lineInParagraph = static_cast<std::size_t>(lineBreakIt - lineBreaks.begin());
+        const std::size_t lineStart = (lineInParagraph > 0) ? lineBreaks[lineInParagraph - 1] : 0;
+        return {indexInParagraph - lineStart, getLineCountBeforeParagraph(paragraphIndex) + lineInParagraph};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<String> WordWrapper::getLines() const
+    {
+        updateLines();
+
+        const String text = m_text.getText();
+        std::vector<String> lines;
+        lines.reserve(getLineCount());
+
+        std::size_t paragraphStart = 0;
+        for (const auto& paragraph : m_paragraphs)
+        {
+            std::size_t paragraphEnd = text.find(U'\n', paragraphStart);
+            if (paragraphEnd == String::npos)
+                paragraphEnd = text.length();
+
+            std::size_t lineStart = paragraphStart;
+            for (const std::size_t lineBreak : paragraph.lineBreaks)
+            {
+                lines.push_back(text.substr(lineStart, paragraphStart + lineBreak - lineStart));
+                lineStart = paragraphStart + lineBreak;
+            }
+
+            lines.push_back(text.substr(lineStart, paragraphEnd - lineStart));
+            paragraphStart = paragraphEnd + 1;
+        }
+
+        return lines;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float WordWrapper::getMaximumLineWidth() const
+    {
+        updateLines();
+
+        float maxLineWidth = 0;
+        for (std::size_t i = 0; i < m_paragraphs.size(); ++i)
+        {
+            Paragraph& paragraph = m_paragraphs[i];
+            if (paragraph.maxLineWidth < 0)
+            {
+                const TextStyles style = m_bold ? TextStyle::Bold : TextStyle::Regular;
+                const String text = m_text.substr(m_text.getLineStart(i), m_text.getLineLength(i));
+
+                paragraph.maxLineWidth = 0;
+                std::size_t lineStart = 0;
+                for (std::size_t lineIndex = 0; lineIndex <= paragraph.lineBreaks.size(); ++lineIndex)
+                {
+                    const std::size_t lineEnd = (lineIndex < paragraph.lineBreaks.size()) ? paragraph.lineBreaks[lineIndex] : text.length();
+                    const float lineWidth = Text::getLineWidth(text.substr(lineStart, lineEnd - lineStart), m_font, m_characterSize, style);
+                    paragraph.maxLineWidth = std::max(paragraph.maxLineWidth, lineWidth);
+                    lineStart = lineEnd;
+                }
+            }
+
+            maxLineWidth = std::max(maxLineWidth, paragraph.maxLineWidth);
+        }
+
+        return maxLineWidth;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    String WordWrapper::getWrappedText() const
+    {
+        const auto lines = getLines();
+
+        String text;
+        text.reserve(m_text.length() + lines.size());
+        for (std::size_t i = 0; i < lines.size(); ++i)
+        {
+            if (i > 0)
+                text += U'\n';
+
+            text += lines[i];
+        }
+
+        return text;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t WordWrapper::getWrappedParagraphCount() const
+    {
+        return m_wrappedParagraphCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void WordWrapper::replaceParagraphs(std::size_t first, std::size_t oldCount, std::size_t newCount)
+    {
+        const auto firstParagraphIt = m_paragraphs.begin() + static_cast<std::ptrdiff_t>(first);
+        if (newCount > oldCount)
+            m_paragraphs.insert(firstParagraphIt + static_cast<std::ptrdiff_t>(oldCount), newCount - oldCount, Paragraph{});
+        else if (newCount < oldCount)
+            m_paragraphs.erase(firstParagraphIt + static_cast<std::ptrdiff_t>(newCount), firstParagraphIt + static_cast<std::ptrdiff_t>(oldCount));
+
+        if (newCount != oldCount)
+        {
+            m_lineCountTreeValid = false;
+
+            // Dirty paragraphs behind the replaced ones have moved
+            if (m_dirtyParagraphsEnd > first + oldCount)
+                m_dirtyParagraphsEnd = m_dirtyParagraphsEnd - oldCount + newCount;
+        }
+
+        for (std::size_t i = first; i < first + newCount; ++i)
+            m_paragraphs[i].dirty = true;
+
+        if (m_dirtyParagraphsBegin < m_dirtyParagraphsEnd)
+        {
+            m_dirtyParagraphsBegin = std::min(m_dirtyParagraphsBegin, first);
+            m_dirtyParagraphsEnd = std::max(m_dirtyParagraphsEnd, first + newCount);
+        }
+        else
+        {
+            m_dirtyParagraphsBegin = first;
+            m_dirtyParagraphsEnd = first + newCount;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void WordWrapper::updateLines() const
+    {
+        if (m_allParagraphsDirty)
+        {
+            const String text = m_text.getText();
+            std::size_t paragraphStart = 0;
+            for (auto& paragraph : m_paragraphs)
+            {
+                std::size_t paragraphEnd = text.find(U'\n', paragraphStart);
+                if (paragraphEnd == String::npos)
+                    paragraphEnd = text.length();
+
+                wrapParagraph(text.substr(paragraphStart, paragraphEnd - paragraphStart), paragraph.lineBreaks);
+                paragraph.dirty = false;
+                paragraph.maxLineWidth = -1;
+                paragraphStart = paragraphEnd + 1;
+            }
+
+            m_wrappedParagraphCount += m_paragraphs.size();
+            m_allParagraphsDirty = false;
+            m_lineCountTreeValid = false;
+        }
+        else if (m_dirtyParagraphsBegin < m_dirtyParagraphsEnd)
+        {
+            const std::size_t dirtyParagraphsEnd = std::min(m_dirtyParagraphsEnd, m_paragraphs.size());
+            for (std::size_t i = m_dirtyParagraphsBegin; i < dirtyParagraphsEnd; ++i)
+            {
+                Paragraph& paragraph = m_paragraphs[i];
+                if (!paragraph.dirty)
+                    continue;
+
+                const std::size_t oldLineCount = paragraph.lineBreaks.size() + 1;
+                wrapParagraph(m_text.substr(m_text.getLineStart(i), m_text.getLineLength(i)), paragraph.lineBreaks);
+                paragraph.dirty = false;
+                paragraph.maxLineWidth = -1;
+                ++m_wrappedParagraphCount;
+
+                // Unsigned overflow is intended here when the amount of lines decreased
+                const std::size_t lineCountChange = paragraph.lineBreaks.size() + 1 - oldLineCount;
+                if (m_lineCountTreeValid && (lineCountChange != 0))
+                {
+                    for (std::size_t j = i + 1; j <= m_paragraphs.size(); j += lowestBit(j))
+                        m_lineCountTree[j] += lineCountChange;
+                }
+            }
+        }
+
+        m_dirtyParagraphsBegin = 0;
+        m_dirtyParagraphsEnd = 0;
+
+        if (!m_lineCountTreeValid)
+        {
+            m_lineCountTree.assign(m_paragraphs.size() + 1, 0);
+            for (std::size_t i = 1; i <= m_paragraphs.size(); ++i)
+            {
+                m_lineCountTree[i] += m_paragraphs[i - 1].lineBreaks.size() + 1;
+
+                const std::size_t parent = i + lowestBit(i);
+                if (parent <= m_paragraphs.size())
+                    m_lineCountTree[parent] += m_lineCountTree[i];
+            }
+
+            m_lineCountTreeValid = true;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t WordWrapper::getLineCountBeforeParagraph(std::size_t paragraphIndex) const
+    {
+        std::size_t lineCount = 0;
+        for (std::size_t i = paragraphIndex; i > 0; i -= lowestBit(i))
+            lineCount += m_lineCountTree[i];
+
+        return lineCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t WordWrapper::findParagraphOfLine(std::size_t& lineIndex) const
+    {
+        TGUI_ASSERT(lineIndex < getLineCountBeforeParagraph(m_paragraphs.size()), "Line index passed to WordWrapper must be smaller than getLineCount()");
+
+        // Descend the Fenwick tree to find the last paragraph that starts at or before the line
+        std::size_t step = 1;
+        while (step * 2 <= m_paragraphs.size())
+            step *= 2;
+
+        std::size_t paragraphIndex = 0;
+        for (; step > 0; step /= 2)
+        {
+            if ((paragraphIndex + step <= m_paragraphs.size()) && (m_lineCountTree[paragraphIndex + step] <= lineIndex))
+            {
+                paragraphIndex += step;
+                lineIndex -= m_lineCountTree[paragraphIndex];
+            }
+        }
+
+        return paragraphIndex;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void WordWrapper::wrapParagraph(const String& text, std::vector<std::size_t>& lineBreaks) const
+    {
+        lineBreaks.clear();
+        if ((m_maxWidth <= 0) || (m_font == nullptr) || text.empty())
+            return;
+
+        // This is the same algorithm as in Text::wordWrap, but for a text without newlines. The advances are taken directly
+        // from the font instead of from the GlyphRunCache, because caching every paragraph would evict all other strings.
+        const float whitespaceWidth = m_font.getGlyphAdvance(U' ', m_characterSize, m_bold);
+        std::size_t index = 0;
+        while (index < text.length())
+        {
+            const std::size_t oldIndex = index;
+
+            // Find out how many characters we can get on this line
+            float width = 0;
+            char32_t prevChar = 0;
+            for (std::size_t i = index; i < text.length(); ++i)
+            {
+                const char32_t curChar = text[i];
+                if (curChar == U'\r')
+                {
+                    // Skip carriage return characters which aren't rendered
+                    index++;
+                    continue;
+                }
+
+                float charWidth;
+                if (curChar == U' ')
+                    charWidth = whitespaceWidth;
+                else if (curChar == U'\t')
+                    charWidth = whitespaceWidth * 4;
+                else
+                    charWidth = m_font.getGlyphAdvance(curChar, m_characterSize, m_bold);
+
+                const float kerning = m_font.getKerning(prevChar, curChar, m_characterSize, m_bold);
+                const bool charIsWhitespace = (curChar == U' ') || (curChar == U'\t');
+
+                // We add the character to the line, unless a non-whitespace character exceeds the line length
+                if (charIsWhitespace || (width + charWidth + kerning <= m_maxWidth))
+                {
+                    width += kerning + charWidth;
+                    index++;
+                }
+                else
+                    break;
+
+                prevChar = curChar;
+            }
+
+            // We must always add at least one character to the line
+            if (index == oldIndex)
+                index++;
+
+            // Implement the word-wrap by removing the last few characters from the line
+            const std::size_t indexWithoutWordWrap = index;
+            if ((index < text.length()) && (!isWhitespace(text[index])))
+            {
+                while ((index > oldIndex) && !isWhitespace(text[index - 1]))
+                    index--;
+
+                // If the entire word doesn't fit on the line then we have no other choice than to simply split the word
+                if (index == oldIndex)
+                    index = indexWithoutWordWrap;
+            }
+
+            if (index < text.length())
+                lineBreaks.push_back(index);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,157 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2023 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+
+// These test cases measure the performance of hot code paths. They are hidden and only run when requested explicitly,
+// e.g. with "tests [.benchmark]". The results are printed as warnings.
+
+static double measureMilliseconds(unsigned int iterations, const std::function<void()>& func)
+{
+    func(); // Warm up
+
+    const auto startTime = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < iterations; ++i)
+        func();
+
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count() / iterations;
+}
+
+TEST_CASE("[Benchmark] Word-wrapping long text", "[.benchmark]")
+{
+    tgui::Font font("resources/DejaVuSans.ttf");
+
+    // The font can measure latin text with table lookups. The same text written with greek letters has to use the slower
+    // path, as those code points don't fit in the tables.
+    const tgui::String sentence = "the quick brown fox jumps over the lazy dog while the five boxing wizards jump quickly\n";
+    tgui::String latinText;
+    for (unsigned int i = 0; i < 1000; ++i)
+        latinText += sentence;
+
+    tgui::String greekText = latinText;
+    for (auto& c : greekText)
+    {
+        if ((c >= U'a') && (c <= U'z'))
+            c = U'\u03B1' + (c - U'a');
+    }
+
+    // Disable the glyph run cache, otherwise only the first call would measure the text
+    const std::size_t glyphRunCacheLimit = tgui::GlyphRunCache::getMemoryLimit();
+    tgui::GlyphRunCache::setMemoryLimit(0);
+
+    tgui::String result;
+    const double latinTime = measureMilliseconds(20, [&]{ result = tgui::Text::wordWrap(300, latinText, font, 16, false); });
+    const double greekTime = measureMilliseconds(20, [&]{ result = tgui::Text::wordWrap(300, greekText, font, 16, false); });
+
+    tgui::GlyphRunCache::setMemoryLimit(glyphRunCacheLimit);
+
+    WARN("Text::wordWrap of " << latinText.length() << " characters: " << latinTime << " ms for latin text (dense tables), "
+         << greekTime << " ms for greek text (glyph lookups)");
+    REQUIRE(!result.empty());
+}
+
+TEST_CASE("[Benchmark] UTF conversions", "[.benchmark]")
+{
+    // Text of about 1 MB in scripts that use 1, 2 and 3 bytes per character in UTF-8
+    const std::pair<const char*, std::u32string> corpora[] = {
+        {"ASCII", U"the quick brown fox jumps over the lazy dog while the five boxing wizards jump quickly\n"},
+        {"Latin-1", U"Le c\u0153ur d\u00E9\u00E7u mais l'\u00E2me plut\u00F4t na\u00EFve, Lou\u00FFs r\u00EAva de crapa\u00FCter en cano\u00EB\n"},
+        {"CJK", U"\u6211\u80FD\u541E\u4E0B\u73BB\u7483\u800C\u4E0D\u4F24\u8EAB\u4F53\u3002\u6211\u80FD\u541E\u4E0B\u73BB\u7483\u800C\u4E0D\u4F24\u8EAB\u4F53\u3002\n"}
+    };
+
+    for (const auto& corpus : corpora)
+    {
+        std::u32string strUtf32;
+        while (strUtf32.length() < 1000000)
+            strUtf32 += corpus.second;
+
+        const std::string strUtf8 = tgui::utf::convertUtf32toStdStringUtf8(strUtf32);
+        const std::u16string strUtf16 = tgui::utf::convertUtf32toUtf16(strUtf32);
+
+        // The iterator overloads decode one character at a time, the pointer overloads process ASCII characters in chunks
+        std::u32string result;
+        const double utf8ScalarTime = measureMilliseconds(10, [&]{ result = tgui::utf::convertUtf8toUtf32(strUtf8.begin(), strUtf8.end()); });
+        const double utf8Time = measureMilliseconds(10, [&]{ result = tgui::utf::convertUtf8toUtf32(strUtf8.data(), strUtf8.data() + strUtf8.length()); });
+        REQUIRE(result == strUtf32);
+
+        const double utf16ScalarTime = measureMilliseconds(10, [&]{ result = tgui::utf::convertUtf16toUtf32(strUtf16.begin(), strUtf16.end()); });
+        const double utf16Time = measureMilliseconds(10, [&]{ result = tgui::utf::convertUtf16toUtf32(strUtf16.data(), strUtf16.data() + strUtf16.length()); });
+        REQUIRE(result == strUtf32);
+
+        std::string resultUtf8;
+        const double toUtf8ScalarTime = measureMilliseconds(10, [&]{
+            resultUtf8.clear();
+            for (const char32_t c : strUtf32)
+                tgui::utf::encodeCharUtf8(c, resultUtf8);
+        });
+        const double toUtf8Time = measureMilliseconds(10, [&]{ resultUtf8 = tgui::utf::convertUtf32toStdStringUtf8(strUtf32); });
+        REQUIRE(resultUtf8 == strUtf8);
+
+        std::u16string resultUtf16;
+        const double toUtf16Time = measureMilliseconds(10, [&]{ resultUtf16 = tgui::utf::convertUtf32toUtf16(strUtf32); });
+        REQUIRE(resultUtf16 == strUtf16);
+
+        WARN("UTF conversions of " << strUtf32.length() << " " << corpus.first << " characters (scalar vs chunked): "
+             << "UTF-8 to UTF-32 " << utf8ScalarTime << " ms vs " << utf8Time << " ms, "
+             << "UTF-16 to UTF-32 " << utf16ScalarTime << " ms vs " << utf16Time << " ms, "
+             << "UTF-32 to UTF-8 " << toUtf8ScalarTime << " ms vs " << toUtf8Time << " ms, "
+             << "UTF-32 to UTF-16 " << toUtf16Time << " ms");
+    }
+}
+
+TEST_CASE("[Benchmark] Parsing theme files", "[.benchmark]")
+{
+    for (const char* filename : {"resources/Black.txt", "resources/BabyBlue.txt", "resources/TransparentGrey.txt"})
+    {
+        std::size_t fileSize;
+        const auto fileContents = tgui::readFileToMemory(filename, fileSize);
+        REQUIRE(fileContents);
+
+        // Besides the theme file itself, a file of about 2 MB is parsed that contains the theme many times
+        const std::string contents{reinterpret_cast<const char*>(fileContents.get()), fileSize};
+        std::string largeContents;
+        while (largeContents.length() < 2000000)
+            largeContents += contents;
+
+        // Both parse overloads share the same parser, so only parsing from memory (as done when loading themes) is measured
+        std::unique_ptr<tgui::DataIO::Node> root;
+        const double time = measureMilliseconds(20, [&]{ root = tgui::DataIO::parse(tgui::CharStringView{contents.data(), contents.size()}); });
+        REQUIRE(!root->children.empty());
+
+        const double largeTime = measureMilliseconds(3, [&]{ root = tgui::DataIO::parse(tgui::CharStringView{largeContents.data(), largeContents.size()}); });
+        REQUIRE(!root->children.empty());
+
+        // The read-only document places its nodes in large memory blocks instead of allocating each node separately
+        tgui::DataIO::Document document;
+        const double documentTime = measureMilliseconds(20, [&]{ document = tgui::DataIO::parseDocument(tgui::CharStringView{contents.data(), contents.size()}); });
+        REQUIRE(document.getRoot().childCount > 0);
+
+        const double largeDocumentTime = measureMilliseconds(3, [&]{ document = tgui::DataIO::parseDocument(tgui::CharStringView{largeContents.data(), largeContents.size()}); });
+        REQUIRE(document.getRoot().childCount > 0);
+
+        WARN("Parsing " << filename << " (parse vs parseDocument): " << time << " ms vs " << documentTime << " ms, "
+             << largeContents.length() << " bytes: " << largeTime << " ms vs " << largeDocumentTime << " ms");
+    }
+}
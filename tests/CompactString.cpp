@@ -0,0 +1,81 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2023 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/CompactString.hpp>
+#include <TGUI/Utf.hpp>
+
+TEST_CASE("[CompactString]")
+{
+    SECTION("Empty")
+    {
+        tgui::CompactString str;
+        REQUIRE(str.empty());
+        REQUIRE(str.length() == 0);
+        REQUIRE(str.isAscii());
+        REQUIRE(str.toString() == "");
+        REQUIRE(str == tgui::String());
+    }
+
+    SECTION("ASCII")
+    {
+        const tgui::CompactString str = tgui::String("Item 1");
+        REQUIRE(!str.empty());
+        REQUIRE(str.length() == 6);
+        REQUIRE(str.isAscii());
+        REQUIRE(str.toStdString() == "Item 1");
+        REQUIRE(str.toString() == "Item 1");
+        REQUIRE(str == tgui::String("Item 1"));
+        REQUIRE(str != tgui::String("Item 2"));
+        REQUIRE(str != tgui::String("Item"));
+        REQUIRE(str == tgui::CompactString("Item 1"));
+    }
+
+    SECTION("Unicode")
+    {
+        const tgui::CompactString str = tgui::String(U"été \U0001F600");
+        REQUIRE(str.length() == 5);
+        REQUIRE(!str.isAscii());
+        REQUIRE(str.toStdString() == "\xC3\xA9t\xC3\xA9 \xF0\x9F\x98\x80");
+        REQUIRE(str.toString() == U"été \U0001F600");
+        REQUIRE(str == tgui::String(U"été \U0001F600"));
+        REQUIRE(str != tgui::String(U"été \U0001F601"));
+        REQUIRE(str == tgui::CompactString(std::string("\xC3\xA9t\xC3\xA9 \xF0\x9F\x98\x80")));
+        REQUIRE(tgui::CompactString("\xC3\xA9t\xC3\xA9").length() == 3);
+    }
+    SECTION("Invalid UTF-8")
+    {
+        for (const std::string& input : {std::string("\xE9"), std::string("a\xE9"), std::string("\xE9t\xE9"), std::string("a\xC3\xA9\xFF")})
+        {
+            const tgui::CompactString str{input};
+            const tgui::String expected = tgui::utf::convertUtf8toUtf32(input.data(), input.data() + input.length());
+            REQUIRE(str.length() == expected.length());
+            REQUIRE(str.toString() == expected);
+            REQUIRE(str == expected);
+            for (const char32_t c : str.toString())
+                REQUIRE(c <= 0x10FFFF);
+        }
+    }
+}
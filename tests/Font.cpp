@@ -22,6 +22,9 @@
 //
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+#include <chrono>
+#include <thread>
+
 #include "Tests.hpp"
 
 TEST_CASE("[Font]")
@@ -32,3 +35,328 @@ TEST_CASE("[Font]")
 
     REQUIRE_THROWS_AS(tgui::Font("NonExistentFile.ttf"), tgui::Exception);
 }
+
+#if TGUI_HAS_FONT_BACKEND_FREETYPE
+    #if !TGUI_BUILD_AS_CXX_MODULE
+        #include <TGUI/Backend/Font/FreeType/BackendFontFreeType.hpp>
+    #endif
+
+    #if TGUI_HAS_RENDERER_BACKEND_SOFTWARE
+        #if TGUI_BUILD_AS_CXX_MODULE
+            import tgui.backend.renderer.software;
+        #else
+            #include <TGUI/Backend/Renderer/Software/BackendRendererSoftware.hpp>
+        #endif
+
+// Renderer that accepts distance fields, so that the font can be tested without a GPU. The textures store the distance
+// values as alpha values, the render target can't draw them correctly.
+class DistanceFieldRendererSoftware : public tgui::BackendRendererSoftware
+{
+    class Texture : public tgui::BackendTextureSoftware
+    {
+    public:
+        bool loadDistanceFieldTextureOnly(tgui::Vector2u size, const std::uint8_t* pixels, bool smooth) override
+        {
+            if (!loadAlphaTextureOnly(size, pixels, smooth))
+                return false;
+
+            m_isDistanceFieldTexture = true;
+            return true;
+        }
+    };
+
+public:
+    std::shared_ptr<tgui::BackendTexture> createTexture() override
+    {
+        return std::make_shared<Texture>();
+    }
+
+    bool supportsDistanceFieldTextures() override
+    {
+        return true;
+    }
+};
+    #endif
+
+TEST_CASE("[BackendFontFreetype]")
+{
+    const std::size_t pageBytes = 128 * 128;
+
+    auto font = std::make_shared<tgui::BackendFontFreetype>();
+    REQUIRE(font->loadFromFile("resources/DejaVuSans.ttf"));
+    REQUIRE(font->getAtlasPageCount() == 0);
+    REQUIRE(font->getAtlasMemoryLimit() == 0);
+
+    // Each character size gets its own page
+    (void)font->getGlyph(U'a', 20, false);
+    (void)font->getGlyph(U'a', 30, false);
+    REQUIRE(font->getAtlasPageCount() == 2);
+    REQUIRE(font->getAtlasMemoryUsage() == 2 * pageBytes);
+    REQUIRE(font->getTextureSize(20) == tgui::Vector2u{128, 128});
+
+    unsigned int version20;
+    unsigned int version30;
+    REQUIRE(font->getTexture(20, version20) != nullptr);
+    REQUIRE(font->getTexture(30, version30) != nullptr);
+    REQUIRE(version20 != version30);
+
+    SECTION("New glyphs are added to the existing texture")
+    {
+        unsigned int version;
+        const auto texture = font->getTexture(20, version);
+        REQUIRE(font->getGlyph(U'b', 20, false).textureRect.width > 0);
+        REQUIRE(font->getTexture(20, version) == texture);
+        REQUIRE(version == version20);
+    }
+
+    SECTION("Preloading glyphs")
+    {
+        auto otherFont = std::make_shared<tgui::BackendFontFreetype>();
+        REQUIRE(otherFont->loadFromFile("resources/DejaVuSans.ttf"));
+        otherFont->preloadGlyphs(U'A', U'Z', 40);
+        REQUIRE(otherFont->getAtlasPageCount() == 1);
+
+        // Glyphs rasterized on a background thread end up at the same location as when loading them directly
+        font->preloadGlyphsAsync(U'A', U'Z', 40);
+        font->waitForPreloadedGlyphs();
+        REQUIRE(font->getAtlasPageCount() == 3);
+        for (char32_t c = U'A'; c <= U'Z'; ++c)
+        {
+            const tgui::FontGlyph glyph = font->getGlyph(c, 40, false);
+            const tgui::FontGlyph otherGlyph = otherFont->getGlyph(c, 40, false);
+            REQUIRE(glyph.textureRect.width > 0);
+            REQUIRE(glyph.textureRect == otherGlyph.textureRect);
+            REQUIRE(glyph.bounds == otherGlyph.bounds);
+            REQUIRE(glyph.advance == otherGlyph.advance);
+        }
+    }
+
+    SECTION("Loading glyphs on worker threads")
+    {
+        auto otherFont = std::make_shared<tgui::BackendFontFreetype>();
+        REQUIRE(otherFont->loadFromFile("resources/DejaVuSans.ttf"));
+
+        REQUIRE(font->getGlyphLoadingThreadCount() == 0);
+        font->setGlyphLoadingThreadCount(2);
+        REQUIRE(font->getGlyphLoadingThreadCount() == 2);
+
+        unsigned int version;
+        REQUIRE(font->getTexture(40, version) != nullptr);
+
+        // Placeholders without pixels but with an estimated advance are returned while the glyphs are being rasterized
+        for (char32_t c = U'A'; c <= U'Z'; ++c)
+        {
+            const tgui::FontGlyph glyph = font->getGlyph(c, 40, false);
+            REQUIRE(glyph.textureRect.width == 0);
+            REQUIRE(std::abs(glyph.advance - otherFont->getGlyph(c, 40, false).advance) <= 1);
+        }
+        REQUIRE(font->hasPendingGlyphs());
+
+        // The glyphs are added to the atlas when the texture is requested after the workers finished
+        unsigned int newVersion = version;
+        for (unsigned int i = 0; (i < 5000) && font->hasPendingGlyphs(); ++i)
+        {
+            (void)font->getTexture(40, newVersion);
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        REQUIRE(!font->hasPendingGlyphs());
+        REQUIRE(newVersion != version);
+
+        for (char32_t c = U'A'; c <= U'Z'; ++c)
+        {
+            const tgui::FontGlyph glyph = font->getGlyph(c, 40, false);
+            const tgui::FontGlyph otherGlyph = otherFont->getGlyph(c, 40, false);
+            REQUIRE(glyph.textureRect.width == otherGlyph.textureRect.width);
+            REQUIRE(glyph.bounds == otherGlyph.bounds);
+            REQUIRE(glyph.advance == otherGlyph.advance);
+        }
+
+        // Stopping the workers removes the placeholders of glyphs that weren't rasterized yet, they are then loaded directly
+        (void)font->getGlyph(U'a', 40, false);
+        font->setGlyphLoadingThreadCount(0);
+        REQUIRE(!font->hasPendingGlyphs());
+        REQUIRE(font->getGlyph(U'a', 40, false).advance == otherFont->getGlyph(U'a', 40, false).advance);
+    }
+
+    SECTION("Advance and kerning tables")
+    {
+        // Characters inside and outside the range that is stored in the tables
+        for (const char32_t c : std::u32string(U"AVWa.\u00E9\u03A9"))
+        {
+            REQUIRE(font->getGlyphAdvance(c, 20, false) == font->getGlyph(c, 20, false).advance);
+            REQUIRE(font->getGlyphAdvance(c, 20, true) == font->getGlyph(c, 20, true).advance);
+        }
+
+        const float kerning = font->getKerning(U'A', U'V', 20, false);
+        REQUIRE(font->getKerning(U'A', U'V', 20, false) == kerning);
+        REQUIRE(font->getKerning(U'A', U'\u03A9', 20, false) == font->getKerning(U'A', U'\u03A9', 20, false));
+
+        // The tables are recreated when the scale changes
+        const float advance = font->getGlyphAdvance(U'W', 20, false);
+        font->setFontScale(1.5f);
+        (void)font->getGlyphAdvance(U'W', 20, false);
+        font->setFontScale(1);
+        REQUIRE(font->getGlyphAdvance(U'W', 20, false) == advance);
+        REQUIRE(font->getKerning(U'A', U'V', 20, false) == kerning);
+    }
+
+    SECTION("Atlas cache")
+    {
+        const tgui::FontGlyph glyph = font->getGlyph(U'b', 20, false);
+        REQUIRE(font->saveAtlasCache("FontAtlasCache.bin"));
+
+        auto cachedFont = std::make_shared<tgui::BackendFontFreetype>();
+        REQUIRE(!cachedFont->loadAtlasCache("FontAtlasCache.bin"));
+        REQUIRE(cachedFont->loadFromFile("resources/DejaVuSans.ttf"));
+        REQUIRE(!cachedFont->loadAtlasCache("NonExistentFile.bin"));
+        REQUIRE(cachedFont->loadAtlasCache("FontAtlasCache.bin"));
+        REQUIRE(cachedFont->getAtlasPageCount() == 2);
+        REQUIRE(cachedFont->getAtlasMemoryUsage() == 2 * pageBytes);
+
+        const tgui::FontGlyph cachedGlyph = cachedFont->getGlyph(U'b', 20, false);
+        REQUIRE(cachedGlyph.textureRect == glyph.textureRect);
+        REQUIRE(cachedGlyph.bounds == glyph.bounds);
+        REQUIRE(cachedGlyph.advance == glyph.advance);
+
+        // Glyphs that weren't cached are placed next to the restored ones
+        REQUIRE(cachedFont->getGlyph(U'c', 20, false).textureRect == font->getGlyph(U'c', 20, false).textureRect);
+
+        // The file is rejected when the hash of the font data doesn't match
+        std::size_t fileSize;
+        auto fileContents = tgui::readFileToMemory("FontAtlasCache.bin", fileSize);
+        REQUIRE(fileContents);
+        fileContents[20] ^= 0xFF;
+        REQUIRE(tgui::writeFile("FontAtlasCache.bin", fileContents.get(), fileSize));
+        REQUIRE(!cachedFont->loadAtlasCache("FontAtlasCache.bin"));
+        REQUIRE(cachedFont->getAtlasPageCount() == 2);
+    }
+
+    SECTION("Least recently used pages are evicted")
+    {
+        font->setAtlasMemoryLimit(2 * pageBytes);
+        REQUIRE(font->getAtlasMemoryLimit() == 2 * pageBytes);
+
+        (void)font->getGlyph(U'a', 20, false);
+        (void)font->getGlyph(U'a', 40, false);
+        REQUIRE(font->getAtlasPageCount() == 2);
+        REQUIRE(font->getAtlasMemoryUsage() == 2 * pageBytes);
+
+        // Size 20 was used more recently than size 30, so its texture still exists
+        unsigned int version;
+        (void)font->getTexture(20, version);
+        REQUIRE(version == version20);
+        (void)font->getTexture(30, version);
+        REQUIRE(version != version30);
+    }
+
+    SECTION("Unused glyphs are removed from a full page")
+    {
+        font->setAtlasMemoryLimit(pageBytes);
+        REQUIRE(font->getAtlasPageCount() == 1);
+
+        // The glyphs don't fit in a single page and the page isn't allowed to grow
+        for (char32_t c = U'A'; c <= U'Z'; ++c)
+            (void)font->getGlyph(c, 60, false);
+
+        REQUIRE(font->getAtlasMemoryUsage() == pageBytes);
+        REQUIRE(font->getGlyph(U'Z', 60, false).textureRect.width == 0);
+        const tgui::FontGlyph glyphA = font->getGlyph(U'A', 60, false);
+
+        // Once no more glyphs are requested, texts have to reload their glyphs to find out which ones are still used
+        unsigned int version;
+        unsigned int newVersion;
+        (void)font->getTexture(60, version);
+        (void)font->getTexture(60, newVersion);
+        REQUIRE(newVersion != version);
+        REQUIRE(font->getGlyph(U'A', 60, false).textureRect == glyphA.textureRect);
+
+        // The glyphs that weren't requested again are removed, which makes room for the glyph that was missing
+        version = newVersion;
+        (void)font->getTexture(60, newVersion);
+        REQUIRE(newVersion == version);
+        (void)font->getTexture(60, newVersion);
+        REQUIRE(newVersion != version);
+        REQUIRE(font->getGlyph(U'A', 60, false).textureRect == glyphA.textureRect);
+        REQUIRE(font->getGlyph(U'Z', 60, false).textureRect.width > 0);
+        REQUIRE(font->getAtlasMemoryUsage() == pageBytes);
+
+        // The texture remains the same while all glyphs fit
+        version = newVersion;
+        for (unsigned int i = 0; i < 3; ++i)
+        {
+            (void)font->getTexture(60, newVersion);
+            REQUIRE(newVersion == version);
+        }
+    }
+
+    SECTION("Pages grow by adding blocks")
+    {
+        // Glyphs of the same size are stored below each other, the width of the page stays the same
+        for (char32_t c = U'A'; c <= U'Z'; ++c)
+            (void)font->getGlyph(c, 60, false);
+
+        const tgui::Vector2u textureSize = font->getTextureSize(60);
+        REQUIRE(textureSize.x == 128);
+        REQUIRE(textureSize.y > 128);
+        REQUIRE(textureSize.y % 128 == 0);
+
+        // Large character sizes get wider blocks
+        (void)font->getGlyph(U'W', 100, false);
+        REQUIRE(font->getTextureSize(100).x == 256);
+    }
+
+#if TGUI_HAS_RENDERER_BACKEND_SOFTWARE
+    SECTION("Distance fields")
+    {
+        const auto oldRenderer = tgui::getBackend()->getRenderer();
+        if (!oldRenderer->supportsDistanceFieldTextures())
+        {
+            REQUIRE(!font->setDistanceFieldEnabled(true));
+            REQUIRE(!font->isDistanceFieldEnabled());
+        }
+
+        const tgui::FontGlyph normalGlyph = font->getGlyph(U'A', 20, false);
+        tgui::getBackend()->setRenderer(std::make_shared<DistanceFieldRendererSoftware>());
+        REQUIRE(!font->isDistanceFieldEnabled());
+        REQUIRE(font->setDistanceFieldEnabled(true, 32));
+        REQUIRE(font->isDistanceFieldEnabled());
+
+        // All character sizes share the glyphs of a single page
+        const std::size_t pageCount = font->getAtlasPageCount();
+        const tgui::FontGlyph glyph20 = font->getGlyph(U'A', 20, false);
+        const tgui::FontGlyph glyph40 = font->getGlyph(U'A', 40, false);
+        REQUIRE(font->getAtlasPageCount() == pageCount + 1);
+        REQUIRE(glyph20.textureRect.width > 0);
+        REQUIRE(glyph20.textureRect == glyph40.textureRect);
+        REQUIRE(glyph40.advance == Approx(2 * glyph20.advance));
+        REQUIRE(glyph40.bounds.width == Approx(2 * glyph20.bounds.width));
+        REQUIRE(glyph40.bounds.left == Approx(2 * glyph20.bounds.left));
+
+        // The quad covers a border around the glyph in which the distances fall off
+        REQUIRE(glyph20.bounds.width > normalGlyph.bounds.width);
+
+        unsigned int version20;
+        unsigned int version40;
+        const auto texture = font->getTexture(20, version20);
+        REQUIRE(texture->isDistanceFieldTexture());
+        REQUIRE(texture->isSmooth());
+        REQUIRE(font->getTexture(40, version40) == texture);
+        REQUIRE(version20 == version40);
+
+        // Changing the scale doesn't require new glyphs
+        font->setFontScale(1.5f);
+        REQUIRE(font->getGlyph(U'A', 20, false).textureRect == glyph20.textureRect);
+        REQUIRE(font->getTexture(20, version40) == texture);
+        REQUIRE(version20 == version40);
+        REQUIRE(font->getAtlasPageCount() == pageCount + 1);
+        font->setFontScale(1);
+
+        REQUIRE(!font->setDistanceFieldEnabled(false));
+        REQUIRE(!font->isDistanceFieldEnabled());
+        REQUIRE(!font->getTexture(20, version20)->isDistanceFieldTexture());
+
+        tgui::getBackend()->setRenderer(oldRenderer);
+    }
+#endif
+}
+#endif
@@ -0,0 +1,121 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2023 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+
+TEST_CASE("[GlyphRunCache]")
+{
+    tgui::GlyphRunCache::clear();
+    tgui::GlyphRunCache::resetStatistics();
+    REQUIRE(tgui::GlyphRunCache::getMemoryUsage() == 0);
+    REQUIRE(tgui::GlyphRunCache::getMemoryLimit() == 1024 * 1024);
+
+    tgui::Font font("resources/DejaVuSans.ttf");
+    const tgui::String str = "Hello world";
+
+    float expectedWidth = 0;
+    char32_t prevChar = 0;
+    for (const char32_t c : str)
+    {
+        expectedWidth += font.getKerning(prevChar, c, 20, false) + font.getGlyph(c, 20, false).advance;
+        prevChar = c;
+    }
+
+    SECTION("Runs are shared")
+    {
+        REQUIRE(tgui::Text::getLineWidth(str, font, 20) == expectedWidth);
+        REQUIRE(tgui::GlyphRunCache::getMissCount() == 1);
+        REQUIRE(tgui::GlyphRunCache::getHitCount() == 0);
+        REQUIRE(tgui::GlyphRunCache::getMemoryUsage() > 0);
+
+        REQUIRE(tgui::Text::getLineWidth(str, font, 20) == expectedWidth);
+        REQUIRE(tgui::Text::wordWrap(0, str, font, 20, false) == str);
+        REQUIRE(tgui::GlyphRunCache::getMissCount() == 1);
+        REQUIRE(tgui::GlyphRunCache::getHitCount() == 2);
+
+        // A different size or style requires a different run
+        (void)tgui::Text::getLineWidth(str, font, 21);
+        (void)tgui::Text::getLineWidth(str, font, 20, tgui::TextStyle::Bold);
+        REQUIRE(tgui::GlyphRunCache::getMissCount() == 3);
+
+        tgui::GlyphRunCache::resetStatistics();
+        REQUIRE(tgui::GlyphRunCache::getMissCount() == 0);
+        REQUIRE(tgui::GlyphRunCache::getHitCount() == 0);
+    }
+
+    SECTION("Positions")
+    {
+        const auto run = tgui::GlyphRunCache::getGlyphRun("ab\ncd", *font.getBackendFont(), 20, false);
+        REQUIRE(run->positions.size() == 6);
+        REQUIRE(run->positions[0] == 0);
+        REQUIRE(run->positions[2] == run->width);
+        REQUIRE(run->positions[3] == 0);
+        REQUIRE(run->positions[4] == font.getGlyph(U'c', 20, false).advance);
+    }
+
+    SECTION("Memory limit")
+    {
+        for (unsigned int i = 0; i < 100; ++i)
+            (void)tgui::Text::getLineWidth(str + tgui::String(i), font, 20);
+
+        const std::size_t memoryUsage = tgui::GlyphRunCache::getMemoryUsage();
+        tgui::GlyphRunCache::setMemoryLimit(memoryUsage / 2);
+        REQUIRE(tgui::GlyphRunCache::getMemoryUsage() <= memoryUsage / 2);
+
+        // The most recently used runs are kept
+        tgui::GlyphRunCache::resetStatistics();
+        (void)tgui::Text::getLineWidth(str + tgui::String(99), font, 20);
+        (void)tgui::Text::getLineWidth(str + tgui::String(0), font, 20);
+        REQUIRE(tgui::GlyphRunCache::getHitCount() == 1);
+        REQUIRE(tgui::GlyphRunCache::getMissCount() == 1);
+
+        // A run that is larger than the limit isn't cached and doesn't evict other runs
+        const std::size_t memoryUsageBeforeLongText = tgui::GlyphRunCache::getMemoryUsage();
+        (void)tgui::Text::getLineWidth(tgui::String(memoryUsage, U'x'), font, 20);
+        REQUIRE(tgui::GlyphRunCache::getMemoryUsage() == memoryUsageBeforeLongText);
+        (void)tgui::Text::getLineWidth(str + tgui::String(0), font, 20);
+        REQUIRE(tgui::GlyphRunCache::getHitCount() == 2);
+
+        // The cache is disabled when the limit is 0
+        tgui::GlyphRunCache::setMemoryLimit(0);
+        REQUIRE(tgui::GlyphRunCache::getMemoryUsage() == 0);
+        REQUIRE(tgui::Text::getLineWidth(str, font, 20) == expectedWidth);
+        REQUIRE(tgui::Text::getLineWidth(str, font, 20) == expectedWidth);
+        REQUIRE(tgui::GlyphRunCache::getHitCount() == 2);
+        REQUIRE(tgui::GlyphRunCache::getMissCount() == 4);
+
+        tgui::GlyphRunCache::setMemoryLimit(1024 * 1024);
+    }
+
+    SECTION("Runs are removed with their font")
+    {
+        {
+            tgui::Font otherFont("resources/DejaVuSans.ttf");
+            (void)tgui::Text::getLineWidth(str, otherFont, 20);
+            REQUIRE(tgui::GlyphRunCache::getMemoryUsage() > 0);
+        }
+        REQUIRE(tgui::GlyphRunCache::getMemoryUsage() == 0);
+    }
+}
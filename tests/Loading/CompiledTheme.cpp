@@ -0,0 +1,261 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2023 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Tests.hpp"
+#include <TGUI/Base64.hpp>
+
+#include <cstring>
+
+static void compareRendererData(const tgui::RendererData& expected, const tgui::RendererData& actual)
+{
+    REQUIRE(actual.propertyValuePairs.size() == expected.propertyValuePairs.size());
+    for (const auto& pair : expected.propertyValuePairs)
+    {
+        INFO("Property: " << pair.first.getName());
+        const auto it = actual.propertyValuePairs.find(pair.first);
+        REQUIRE(it != actual.propertyValuePairs.end());
+
+        // The values from the text theme are strings, they are deserialized to the type that the compiled theme stored
+        tgui::ObjectConverter expectedValue = pair.second;
+        tgui::ObjectConverter actualValue = it->second;
+        switch (actualValue.getType())
+        {
+        case tgui::ObjectConverter::Type::String:
+            REQUIRE(actualValue.getString() == expectedValue.getString());
+            break;
+        case tgui::ObjectConverter::Type::Bool:
+            REQUIRE(actualValue.getBool() == expectedValue.getBool());
+            break;
+        case tgui::ObjectConverter::Type::Number:
+            REQUIRE(actualValue.getNumber() == expectedValue.getNumber());
+            break;
+        case tgui::ObjectConverter::Type::Color:
+            REQUIRE(actualValue.getColor() == expectedValue.getColor());
+            break;
+        case tgui::ObjectConverter::Type::Outline:
+            REQUIRE(actualValue.getOutline() == expectedValue.getOutline());
+            break;
+        case tgui::ObjectConverter::Type::TextStyle:
+            REQUIRE(actualValue.getTextStyle() == expectedValue.getTextStyle());
+            break;
+        case tgui::ObjectConverter::Type::Font:
+            REQUIRE(actualValue.getFont().getId() == expectedValue.getFont().getId());
+            break;
+        case tgui::ObjectConverter::Type::Texture:
+            REQUIRE(actualValue.getTexture().getId() == expectedValue.getTexture().getId());
+            REQUIRE(actualValue.getTexture().getPartRect() == expectedValue.getTexture().getPartRect());
+            REQUIRE(actualValue.getTexture().getMiddleRect() == expectedValue.getTexture().getMiddleRect());
+            REQUIRE(actualValue.getTexture().isSmooth() == expectedValue.getTexture().isSmooth());
+            break;
+        case tgui::ObjectConverter::Type::RendererData:
+            compareRendererData(*expectedValue.getRenderer(), *actualValue.getRenderer());
+            break;
+        default:
+            FAIL("Compiled theme contains an empty value");
+        }
+    }
+}
+
+TEST_CASE("[CompiledTheme]")
+{
+    SECTION("Same properties as text theme")
+    {
+        for (const tgui::String name : {"Black", "BabyBlue", "TransparentGrey"})
+        {
+            INFO("Theme: " << name);
+            const tgui::String textFilename = "resources/" + name + ".txt";
+            const tgui::String compiledFilename = "resources/" + name + ".bin";
+            REQUIRE_NOTHROW(tgui::CompiledTheme::compileToFile(textFilename, compiledFilename));
+
+            tgui::CompiledTheme compiledTheme;
+            REQUIRE_NOTHROW(compiledTheme.open(compiledFilename));
+
+            std::map<tgui::String, tgui::ObjectConverter> textGlobalProperties;
+            for (const auto& pair : tgui::Theme::getThemeLoader()->getGlobalProperties(textFilename))
+                textGlobalProperties[pair.first] = tgui::ObjectConverter{pair.second};
+            compareRendererData(*tgui::RendererData::create(textGlobalProperties), *tgui::RendererData::create(compiledTheme.getGlobalProperties()));
+
+            const auto sectionNames = compiledTheme.getSectionNames();
+            REQUIRE(!sectionNames.empty());
+            REQUIRE(std::is_sorted(sectionNames.begin(), sectionNames.end()));
+
+            tgui::Theme textTheme{textFilename};
+            tgui::Theme theme;
+            theme.loadCompiled(compiledFilename);
+            REQUIRE(theme.getPrimary() == compiledFilename);
+            for (const auto& section : sectionNames)
+            {
+                INFO("Section: " << section);
+                REQUIRE(compiledTheme.hasSection(section));
+                compareRendererData(*textTheme.getRenderer(section), *theme.getRenderer(section));
+            }
+        }
+    }
+
+    SECTION("Values")
+    {
+        std::size_t imageSize;
+        const auto imageData = tgui::readFileToMemory("resources/image.png", imageSize);
+        REQUIRE(imageData);
+
+        const std::string themeText =
+            "TextColor = rgb(10, 20, 30);\n"
+            "Button {\n"
+            "    TextColor = Red;\n"
+            "    BackgroundColor = None;\n"
+            "    Borders = (1, 2, 3, 4);\n"
+            "    Padding = (10%, 5);\n"
+            "    TextStyle = Bold | Italic;\n"
+            "    Texture = \"Texture1.png\" Part(0, 0, 30, 20) Middle(5, 5, 20, 10) NoSmooth;\n"
+            "    TextureHover = \"data:image/png;base64," + tgui::base64Encode(imageData.get(), imageSize) + "\" Part(5, 5, 20, 10);\n"
+            "    TextureDown = None;\n"
+            "    CustomProperty = \"Custom value\";\n"
+            "}\n"
+            "Slider {\n"
+            "    TrackColor = Green;\n"
+            "}\n"
+            "ChildWindow {\n"
+            "    CloseButton = &Button;\n"
+            "    MaximizeButton {\n"
+            "        TextColor = Blue;\n"
+            "    }\n"
+            "    ShowTextOnTitleButtons = true;\n"
+            "    TitleBarHeight = 25;\n"
+            "}\n";
+        REQUIRE(tgui::writeFile("resources/ThemeCompiled.txt", themeText));
+
+        tgui::CompiledTheme::compileToFile("resources/ThemeCompiled.txt", "resources/ThemeCompiled.bin");
+        tgui::Theme theme;
+        theme.loadCompiled("resources/ThemeCompiled.bin");
+
+        REQUIRE(theme.getGlobalProperty("TextColor").getType() == tgui::ObjectConverter::Type::Color);
+        REQUIRE(theme.getGlobalProperty("TextColor").getColor() == tgui::Color{10, 20, 30});
+
+        auto& button = theme.getRenderer("Button")->propertyValuePairs;
+        REQUIRE(button.size() == 9);
+        REQUIRE(button["TextColor"].getType() == tgui::ObjectConverter::Type::Color);
+        REQUIRE(button["TextColor"].getColor() == tgui::Color::Red);
+        REQUIRE(button["BackgroundColor"].getType() == tgui::ObjectConverter::Type::Color);
+        REQUIRE(!button["BackgroundColor"].getColor().isSet());
+        REQUIRE(button["Borders"].getType() == tgui::ObjectConverter::Type::Outline);
+        REQUIRE(button["Borders"].getOutline() == tgui::Outline{1, 2, 3, 4});
+        REQUIRE(button["TextStyle"].getType() == tgui::ObjectConverter::Type::TextStyle);
+        REQUIRE(button["TextStyle"].getTextStyle() == (tgui::TextStyle::Bold | tgui::TextStyle::Italic));
+
+        // Relative outlines and properties of unknown type are stored as text
+        REQUIRE(button["Padding"].getType() == tgui::ObjectConverter::Type::String);
+        REQUIRE(button["Padding"].getOutline().getTop() == 5);
+        REQUIRE(button["CustomProperty"].getType() == tgui::ObjectConverter::Type::String);
+        REQUIRE(button["CustomProperty"].getString() == "\"Custom value\"");
+
+        // Relative filenames are relative to the compiled theme
+        REQUIRE(button["Texture"].getType() == tgui::ObjectConverter::Type::Texture);
+        REQUIRE(button["Texture"].getTexture().getId() == "resources/Texture1.png");
+        REQUIRE(button["Texture"].getTexture().getPartRect() == tgui::UIntRect{0, 0, 30, 20});
+        REQUIRE(button["Texture"].getTexture().getMiddleRect() == tgui::UIntRect{5, 5, 20, 10});
+        REQUIRE(!button["Texture"].getTexture().isSmooth());
+        REQUIRE(button["TextureHover"].getType() == tgui::ObjectConverter::Type::Texture);
+        REQUIRE(button["TextureHover"].getTexture().getImageSize() == tgui::Vector2u{20, 10});
+        REQUIRE(button["TextureHover"].getTexture().getPartRect() == tgui::UIntRect{5, 5, 20, 10});
+        REQUIRE(button["TextureDown"].getType() == tgui::ObjectConverter::Type::Texture);
+        REQUIRE(!button["TextureDown"].getTexture().getData());
+
+        auto& childWindow = theme.getRenderer("ChildWindow")->propertyValuePairs;
+        REQUIRE(childWindow["ShowTextOnTitleButtons"].getType() == tgui::ObjectConverter::Type::Bool);
+        REQUIRE(childWindow["ShowTextOnTitleButtons"].getBool());
+        REQUIRE(childWindow["TitleBarHeight"].getType() == tgui::ObjectConverter::Type::Number);
+        REQUIRE(childWindow["TitleBarHeight"].getNumber() == 25);
+        REQUIRE(childWindow["CloseButton"].getType() == tgui::ObjectConverter::Type::RendererData);
+        REQUIRE(childWindow["CloseButton"].getRenderer()->propertyValuePairs["TextColor"].getColor() == tgui::Color::Red);
+        REQUIRE(childWindow["CloseButton"].getRenderer()->propertyValuePairs.size() == 9);
+        REQUIRE(childWindow["MaximizeButton"].getType() == tgui::ObjectConverter::Type::RendererData);
+        REQUIRE(childWindow["MaximizeButton"].getRenderer()->propertyValuePairs["TextColor"].getColor() == tgui::Color::Blue);
+
+        SECTION("Widgets")
+        {
+            auto slider = tgui::Slider::create();
+            slider->setRenderer(theme.getRenderer("Slider"));
+            REQUIRE(slider->getSharedRenderer()->getTrackColor() == tgui::Color::Green);
+
+            // Widget types without a section get an empty renderer, their properties are inherited from the global properties
+            auto label = tgui::Label::create();
+            label->setRenderer(theme.getRenderer("Label"));
+            REQUIRE(label->getSharedRenderer()->getTextColor() == tgui::Color{10, 20, 30});
+
+            // Reloading the theme updates the widgets
+            tgui::CompiledTheme::compileToFile("resources/Black.txt", "resources/Black.bin");
+            theme.loadCompiled("resources/Black.bin");
+            REQUIRE(slider->getSharedRenderer()->getTextureTrack().getId() == "resources/Black.png");
+
+            // Switching back to a text theme
+            theme.load("resources/BabyBlue.txt");
+            REQUIRE(slider->getSharedRenderer()->getTextureTrack().getId() == "resources/BabyBlue.png");
+        }
+    }
+
+    SECTION("Missing sections")
+    {
+        tgui::CompiledTheme::compileToFile("resources/Black.txt", "resources/Black.bin");
+        tgui::Theme theme;
+        theme.loadCompiled("resources/Black.bin");
+
+        REQUIRE(theme.getRenderer("Picture")->propertyValuePairs.empty());
+        REQUIRE_THROWS_AS(theme.getRenderer("nonexistent_section"), tgui::Exception);
+        REQUIRE(theme.getRendererNoThrow("nonexistent_section") == nullptr);
+    }
+
+    SECTION("Invalid files")
+    {
+        tgui::Theme theme;
+        REQUIRE_THROWS_AS(theme.loadCompiled("nonexistent_file"), tgui::Exception);
+        REQUIRE_THROWS_AS(theme.loadCompiled("resources/Black.txt"), tgui::Exception);
+        REQUIRE_THROWS_AS(tgui::CompiledTheme::compile("nonexistent_file"), tgui::Exception);
+
+        REQUIRE(tgui::writeFile("resources/ThemeCompiledInvalid.txt", "Button { TextColor = Red;"));
+        REQUIRE_THROWS_AS(tgui::CompiledTheme::compile("resources/ThemeCompiledInvalid.txt"), tgui::Exception);
+
+        // A truncated file is rejected
+        const auto data = tgui::CompiledTheme::compile("resources/Black.txt");
+        REQUIRE(tgui::writeFile("resources/Truncated.bin", data.data(), data.size() / 2));
+        REQUIRE_THROWS_AS(theme.loadCompiled("resources/Truncated.bin"), tgui::Exception);
+
+        // A nested property list that refers back to the list that contains it is rejected
+        std::vector<std::uint32_t> words = {
+            0, 0, 1, 0x01020304, 0, 32, 1, 36, // Header, the signature and file size are filled in below
+            0,                                 // Global properties (offset 32)
+            68, 6, 48,                         // Section "Button" (offset 36)
+            1, 74, 5, 8, 48                    // Property list of the section with "Inner" pointing to itself (offset 48)
+        };
+        std::string file(words.size() * sizeof(std::uint32_t), '\0');
+        std::memcpy(&file[0], words.data(), file.size());
+        file += "ButtonInner";
+        std::memcpy(&file[0], "TGUITHM", 8);
+        const auto fileSize = static_cast<std::uint32_t>(file.size());
+        std::memcpy(&file[16], &fileSize, sizeof(fileSize));
+
+        REQUIRE(tgui::writeFile("resources/SelfReferencing.bin", tgui::CharStringView{file.data(), file.size()}));
+        theme.loadCompiled("resources/SelfReferencing.bin");
+        REQUIRE_THROWS_AS(theme.getRenderer("Button"), tgui::Exception);
+    }
+}
@@ -24,6 +24,25 @@
 
 #include "Tests.hpp"
 
+static void compareDocumentWithTree(const tgui::DataIO::NodeView& view, const tgui::DataIO::Node& node)
+{
+    REQUIRE(tgui::String(std::string(view.name.data(), view.name.length())) == node.name);
+
+    REQUIRE(view.propertyCount == node.propertyValuePairs.size());
+    std::size_t i = 0;
+    for (const auto& pair : node.propertyValuePairs)
+    {
+        const tgui::DataIO::PropertyView& property = view.properties[i++];
+        REQUIRE(tgui::String(std::string(property.name.data(), property.name.length())) == pair.first);
+        REQUIRE(tgui::String(std::string(property.value.data(), property.value.length())) == pair.second->value);
+        REQUIRE(view.findProperty(property.name) == &property);
+    }
+
+    REQUIRE(view.childCount == node.children.size());
+    for (std::size_t j = 0; j < view.childCount; ++j)
+        compareDocumentWithTree(view.children[j], *node.children[j]);
+}
+
 TEST_CASE("[DataIO]")
 {
     SECTION("parse")
@@ -228,6 +247,98 @@ TEST_CASE("[DataIO]")
         }
     }
 
+    SECTION("parse from memory")
+    {
+        const std::string contents = "// Comment\nSection /* Comment */ {\n"
+                                     "    Text = \"a;b // c\" /* Comment */;\n"
+                                     "    Name/* Comment */Part = Value // Comment\n;\n"
+                                     "    List = [1, \"2, 3\"];\n"
+                                     "}\n";
+
+        auto root = tgui::DataIO::parse(tgui::CharStringView{contents.data(), contents.size()});
+        REQUIRE(root->children.size() == 1);
+        REQUIRE(root->children[0]->name == "Section");
+        REQUIRE(root->children[0]->propertyValuePairs.size() == 3);
+        REQUIRE(root->children[0]->propertyValuePairs["Text"]->value == "\"a;b // c\"");
+        REQUIRE(root->children[0]->propertyValuePairs["NamePart"]->value == "Value");
+        REQUIRE(root->children[0]->propertyValuePairs["List"]->valueList.size() == 2);
+        REQUIRE(root->children[0]->propertyValuePairs["List"]->valueList[1] == "\"2, 3\"");
+
+        // Parsing a stream gives the same result
+        std::stringstream input{contents};
+        std::stringstream output1;
+        std::stringstream output2;
+        tgui::DataIO::emit(root, output1);
+        tgui::DataIO::emit(tgui::DataIO::parse(input), output2);
+        REQUIRE(output1.str() == output2.str());
+
+        // The line on which the error occurs is reported
+        const std::string invalidContents = "Section {\n\n    Property = ;\n}";
+        try
+        {
+            (void)tgui::DataIO::parse(tgui::CharStringView{invalidContents.data(), invalidContents.size()});
+            FAIL("Parsing invalid input didn't throw");
+        }
+        catch (const tgui::Exception& e)
+        {
+            REQUIRE(tgui::String(e.what()).contains(U"line 3"));
+        }
+
+        // A comment directly behind a quoted value isn't part of the value
+        const std::string commentContents = "Section {\n    Text = \"a\"/*c*/;\n}";
+        root = tgui::DataIO::parse(tgui::CharStringView{commentContents.data(), commentContents.size()});
+        REQUIRE(root->children[0]->propertyValuePairs["Text"]->value == "\"a\"");
+
+        // A quote that is never closed is an error
+        const std::string quoteContents = "Section {\n    X = \"q\"\";\n}";
+        REQUIRE_THROWS_AS(tgui::DataIO::parse(tgui::CharStringView{quoteContents.data(), quoteContents.size()}), tgui::Exception);
+    }
+
+    SECTION("parseDocument")
+    {
+        const std::string contents = "Global = 1;\n"
+                                     "Base {\n"
+                                     "    A = 1;\n"
+                                     "    B = \"x\" /* Comment */;\n"
+                                     "    Child { C = 2; }\n"
+                                     "}\n"
+                                     "Derived : Base {\n"
+                                     "    B = 3;\n"
+                                     "    B = 4;\n"
+                                     "    List = [1, \"2, 3\"];\n"
+                                     "    Nested : Base { A = 5; }\n"
+                                     "}\n";
+
+        const tgui::DataIO::Document document = tgui::DataIO::parseDocument(tgui::CharStringView{contents.data(), contents.size()});
+        const tgui::DataIO::NodeView& root = document.getRoot();
+        compareDocumentWithTree(root, *tgui::DataIO::parse(tgui::CharStringView{contents.data(), contents.size()}));
+
+        REQUIRE(root.childCount == 2);
+        const tgui::DataIO::NodeView& derived = root.children[1];
+        REQUIRE(derived.findProperty("B")->value == "4");
+        REQUIRE(derived.findProperty("A")->value == "1");
+        REQUIRE(derived.findProperty("C") == nullptr);
+        REQUIRE(derived.childCount == 2);
+
+        // Inherited children share their memory with the base section
+        REQUIRE(derived.children[1].properties == root.children[0].children[0].properties);
+
+        // The shipped themes result in the same nodes as the Node tree
+        for (const char* filename : {"resources/Black.txt", "resources/BabyBlue.txt", "resources/TransparentGrey.txt"})
+        {
+            std::size_t fileSize;
+            const auto fileContents = tgui::readFileToMemory(filename, fileSize);
+            REQUIRE(fileContents);
+
+            const tgui::CharStringView data{reinterpret_cast<const char*>(fileContents.get()), fileSize};
+            compareDocumentWithTree(tgui::DataIO::parseDocument(data).getRoot(), *tgui::DataIO::parse(data));
+        }
+
+        // Errors are reported the same way as by parse
+        const std::string invalidContents = "Section {\n\n    Property = ;\n}";
+        REQUIRE_THROWS_AS(tgui::DataIO::parseDocument(tgui::CharStringView{invalidContents.data(), invalidContents.size()}), tgui::Exception);
+    }
+
     SECTION("correct input")
     {
         std::stringstream stream;
@@ -63,6 +63,32 @@ TEST_CASE("[Theme]")
             tgui::Theme theme2("resources/Black.txt");
             REQUIRE_THROWS_AS(theme2.getRenderer("nonexistent_section"), tgui::Exception);
         }
+
+        SECTION("Preloading renderers")
+        {
+            tgui::DefaultThemeLoader::flushCache();
+            tgui::DefaultThemeLoader::setLazyLoading(true);
+
+            tgui::Theme theme("resources/Black.txt");
+            theme.preloadRenderers({"Button", "ChildWindow"});
+
+            auto buttonRenderer = theme.getRenderer("Button");
+            REQUIRE(buttonRenderer->propertyValuePairs["Texture"].getType() == tgui::ObjectConverter::Type::Texture);
+            REQUIRE(buttonRenderer->propertyValuePairs["Texture"].getTexture().getId() == "resources/Black.png");
+
+            auto childWindowRenderer = theme.getRenderer("ChildWindow");
+            REQUIRE(childWindowRenderer->propertyValuePairs["ShowTextOnTitleButtons"].getType() == tgui::ObjectConverter::Type::String);
+            REQUIRE(childWindowRenderer->propertyValuePairs["CloseButton"].getType() == tgui::ObjectConverter::Type::RendererData);
+            REQUIRE(childWindowRenderer->propertyValuePairs["CloseButton"].getRenderer()->propertyValuePairs["Texture"].getType() == tgui::ObjectConverter::Type::Texture);
+
+            // Renderers that weren't preloaded still contain serialized values
+            REQUIRE(theme.getRenderer("EditBox")->propertyValuePairs["Texture"].getType() == tgui::ObjectConverter::Type::String);
+
+            REQUIRE_THROWS_AS(theme.preloadRenderers({"nonexistent_section"}), tgui::Exception);
+
+            tgui::DefaultThemeLoader::flushCache();
+            tgui::DefaultThemeLoader::setLazyLoading(false);
+        }
     }
 
     SECTION("Adding and removing renderers")
@@ -41,6 +41,7 @@ public:
 TEST_CASE("[ThemeLoader]")
 {
     tgui::DefaultThemeLoader::flushCache(); // Clear static data that could be cached from other tests
+    tgui::DefaultThemeLoader::setLazyLoading(false);
 
     auto loader = std::make_shared<CustomThemeLoader>();
 
@@ -186,4 +187,66 @@ TEST_CASE("[ThemeLoader]")
             REQUIRE(loader->getPropertiesCache().size() == 0);
         }
     }
+
+    SECTION("lazy loading")
+    {
+        REQUIRE(tgui::writeFile("resources/ThemeLazyInheritance.txt",
+            "Button { TextColor = Red; Scrollbar { ThumbColor = Green; } };\n"
+            "Derived : Button { BackgroundColor = Blue; };\n"
+            "\"Derived 2\" : Derived { TextColor = Yellow; }\n"
+            "TextColor = White;"));
+
+        for (const tgui::String filename : {"resources/Black.txt", "resources/TransparentGrey.txt", "resources/ThemeComments.txt",
+                                            "resources/ThemeNested.txt", "resources/ThemeSpecialCases.txt", "resources/ThemeLazyInheritance.txt"})
+        {
+            INFO("Theme: " << filename);
+            loader->preload(filename);
+            const auto expectedSections = loader->getPropertiesCache()[filename];
+            const auto expectedGlobalProperties = loader->getGlobalProperties(filename);
+            tgui::DefaultThemeLoader::flushCache();
+
+            tgui::DefaultThemeLoader::setLazyLoading(true);
+            REQUIRE(tgui::DefaultThemeLoader::getLazyLoading());
+
+            // Only the global properties are loaded when preloading the file
+            loader->preload(filename);
+            REQUIRE(loader->getPropertiesCache()[filename].empty());
+            REQUIRE(loader->getGlobalProperties(filename) == expectedGlobalProperties);
+
+            for (const auto& section : expectedSections)
+            {
+                INFO("Section: " << section.first);
+                REQUIRE(loader->canLoad(filename, section.first));
+                REQUIRE(loader->load(filename, section.first) == section.second);
+            }
+
+            REQUIRE(loader->getPropertiesCache()[filename] == expectedSections);
+            REQUIRE(!loader->canLoad(filename, "NonexistentClassName"));
+            REQUIRE_THROWS_AS(loader->load(filename, "NonexistentClassName"), tgui::Exception);
+
+            tgui::DefaultThemeLoader::flushCache();
+            tgui::DefaultThemeLoader::setLazyLoading(false);
+        }
+
+        tgui::DefaultThemeLoader::setLazyLoading(true);
+
+        // Loading a section parses the sections that it references, but nothing else
+        REQUIRE(loader->load("resources/ThemeNested.txt", "ComboBox1").size() == 1);
+        REQUIRE(loader->getPropertiesCache()["resources/ThemeNested.txt"].size() == 1);
+        REQUIRE(loader->load("resources/ThemeNested.txt", "ComboBox1").at("ListBox") == "{\nBackgroundColor = White;\nScrollbar = {\nThumbColor = Green;\nTrackColor = Red;\n};\n}");
+
+        // Errors in a section are only detected when the section is loaded
+        REQUIRE(tgui::writeFile("resources/ThemeLazyError.txt", "TextColor = Red;\nButton { TextColor = Green; }\nLabel { TextColor Red; }\nSlider { TrackColor = &Missing; }"));
+        REQUIRE(loader->load("resources/ThemeLazyError.txt", "Button").size() == 1);
+        REQUIRE(loader->getGlobalProperties("resources/ThemeLazyError.txt").size() == 1);
+        REQUIRE_THROWS_AS(loader->load("resources/ThemeLazyError.txt", "Label"), tgui::Exception);
+        REQUIRE_THROWS_AS(loader->load("resources/ThemeLazyError.txt", "Slider"), tgui::Exception);
+
+        tgui::DefaultThemeLoader::flushCache("resources/ThemeLazyError.txt");
+        REQUIRE(tgui::writeFile("resources/ThemeLazyError.txt", "Button { TextColor = Green; "));
+        REQUIRE_THROWS_AS(loader->preload("resources/ThemeLazyError.txt"), tgui::Exception);
+
+        tgui::DefaultThemeLoader::flushCache();
+        tgui::DefaultThemeLoader::setLazyLoading(false);
+    }
 }
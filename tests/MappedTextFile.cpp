@@ -0,0 +1,98 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2023 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/MappedTextFile.hpp>
+
+TEST_CASE("[MappedTextFile]")
+{
+    tgui::MappedTextFile file;
+    REQUIRE(!file.isOpen());
+    REQUIRE(!file.open("NonExistentFile.txt"));
+    REQUIRE(!file.isOpen());
+
+    SECTION("Lines")
+    {
+        std::string contents;
+        for (unsigned int i = 0; i < 200; ++i)
+            contents += "Line " + std::to_string(i) + "\r\n";
+        contents += "Last line \xC3\xA9";
+        REQUIRE(tgui::writeFile("MappedTextFile.txt", contents));
+
+        REQUIRE(file.open("MappedTextFile.txt"));
+        REQUIRE(file.isOpen());
+        REQUIRE(file.getSize() == contents.length());
+
+        // Only the lines up to the requested one are scanned
+        REQUIRE(file.getLine(1) == "Line 1");
+        REQUIRE(!file.isFullyIndexed());
+        REQUIRE(file.getLine(130) == "Line 130");
+        REQUIRE(file.getLine(64) == "Line 64");
+        REQUIRE(file.getLine(0) == "Line 0");
+        REQUIRE(!file.isFullyIndexed());
+        REQUIRE(file.getLineCount() > 190);
+        REQUIRE(file.getLineCount() < 210);
+
+        REQUIRE(file.getLine(200) == U"Last line é");
+        REQUIRE(file.getLine(201) == "");
+        REQUIRE(file.isFullyIndexed());
+        REQUIRE(file.getLineCount() == 201);
+        REQUIRE(file.getText().length() == contents.length() - 200 - 1);
+
+        file.close();
+        REQUIRE(!file.isOpen());
+        REQUIRE(file.getSize() == 0);
+    }
+
+    SECTION("Empty file")
+    {
+        REQUIRE(tgui::writeFile("MappedTextFile.txt", ""));
+        REQUIRE(file.open("MappedTextFile.txt"));
+        REQUIRE(file.getSize() == 0);
+        REQUIRE(file.getLineCount() == 1);
+        REQUIRE(file.getLine(0) == "");
+        REQUIRE(file.getText() == "");
+    }
+
+    SECTION("Trailing newline")
+    {
+        REQUIRE(tgui::writeFile("MappedTextFile.txt", "a\nb\n"));
+        REQUIRE(file.open("MappedTextFile.txt"));
+        file.indexLines(10);
+        REQUIRE(file.isFullyIndexed());
+        REQUIRE(file.getLineCount() == 3);
+        REQUIRE(file.getLine(1) == "b");
+        REQUIRE(file.getLine(2) == "");
+    }
+
+    SECTION("Carriage return without line feed")
+    {
+        REQUIRE(tgui::writeFile("MappedTextFile.txt", "a\rb\r\nc\r"));
+        REQUIRE(file.open("MappedTextFile.txt"));
+        REQUIRE(file.getLine(0) == "a\rb");
+        REQUIRE(file.getLine(1) == "c\r");
+        REQUIRE(file.getText() == "a\rb\nc\r");
+    }
+}
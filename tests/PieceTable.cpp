@@ -0,0 +1,165 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2023 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/PieceTable.hpp>
+
+TEST_CASE("[PieceTable]")
+{
+    tgui::PieceTable table;
+    REQUIRE(table.empty());
+    REQUIRE(table.length() == 0);
+    REQUIRE(table.getLineCount() == 1);
+    REQUIRE(table.getLineLength(0) == 0);
+    REQUIRE(table.getText() == "");
+
+    SECTION("Insert and erase")
+    {
+        table.setText("Hello world");
+        table.insert(5, ",");
+        table.insert(12, "!");
+        table.insert(0, ">> ");
+        REQUIRE(table.getText() == ">> Hello, world!");
+        REQUIRE(table.length() == 16);
+        REQUIRE(table.getCharacter(0) == U'>');
+        REQUIRE(table.getCharacter(8) == U',');
+        REQUIRE(table.getCharacter(15) == U'!');
+        REQUIRE(table.substr(3, 5) == "Hello");
+        REQUIRE(table.substr(10) == "world!");
+
+        table.erase(7, 2);
+        REQUIRE(table.getText() == ">> Hell world!");
+        table.erase(0, 3);
+        REQUIRE(table.getText() == "Hell world!");
+        table.erase(4);
+        REQUIRE(table.getText() == "Hell");
+        table.erase(0);
+        REQUIRE(table.empty());
+        REQUIRE(table.getPieceCount() == 0);
+
+        table.append("abc");
+        REQUIRE(table.getText() == "abc");
+    }
+
+    SECTION("Typing characters one by one")
+    {
+        table.setText("ab");
+        table.insert(1, "1");
+        table.insert(2, "2");
+        table.insert(3, "3");
+        REQUIRE(table.getText() == "a123b");
+        REQUIRE(table.getPieceCount() == 3);
+
+        for (char c = 'c'; c <= 'z'; ++c)
+            table.append(tgui::String(c));
+        REQUIRE(table.getPieceCount() == 4);
+        REQUIRE(table.getText() == "a123bcdefghijklmnopqrstuvwxyz");
+    }
+
+    SECTION("Lines")
+    {
+        table.setText("first\nsecond");
+        table.insert(12, "\n\nfourth\n");
+        table.insert(3, "\n");
+        REQUIRE(table.getText() == "fir\nst\nsecond\n\nfourth\n");
+        REQUIRE(table.getLineCount() == 6);
+
+        REQUIRE(table.getLineStart(0) == 0);
+        REQUIRE(table.getLineStart(1) == 4);
+        REQUIRE(table.getLineStart(2) == 7);
+        REQUIRE(table.getLineStart(3) == 14);
+        REQUIRE(table.getLineStart(4) == 15);
+        REQUIRE(table.getLineStart(5) == 22);
+
+        REQUIRE(table.getLineLength(0) == 3);
+        REQUIRE(table.getLineLength(2) == 6);
+        REQUIRE(table.getLineLength(3) == 0);
+        REQUIRE(table.getLineLength(5) == 0);
+
+        REQUIRE(table.getLineOfIndex(0) == 0);
+        REQUIRE(table.getLineOfIndex(3) == 0);
+        REQUIRE(table.getLineOfIndex(4) == 1);
+        REQUIRE(table.getLineOfIndex(13) == 2);
+        REQUIRE(table.getLineOfIndex(14) == 3);
+        REQUIRE(table.getLineOfIndex(22) == 5);
+
+        table.erase(6, 8);
+        REQUIRE(table.getText() == "fir\nst\nfourth\n");
+        REQUIRE(table.getLineCount() == 4);
+        REQUIRE(table.getLineStart(2) == 7);
+    }
+
+    SECTION("Random edits")
+    {
+        // Compare with a normal string after many edits, which splits the text in many pieces
+        tgui::String expected = "Lorem ipsum\ndolor sit amet";
+        table.setText(expected);
+
+        std::uint32_t random = 12345;
+        const auto nextRandom = [&random](std::size_t max) {
+            random = random * 1103515245 + 12345;
+            return static_cast<std::size_t>((random >> 8) % (max + 1));
+        };
+
+        for (unsigned int i = 0; i < 500; ++i)
+        {
+            const std::size_t index = nextRandom(expected.length());
+            if (nextRandom(2) == 0)
+            {
+                const std::size_t count = nextRandom(5);
+                expected.erase(index, count);
+                table.erase(index, count);
+            }
+            else
+            {
+                const tgui::String text = (nextRandom(3) == 0) ? "\n" : "xyz";
+                expected.insert(index, text);
+                table.insert(index, text);
+            }
+        }
+
+        REQUIRE(table.getText() == expected);
+        REQUIRE(table.length() == expected.length());
+
+        std::size_t lineStart = 0;
+        for (std::size_t line = 0; line < table.getLineCount(); ++line)
+        {
+            REQUIRE(table.getLineStart(line) == lineStart);
+            REQUIRE(table.getLineOfIndex(lineStart) == line);
+
+            const std::size_t newlinePos = expected.find(U'\n', lineStart);
+            const std::size_t lineEnd = (newlinePos != tgui::String::npos) ? newlinePos : expected.length();
+            REQUIRE(table.getLineLength(line) == lineEnd - lineStart);
+            lineStart = lineEnd + 1;
+        }
+        REQUIRE(lineStart == expected.length() + 1);
+
+        // Copies are independent of the original
+        tgui::PieceTable copy = table;
+        copy.insert(0, "copy");
+        REQUIRE(table.getText() == expected);
+        REQUIRE(copy.getText() == "copy" + expected);
+    }
+}
@@ -0,0 +1,419 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2023 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include "Tests.hpp"
+
+#if TGUI_HAS_RENDERER_BACKEND_SOFTWARE
+    #if TGUI_BUILD_AS_CXX_MODULE
+        import tgui.backend.renderer.software;
+    #else
+        #include <TGUI/Backend/Renderer/Software/BackendRendererSoftware.hpp>
+    #endif
+
+static tgui::Color getPixel(const tgui::BackendRenderTargetSoftware& target, unsigned int x, unsigned int y)
+{
+    const std::uint8_t* pixel = target.getPixels() + (y * target.getSize().x + x) * 4;
+    return {pixel[0], pixel[1], pixel[2], pixel[3]};
+}
+
+TEST_CASE("[SoftwareRenderer]")
+{
+    tgui::BackendRenderTargetSoftware target({40, 30});
+    REQUIRE(target.getSize() == tgui::Vector2u{40, 30});
+
+    target.setView({0, 0, 40, 30}, {0, 0, 40, 30}, {40, 30});
+    target.setClearColor(tgui::Color::Blue);
+    target.clearScreen();
+
+    SECTION("clearScreen")
+    {
+        REQUIRE(getPixel(target, 0, 0) == tgui::Color::Blue);
+        REQUIRE(getPixel(target, 39, 29) == tgui::Color::Blue);
+    }
+
+    SECTION("drawFilledRect")
+    {
+        tgui::RenderStates states;
+        states.transform.translate({10, 5});
+        target.drawFilledRect(states, {20, 10}, tgui::Color::Red);
+
+        REQUIRE(getPixel(target, 10, 5) == tgui::Color::Red);
+        REQUIRE(getPixel(target, 29, 14) == tgui::Color::Red);
+        REQUIRE(getPixel(target, 9, 5) == tgui::Color::Blue);
+        REQUIRE(getPixel(target, 10, 4) == tgui::Color::Blue);
+        REQUIRE(getPixel(target, 30, 14) == tgui::Color::Blue);
+        REQUIRE(getPixel(target, 29, 15) == tgui::Color::Blue);
+    }
+
+    SECTION("Blending")
+    {
+        target.drawFilledRect({}, {40, 30}, {255, 0, 0, 128});
+        REQUIRE(getPixel(target, 0, 0) == tgui::Color(128, 0, 127, 191));
+        REQUIRE(getPixel(target, 39, 29) == tgui::Color(128, 0, 127, 191));
+    }
+
+    SECTION("Clipping")
+    {
+        target.addClippingLayer({}, {{5, 5}, {10, 10}});
+        target.drawFilledRect({}, {40, 30}, tgui::Color::Red);
+        target.removeClippingLayer();
+
+        REQUIRE(getPixel(target, 5, 5) == tgui::Color::Red);
+        REQUIRE(getPixel(target, 14, 14) == tgui::Color::Red);
+        REQUIRE(getPixel(target, 4, 5) == tgui::Color::Blue);
+        REQUIRE(getPixel(target, 15, 14) == tgui::Color::Blue);
+
+        target.drawFilledRect({}, {40, 30}, tgui::Color::Green);
+        REQUIRE(getPixel(target, 0, 0) == tgui::Color::Green);
+    }
+
+    SECTION("Texture")
+    {
+        const std::uint8_t pixels[] = {
+            255, 0, 0, 255,    0, 255, 0, 255,
+            0, 0, 0, 0,        255, 255, 255, 255
+        };
+        auto texture = std::make_shared<tgui::BackendTextureSoftware>();
+        REQUIRE(texture->loadTextureOnly({2, 2}, pixels, false));
+
+        const tgui::Vertex::Color white{255, 255, 255, 255};
+        const std::array<tgui::Vertex, 4> vertices = {{
+            {{0, 0}, white, {0, 0}},
+            {{0, 4}, white, {0, 1}},
+            {{4, 0}, white, {1, 0}},
+            {{4, 4}, white, {1, 1}}
+        }};
+        const std::array<unsigned int, 6> indices = {{0, 1, 2, 2, 1, 3}};
+        target.drawVertexArray({}, vertices.data(), vertices.size(), indices.data(), indices.size(), texture);
+
+        REQUIRE(getPixel(target, 0, 0) == tgui::Color::Red);
+        REQUIRE(getPixel(target, 3, 1) == tgui::Color::Green);
+        REQUIRE(getPixel(target, 1, 3) == tgui::Color::Blue);
+        REQUIRE(getPixel(target, 3, 3) == tgui::Color::White);
+        REQUIRE(getPixel(target, 4, 0) == tgui::Color::Blue);
+    }
+
+    SECTION("Alpha texture")
+    {
+        const std::uint8_t alphaValues[] = {
+            255, 0,
+            0, 0
+        };
+        auto texture = std::make_shared<tgui::BackendTextureSoftware>();
+        REQUIRE(texture->loadAlphaTextureOnly({2, 2}, alphaValues, false));
+        REQUIRE(texture->isAlphaTexture());
+
+        const std::uint8_t newAlphaValues[] = {255};
+        REQUIRE(texture->updateTextureRegion({1, 1, 1, 1}, newAlphaValues));
+
+        const tgui::Vertex::Color red{255, 0, 0, 255};
+        const std::array<tgui::Vertex, 4> vertices = {{
+            {{0, 0}, red, {0, 0}},
+            {{0, 4}, red, {0, 1}},
+            {{4, 0}, red, {1, 0}},
+            {{4, 4}, red, {1, 1}}
+        }};
+        const std::array<unsigned int, 6> indices = {{0, 1, 2, 2, 1, 3}};
+        target.drawVertexArray({}, vertices.data(), vertices.size(), indices.data(), indices.size(), texture);
+
+        REQUIRE(getPixel(target, 0, 0) == tgui::Color::Red);
+        REQUIRE(getPixel(target, 3, 1) == tgui::Color::Blue);
+        REQUIRE(getPixel(target, 1, 3) == tgui::Color::Blue);
+        REQUIRE(getPixel(target, 3, 3) == tgui::Color::Red);
+
+        const std::uint8_t rgbaPixels[] = {255, 255, 255, 255};
+        REQUIRE(texture->loadTextureOnly({1, 1}, rgbaPixels, false));
+        REQUIRE(!texture->isAlphaTexture());
+    }
+}
+
+class PartialRedrawGui : public tgui::BackendGui
+{
+public:
+    PartialRedrawGui(std::shared_ptr<tgui::BackendRenderTargetSoftware> target)
+    {
+        m_backendRenderTarget = std::move(target);
+        m_framebufferSize = {40, 30};
+        updateContainerSize();
+    }
+
+    void mainLoop(tgui::Color) override
+    {
+    }
+};
+
+TEST_CASE("[PartialRedraw]")
+{
+    auto target = std::make_shared<tgui::BackendRenderTargetSoftware>(tgui::Vector2u{40, 30});
+    target->setClearColor(tgui::Color::Blue);
+
+    PartialRedrawGui gui(target);
+    REQUIRE(!gui.isPartialRedrawEnabled());
+    REQUIRE(gui.isRedrawRequired());
+
+    auto panel = tgui::Panel::create({10, 10});
+    panel->setPosition({10, 5});
+    panel->getRenderer()->setBorders(0);
+    panel->getRenderer()->setBackgroundColor(tgui::Color::Red);
+    gui.add(panel);
+
+    gui.setPartialRedrawEnabled(true);
+    REQUIRE(gui.isPartialRedrawEnabled());
+    REQUIRE(gui.isFullRedrawRequired());
+
+    target->clearScreen();
+    gui.draw();
+    REQUIRE(!gui.isRedrawRequired());
+    REQUIRE(getPixel(*target, 12, 8) == tgui::Color::Red);
+
+    // Mark the entire screen so that we can detect which pixels get redrawn
+    target->drawFilledRect({}, {40, 30}, tgui::Color::Green);
+
+    SECTION("Moving widget")
+    {
+        panel->setPosition({20, 5});
+        REQUIRE(gui.isRedrawRequired());
+        REQUIRE(!gui.isFullRedrawRequired());
+
+        gui.draw();
+        REQUIRE(!gui.isRedrawRequired());
+        REQUIRE(getPixel(*target, 12, 8) == tgui::Color::Blue);
+        REQUIRE(getPixel(*target, 22, 8) == tgui::Color::Red);
+        REQUIRE(getPixel(*target, 2, 25) == tgui::Color::Green);
+    }
+
+    SECTION("Invisible widget")
+    {
+        panel->setVisible(false);
+        gui.draw();
+        REQUIRE(getPixel(*target, 12, 8) == tgui::Color::Blue);
+        REQUIRE(getPixel(*target, 2, 25) == tgui::Color::Green);
+
+        // Changing an invisible widget doesn't require a redraw
+        panel->setPosition({20, 5});
+        REQUIRE(!gui.isRedrawRequired());
+    }
+
+    SECTION("Events only redraw widgets that change")
+    {
+        tgui::Event event;
+        event.type = tgui::Event::Type::MouseMoved;
+        event.mouseMove.x = 2;
+        event.mouseMove.y = 25;
+        gui.handleEvent(event);
+        REQUIRE(!gui.isRedrawRequired());
+
+        // The panel is redrawn when the mouse enters it
+        event.mouseMove.x = 12;
+        event.mouseMove.y = 8;
+        gui.handleEvent(event);
+        REQUIRE(gui.isRedrawRequired());
+        REQUIRE(!gui.isFullRedrawRequired());
+
+        gui.draw();
+        REQUIRE(getPixel(*target, 2, 25) == tgui::Color::Green);
+        REQUIRE(getPixel(*target, 12, 8) == tgui::Color::Red);
+    }
+
+    SECTION("Changing widget contents")
+    {
+        auto rangeSlider = tgui::RangeSlider::create(0, 10);
+        rangeSlider->setPosition({5, 20});
+        rangeSlider->setSize({20, 4});
+        gui.add(rangeSlider);
+
+        auto editBox = tgui::EditBox::create();
+        editBox->setPosition({25, 20});
+        editBox->setSize({10, 8});
+        gui.add(editBox);
+
+        auto childWindow = tgui::ChildWindow::create();
+        childWindow->setPosition({0, 0});
+        childWindow->setSize({10, 10});
+        gui.add(childWindow);
+
+        gui.draw();
+        REQUIRE(!gui.isRedrawRequired());
+
+        rangeSlider->setSelectionStart(2);
+        REQUIRE(gui.isRedrawRequired());
+        gui.draw();
+        REQUIRE(!gui.isRedrawRequired());
+
+        editBox->setDefaultText("Default");
+        REQUIRE(gui.isRedrawRequired());
+        gui.draw();
+        REQUIRE(!gui.isRedrawRequired());
+
+        childWindow->setTitle("Title");
+        REQUIRE(gui.isRedrawRequired());
+        REQUIRE(!gui.isFullRedrawRequired());
+    }
+
+    SECTION("Disabling partial redraw")
+    {
+        gui.setPartialRedrawEnabled(false);
+        REQUIRE(gui.isRedrawRequired());
+        REQUIRE(gui.isFullRedrawRequired());
+    }
+}
+
+TEST_CASE("[RenderCache]")
+{
+    auto target = std::make_shared<tgui::BackendRenderTargetSoftware>(tgui::Vector2u{40, 30});
+    target->setClearColor(tgui::Color::Blue);
+
+    PartialRedrawGui gui(target);
+
+    auto panel = tgui::Panel::create({20, 20});
+    panel->setPosition({5, 5});
+    panel->getRenderer()->setBorders(0);
+    panel->getRenderer()->setBackgroundColor(tgui::Color::Transparent);
+    gui.add(panel);
+
+    auto child = tgui::Panel::create({10, 10});
+    child->setPosition({2, 2});
+    child->getRenderer()->setBorders(0);
+    child->getRenderer()->setBackgroundColor({255, 0, 0, 128});
+    panel->add(child);
+
+    // Draw once without caching to know what the result should look like
+    target->clearScreen();
+    gui.draw();
+    const tgui::Color expectedColor = getPixel(*target, 10, 10);
+    REQUIRE(getPixel(*target, 20, 20) == tgui::Color::Blue);
+
+    REQUIRE(!panel->isRenderCacheEnabled());
+    panel->setRenderCacheEnabled(true);
+    REQUIRE(panel->isRenderCacheEnabled());
+    REQUIRE(panel->getRenderCacheHits() == 0);
+    REQUIRE(panel->getRenderCacheMisses() == 0);
+
+    // Only the color channels are compared, the alpha channel of the screen is blended differently when drawing the cache
+    const auto requireSimilarColor = [](tgui::Color color, tgui::Color expected)
+    {
+        REQUIRE(std::abs(static_cast<int>(color.getRed()) - static_cast<int>(expected.getRed())) <= 1);
+        REQUIRE(std::abs(static_cast<int>(color.getGreen()) - static_cast<int>(expected.getGreen())) <= 1);
+        REQUIRE(std::abs(static_cast<int>(color.getBlue()) - static_cast<int>(expected.getBlue())) <= 1);
+    };
+
+    target->clearScreen();
+    gui.draw();
+    REQUIRE(panel->getRenderCacheMisses() == 1);
+    REQUIRE(panel->getRenderCacheHits() == 0);
+    requireSimilarColor(getPixel(*target, 10, 10), expectedColor);
+    REQUIRE(getPixel(*target, 20, 20) == tgui::Color::Blue);
+
+    target->clearScreen();
+    gui.draw();
+    REQUIRE(panel->getRenderCacheMisses() == 1);
+    REQUIRE(panel->getRenderCacheHits() == 1);
+    requireSimilarColor(getPixel(*target, 10, 10), expectedColor);
+
+    SECTION("Moving the container")
+    {
+        panel->setPosition({15, 5});
+        target->clearScreen();
+        gui.draw();
+        REQUIRE(panel->getRenderCacheMisses() == 1);
+        REQUIRE(panel->getRenderCacheHits() == 2);
+        requireSimilarColor(getPixel(*target, 20, 10), expectedColor);
+        REQUIRE(getPixel(*target, 10, 10) == tgui::Color::Blue);
+    }
+
+    SECTION("Changing a child")
+    {
+        child->setPosition({12, 12});
+        target->clearScreen();
+        gui.draw();
+        REQUIRE(panel->getRenderCacheMisses() == 2);
+        REQUIRE(panel->getRenderCacheHits() == 1);
+        REQUIRE(getPixel(*target, 10, 10) == tgui::Color::Blue);
+        requireSimilarColor(getPixel(*target, 20, 20), expectedColor);
+    }
+
+    SECTION("Changing the container")
+    {
+        panel->getRenderer()->setBackgroundColor(tgui::Color::Green);
+        target->clearScreen();
+        gui.draw();
+        REQUIRE(panel->getRenderCacheMisses() == 2);
+        REQUIRE(getPixel(*target, 20, 20) == tgui::Color::Green);
+    }
+
+    SECTION("Changing the contents of a child")
+    {
+        auto listBox = tgui::ListBox::create();
+        listBox->setSize({15, 15});
+        panel->add(listBox);
+        target->clearScreen();
+        gui.draw();
+        target->clearScreen();
+        gui.draw();
+        REQUIRE(panel->getRenderCacheMisses() == 2);
+        REQUIRE(panel->getRenderCacheHits() == 2);
+
+        listBox->addItem("Item");
+        target->clearScreen();
+        gui.draw();
+        REQUIRE(panel->getRenderCacheMisses() == 3);
+
+        listBox->setSelectedItemByIndex(0);
+        target->clearScreen();
+        gui.draw();
+        REQUIRE(panel->getRenderCacheMisses() == 4);
+    }
+
+    SECTION("Timer callback")
+    {
+        // A timer that doesn't change any widget keeps the cache
+        tgui::Timer::scheduleCallback([]{}, std::chrono::milliseconds(10));
+        gui.updateTime(std::chrono::milliseconds(20));
+        target->clearScreen();
+        gui.draw();
+        REQUIRE(panel->getRenderCacheMisses() == 1);
+        REQUIRE(panel->getRenderCacheHits() == 2);
+
+        tgui::Timer::scheduleCallback([&]{ child->getRenderer()->setBackgroundColor(tgui::Color::Green); }, std::chrono::milliseconds(10));
+        gui.updateTime(std::chrono::milliseconds(20));
+        target->clearScreen();
+        gui.draw();
+        REQUIRE(panel->getRenderCacheMisses() == 2);
+        REQUIRE(panel->getRenderCacheHits() == 2);
+        REQUIRE(getPixel(*target, 10, 10) == tgui::Color::Green);
+    }
+
+    SECTION("Disabling the cache")
+    {
+        panel->setRenderCacheEnabled(false);
+        target->clearScreen();
+        gui.draw();
+        REQUIRE(panel->getRenderCacheMisses() == 1);
+        REQUIRE(panel->getRenderCacheHits() == 1);
+        REQUIRE(getPixel(*target, 10, 10) == expectedColor);
+    }
+}
+#endif
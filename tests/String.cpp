@@ -172,6 +172,38 @@ TEST_CASE("[String]")
 #endif
     }
 
+    SECTION("Conversions of long strings")
+    {
+        // Long strings are converted in chunks, mix ASCII with multi-byte characters and surrogate pairs at different positions
+        const std::u32string pieces[] = {U"abcdefghijklmnopqrstuvwxyz0123456789", U"\u00E9", U"\u20AC", U"\U00010348", U"\u4E2D\u6587"};
+        std::u32string strUtf32;
+        for (unsigned int i = 0; i < 200; ++i)
+            strUtf32 += pieces[0].substr(0, i % 37) + pieces[1 + (i % 4)];
+
+        const std::string strUtf8 = tgui::utf::convertUtf32toStdStringUtf8(strUtf32);
+        const std::u16string strUtf16 = tgui::utf::convertUtf32toUtf16(strUtf32);
+        REQUIRE(tgui::utf::convertUtf8toUtf32(strUtf8.data(), strUtf8.data() + strUtf8.length()) == strUtf32);
+        REQUIRE(tgui::utf::convertUtf16toUtf32(strUtf16.data(), strUtf16.data() + strUtf16.length()) == strUtf32);
+
+        // The results are identical to the ones of the character by character conversion
+        std::string expectedUtf8;
+        for (const char32_t c : strUtf32)
+            tgui::utf::encodeCharUtf8(c, expectedUtf8);
+        REQUIRE(strUtf8 == expectedUtf8);
+        REQUIRE(tgui::utf::convertUtf16toUtf32(strUtf16.begin(), strUtf16.end()) == strUtf32);
+
+        REQUIRE(tgui::String(strUtf8) == strUtf32);
+        REQUIRE(tgui::String(strUtf16) == strUtf32);
+        REQUIRE(tgui::String(strUtf32).toStdString() == strUtf8);
+        REQUIRE(tgui::String(strUtf32).toUtf16() == strUtf16);
+
+        // Invalid characters are skipped
+        const std::u16string invalidUtf16 = u"abcdefgh\xD800" + std::u16string(20, u'x') + u"\xD800";
+        REQUIRE(tgui::utf::convertUtf16toUtf32(invalidUtf16.data(), invalidUtf16.data() + invalidUtf16.length())
+                == tgui::utf::convertUtf16toUtf32(invalidUtf16.begin(), invalidUtf16.end()));
+        REQUIRE(tgui::utf::convertUtf32toUtf16(U"abcdefgh" + std::u32string(1, char32_t(0x110000)) + U"ijklmnopqrstuvwxyz") == u"abcdefghijklmnopqrstuvwxyz");
+    }
+
     SECTION("assign")
     {
         REQUIRE(str.assign("xyz") == "xyz");
@@ -29,6 +29,52 @@
 
 #include "Tests.hpp"
 
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// The global operator new is replaced in order to count allocations. The array versions call this function by default.
+// Allocations are only counted while an AllocationCounter exists, other tests only pay for checking the flag.
+static std::atomic<bool> countingAllocations{false};
+static std::atomic<std::size_t> allocationCount{0};
+
+void* operator new(std::size_t size)
+{
+    if (countingAllocations.load(std::memory_order_relaxed))
+        ++allocationCount;
+    if (void* ptr = std::malloc(size > 0 ? size : 1))
+        return ptr;
+
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+AllocationCounter::AllocationCounter()
+{
+    REQUIRE(!countingAllocations);
+    allocationCount = 0;
+    countingAllocations = true;
+}
+
+AllocationCounter::~AllocationCounter()
+{
+    countingAllocations = false;
+}
+
+std::size_t AllocationCounter::getCount() const
+{
+    return allocationCount;
+}
+
 tgui::String getClipboardContents()
 {
 #ifdef TGUI_SYSTEM_WINDOWS
@@ -140,6 +140,21 @@ void testClickableWidgetSignals(const tgui::Panel::Ptr& widget);
 
 void testWidgetRenderer(tgui::WidgetRenderer* renderer);
 
+// Counts the calls to the global operator new while the object exists. Only one counter can exist at a time.
+// On Windows, code inside the TGUI dll uses the operator new of the dll. When TGUI is built as a shared library, allocations
+// made inside the library are thus not counted there, only those made by inline functions from the headers.
+class AllocationCounter
+{
+public:
+    AllocationCounter();
+    ~AllocationCounter();
+
+    AllocationCounter(const AllocationCounter&) = delete;
+    AllocationCounter& operator=(const AllocationCounter&) = delete;
+
+    std::size_t getCount() const;
+};
+
 template <typename WidgetType>
 void testSavingWidget(const tgui::String& name, std::shared_ptr<WidgetType> widget, bool loadFromTheme = true)
 {
@@ -139,3 +139,106 @@ TEST_CASE("[Text]")
         }
     }
 }
+
+#if TGUI_HAS_RENDERER_BACKEND_SOFTWARE
+    #if TGUI_BUILD_AS_CXX_MODULE
+        import tgui.backend.renderer.software;
+    #else
+        #include <TGUI/Backend/Renderer/Software/BackendRendererSoftware.hpp>
+    #endif
+
+// The font textures are created by the renderer of the backend that runs the tests, so they can't be drawn by the software
+// render target. This render target only counts the vertices that are passed to it.
+class VertexCountingRenderTarget : public tgui::BackendRenderTargetSoftware
+{
+public:
+    VertexCountingRenderTarget() :
+        tgui::BackendRenderTargetSoftware({100, 100})
+    {
+    }
+
+    void drawVertexArray(const tgui::RenderStates&, const tgui::Vertex*, std::size_t vertexCount,
+                         const unsigned int*, std::size_t, const std::shared_ptr<tgui::BackendTexture>& texture) override
+    {
+        REQUIRE(texture != nullptr);
+        drawnVertexCount += vertexCount;
+    }
+
+    std::size_t drawnVertexCount = 0;
+};
+
+TEST_CASE("[Text drawing]")
+{
+    VertexCountingRenderTarget target;
+
+    const tgui::Font font{"resources/DejaVuSans.ttf"};
+    std::vector<tgui::Text> texts(50);
+    for (std::size_t i = 0; i < texts.size(); ++i)
+    {
+        texts[i].setFont(font);
+        texts[i].setCharacterSize(16);
+        texts[i].setString("Label " + tgui::String(i));
+    }
+    texts[0].setOutlineThickness(1);
+
+    // The first frame creates the vertices and loads the glyphs
+    for (const auto& text : texts)
+        target.drawText({}, text);
+    const std::size_t vertexCount = target.drawnVertexCount;
+    REQUIRE(vertexCount > 0);
+
+    SECTION("Drawing doesn't allocate")
+    {
+        const AllocationCounter allocations;
+        for (unsigned int frame = 0; frame < 10; ++frame)
+        {
+            for (const auto& text : texts)
+                target.drawText({}, text);
+        }
+        REQUIRE(allocations.getCount() == 0);
+        REQUIRE(target.drawnVertexCount == 11 * vertexCount);
+    }
+
+    SECTION("Changing the color doesn't allocate")
+    {
+        const AllocationCounter allocations;
+        for (auto& text : texts)
+        {
+            text.setColor(tgui::Color::Red);
+            text.setOutlineColor(tgui::Color::Blue);
+            target.drawText({}, text);
+        }
+        REQUIRE(allocations.getCount() == 0);
+    }
+
+    SECTION("Vertices are reused when the string changes")
+    {
+        // Each string is replaced by a shorter one that only contains glyphs that were already loaded.
+        // The layout of the string is calculated in advance, so that it is found in the glyph run cache.
+        const tgui::String newString = "Label";
+        (void)tgui::Text::getLineWidth(newString, font, 16);
+        const AllocationCounter allocations;
+        for (auto& text : texts)
+        {
+            text.setString(newString);
+            target.drawText({}, text);
+        }
+        REQUIRE(allocations.getCount() == 0);
+    }
+
+    SECTION("Deprecated getVertexData reuses its memory")
+    {
+        auto backendText = texts[0].getBackendText();
+TGUI_IGNORE_DEPRECATED_WARNINGS_START
+        (void)backendText->getVertexData();
+
+        const AllocationCounter allocations;
+        const auto& vertexData = backendText->getVertexData();
+TGUI_IGNORE_DEPRECATED_WARNINGS_END
+        REQUIRE(allocations.getCount() == 0);
+        REQUIRE(vertexData.size() == 2);
+        REQUIRE(vertexData[0].second->size() == backendText->getOutlineVertices().size());
+        REQUIRE(vertexData[1].second->size() == backendText->getVertices().size());
+    }
+}
+#endif
@@ -460,6 +460,61 @@ TEST_CASE("[Widget]")
             REQUIRE(clonedRenderer->propertyValuePairs["Font"].getFont().getId() == "resources/DejaVuSans.ttf");
         }
 
+        SECTION("Layer on shared renderer")
+        {
+            auto sharedData = tgui::RendererData::create({{"BackgroundColor", tgui::Color::Red}, {"TextColor", tgui::Color::Green}});
+            auto button1 = tgui::Button::create();
+            auto button2 = tgui::Button::create();
+            button1->setRenderer(sharedData);
+            button2->setRenderer(sharedData);
+
+            // Changing the renderer of one widget only stores the changed property
+            button1->getRenderer()->setTextColor(tgui::Color::Blue);
+            auto layer = button1->getSharedRenderer()->getData();
+            REQUIRE(layer != sharedData);
+            REQUIRE(layer->base == sharedData);
+            REQUIRE(layer->propertyValuePairs.size() == 1);
+            REQUIRE(button1->getSharedRenderer()->getBackgroundColor() == tgui::Color::Red);
+            REQUIRE(button1->getSharedRenderer()->getTextColor() == tgui::Color::Blue);
+            REQUIRE(button2->getSharedRenderer()->getTextColor() == tgui::Color::Green);
+            REQUIRE(button1->getSharedRenderer()->getMergedPropertyValuePairs()["TextColor"].getColor() == tgui::Color::Blue);
+            REQUIRE(button1->getSharedRenderer()->getMergedPropertyValuePairs()["BackgroundColor"].getColor() == tgui::Color::Red);
+            REQUIRE(layer->propertyValuePairs.size() == 1);
+
+            // Setting the value that is already used doesn't add it to the layer
+            button1->getRenderer()->setBackgroundColor(tgui::Color::Red);
+            REQUIRE(layer->propertyValuePairs.size() == 1);
+
+            // Changing the shared renderer doesn't affect the widget with its own renderer
+            button2->getSharedRenderer()->setBackgroundColor(tgui::Color::Yellow);
+            REQUIRE(button2->getSharedRenderer()->getBackgroundColor() == tgui::Color::Yellow);
+            REQUIRE(button1->getSharedRenderer()->getBackgroundColor() == tgui::Color::Red);
+            REQUIRE(layer->base != sharedData);
+            REQUIRE(sharedData->layers.empty());
+
+            // A clone contains all properties
+            auto clonedData = button1->getSharedRenderer()->clone();
+            REQUIRE(clonedData->base == nullptr);
+            REQUIRE(clonedData->propertyValuePairs["BackgroundColor"].getColor() == tgui::Color::Red);
+            REQUIRE(clonedData->propertyValuePairs["TextColor"].getColor() == tgui::Color::Blue);
+
+            // Reading a texture that isn't set stores an empty texture, which layers on top of the data don't see
+            auto button3 = tgui::Button::create();
+            button3->setRenderer(button2->getSharedRenderer()->getData());
+            button3->getRenderer()->setTextColor(tgui::Color::Black);
+            auto layer3 = button3->getSharedRenderer()->getData();
+            REQUIRE(layer3->base == button2->getSharedRenderer()->getData());
+            (void)button2->getSharedRenderer()->getTexture();
+            REQUIRE(layer3->findProperty(tgui::Property::Texture) == nullptr);
+
+            // The base is merged into the layer when a reference to all its properties is requested
+            const auto& pairs = button1->getSharedRenderer()->getPropertyValuePairs();
+            REQUIRE(&pairs == &layer->propertyValuePairs);
+            REQUIRE(layer->base == nullptr);
+            REQUIRE(pairs.size() == 2);
+            REQUIRE(button1->getSharedRenderer()->getBackgroundColor() == tgui::Color::Red);
+        }
+
         // TODO: Other tests with the renderer class (e.g. sharing and copying a renderer when using multiple widgets)
     }
 
@@ -130,6 +130,15 @@ TEST_CASE("[Label]")
         REQUIRE(label->getScrollbarPolicy() == tgui::Scrollbar::Policy::Never);
         label->setScrollbarPolicy(tgui::Scrollbar::Policy::Automatic);
         REQUIRE(label->getScrollbarPolicy() == tgui::Scrollbar::Policy::Automatic);
+
+        // The scrollbar disappears again when the text becomes short enough
+        label->setSize(80, 30);
+        label->setText("This text is too long to fit inside the label without a scrollbar");
+        label->setScrollbarValue(1000);
+        REQUIRE(label->getScrollbarValue() > 0);
+        label->setText("Some text");
+        label->setScrollbarValue(1000);
+        REQUIRE(label->getScrollbarValue() == 0);
     }
 
     SECTION("IgnoreMouseEvents")
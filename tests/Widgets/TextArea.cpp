@@ -89,6 +89,43 @@ TEST_CASE("[TextArea]")
         REQUIRE(textArea->getText() == U"A\nB\n\n\nCD");
     }
 
+    SECTION("File")
+    {
+        REQUIRE(!textArea->isFileOpen());
+        REQUIRE_THROWS_AS(textArea->openFile("NonExistentFile.txt"), tgui::Exception);
+
+        std::string contents;
+        for (unsigned int i = 0; i < 1000; ++i)
+            contents += "Line " + std::to_string(i) + "\n";
+        REQUIRE(tgui::writeFile("TextAreaFile.txt", contents));
+
+        textArea->setText("Hello");
+        textArea->openFile("TextAreaFile.txt");
+        REQUIRE(textArea->isFileOpen());
+        REQUIRE(textArea->getText() == contents);
+        REQUIRE(textArea->getLinesCount() > 1);
+
+        // The file can't be edited
+        textArea->textEntered('x');
+        textArea->addText("x");
+        REQUIRE(textArea->getText() == contents);
+
+        // Scrolling to the end requires the lines of the entire file to be known
+        textArea->setFocused(true);
+        textArea->keyPressed(createKeyEvent(tgui::Event::KeyboardKey::End, true, false));
+        REQUIRE(textArea->getLinesCount() == 1001);
+        REQUIRE(textArea->getVerticalScrollbarValue() > 0);
+
+        textArea->setText("Hello");
+        REQUIRE(!textArea->isFileOpen());
+        REQUIRE(textArea->getText() == "Hello");
+
+        textArea->openFile("TextAreaFile.txt");
+        textArea->closeFile();
+        REQUIRE(!textArea->isFileOpen());
+        REQUIRE(textArea->getText() == "");
+    }
+
     SECTION("DefaultText")
     {
         REQUIRE(textArea->getDefaultText() == "");
@@ -233,6 +270,20 @@ TEST_CASE("[TextArea]")
 
         textArea->setText("More\nthan\none\nline");
         REQUIRE(textArea->getLinesCount() == 4);
+
+        // Only the visible lines are placed in texts, but the entire text should still be editable
+        tgui::String text;
+        for (unsigned int i = 0; i < 1000; ++i)
+            text += "Line " + tgui::String(i) + "\n";
+        textArea->setText(text);
+        REQUIRE(textArea->getLinesCount() == 1001);
+
+        textArea->setCaretPosition(7);
+        textArea->textEntered('x');
+        textArea->setCaretPosition(text.length() + 1);
+        textArea->textEntered('y');
+        REQUIRE(textArea->getText() == "Line 0\nxLine 1\n" + text.substr(14) + "y");
+        REQUIRE(textArea->getCaretPosition() == text.length() + 2);
     }
 
     SECTION("Events / Signals")
@@ -0,0 +1,178 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2023 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+
+TEST_CASE("[WordWrapper]")
+{
+    tgui::Font font("resources/DejaVuSans.ttf");
+    tgui::String text = "The quick brown fox jumps over the lazy dog\n\nLorem ipsum dolor sit amet\nconsectetur adipiscing elit, sed do eiusmod";
+
+    tgui::WordWrapper emptyWrapper;
+    REQUIRE(emptyWrapper.getLines().size() == 1);
+    REQUIRE(emptyWrapper.getLines()[0].empty());
+    REQUIRE(emptyWrapper.getTextLength() == 0);
+
+    tgui::WordWrapper wrapper;
+    wrapper.setWrapping(100, font, 16, false);
+    wrapper.setText(text);
+    REQUIRE(wrapper.getText() == text);
+    REQUIRE(wrapper.getTextLength() == text.length());
+    REQUIRE(wrapper.getWrappedText() == tgui::Text::wordWrap(100, text, font, 16, false));
+    REQUIRE(wrapper.getLines().size() > 4);
+    REQUIRE(wrapper.getWrappedParagraphCount() == 4);
+
+    SECTION("Inserting text")
+    {
+        wrapper.insertText(10, "and very ");
+        text.insert(10, "and very ");
+        REQUIRE(wrapper.getWrappedText() == tgui::Text::wordWrap(100, text, font, 16, false));
+        REQUIRE(wrapper.getWrappedParagraphCount() == 5);
+
+        // Inserting newlines splits a paragraph
+        wrapper.insertText(text.length() - 3, "\nA\nB");
+        text.insert(text.length() - 3, "\nA\nB");
+        REQUIRE(wrapper.getText() == text);
+        REQUIRE(wrapper.getWrappedText() == tgui::Text::wordWrap(100, text, font, 16, false));
+        REQUIRE(wrapper.getWrappedParagraphCount() == 8);
+
+        // Text can be inserted in an empty paragraph
+        wrapper.insertText(text.find(U'\n') + 1, "x");
+        text.insert(text.find(U'\n') + 1, "x");
+        REQUIRE(wrapper.getWrappedText() == tgui::Text::wordWrap(100, text, font, 16, false));
+        REQUIRE(wrapper.getWrappedParagraphCount() == 9);
+    }
+
+    SECTION("Erasing text")
+    {
+        wrapper.eraseText(4, 6);
+        text.erase(4, 6);
+        REQUIRE(wrapper.getWrappedText() == tgui::Text::wordWrap(100, text, font, 16, false));
+        REQUIRE(wrapper.getWrappedParagraphCount() == 5);
+
+        // Erasing newlines merges paragraphs
+        const std::size_t index = text.find(U'\n') - 3;
+        wrapper.eraseText(index, 10);
+        text.erase(index, 10);
+        REQUIRE(wrapper.getText() == text);
+        REQUIRE(wrapper.getWrappedText() == tgui::Text::wordWrap(100, text, font, 16, false));
+        REQUIRE(wrapper.getWrappedParagraphCount() == 6);
+
+        wrapper.eraseText(text.length() - 5);
+        text.erase(text.length() - 5);
+        REQUIRE(wrapper.getWrappedText() == tgui::Text::wordWrap(100, text, font, 16, false));
+
+        wrapper.eraseText(0);
+        REQUIRE(wrapper.getTextLength() == 0);
+        REQUIRE(wrapper.getLines().size() == 1);
+        REQUIRE(wrapper.getLines()[0].empty());
+    }
+
+    SECTION("Appending text")
+    {
+        wrapper.appendText(" tempor\nincididunt ut labore et dolore magna aliqua");
+        text += " tempor\nincididunt ut labore et dolore magna aliqua";
+        REQUIRE(wrapper.getWrappedText() == tgui::Text::wordWrap(100, text, font, 16, false));
+        REQUIRE(wrapper.getWrappedParagraphCount() == 6);
+
+        // Setting a text that only differs at the end has the same effect
+        text += " ut enim";
+        wrapper.setText(text);
+        REQUIRE(wrapper.getWrappedText() == tgui::Text::wordWrap(100, text, font, 16, false));
+        REQUIRE(wrapper.getWrappedParagraphCount() == 7);
+
+        // Setting the same text doesn't require anything to be wrapped
+        wrapper.setText(text);
+        REQUIRE(wrapper.getWrappedText() == tgui::Text::wordWrap(100, text, font, 16, false));
+        REQUIRE(wrapper.getWrappedParagraphCount() == 7);
+    }
+
+    SECTION("Looking up lines")
+    {
+        wrapper.insertText(20, "\nextra words in a new paragraph that is wrapped");
+        text.insert(20, "\nextra words in a new paragraph that is wrapped");
+
+        const std::vector<tgui::String> lines = wrapper.getLines();
+        REQUIRE(wrapper.getLineCount() == lines.size());
+
+        std::size_t index = 0;
+        for (std::size_t i = 0; i < lines.size(); ++i)
+        {
+            REQUIRE(wrapper.getLine(i) == lines[i]);
+            REQUIRE(wrapper.getLineLength(i) == lines[i].length());
+            REQUIRE(wrapper.getLineStartIndex(i) == index);
+
+            // A position at the end of a line is preferred over the same position at the start of the next line
+            REQUIRE(wrapper.getPositionOfIndex(index + lines[i].length()) == tgui::Vector2<std::size_t>{lines[i].length(), i});
+            if (!lines[i].empty())
+                REQUIRE(wrapper.getPositionOfIndex(index + 1) == tgui::Vector2<std::size_t>{1, i});
+
+            index += lines[i].length();
+            if ((index < text.length()) && (text[index] == U'\n'))
+                ++index;
+        }
+
+        REQUIRE(index == text.length());
+        REQUIRE(wrapper.getSubstring(4, 5) == "quick");
+    }
+
+    SECTION("Changing the wrapping")
+    {
+        wrapper.setWrapping(100, font, 16, false);
+        REQUIRE(wrapper.getLines().size() > 4);
+        REQUIRE(wrapper.getWrappedParagraphCount() == 4);
+
+        wrapper.setWrapping(150, font, 16, true);
+        REQUIRE(wrapper.getWrappedText() == tgui::Text::wordWrap(150, text, font, 16, true));
+        REQUIRE(wrapper.getWrappedParagraphCount() == 8);
+
+        // Without maximum width, the text is only split at newlines
+        wrapper.setWrapping(0, font, 16, false);
+        REQUIRE(wrapper.getLines().size() == 4);
+        REQUIRE(wrapper.getWrappedText() == text);
+    }
+    SECTION("Maximum line width")
+    {
+        const auto calculateMaximumLineWidth = [&]{
+            float maxLineWidth = 0;
+            for (const auto& line : wrapper.getLines())
+                maxLineWidth = std::max(maxLineWidth, tgui::Text::getLineWidth(line, font, 16));
+            return maxLineWidth;
+        };
+
+        REQUIRE(wrapper.getMaximumLineWidth() == calculateMaximumLineWidth());
+        REQUIRE(wrapper.getMaximumLineWidth() <= 100);
+
+        wrapper.setWrapping(0, font, 16, false);
+        REQUIRE(wrapper.getMaximumLineWidth() == calculateMaximumLineWidth());
+        REQUIRE(wrapper.getMaximumLineWidth() > 100);
+
+        // Only the edited paragraphs are measured again
+        wrapper.insertText(text.find(U'\n') + 1, "A much longer line than all the other lines in the text");
+        REQUIRE(wrapper.getMaximumLineWidth() == calculateMaximumLineWidth());
+        wrapper.eraseText(text.find(U'\n') + 1, 30);
+        REQUIRE(wrapper.getMaximumLineWidth() == calculateMaximumLineWidth());
+    }
+}